@@ -0,0 +1,95 @@
+/*********************                                                        */
+/*! \file bench-assumptions.cpp
+** \verbatim
+** Top contributors (to current version):
+**   agent
+** This file is part of the smt-switch project.
+** Copyright (c) 2026 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved.  See the file LICENSE in the top-level source
+** directory for licensing information.\endverbatim
+**
+** \brief Measures incremental queries under many assumptions.
+**
+** Usage: bench-assumptions [assumptions] [queries]
+**
+** Guards one easy constraint per boolean indicator and repeatedly checks
+** under all indicators, passing them:
+**   copy - as a set copied into a TermVec by the caller
+**   set  - as a set, with check_sat_assuming_set
+**   list - as a list, with check_sat_assuming_list
+**/
+
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+
+#include "available_solvers.h"
+#include "smt.h"
+
+using namespace smt;
+using namespace smt_tests;
+using namespace std;
+
+int main(int argc, char ** argv)
+{
+  size_t num_assumps = argc > 1 ? strtoul(argv[1], nullptr, 10) : 2000;
+  size_t num_queries = argc > 2 ? strtoul(argv[2], nullptr, 10) : 200;
+
+  cout << left << setw(12) << "solver" << setw(12) << "method" << right
+       << setw(12) << "seconds" << endl;
+  for (auto sc : filter_non_generic_solver_configurations({ THEORY_BV }))
+  {
+    if (sc.is_logging_solver)
+    {
+      continue;
+    }
+    SmtSolver s = create_solver(sc);
+    s->set_opt("incremental", "true");
+    s->set_opt("produce-unsat-assumptions", "true");
+    Sort boolsort = s->make_sort(BOOL);
+    Sort bvsort = s->make_sort(BV, 8);
+    Term x = s->make_symbol("x", bvsort);
+
+    UnorderedTermSet assump_set;
+    TermList assump_list;
+    for (size_t i = 0; i < num_assumps; ++i)
+    {
+      Term ind = s->make_symbol("ind" + to_string(i), boolsort);
+      s->assert_formula(s->make_term(
+          Implies,
+          ind,
+          s->make_term(BVUge, x, s->make_term(i % 256, bvsort))));
+      assump_set.insert(ind);
+      assump_list.push_back(ind);
+    }
+
+    auto run = [&](const string & method, function<Result()> query) {
+      auto start = chrono::steady_clock::now();
+      for (size_t i = 0; i < num_queries; ++i)
+      {
+        if (!query().is_sat())
+        {
+          cerr << "expected sat for " << sc.solver_enum << endl;
+          exit(1);
+        }
+      }
+      double secs =
+          chrono::duration<double>(chrono::steady_clock::now() - start)
+              .count();
+      cout << left << setw(12) << to_string(sc.solver_enum) << setw(12)
+           << method << right << fixed << setprecision(3) << setw(12) << secs
+           << endl;
+    };
+
+    run("copy", [&]() {
+      return s->check_sat_assuming(
+          TermVec(assump_set.begin(), assump_set.end()));
+    });
+    run("set", [&]() { return s->check_sat_assuming_set(assump_set); });
+    run("list", [&]() { return s->check_sat_assuming_list(assump_list); });
+  }
+  return 0;
+}
@@ -0,0 +1,112 @@
+/*********************                                                        */
+/*! \file bench-bv-values.cpp
+** \verbatim
+** Top contributors (to current version):
+**   agent
+** This file is part of the smt-switch project.
+** Copyright (c) 2026 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved.  See the file LICENSE in the top-level source
+** directory for licensing information.\endverbatim
+**
+** \brief Measures model extraction throughput for wide bit-vectors.
+**
+** Usage: bench-bv-values [width] [symbols] [rounds]
+**
+** Compares three ways of reading the same satisfying assignment:
+**   string       - get_value, then parse the printed value
+**   to_bv_words  - get_value, then AbsTerm::to_bv_words
+**   get_bv_value - AbsSmtSolver::get_bv_value, without a value term
+**/
+
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <random>
+
+#include "available_solvers.h"
+#include "smt.h"
+#include "utils.h"
+
+using namespace smt;
+using namespace smt_tests;
+using namespace std;
+
+int main(int argc, char ** argv)
+{
+  uint64_t width = argc > 1 ? strtoul(argv[1], nullptr, 10) : 512;
+  size_t num_symbols = argc > 2 ? strtoul(argv[2], nullptr, 10) : 1000;
+  size_t rounds = argc > 3 ? strtoul(argv[3], nullptr, 10) : 10;
+
+  cout << left << setw(12) << "solver" << setw(16) << "method" << right
+       << setw(14) << "values/s" << setw(12) << "MB/s" << endl;
+  for (auto sc : filter_non_generic_solver_configurations({ THEORY_BV }))
+  {
+    if (sc.is_logging_solver)
+    {
+      continue;
+    }
+    SmtSolver s = create_solver(sc);
+    s->set_opt("produce-models", "true");
+    Sort sort = s->make_sort(BV, width);
+
+    mt19937_64 gen(42);
+    TermVec symbols;
+    for (size_t i = 0; i < num_symbols; ++i)
+    {
+      string bits;
+      for (uint64_t b = 0; b < width; ++b)
+      {
+        bits += (gen() & 1) ? '1' : '0';
+      }
+      Term x = s->make_symbol("x" + to_string(i), sort);
+      s->assert_formula(s->make_term(Equal, x, s->make_term(bits, sort, 2)));
+      symbols.push_back(x);
+    }
+    if (!s->check_sat().is_sat())
+    {
+      cerr << "unexpected result for " << sc.solver_enum << endl;
+      return 1;
+    }
+
+    vector<uint64_t> words;
+    uint64_t checksum = 0;
+    vector<pair<string, function<void(const Term &)>>> methods = {
+      { "string",
+        [&](const Term & x) {
+          bv_string_to_words(s->get_value(x)->to_string(), width, words);
+        } },
+      { "to_bv_words",
+        [&](const Term & x) { s->get_value(x)->to_bv_words(words); } },
+      { "get_bv_value", [&](const Term & x) { s->get_bv_value(x, words); } }
+    };
+    for (const auto & m : methods)
+    {
+      auto start = chrono::steady_clock::now();
+      for (size_t r = 0; r < rounds; ++r)
+      {
+        for (const auto & x : symbols)
+        {
+          m.second(x);
+          checksum += words[0];
+        }
+      }
+      double secs = chrono::duration<double>(chrono::steady_clock::now() - start)
+                        .count();
+      double values = double(rounds * num_symbols);
+      double mb = values * ((width + 7) / 8) / (1024.0 * 1024.0);
+      cout << left << setw(12) << to_string(sc.solver_enum) << setw(16)
+           << m.first << right << fixed << setprecision(0) << setw(14)
+           << values / secs << setprecision(2) << setw(12) << mb / secs
+           << endl;
+    }
+    // keep the extraction from being optimized away
+    if (checksum == 42)
+    {
+      cout << "";
+    }
+  }
+  return 0;
+}
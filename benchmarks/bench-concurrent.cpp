@@ -0,0 +1,115 @@
+/*********************                                                        */
+/*! \file bench-concurrent.cpp
+** \verbatim
+** Top contributors (to current version):
+**   agent
+** This file is part of the smt-switch project.
+** Copyright (c) 2026 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved.  See the file LICENSE in the top-level source
+** directory for licensing information.\endverbatim
+**
+** \brief Measures building one large formula from several threads.
+**
+** Usage: bench-concurrent [terms] [max threads]
+**
+** Splits a fixed number of term constructions evenly over 1, 2, 4, ...
+** threads (up to max threads) and reports the wall-clock time for:
+**   shared   - all threads build on one ConcurrentSolver
+**   separate - every thread builds on its own solver instance
+**              (only for backends with CONCURRENT_INSTANCES)
+**/
+
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "available_solvers.h"
+#include "concurrent_solver.h"
+#include "smt.h"
+
+using namespace smt;
+using namespace smt_tests;
+using namespace std;
+
+namespace {
+
+// builds num_terms operations over a few symbols, as short chains
+// that are asserted one by one
+void build(SmtSolver & s, const string & prefix, size_t num_terms)
+{
+  Sort bvsort = s->make_sort(BV, 32);
+  TermVec syms;
+  for (size_t i = 0; i < 4; ++i)
+  {
+    syms.push_back(s->make_symbol(prefix + to_string(i), bvsort));
+  }
+  const PrimOp ops[] = { BVAdd, BVXor, BVMul, BVAnd };
+  Term t = syms[0];
+  for (size_t i = 1; i <= num_terms; ++i)
+  {
+    t = s->make_term(ops[i % 4], t, s->make_term(i, bvsort));
+    if (i % 64 == 0)
+    {
+      s->assert_formula(s->make_term(BVUge, t, syms[i / 64 % 4]));
+      t = syms[0];
+    }
+  }
+}
+
+double run_threads(size_t num_threads, function<void(size_t)> work)
+{
+  auto start = chrono::steady_clock::now();
+  vector<thread> threads;
+  for (size_t i = 0; i < num_threads; ++i)
+  {
+    threads.emplace_back(work, i);
+  }
+  for (auto & t : threads)
+  {
+    t.join();
+  }
+  return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+}
+
+}  // namespace
+
+int main(int argc, char ** argv)
+{
+  size_t num_terms = argc > 1 ? strtoul(argv[1], nullptr, 10) : 50000;
+  size_t max_threads = argc > 2 ? strtoul(argv[2], nullptr, 10) : 32;
+
+  cout << left << setw(12) << "solver" << setw(12) << "method" << right
+       << setw(10) << "threads" << setw(12) << "seconds" << endl;
+  for (auto sc : filter_non_generic_solver_configurations({ THEORY_BV }))
+  {
+    string name =
+        to_string(sc.solver_enum) + (sc.is_logging_solver ? "-log" : "");
+    auto report = [&](const string & method, size_t n, double secs) {
+      cout << left << setw(12) << name << setw(12) << method << right
+           << setw(10) << n << fixed << setprecision(3) << setw(12) << secs
+           << endl;
+    };
+
+    for (size_t n = 1; n <= max_threads; n *= 2)
+    {
+      SmtSolver shared = create_concurrent_solver(create_solver(sc));
+      report("shared", n, run_threads(n, [&](size_t i) {
+               build(shared, "t" + to_string(i) + "_", num_terms / n);
+             }));
+
+      if (solver_has_attribute(sc.solver_enum, CONCURRENT_INSTANCES))
+      {
+        report("separate", n, run_threads(n, [&](size_t i) {
+                 SmtSolver s = create_solver(sc);
+                 build(s, "t" + to_string(i) + "_", num_terms / n);
+               }));
+      }
+    }
+  }
+  return 0;
+}
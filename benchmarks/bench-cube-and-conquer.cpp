@@ -0,0 +1,109 @@
+/*********************                                                        */
+/*! \file bench-cube-and-conquer.cpp
+** \verbatim
+** Top contributors (to current version):
+**   agent
+** This file is part of the smt-switch project.
+** Copyright (c) 2026 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved.  See the file LICENSE in the top-level source
+** directory for licensing information.\endverbatim
+**
+** \brief Compares a single check_sat with CubeAndConquer on pigeonhole.
+**
+** Usage: bench-cube-and-conquer [pigeons] [workers] [max depth]
+**/
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+
+#include "available_solvers.h"
+#include "cube_and_conquer.h"
+#include "smt.h"
+
+using namespace smt;
+using namespace smt_tests;
+using namespace std;
+
+// pigeons in pigeons - 1 holes (unsat)
+Term pigeonhole(const SmtSolver & s, size_t pigeons)
+{
+  size_t holes = pigeons - 1;
+  Sort boolsort = s->make_sort(BOOL);
+  vector<TermVec> p(pigeons);
+  Term res = s->make_term(true);
+  for (size_t i = 0; i < pigeons; ++i)
+  {
+    Term some_hole = s->make_term(false);
+    for (size_t j = 0; j < holes; ++j)
+    {
+      p[i].push_back(s->make_symbol(
+          "p_" + std::to_string(i) + "_" + std::to_string(j), boolsort));
+      some_hole = s->make_term(Or, some_hole, p[i][j]);
+    }
+    res = s->make_term(And, res, some_hole);
+  }
+  for (size_t j = 0; j < holes; ++j)
+  {
+    for (size_t i = 0; i < pigeons; ++i)
+    {
+      for (size_t k = i + 1; k < pigeons; ++k)
+      {
+        res = s->make_term(
+            And, res, s->make_term(Not, s->make_term(And, p[i][j], p[k][j])));
+      }
+    }
+  }
+  return res;
+}
+
+int main(int argc, char ** argv)
+{
+  size_t pigeons = argc > 1 ? strtoul(argv[1], nullptr, 10) : 8;
+  size_t num_workers = argc > 2 ? strtoul(argv[2], nullptr, 10) : 4;
+  size_t max_depth = argc > 3 ? strtoul(argv[3], nullptr, 10) : 6;
+
+  cout << left << setw(12) << "solver" << right << setw(16) << "single (ms)"
+       << setw(16) << "cubes (ms)" << endl;
+
+  for (auto sc : filter_non_generic_solver_configurations(
+           { THEORY_BV, UNSAT_CORE }))
+  {
+    if (sc.is_logging_solver)
+    {
+      continue;
+    }
+
+    SmtSolver s = create_solver(sc);
+    Term f = pigeonhole(s, pigeons);
+
+    auto start = chrono::steady_clock::now();
+    SmtSolver single = create_solver(sc);
+    TermTranslator to_single(single);
+    single->assert_formula(to_single.transfer_term(f, BOOL));
+    single->check_sat();
+    auto end = chrono::steady_clock::now();
+    double single_ms =
+        chrono::duration<double, milli>(end - start).count();
+
+    vector<SmtSolver> workers;
+    for (size_t i = 0; i < num_workers; ++i)
+    {
+      workers.push_back(create_solver(sc));
+    }
+    start = chrono::steady_clock::now();
+    CubeAndConquer cc(workers, f);
+    cc.set_max_depth(max_depth);
+    cc.solve();
+    end = chrono::steady_clock::now();
+    double cubes_ms = chrono::duration<double, milli>(end - start).count();
+
+    cout << left << setw(12) << to_string(sc.solver_enum) << right << fixed
+         << setprecision(2) << setw(16) << single_ms << setw(16) << cubes_ms
+         << endl;
+    cc.print_report(cout);
+  }
+  return 0;
+}
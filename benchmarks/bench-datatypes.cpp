@@ -0,0 +1,132 @@
+/*********************                                                        */
+/*! \file bench-datatypes.cpp
+** \verbatim
+** Top contributors (to current version):
+**   agent
+** This file is part of the smt-switch project.
+** Copyright (c) 2026 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved.  See the file LICENSE in the top-level source
+** directory for licensing information.\endverbatim
+**
+** \brief Measures declaring large families of algebraic datatypes.
+**
+** Usage: bench-datatypes [datatypes] [constructors]
+**
+** Declares a hierarchy of datatypes where every datatype is a list-like
+** type whose constructors also hold the previous datatype, then checks one
+** query over the last one:
+**   one-at-a-time - one make_sort call per datatype
+**   batched       - one make_datatype_sorts call for the whole family
+**/
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+
+#include "available_solvers.h"
+#include "smt.h"
+
+using namespace smt;
+using namespace smt_tests;
+using namespace std;
+
+namespace {
+
+DatatypeDecl make_decl(SmtSolver & s,
+                       const string & prefix,
+                       size_t i,
+                       size_t num_cons,
+                       const Sort & prev)
+{
+  string name = prefix + "dt" + to_string(i);
+  DatatypeDecl d = s->make_datatype_decl(name);
+  DatatypeConstructorDecl base =
+      s->make_datatype_constructor_decl(name + "_base");
+  s->add_constructor(d, base);
+  for (size_t j = 0; j < num_cons; ++j)
+  {
+    string cname = name + "_c" + to_string(j);
+    DatatypeConstructorDecl c = s->make_datatype_constructor_decl(cname);
+    s->add_selector(c, cname + "_val", prev);
+    s->add_selector_self(c, cname + "_next");
+    s->add_constructor(d, c);
+  }
+  return d;
+}
+
+Result query(SmtSolver & s, const Sort & last, const string & prefix)
+{
+  Term x = s->make_symbol(prefix + "x", last);
+  string name = last->get_datatype()->get_name();
+  return s->check_sat_assuming({ s->make_term(
+      Not,
+      s->make_term(Apply_Tester, s->get_tester(last, name + "_base"), x)) });
+}
+
+}  // namespace
+
+int main(int argc, char ** argv)
+{
+  size_t num_dts = argc > 1 ? strtoul(argv[1], nullptr, 10) : 200;
+  size_t num_cons = argc > 2 ? strtoul(argv[2], nullptr, 10) : 8;
+
+  cout << left << setw(12) << "solver" << setw(16) << "method" << right
+       << setw(12) << "seconds" << endl;
+  for (auto sc : filter_non_generic_solver_configurations({ THEORY_DATATYPE }))
+  {
+    SmtSolver s = create_solver(sc);
+    s->set_opt("incremental", "true");
+    Sort intsort = s->make_sort(INT);
+
+    auto report = [&](const string & method, double secs) {
+      cout << left << setw(12)
+           << (to_string(sc.solver_enum) + (sc.is_logging_solver ? "-log" : ""))
+           << setw(16) << method << right << fixed << setprecision(3) << setw(12) << secs
+           << endl;
+    };
+
+    auto start = chrono::steady_clock::now();
+    Sort prev = intsort;
+    for (size_t i = 0; i < num_dts; ++i)
+    {
+      prev = s->make_sort(make_decl(s, "a", i, num_cons, prev));
+    }
+    if (!query(s, prev, "a").is_sat())
+    {
+      cerr << "expected sat for " << sc.solver_enum << endl;
+      return 1;
+    }
+    report("one-at-a-time",
+           chrono::duration<double>(chrono::steady_clock::now() - start)
+               .count());
+
+    // placeholders stand in for the previous datatype of the family
+    start = chrono::steady_clock::now();
+    vector<DatatypeDecl> decls;
+    try
+    {
+      prev = intsort;
+      for (size_t i = 0; i < num_dts; ++i)
+      {
+        decls.push_back(make_decl(s, "b", i, num_cons, prev));
+        prev = s->make_unresolved_sort(decls.back());
+      }
+    }
+    catch (NotImplementedException & e)
+    {
+      continue;
+    }
+    SortVec sorts = s->make_datatype_sorts(decls);
+    if (!query(s, sorts.back(), "b").is_sat())
+    {
+      cerr << "expected sat for " << sc.solver_enum << endl;
+      return 1;
+    }
+    report("batched",
+           chrono::duration<double>(chrono::steady_clock::now() - start)
+               .count());
+  }
+  return 0;
+}
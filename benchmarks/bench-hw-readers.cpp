@@ -0,0 +1,151 @@
+/*********************                                                        */
+/*! \file bench-hw-readers.cpp
+** \verbatim
+** Top contributors (to current version):
+**   agent
+** This file is part of the smt-switch project.
+** Copyright (c) 2026 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved.  See the file LICENSE in the top-level source
+** directory for licensing information.\endverbatim
+**
+** \brief Measures the throughput of Btor2Reader and AigerReader.
+**
+** Usage: bench-hw-readers [megabytes] [btor2 or aiger file...]
+**
+** Without files, synthetic models of roughly the given size are generated
+** (HWMCC instances range from a few kilobytes to a few hundred megabytes).
+**/
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+#include "aiger_reader.h"
+#include "available_solvers.h"
+#include "btor2_reader.h"
+#include "smt.h"
+
+using namespace smt;
+using namespace smt_tests;
+using namespace std;
+
+// a chain of 16-bit operations over a few inputs and states
+string synthetic_btor2(size_t bytes)
+{
+  string out = "1 sort bitvec 1\n2 sort bitvec 16\n";
+  const char * ops[] = { "add", "xor", "mul", "and", "sub", "or" };
+  size_t id = 3;
+  for (size_t i = 0; i < 8; ++i, ++id)
+  {
+    out += to_string(id) + " state 2 s" + to_string(i) + "\n";
+  }
+  for (size_t i = 0; i < 8; ++i, ++id)
+  {
+    out += to_string(id) + " input 2 x" + to_string(i) + "\n";
+  }
+  while (out.size() < bytes)
+  {
+    out += to_string(id) + " " + ops[id % 6] + " 2 " + to_string(id - 1) + " "
+           + to_string(id - 1 - id % 13) + "\n";
+    ++id;
+  }
+  out += to_string(id) + " redor 1 " + to_string(id - 1) + "\n";
+  out += to_string(id + 1) + " bad " + to_string(id) + "\n";
+  return out;
+}
+
+// a binary AIG of random-ish AND gates
+string synthetic_aiger(size_t bytes)
+{
+  uint64_t inputs = 64;
+  uint64_t ands = bytes / 3;
+  string out = "aig " + to_string(inputs + ands) + " " + to_string(inputs)
+               + " 0 1 " + to_string(ands) + "\n"
+               + to_string(2 * (inputs + ands)) + "\n";
+  auto encode = [&out](uint64_t x) {
+    while (x & ~0x7f)
+    {
+      out += char((x & 0x7f) | 0x80);
+      x >>= 7;
+    }
+    out += char(x);
+  };
+  for (uint64_t i = 0; i < ands; ++i)
+  {
+    uint64_t lhs = 2 * (inputs + i + 1);
+    uint64_t rhs0 = lhs - 2 - (i % 3);
+    uint64_t rhs1 = rhs0 - 2 - 2 * (i % 7) - (i % 2);
+    if (rhs1 < 2)
+    {
+      rhs1 = 2;
+    }
+    encode(lhs - rhs0);
+    encode(rhs0 - rhs1);
+  }
+  return out;
+}
+
+template <class Reader>
+double mb_per_s(const SolverConfiguration & sc, const string & filename)
+{
+  SmtSolver s = create_solver(sc);
+  Reader r(s);
+  auto start = chrono::steady_clock::now();
+  r.parse(filename);
+  auto end = chrono::steady_clock::now();
+  ifstream in(filename, ios::binary | ios::ate);
+  double mb = in.tellg() / (1024.0 * 1024.0);
+  return mb / chrono::duration<double>(end - start).count();
+}
+
+int main(int argc, char ** argv)
+{
+  size_t megabytes = argc > 1 ? strtoul(argv[1], nullptr, 10) : 16;
+
+  vector<pair<string, bool>> files;  // file name, is btor2
+  bool generated = argc <= 2;
+  if (generated)
+  {
+    ofstream("bench-hw-readers.btor2") << synthetic_btor2(megabytes << 20);
+    ofstream("bench-hw-readers.aig", ios::binary)
+        << synthetic_aiger(megabytes << 20);
+    files = { { "bench-hw-readers.btor2", true },
+              { "bench-hw-readers.aig", false } };
+  }
+  for (int i = 2; i < argc; ++i)
+  {
+    string f = argv[i];
+    files.push_back({ f, f.find(".btor") != string::npos });
+  }
+
+  cout << left << setw(12) << "solver" << setw(32) << "file" << right
+       << setw(12) << "MB/s" << endl;
+  for (auto sc : filter_non_generic_solver_configurations({ THEORY_BV }))
+  {
+    if (sc.is_logging_solver)
+    {
+      continue;
+    }
+    for (const auto & f : files)
+    {
+      double rate = f.second ? mb_per_s<Btor2Reader>(sc, f.first)
+                             : mb_per_s<AigerReader>(sc, f.first);
+      cout << left << setw(12) << to_string(sc.solver_enum) << setw(32)
+           << f.first << right << fixed << setprecision(2) << setw(12) << rate
+           << endl;
+    }
+  }
+
+  if (generated)
+  {
+    for (const auto & f : files)
+    {
+      std::remove(f.first.c_str());
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,87 @@
+/*********************                                                        */
+/*! \file bench-logging-churn.cpp
+** \verbatim
+** Top contributors (to current version):
+**   agent
+** This file is part of the smt-switch project.
+** Copyright (c) 2026 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved.  See the file LICENSE in the top-level source
+** directory for licensing information.\endverbatim
+**
+** \brief Measures the memory of a LoggingSolver under term churn.
+**
+** Usage: bench-logging-churn [rounds] [terms per round]
+**
+** Every round builds a batch of new short-lived terms over a few
+** persistent symbols (like the queries of a model checker) and reports
+** the memory statistics every tenth of the run:
+**   dropped  - the terms of a round are dropped after the round
+**   retained - all terms are kept (like a strong hash-consing table)
+**/
+
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+
+#include "available_solvers.h"
+#include "smt.h"
+
+using namespace smt;
+using namespace smt_tests;
+using namespace std;
+
+int main(int argc, char ** argv)
+{
+  size_t num_rounds = argc > 1 ? strtoul(argv[1], nullptr, 10) : 200;
+  size_t num_terms = argc > 2 ? strtoul(argv[2], nullptr, 10) : 5000;
+
+  cout << left << setw(12) << "solver" << setw(10) << "mode" << right
+       << setw(8) << "round" << setw(14) << "table" << setw(14)
+       << "live terms" << setw(12) << "rss (kB)" << endl;
+  for (auto sc : filter_non_generic_solver_configurations({ THEORY_BV }))
+  {
+    if (!sc.is_logging_solver)
+    {
+      continue;
+    }
+    for (bool retain : { false, true })
+    {
+      SmtSolver s = create_solver(sc);
+      Sort bvsort = s->make_sort(BV, 32);
+      TermVec syms;
+      for (size_t i = 0; i < 4; ++i)
+      {
+        syms.push_back(s->make_symbol("s" + to_string(i), bvsort));
+      }
+
+      TermVec retained;
+      for (size_t r = 1; r <= num_rounds; ++r)
+      {
+        TermVec round;
+        for (size_t i = 0; i < num_terms; ++i)
+        {
+          Term c = s->make_term(r * num_terms + i, bvsort);
+          round.push_back(s->make_term(
+              BVUlt, s->make_term(BVAdd, syms[i % 4], c), syms[(i + 1) % 4]));
+        }
+        if (retain)
+        {
+          retained.insert(retained.end(), round.begin(), round.end());
+        }
+
+        if (r % (num_rounds < 10 ? 1 : num_rounds / 10) == 0)
+        {
+          round.clear();
+          MemoryStats stats = s->get_memory_stats();
+          cout << left << setw(12) << to_string(sc.solver_enum) << setw(10)
+               << (retain ? "retained" : "dropped") << right << setw(8) << r
+               << setw(14) << stats.cache_entries.at("logging_hashtable")
+               << setw(14) << stats.live_terms << setw(12) << stats.rss_kb
+               << endl;
+        }
+      }
+    }
+  }
+  return 0;
+}
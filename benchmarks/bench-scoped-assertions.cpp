@@ -0,0 +1,93 @@
+/*********************                                                        */
+/*! \file bench-scoped-assertions.cpp
+** \verbatim
+** Top contributors (to current version):
+**   agent
+** This file is part of the smt-switch project.
+** Copyright (c) 2026 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved.  See the file LICENSE in the top-level source
+** directory for licensing information.\endverbatim
+**
+** \brief Compares native push / pop with ScopedAssertions.
+**
+** Usage: bench-scoped-assertions [iterations] [garbage threshold]
+**/
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+
+#include "available_solvers.h"
+#include "scoped_assertions.h"
+#include "smt.h"
+
+using namespace smt;
+using namespace smt_tests;
+using namespace std;
+
+// scoped queries: push, assert a few constraints, check, pop
+template <class Scopes>
+double run(Scopes & scopes, const SmtSolver & s, size_t iterations)
+{
+  Sort bvsort = s->make_sort(BV, 16);
+  Term x = s->make_symbol("x", bvsort);
+  Term y = s->make_symbol("y", bvsort);
+  scopes.assert_formula(s->make_term(BVUlt, x, y));
+
+  auto start = chrono::steady_clock::now();
+  for (size_t i = 0; i < iterations; ++i)
+  {
+    scopes.push();
+    Term c = s->make_term(i % (1 << 16), bvsort);
+    scopes.assert_formula(s->make_term(BVUge, x, c));
+    scopes.assert_formula(s->make_term(BVUle, y, s->make_term(BVAdd, x, c)));
+    scopes.check_sat();
+    scopes.pop();
+  }
+  auto end = chrono::steady_clock::now();
+  return chrono::duration<double, micro>(end - start).count() / iterations;
+}
+
+// adapter so the native solver has the same interface as ScopedAssertions
+struct NativeScopes
+{
+  SmtSolver s;
+  void push() { s->push(); }
+  void pop() { s->pop(); }
+  void assert_formula(const Term & t) { s->assert_formula(t); }
+  Result check_sat() { return s->check_sat(); }
+};
+
+int main(int argc, char ** argv)
+{
+  size_t iterations = argc > 1 ? strtoul(argv[1], nullptr, 10) : 1000;
+  size_t garbage_threshold = argc > 2 ? strtoul(argv[2], nullptr, 10) : 100;
+
+  cout << left << setw(12) << "solver" << right << setw(16) << "native (us)"
+       << setw(16) << "scoped (us)" << endl;
+
+  for (auto sc : filter_non_generic_solver_configurations({ THEORY_BV }))
+  {
+    if (sc.is_logging_solver)
+    {
+      continue;
+    }
+
+    SmtSolver native = create_solver(sc);
+    native->set_opt("incremental", "true");
+    NativeScopes ns{ native };
+    double native_us = run(ns, native, iterations);
+
+    SmtSolver emulated = create_solver(sc);
+    emulated->set_opt("incremental", "true");
+    ScopedAssertions sa(emulated, garbage_threshold);
+    double scoped_us = run(sa, emulated, iterations);
+
+    cout << left << setw(12) << to_string(sc.solver_enum) << right << fixed
+         << setprecision(2) << setw(16) << native_us << setw(16) << scoped_us
+         << endl;
+  }
+  return 0;
+}
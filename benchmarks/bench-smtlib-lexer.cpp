@@ -0,0 +1,160 @@
+/*********************                                                        */
+/*! \file bench-smtlib-lexer.cpp
+** \verbatim
+** Top contributors (to current version):
+**   agent
+** This file is part of the smt-switch project.
+** Copyright (c) 2026 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved.  See the file LICENSE in the top-level source
+** directory for licensing information.\endverbatim
+**
+** \brief Measures the throughput of SmtLibLexer with each instruction set,
+**        and of the flex scanner of SmtLibReader if it was built.
+**
+** Usage: bench-smtlib-lexer [megabytes] [smt2 file...]
+**
+** Without files, a synthetic QF_BV benchmark of roughly the given size is
+** generated.
+**/
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+#include "available_solvers.h"
+#include "mapped_file.h"
+#include "smt.h"
+#include "smtlib_lexer.h"
+
+#ifdef BUILD_SMTLIB_READER
+#include "smtlib_reader.h"
+
+// the scanner is generated with the smtlib prefix, which renames yylex
+smtlib::parser::symbol_type smtliblex(smt::SmtLibReader & drv);
+#endif
+
+using namespace smt;
+using namespace smt_tests;
+using namespace std;
+
+// assertions over a few bit-vector symbols, with comments, quoted names and
+// 32-bit literals, printed over two lines
+string synthetic_smt2(size_t bytes)
+{
+  string out = "(set-logic QF_BV)\n";
+  for (size_t i = 0; i < 64; ++i)
+  {
+    out += "(declare-fun |state var " + to_string(i)
+           + "| () (_ BitVec 32))\n";
+  }
+  const char * ops[] = { "bvadd", "bvxor", "bvmul", "bvand", "bvsub", "bvor" };
+  for (size_t i = 0; out.size() < bytes; ++i)
+  {
+    if (i % 16 == 0)
+    {
+      out += "; assertion group " + to_string(i / 16) + "\n";
+    }
+    string bits;
+    for (size_t b = 0; b < 32; ++b)
+    {
+      bits += (i >> (b % 16)) & 1 ? '1' : '0';
+    }
+    out += "(assert (! (= (" + string(ops[i % 6]) + " |state var "
+           + to_string(i % 64) + "| #b" + bits + ")\n    (bvnot |state var "
+           + to_string((i * 7) % 64) + "|)) :named assertion_"
+           + to_string(i) + "))\n";
+  }
+  out += "(check-sat)\n";
+  return out;
+}
+
+const char * isa_name(SmtLibLexerIsa isa)
+{
+  switch (isa)
+  {
+    case LEXER_AVX2: return "avx2";
+    case LEXER_SSE42: return "sse4.2";
+    default: return "scalar";
+  }
+}
+
+int main(int argc, char ** argv)
+{
+  size_t megabytes = argc > 1 ? strtoul(argv[1], nullptr, 10) : 64;
+
+  vector<string> files;
+  bool generated = argc <= 2;
+  if (generated)
+  {
+    ofstream("bench-smtlib-lexer.smt2") << synthetic_smt2(megabytes << 20);
+    files.push_back("bench-smtlib-lexer.smt2");
+  }
+  for (int i = 2; i < argc; ++i)
+  {
+    files.push_back(argv[i]);
+  }
+
+  cout << left << setw(12) << "lexer" << setw(32) << "file" << right
+       << setw(12) << "tokens" << setw(12) << "MB/s" << endl;
+  for (const auto & f : files)
+  {
+    MappedFile mf(f);
+    double mb = mf.size() / (1024.0 * 1024.0);
+    for (int i = LEXER_SCALAR; i <= SmtLibLexer::best_isa(); ++i)
+    {
+      // best of three runs
+      double best = 0;
+      size_t tokens = 0;
+      for (size_t run = 0; run < 3; ++run)
+      {
+        auto start = chrono::steady_clock::now();
+        SmtLibLexer lexer(mf.data(), mf.size(), (SmtLibLexerIsa)i);
+        SmtLibToken buf[256];
+        size_t n;
+        tokens = 0;
+        do
+        {
+          n = lexer.next(buf, 256);
+          tokens += n;
+        } while (buf[n - 1].kind != TOK_EOF);
+        --tokens;
+        auto end = chrono::steady_clock::now();
+        double rate = mb / chrono::duration<double>(end - start).count();
+        best = rate > best ? rate : best;
+      }
+      cout << left << setw(12) << isa_name((SmtLibLexerIsa)i) << setw(32) << f
+           << right << setw(12) << tokens << fixed << setprecision(2)
+           << setw(12) << best << endl;
+    }
+
+#ifdef BUILD_SMTLIB_READER
+    // the flex scanner copies each token into the parser's symbol type
+    SmtSolver s = create_solver(
+        filter_non_generic_solver_configurations({ THEORY_BV })[0]);
+    SmtLibReader reader(s);
+    reader.file = f;
+    auto start = chrono::steady_clock::now();
+    reader.scan_begin();
+    size_t tokens = 0;
+    while (smtliblex(reader).kind() != smtlib::parser::symbol_kind::S_YYEOF)
+    {
+      ++tokens;
+    }
+    reader.scan_end();
+    auto end = chrono::steady_clock::now();
+    cout << left << setw(12) << "flex" << setw(32) << f << right << setw(12)
+         << tokens << fixed << setprecision(2) << setw(12)
+         << mb / chrono::duration<double>(end - start).count() << endl;
+#endif
+  }
+
+  if (generated)
+  {
+    std::remove(files[0].c_str());
+  }
+  return 0;
+}
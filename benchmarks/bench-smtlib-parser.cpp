@@ -0,0 +1,133 @@
+/*********************                                                        */
+/*! \file bench-smtlib-parser.cpp
+** \verbatim
+** Top contributors (to current version):
+**   agent
+** This file is part of the smt-switch project.
+** Copyright (c) 2026 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved.  See the file LICENSE in the top-level source
+** directory for licensing information.\endverbatim
+**
+** \brief Compares the bison parser of SmtLibReader with SmtLibDirectParser.
+**        The assertions are built but not asserted, so this measures the
+**        parsing and term construction only.
+**
+** Usage: bench-smtlib-parser [megabytes] [smt2 file...]
+**
+** Without files, a synthetic QF_BV benchmark of roughly the given size is
+** generated.
+**/
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+#include "available_solvers.h"
+#include "smt.h"
+#include "smtlib_direct_parser.h"
+#include "smtlib_reader.h"
+
+using namespace smt;
+using namespace smt_tests;
+using namespace std;
+
+class ParseOnlyReader : public SmtLibReader
+{
+ public:
+  ParseOnlyReader(SmtSolver & solver) : SmtLibReader(solver), assertions(0)
+  {
+  }
+
+  void assert_formula(const Term & assertion) override { ++assertions; }
+  Result check_sat() override { return Result(UNKNOWN); }
+  Result check_sat_assuming(const TermVec & assumptions) override
+  {
+    return Result(UNKNOWN);
+  }
+  void term_attribute(const Term & term,
+                      const string & keyword,
+                      const string & value) override
+  {
+  }
+
+  size_t assertions;
+};
+
+// deep assertions over a few bit-vector symbols, with lets, define-funs
+// and attributes
+string synthetic_smt2(size_t bytes)
+{
+  string out = "(set-logic QF_UFBV)\n";
+  for (size_t i = 0; i < 64; ++i)
+  {
+    out += "(declare-fun |state var " + to_string(i)
+           + "| () (_ BitVec 32))\n";
+  }
+  out += "(declare-fun f ((_ BitVec 32)) (_ BitVec 32))\n";
+  out += "(define-fun inc ((a (_ BitVec 32))) (_ BitVec 32) "
+         "(bvadd a #x00000001))\n";
+  const char * ops[] = { "bvadd", "bvxor", "bvmul", "bvand", "bvsub", "bvor" };
+  for (size_t i = 0; out.size() < bytes; ++i)
+  {
+    string v = "|state var " + to_string(i % 64) + "|";
+    string w = "|state var " + to_string((i * 7) % 64) + "|";
+    out += "(assert (! (let ((_let_0 (" + string(ops[i % 6]) + " " + v + " "
+           + w + ")))\n  (= (f (bvnot _let_0)) (inc ((_ extract 31 0) "
+           + "(bvor _let_0 (_ bv" + to_string(i) + " 32)))))) :named a"
+           + to_string(i) + "))\n";
+  }
+  return out;
+}
+
+int main(int argc, char ** argv)
+{
+  size_t megabytes = argc > 1 ? strtoul(argv[1], nullptr, 10) : 16;
+
+  vector<string> files;
+  bool generated = argc <= 2;
+  if (generated)
+  {
+    ofstream("bench-smtlib-parser.smt2") << synthetic_smt2(megabytes << 20);
+    files.push_back("bench-smtlib-parser.smt2");
+  }
+  for (int i = 2; i < argc; ++i)
+  {
+    files.push_back(argv[i]);
+  }
+
+  SolverConfiguration sc =
+      filter_non_generic_solver_configurations({ THEORY_BV })[0];
+  cout << left << setw(12) << "parser" << setw(32) << "file" << right
+       << setw(12) << "assertions" << setw(12) << "seconds" << endl;
+  for (const auto & f : files)
+  {
+    for (bool direct : { false, true })
+    {
+      // a fresh solver each time, so neither run reuses the other's terms
+      SmtSolver s = create_solver(sc);
+      ParseOnlyReader reader(s);
+      auto start = chrono::steady_clock::now();
+      int res = direct ? SmtLibDirectParser(reader).parse(f) : reader.parse(f);
+      auto end = chrono::steady_clock::now();
+      if (res)
+      {
+        cerr << "failed to parse " << f << endl;
+        return res;
+      }
+      cout << left << setw(12) << (direct ? "direct" : "bison") << setw(32)
+           << f << right << setw(12) << reader.assertions << fixed
+           << setprecision(3) << setw(12)
+           << chrono::duration<double>(end - start).count() << endl;
+    }
+  }
+
+  if (generated)
+  {
+    std::remove(files[0].c_str());
+  }
+  return 0;
+}
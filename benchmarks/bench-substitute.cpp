@@ -0,0 +1,102 @@
+/*********************                                                        */
+/*! \file bench-substitute.cpp
+** \verbatim
+** Top contributors (to current version):
+**   agent
+** This file is part of the smt-switch project.
+** Copyright (c) 2026 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved.  See the file LICENSE in the top-level source
+** directory for licensing information.\endverbatim
+**
+** \brief Measures substitute_terms on many roots with shared structure.
+**
+** Usage: bench-substitute [roots] [shared nodes]
+**
+** Builds a shared chain of bit-vector operations over the current-state
+** variables and one root per next-state variable on top of it (like a
+** transition relation), then substitutes the current-state variables:
+**   per-root - one substitute call per root
+**   batched  - one substitute_terms call
+**/
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+
+#include "available_solvers.h"
+#include "smt.h"
+
+using namespace smt;
+using namespace smt_tests;
+using namespace std;
+
+int main(int argc, char ** argv)
+{
+  size_t num_roots = argc > 1 ? strtoul(argv[1], nullptr, 10) : 2000;
+  size_t num_shared = argc > 2 ? strtoul(argv[2], nullptr, 10) : 2000;
+
+  cout << left << setw(12) << "solver" << setw(12) << "method" << right
+       << setw(12) << "seconds" << endl;
+  for (auto sc : filter_non_generic_solver_configurations({ THEORY_BV }))
+  {
+    if (sc.is_logging_solver)
+    {
+      continue;
+    }
+    SmtSolver s = create_solver(sc);
+    Sort bvsort = s->make_sort(BV, 16);
+
+    TermVec cur, subst;
+    UnorderedTermMap smap;
+    for (size_t i = 0; i < 8; ++i)
+    {
+      cur.push_back(s->make_symbol("s" + to_string(i), bvsort));
+      subst.push_back(s->make_symbol("s" + to_string(i) + "_0", bvsort));
+      smap[cur.back()] = subst.back();
+    }
+    const PrimOp ops[] = { BVAdd, BVXor, BVMul, BVAnd, BVSub, BVOr };
+    TermVec shared(cur);
+    for (size_t i = 0; i < num_shared; ++i)
+    {
+      size_t n = shared.size();
+      shared.push_back(
+          s->make_term(ops[i % 6], shared[n - 1], shared[n - 1 - i % 7]));
+    }
+    TermVec roots;
+    for (size_t i = 0; i < num_roots; ++i)
+    {
+      Term next = s->make_symbol("n" + to_string(i), bvsort);
+      roots.push_back(s->make_term(
+          Equal, next, s->make_term(BVAdd, shared.back(), cur[i % 8])));
+    }
+
+    auto start = chrono::steady_clock::now();
+    TermVec per_root;
+    for (const auto & r : roots)
+    {
+      per_root.push_back(s->substitute(r, smap));
+    }
+    double per_root_secs =
+        chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    start = chrono::steady_clock::now();
+    TermVec batched = s->substitute_terms(roots, smap);
+    double batched_secs =
+        chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    if (per_root != batched)
+    {
+      cerr << "substitution results differ for " << sc.solver_enum << endl;
+      return 1;
+    }
+    cout << left << setw(12) << to_string(sc.solver_enum) << setw(12)
+         << "per-root" << right << fixed << setprecision(3) << setw(12)
+         << per_root_secs << endl;
+    cout << left << setw(12) << to_string(sc.solver_enum) << setw(12)
+         << "batched" << right << fixed << setprecision(3) << setw(12)
+         << batched_secs << endl;
+  }
+  return 0;
+}
@@ -0,0 +1,135 @@
+/*********************                                                        */
+/*! \file bench-term-traversal.cpp
+** \verbatim
+** Top contributors (to current version):
+**   agent
+** This file is part of the smt-switch project.
+** Copyright (c) 2026 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved.  See the file LICENSE in the top-level source
+** directory for licensing information.\endverbatim
+**
+** \brief Measures the cost of walking a term DAG through the child
+**        iterators of each backend.
+**
+** Usage: bench-term-traversal [layers] [width] [passes]
+**
+** Builds a DAG of bit-vector terms where every node of a layer is built
+** from two nodes of the previous layer, and walks it like a walker does:
+** every edge is dereferenced and the children are looked up in a cache.
+** Reports the time per edge and the number of term objects that the
+** walk created, i.e. that are alive in addition to the DAG while the
+** children of all nodes are held (one per edge without interning, none
+** if the backend returns the existing wrappers).
+**/
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <unordered_set>
+
+#include "available_solvers.h"
+#include "smt.h"
+
+using namespace smt;
+using namespace smt_tests;
+using namespace std;
+
+int main(int argc, char ** argv)
+{
+  size_t num_layers = argc > 1 ? strtoul(argv[1], nullptr, 10) : 200;
+  size_t width = argc > 2 ? strtoul(argv[2], nullptr, 10) : 100;
+  size_t num_passes = argc > 3 ? strtoul(argv[3], nullptr, 10) : 5;
+
+  cout << left << setw(12) << "solver" << right << setw(12) << "edges"
+       << setw(16) << "new wrappers" << setw(14) << "ns / edge" << endl;
+  for (auto sc :
+       filter_non_generic_solver_configurations({ TERMITER, THEORY_BV }))
+  {
+    if (sc.is_logging_solver)
+    {
+      continue;
+    }
+
+    SmtSolver s = create_solver(sc);
+    Sort bvsort = s->make_sort(BV, 32);
+    TermVec layer;
+    for (size_t i = 0; i < width; ++i)
+    {
+      layer.push_back(s->make_symbol("x" + to_string(i), bvsort));
+    }
+    TermVec dag = layer;
+    PrimOp ops[] = { BVAdd, BVMul, BVXor, BVAnd };
+    for (size_t l = 0; l < num_layers; ++l)
+    {
+      TermVec next;
+      for (size_t i = 0; i < width; ++i)
+      {
+        next.push_back(s->make_term(
+            ops[(l + i) % 4], layer[i], layer[(i * 7 + l + 1) % width]));
+      }
+      dag.insert(dag.end(), next.begin(), next.end());
+      layer = next;
+    }
+
+    unordered_set<const AbsTerm *> dag_objects;
+    for (const auto & t : dag)
+    {
+      dag_objects.insert(t.get());
+    }
+
+    size_t num_edges = 0;
+    uint64_t new_wrappers = 0;
+    double seconds = 0;
+    for (size_t p = 0; p < num_passes; ++p)
+    {
+      auto start = chrono::steady_clock::now();
+      UnorderedTermSet visited;
+      vector<TermVec> children;
+      children.reserve(dag.size());
+      TermVec to_visit = layer;
+      while (!to_visit.empty())
+      {
+        Term t = to_visit.back();
+        to_visit.pop_back();
+        if (!visited.insert(t).second)
+        {
+          continue;
+        }
+        children.emplace_back(t->begin(), t->end());
+        to_visit.insert(
+            to_visit.end(), children.back().begin(), children.back().end());
+        num_edges += children.back().size();
+      }
+      seconds +=
+          chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+      // the children that are not the objects of the DAG were created
+      unordered_set<const AbsTerm *> created;
+      for (const auto & tv : children)
+      {
+        for (const auto & c : tv)
+        {
+          if (dag_objects.find(c.get()) == dag_objects.end())
+          {
+            created.insert(c.get());
+          }
+        }
+      }
+      new_wrappers = created.size();
+
+      // freeing the wrappers is part of the cost
+      start = chrono::steady_clock::now();
+      children.clear();
+      visited.clear();
+      seconds +=
+          chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    }
+
+    cout << left << setw(12) << to_string(sc.solver_enum) << right << setw(12)
+         << num_edges / num_passes << setw(16) << new_wrappers << setw(14)
+         << fixed << setprecision(1) << seconds * 1e9 / num_edges << endl;
+  }
+  return 0;
+}
@@ -0,0 +1,153 @@
+/*********************                                                        */
+/*! \file calibrate-auto-solver.cpp
+** \verbatim
+** Top contributors (to current version):
+**   agent
+** This file is part of the smt-switch project.
+** Copyright (c) 2026 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved.  See the file LICENSE in the top-level source
+** directory for licensing information.\endverbatim
+**
+** \brief Fits the rule table of AutoSolver to a benchmark set.
+**
+** Usage: calibrate-auto-solver <smt2 directory> <rule file> [timeout]
+**
+** Runs every .smt2 file in the directory on every available backend,
+** records the features of the assertions and the check-sat times, and
+** writes the rule table fitted with BackendSelector::fit (default rules
+** included as fallbacks) to the rule file. The timeout (in seconds,
+** default 60) is only enforced for backends with the TIMELIMIT
+** attribute, but it is always used for the PAR-2 scores.
+**/
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+#include "auto_solver.h"
+#include "available_solvers.h"
+#include "smt.h"
+#include "smtlib_reader.h"
+
+using namespace smt;
+using namespace smt_tests;
+using namespace std;
+
+// runs a file, collecting the features and the time spent in check-sat
+class TimingReader : public SmtLibReader
+{
+ public:
+  TimingReader(SmtSolver & solver) : SmtLibReader(solver) {}
+
+  void assert_formula(const Term & assertion) override
+  {
+    stats.add(assertion);
+    SmtLibReader::assert_formula(assertion);
+  }
+
+  Result check_sat() override
+  {
+    return timed([this]() { return solver_->check_sat(); });
+  }
+
+  Result check_sat_assuming(const TermVec & assumptions) override
+  {
+    return timed([this, &assumptions]() {
+      return solver_->check_sat_assuming(assumptions);
+    });
+  }
+
+  TermStats stats;
+  double seconds = 0;
+  bool solved = true;
+
+ protected:
+  template <class F>
+  Result timed(F && f)
+  {
+    auto start = chrono::steady_clock::now();
+    Result r = f();
+    seconds +=
+        chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    solved &= !r.is_unknown();
+    return r;
+  }
+};
+
+int main(int argc, char ** argv)
+{
+  if (argc < 3)
+  {
+    cerr << "Usage: " << argv[0] << " <smt2 directory> <rule file> [timeout]"
+         << endl;
+    return 1;
+  }
+  double timeout = argc > 3 ? atof(argv[3]) : 60;
+
+  vector<string> files;
+  for (const auto & entry : filesystem::directory_iterator(argv[1]))
+  {
+    if (entry.path().extension() == ".smt2")
+    {
+      files.push_back(entry.path().string());
+    }
+  }
+  sort(files.begin(), files.end());
+
+  vector<TimingRecord> records;
+  cout << left << setw(40) << "benchmark" << setw(10) << "logic" << right
+       << setw(10) << "dag size" << setw(10) << "solver" << setw(12)
+       << "time (s)" << endl;
+  for (const auto & f : files)
+  {
+    for (auto se : available_non_generic_solver_enums())
+    {
+      // logging solvers support term iteration, which TermStats needs
+      SmtSolver s = create_solver(SolverConfiguration(se, true));
+      if (solver_has_attribute(se, TIMELIMIT))
+      {
+        s->set_opt("time-limit", to_string((size_t)ceil(timeout)));
+      }
+
+      TimingReader reader(s);
+      try
+      {
+        reader.parse(f);
+      }
+      catch (SmtException & e)
+      {
+        // not counted, so this backend is not compared on this logic
+        cout << left << setw(40) << f << "skipped " << se << ": " << e.what()
+             << endl;
+        continue;
+      }
+
+      bool solved = reader.solved && reader.seconds <= timeout;
+      records.push_back({ f,
+                          reader.stats.logic(),
+                          reader.stats.dag_size(),
+                          reader.stats.max_bv_width(),
+                          se,
+                          reader.seconds,
+                          solved });
+      cout << left << setw(40) << f << setw(10) << reader.stats.logic()
+           << right << setw(10) << reader.stats.dag_size() << setw(10)
+           << to_string(se) << setw(12) << fixed << setprecision(3)
+           << reader.seconds << (solved ? "" : " (unsolved)") << endl;
+    }
+  }
+
+  BackendSelector selector;
+  selector.fit(records, timeout);
+  ofstream out(argv[2]);
+  selector.save(out);
+  cout << "wrote " << selector.get_rules().size() << " rules to " << argv[2]
+       << endl;
+  return 0;
+}
@@ -0,0 +1,575 @@
+/*********************                                                        */
+/*! \file smt-switch-runner.cpp
+** \verbatim
+** Top contributors (to current version):
+**   agent
+** This file is part of the smt-switch project.
+** Copyright (c) 2026 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved.  See the file LICENSE in the top-level source
+** directory for licensing information.\endverbatim
+**
+** \brief Runs a directory of SMT-LIB files on every backend and reports
+**        the parse time, solve time, result and peak memory of each run.
+**
+** Usage: smt-switch-runner [--timeout s] [--memory MB] [--format csv|json]
+**                          [--output file] <smt2 directory>
+**        smt-switch-runner --compare <baseline csv> <csv> [--slowdown f]
+**
+** Every run is done in a child process with an address-space limit
+** (default 4096 MB, 0 for none) and is killed after the wall-clock
+** timeout (default 60 s). The result column holds the check-sat results
+** separated by ';', or one of timeout, memout or error.
+**
+** The compare mode reads two CSV reports and lists the runs that got a
+** different answer, are no longer solved, or got slower / use more memory
+** by more than the slowdown factor (default 1.5, differences under 0.1 s
+** or 1 MB are ignored). It exits with 1 if there are any such runs.
+**/
+
+#include <poll.h>
+#include <signal.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <new>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "available_solvers.h"
+#include "smt.h"
+#include "smtlib_reader.h"
+
+using namespace smt;
+using namespace smt_tests;
+using namespace std;
+
+struct Run
+{
+  string file;
+  string solver;
+  string result;
+  double parse_s = 0;
+  double solve_s = 0;
+  long peak_rss_kb = 0;
+};
+
+// records the results and the time spent in check-sat, prints nothing
+class RunnerReader : public SmtLibReader
+{
+ public:
+  RunnerReader(SmtSolver & solver) : SmtLibReader(solver) {}
+
+  Result check_sat() override
+  {
+    return timed([this]() { return solver_->check_sat(); });
+  }
+
+  Result check_sat_assuming(const TermVec & assumptions) override
+  {
+    return timed([this, &assumptions]() {
+      return solver_->check_sat_assuming(assumptions);
+    });
+  }
+
+  string results;
+  double solve_s = 0;
+
+ protected:
+  template <class F>
+  Result timed(F && f)
+  {
+    auto start = chrono::steady_clock::now();
+    Result r = f();
+    solve_s +=
+        chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    results += (results.empty() ? "" : ";") + r.to_string();
+    return r;
+  }
+};
+
+// the body of a child process, writes "<result> <parse_s> <solve_s>"
+void run_child(const string & file, SolverEnum se, int fd)
+{
+  string out;
+  try
+  {
+    SmtSolver s = create_solver(SolverConfiguration(se, false));
+    RunnerReader reader(s);
+    auto start = chrono::steady_clock::now();
+    reader.parse(file);
+    double total =
+        chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    out = (reader.results.empty() ? "none" : reader.results) + " "
+          + to_string(total - reader.solve_s) + " "
+          + to_string(reader.solve_s);
+  }
+  catch (bad_alloc &)
+  {
+    out = "memout 0 0";
+  }
+  catch (exception & e)
+  {
+    cerr << file << " (" << se << "): " << e.what() << endl;
+    out = "error 0 0";
+  }
+  // the parent reads while we write, large outputs take several writes
+  for (size_t done = 0; done < out.size();)
+  {
+    ssize_t n = write(fd, out.c_str() + done, out.size() - done);
+    if (n < 0)
+    {
+      if (errno == EINTR)
+      {
+        continue;
+      }
+      _exit(1);
+    }
+    done += n;
+  }
+  _exit(0);
+}
+
+Run run(const string & file,
+        SolverEnum se,
+        double timeout,
+        size_t memory_mb)
+{
+  Run res;
+  res.file = file;
+  res.solver = to_string(se);
+
+  int fds[2];
+  if (pipe(fds))
+  {
+    throw SmtException("Could not create a pipe: " + string(strerror(errno)));
+  }
+  pid_t pid = fork();
+  if (pid < 0)
+  {
+    throw SmtException("Could not fork: " + string(strerror(errno)));
+  }
+
+  if (pid == 0)
+  {
+    close(fds[0]);
+    // get-value and friends print to stdout
+    FILE * devnull = freopen("/dev/null", "w", stdout);
+    (void)devnull;
+    if (memory_mb)
+    {
+      rlim_t bytes = (rlim_t)memory_mb << 20;
+      struct rlimit limit = { bytes, bytes };
+      setrlimit(RLIMIT_AS, &limit);
+    }
+    run_child(file, se, fds[1]);
+  }
+
+  close(fds[1]);
+  auto start = chrono::steady_clock::now();
+  int status = 0;
+  struct rusage usage = {};
+  bool timed_out = false;
+  // drain the pipe while waiting, otherwise a child with more output
+  // than the pipe buffer blocks in write until the timeout
+  string out;
+  char buf[4096];
+  struct pollfd pfd = { fds[0], POLLIN, 0 };
+  while (!wait4(pid, &status, WNOHANG, &usage))
+  {
+    if (chrono::duration<double>(chrono::steady_clock::now() - start).count()
+        > timeout)
+    {
+      kill(pid, SIGKILL);
+      wait4(pid, &status, 0, &usage);
+      timed_out = true;
+      break;
+    }
+    if (pfd.fd < 0)
+    {
+      this_thread::sleep_for(chrono::milliseconds(5));
+    }
+    else if (poll(&pfd, 1, 5) > 0)
+    {
+      ssize_t n = read(fds[0], buf, sizeof(buf));
+      if (n > 0)
+      {
+        out.append(buf, n);
+      }
+      else if (n == 0 || errno != EINTR)
+      {
+        // end of file, only wait for the exit from now on
+        pfd.fd = -1;
+      }
+    }
+  }
+  // ru_maxrss is in kilobytes on Linux
+  res.peak_rss_kb = usage.ru_maxrss;
+
+  // the child exited, read the rest up to the end of file
+  while (!timed_out && pfd.fd >= 0)
+  {
+    ssize_t n = read(fds[0], buf, sizeof(buf));
+    if (n > 0)
+    {
+      out.append(buf, n);
+    }
+    else if (n == 0 || errno != EINTR)
+    {
+      break;
+    }
+  }
+  close(fds[0]);
+  if (timed_out)
+  {
+    res.result = "timeout";
+    res.solve_s = timeout;
+  }
+  else if (!out.empty() && WIFEXITED(status) && !WEXITSTATUS(status))
+  {
+    istringstream ss(out);
+    ss >> res.result >> res.parse_s >> res.solve_s;
+  }
+  else
+  {
+    // most allocators abort (or the process is killed) at the limit
+    bool at_limit =
+        memory_mb && (size_t)res.peak_rss_kb >= (memory_mb << 10) * 9 / 10;
+    res.result = at_limit ? "memout" : "error";
+  }
+  return res;
+}
+
+string json_escape(const string & s)
+{
+  string res;
+  for (char c : s)
+  {
+    if (c == '"' || c == '\\')
+    {
+      res += '\\';
+    }
+    res += c;
+  }
+  return res;
+}
+
+// RFC 4180 quoting, only for fields that need it
+string csv_quote(const string & s)
+{
+  if (s.find_first_of(",\"\r\n") == string::npos)
+  {
+    return s;
+  }
+  string res = "\"";
+  for (char c : s)
+  {
+    if (c == '"')
+    {
+      res += '"';
+    }
+    res += c;
+  }
+  return res + "\"";
+}
+
+// reads one record, a quoted field may contain commas, doubled quotes and
+// line breaks
+bool read_csv_record(istream & in, vector<string> & fields)
+{
+  fields.clear();
+  if (in.peek() == EOF)
+  {
+    return false;
+  }
+
+  string field;
+  bool quoted = false;
+  char c;
+  while (in.get(c))
+  {
+    if (quoted)
+    {
+      if (c != '"')
+      {
+        field += c;
+      }
+      else if (in.peek() == '"')
+      {
+        field += in.get();
+      }
+      else
+      {
+        quoted = false;
+      }
+    }
+    else if (c == '"')
+    {
+      quoted = true;
+    }
+    else if (c == ',')
+    {
+      fields.push_back(field);
+      field.clear();
+    }
+    else if (c == '\n')
+    {
+      break;
+    }
+    else if (c != '\r')
+    {
+      field += c;
+    }
+  }
+  fields.push_back(field);
+  return true;
+}
+
+void write_csv(ostream & os, const vector<Run> & runs)
+{
+  os << "file,solver,result,parse_s,solve_s,peak_rss_kb" << endl;
+  for (const auto & r : runs)
+  {
+    os << csv_quote(r.file) << "," << csv_quote(r.solver) << ","
+       << csv_quote(r.result) << "," << r.parse_s << "," << r.solve_s << ","
+       << r.peak_rss_kb << endl;
+  }
+}
+
+void write_json(ostream & os, const vector<Run> & runs)
+{
+  os << "[" << endl;
+  for (size_t i = 0; i < runs.size(); ++i)
+  {
+    const Run & r = runs[i];
+    os << "  { \"file\": \"" << json_escape(r.file) << "\", \"solver\": \""
+       << r.solver << "\", \"result\": \"" << r.result
+       << "\", \"parse_s\": " << r.parse_s << ", \"solve_s\": " << r.solve_s
+       << ", \"peak_rss_kb\": " << r.peak_rss_kb << " }"
+       << (i + 1 < runs.size() ? "," : "") << endl;
+  }
+  os << "]" << endl;
+}
+
+map<pair<string, string>, Run> read_csv(const string & filename)
+{
+  ifstream in(filename);
+  if (!in)
+  {
+    throw SmtException("Could not open " + filename);
+  }
+
+  map<pair<string, string>, Run> runs;
+  vector<string> fields;
+  read_csv_record(in, fields);  // header
+  while (read_csv_record(in, fields))
+  {
+    if (fields.size() != 6)
+    {
+      string line;
+      for (size_t i = 0; i < fields.size(); ++i)
+      {
+        line += (i ? "," : "") + csv_quote(fields[i]);
+      }
+      throw SmtException("Malformed line in " + filename + ": " + line);
+    }
+    Run r;
+    r.file = fields[0];
+    r.solver = fields[1];
+    r.result = fields[2];
+    r.parse_s = stod(fields[3]);
+    r.solve_s = stod(fields[4]);
+    r.peak_rss_kb = stol(fields[5]);
+    runs[{ r.file, r.solver }] = r;
+  }
+  return runs;
+}
+
+bool solved(const Run & r)
+{
+  return r.result != "timeout" && r.result != "memout" && r.result != "error"
+         && r.result.find("unknown") == string::npos;
+}
+
+int compare(const string & baseline, const string & current, double slowdown)
+{
+  auto old_runs = read_csv(baseline);
+  auto new_runs = read_csv(current);
+
+  size_t regressions = 0;
+  auto report = [&regressions](const Run & r, const string & what) {
+    cout << r.file << " (" << r.solver << "): " << what << endl;
+    ++regressions;
+  };
+
+  for (const auto & elem : old_runs)
+  {
+    const Run & o = elem.second;
+    auto it = new_runs.find(elem.first);
+    if (it == new_runs.end())
+    {
+      report(o, "missing");
+      continue;
+    }
+    const Run & n = it->second;
+
+    if (solved(o) && solved(n) && o.result != n.result)
+    {
+      report(n, "result changed from " + o.result + " to " + n.result);
+    }
+    else if (solved(o) && !solved(n))
+    {
+      report(n, "not solved anymore (" + n.result + ")");
+    }
+    else if (solved(o))
+    {
+      if (n.solve_s > slowdown * o.solve_s && n.solve_s - o.solve_s > 0.1)
+      {
+        report(n,
+               "solve time " + to_string(o.solve_s) + " s -> "
+                   + to_string(n.solve_s) + " s");
+      }
+      if (n.parse_s > slowdown * o.parse_s && n.parse_s - o.parse_s > 0.1)
+      {
+        report(n,
+               "parse time " + to_string(o.parse_s) + " s -> "
+                   + to_string(n.parse_s) + " s");
+      }
+      if (n.peak_rss_kb > slowdown * o.peak_rss_kb
+          && n.peak_rss_kb - o.peak_rss_kb > 1024)
+      {
+        report(n,
+               "peak memory " + to_string(o.peak_rss_kb) + " kB -> "
+                   + to_string(n.peak_rss_kb) + " kB");
+      }
+    }
+  }
+
+  cout << regressions << " regression(s) in " << old_runs.size() << " runs"
+       << endl;
+  return regressions ? 1 : 0;
+}
+
+int usage(const char * name)
+{
+  cerr << "Usage: " << name
+       << " [--timeout s] [--memory MB] [--format csv|json] [--output file]"
+          " <smt2 directory>"
+       << endl
+       << "       " << name
+       << " --compare <baseline csv> <csv> [--slowdown f]" << endl;
+  return 2;
+}
+
+int main(int argc, char ** argv)
+{
+  double timeout = 60;
+  size_t memory_mb = 4096;
+  string format = "csv";
+  string output;
+  double slowdown = 1.5;
+  bool compare_mode = false;
+  vector<string> positional;
+  for (int i = 1; i < argc; ++i)
+  {
+    string arg = argv[i];
+    bool has_value = i + 1 < argc;
+    if (arg == "--compare")
+    {
+      compare_mode = true;
+    }
+    else if (arg == "--timeout" && has_value)
+    {
+      timeout = atof(argv[++i]);
+    }
+    else if (arg == "--memory" && has_value)
+    {
+      memory_mb = strtoul(argv[++i], nullptr, 10);
+    }
+    else if (arg == "--format" && has_value)
+    {
+      format = argv[++i];
+    }
+    else if (arg == "--output" && has_value)
+    {
+      output = argv[++i];
+    }
+    else if (arg == "--slowdown" && has_value)
+    {
+      slowdown = atof(argv[++i]);
+    }
+    else if (arg.compare(0, 2, "--") == 0)
+    {
+      return usage(argv[0]);
+    }
+    else
+    {
+      positional.push_back(arg);
+    }
+  }
+
+  if (compare_mode)
+  {
+    if (positional.size() != 2)
+    {
+      return usage(argv[0]);
+    }
+    return compare(positional[0], positional[1], slowdown);
+  }
+
+  if (positional.size() != 1 || (format != "csv" && format != "json"))
+  {
+    return usage(argv[0]);
+  }
+
+  vector<string> files;
+  for (const auto & entry :
+       filesystem::recursive_directory_iterator(positional[0]))
+  {
+    if (entry.path().extension() == ".smt2")
+    {
+      files.push_back(entry.path().string());
+    }
+  }
+  sort(files.begin(), files.end());
+
+  vector<Run> runs;
+  for (const auto & f : files)
+  {
+    for (auto se : available_non_generic_solver_enums())
+    {
+      runs.push_back(run(f, se, timeout, memory_mb));
+      cerr << f << " " << runs.back().solver << " " << runs.back().result
+           << endl;
+    }
+  }
+
+  ofstream file_out;
+  if (!output.empty())
+  {
+    file_out.open(output);
+  }
+  ostream & os = output.empty() ? cout : file_out;
+  if (format == "csv")
+  {
+    write_csv(os, runs);
+  }
+  else
+  {
+    write_json(os, runs);
+  }
+  return 0;
+}
@@ -84,6 +84,7 @@ class BzlaSolver : public AbsSmtSolver
   void pop(uint64_t num = 1) override;
   uint64_t get_context_level() const override;
   Term get_value(const Term & t) const override;
+  void get_bv_value(const Term & t, std::vector<uint64_t> & out) const override;
   UnorderedTermMap get_array_values(const Term & arr,
                                     Term & out_const_base) const override;
   void get_unsat_assumptions(UnorderedTermSet & out) override;
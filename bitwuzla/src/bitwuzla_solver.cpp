@@ -16,7 +16,10 @@
 
 #include "bitwuzla_solver.h"
 
+#include <cstring>
+
 #include "assert.h"
+#include "trace.h"
 
 using namespace std;
 
@@ -132,6 +135,7 @@ void BzlaSolver::assert_formula(const Term & t)
 
 Result BzlaSolver::check_sat()
 {
+  SMT_TRACE_SPAN("BzlaSolver::check_sat", "backend");
   timelimit_start();
   BitwuzlaResult r = bitwuzla_check_sat(bzla);
   bool tl_triggered = timelimit_end();
@@ -156,28 +160,33 @@ Result BzlaSolver::check_sat()
 
 Result BzlaSolver::check_sat_assuming(const TermVec & assumptions)
 {
+  SMT_TRACE_SPAN("BzlaSolver::check_sat_assuming", "backend");
   return check_sat_assuming_internal(assumptions.begin(), assumptions.end());
 }
 
 Result BzlaSolver::check_sat_assuming_list(const TermList & assumptions)
 {
+  SMT_TRACE_SPAN("BzlaSolver::check_sat_assuming_list", "backend");
   return check_sat_assuming_internal(assumptions.begin(), assumptions.end());
 }
 
 Result BzlaSolver::check_sat_assuming_set(
     const UnorderedTermSet & assumptions)
 {
+  SMT_TRACE_SPAN("BzlaSolver::check_sat_assuming_set", "backend");
   return check_sat_assuming_internal(assumptions.begin(), assumptions.end());
 }
 
 void BzlaSolver::push(uint64_t num)
 {
+  SMT_TRACE_SPAN("BzlaSolver::push", "backend");
   bitwuzla_push(bzla, num);
   context_level += num;
 }
 
 void BzlaSolver::pop(uint64_t num)
 {
+  SMT_TRACE_SPAN("BzlaSolver::pop", "backend");
   bitwuzla_pop(bzla, num);
   context_level -= num;
 }
@@ -186,10 +195,25 @@ uint64_t BzlaSolver::get_context_level() const { return context_level; }
 
 Term BzlaSolver::get_value(const Term & t) const
 {
+  SMT_TRACE_SPAN("BzlaSolver::get_value", "backend");
   shared_ptr<BzlaTerm> bterm = static_pointer_cast<BzlaTerm>(t);
   return make_shared<BzlaTerm>(bitwuzla_get_value(bzla, bterm->term));
 }
 
+void BzlaSolver::get_bv_value(const Term & t,
+                              std::vector<uint64_t> & out) const
+{
+  shared_ptr<BzlaTerm> bterm = static_pointer_cast<BzlaTerm>(t);
+  if (!bitwuzla_term_is_bv(bterm->term))
+  {
+    throw IncorrectUsageException("get_bv_value expects a bit-vector term");
+  }
+  // binary string of the assignment, owned by bitwuzla
+  const char * bits = bitwuzla_get_bv_value(bzla, bterm->term);
+  bits_to_words(
+      bits, strlen(bits), bitwuzla_term_bv_get_size(bterm->term), out);
+}
+
 UnorderedTermMap BzlaSolver::get_array_values(const Term & arr,
                                               Term & out_const_base) const
 {
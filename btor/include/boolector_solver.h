@@ -65,6 +65,7 @@ class BoolectorSolver : public AbsSmtSolver
   void pop(uint64_t num = 1) override;
   uint64_t get_context_level() const override;
   Term get_value(const Term & t) const override;
+  void get_bv_value(const Term & t, std::vector<uint64_t> & out) const override;
   UnorderedTermMap get_array_values(const Term & arr,
                                     Term & out_const_base) const override;
   void get_unsat_assumptions(UnorderedTermSet & out) override;
@@ -112,8 +113,12 @@ class BoolectorSolver : public AbsSmtSolver
   Term make_term(Op op, const TermVec & terms) const override;
   void reset() override;
   void reset_assertions() override;
+  MemoryStats get_memory_stats() const override;
   Term substitute(const Term term,
                   const UnorderedTermMap & substitution_map) const override;
+  TermVec substitute_terms(
+      const TermVec & terms,
+      const UnorderedTermMap & substitution_map) const override;
   // helper methods for making a term with a primitive op
   Term apply_prim_op(PrimOp op, Term t) const;
   Term apply_prim_op(PrimOp op, Term t0, Term t1) const;
@@ -139,6 +144,15 @@ class BoolectorSolver : public AbsSmtSolver
   ///< set this flag with set_opt("base-context-1", "true")
   size_t context_level = 0;  ///< tracks the current solving context level
 
+  mutable TermInternTable term_table_;  ///< one wrapper per live node
+
+  // helper for creating the term wrappers, takes ownership of one
+  // reference of n
+  Term wrap(BoolectorNode * n) const
+  {
+    return BoolectorTerm::wrap(btor, &term_table_, n);
+  }
+
   // helper functions
   template <class I>
   inline Result check_sat_assuming(I it, const I & end)
@@ -26,6 +26,7 @@ extern "C" {
 }
 
 #include "term.h"
+#include "term_hashtable.h"
 #include "utils.h"
 
 #include "boolector_sort.h"
@@ -42,8 +43,11 @@ class BoolectorTermIter : public TermIterBase
 {
  public:
   // IMPORTANT: The correctness of this code depends on the array e being of size 3
-  BoolectorTermIter(Btor * btor, std::vector<BtorNode *> c, int64_t idx)
-      : btor(btor), children(c), idx(idx)
+  BoolectorTermIter(Btor * btor,
+                    std::vector<BtorNode *> c,
+                    int64_t idx,
+                    TermInternTable * table = nullptr)
+      : btor(btor), children(c), idx(idx), table(table)
   {
   }
   BoolectorTermIter(const BoolectorTermIter & it)
@@ -51,6 +55,7 @@ class BoolectorTermIter : public TermIterBase
     btor = it.btor;
     children = it.children;
     idx = it.idx;
+    table = it.table;
   };
   ~BoolectorTermIter(){};
   BoolectorTermIter & operator=(const BoolectorTermIter & it);
@@ -67,6 +72,7 @@ class BoolectorTermIter : public TermIterBase
   Btor * btor;
   std::vector<BtorNode *> children;
   int64_t idx;
+  TermInternTable * table;  ///< interns the children, may be null
 };
 
 class BoolectorTerm : public AbsTerm
@@ -85,6 +91,7 @@ class BoolectorTerm : public AbsTerm
   bool is_value() const override;
   virtual std::string to_string() override;
   uint64_t to_int() const override;
+  void to_bv_words(std::vector<uint64_t> & out) override;
   /** Iterators for traversing the children
    */
   TermIter begin() override;
@@ -117,6 +124,16 @@ class BoolectorTerm : public AbsTerm
   // for the smt-switch abstract interface
   bool children_cached_ =
       false;  ///< set to true if children have already been gathered
+  /** the table of the solver that created this term, if any
+   *  the children are interned in the same table
+   */
+  TermInternTable * intern_table = nullptr;
+
+  /** wrap a node, interned by its address if table is not null
+   *  takes ownership of one external reference of n, which is released
+   *  if there already is a live wrapper for n
+   */
+  static Term wrap(Btor * btor, TermInternTable * table, BoolectorNode * n);
 
   // helpers
   bool is_const_array() const;
@@ -15,7 +15,11 @@
 **/
 
 #include "boolector_solver.h"
+
+#include <cstring>
+
 #include "solver_utils.h"
+#include "trace.h"
 
 extern "C" {
 #include "btornode.h"
@@ -207,11 +211,11 @@ Term BoolectorSolver::make_term(bool b) const
 {
   if (b)
   {
-    return std::make_shared<BoolectorTerm> (btor, boolector_const(btor, "1"));
+    return wrap(boolector_const(btor, "1"));
   }
   else
   {
-    return std::make_shared<BoolectorTerm> (btor, boolector_const(btor, "0"));
+    return wrap(boolector_const(btor, "0"));
   }
 }
 
@@ -222,7 +226,7 @@ Term BoolectorSolver::make_term(int64_t i, const Sort & sort) const
     std::shared_ptr<BoolectorSortBase> bs =
         std::static_pointer_cast<BoolectorSortBase>(sort);
     // note: give the constant value a null PrimOp
-    return std::make_shared<BoolectorTerm> (btor, boolector_int(btor, i, bs->sort));
+    return wrap(boolector_int(btor, i, bs->sort));
   }
   catch (InternalSolverException & e)
   {
@@ -260,7 +264,7 @@ Term BoolectorSolver::make_term(std::string val,
           + std::to_string(base));
     }
 
-    return std::make_shared<BoolectorTerm> (btor, node);
+    return wrap(node);
   }
   catch (InternalSolverException & e)
   {
@@ -277,8 +281,7 @@ Term BoolectorSolver::make_term(const Term & val, const Sort & sort) const
         std::static_pointer_cast<BoolectorTerm>(val);
     std::shared_ptr<BoolectorSortBase> bs =
         std::static_pointer_cast<BoolectorSortBase>(sort);
-    return std::make_shared<BoolectorTerm>
-        (btor, boolector_const_array(btor, bs->sort, bt->node));
+    return wrap(boolector_const_array(btor, bs->sort, bt->node));
   }
   else
   {
@@ -297,6 +300,7 @@ void BoolectorSolver::assert_formula(const Term & t)
 
 Result BoolectorSolver::check_sat()
 {
+  SMT_TRACE_SPAN("BoolectorSolver::check_sat", "backend");
   int32_t res = boolector_sat(btor);
   if (res == BOOLECTOR_SAT)
   {
@@ -314,28 +318,33 @@ Result BoolectorSolver::check_sat()
 
 Result BoolectorSolver::check_sat_assuming(const TermVec & assumptions)
 {
+  SMT_TRACE_SPAN("BoolectorSolver::check_sat_assuming", "backend");
   return check_sat_assuming(assumptions.begin(), assumptions.end());
 }
 
 Result BoolectorSolver::check_sat_assuming_list(const TermList & assumptions)
 {
+  SMT_TRACE_SPAN("BoolectorSolver::check_sat_assuming_list", "backend");
   return check_sat_assuming(assumptions.begin(), assumptions.end());
 }
 
 Result BoolectorSolver::check_sat_assuming_set(
     const UnorderedTermSet & assumptions)
 {
+  SMT_TRACE_SPAN("BoolectorSolver::check_sat_assuming_set", "backend");
   return check_sat_assuming(assumptions.begin(), assumptions.end());
 }
 
 void BoolectorSolver::push(uint64_t num)
 {
+  SMT_TRACE_SPAN("BoolectorSolver::push", "backend");
   boolector_push(btor, num);
   context_level += num;
 }
 
 void BoolectorSolver::pop(uint64_t num)
 {
+  SMT_TRACE_SPAN("BoolectorSolver::pop", "backend");
   boolector_pop(btor, num);
   context_level -= num;
 }
@@ -344,6 +353,7 @@ uint64_t BoolectorSolver::get_context_level() const { return context_level; }
 
 Term BoolectorSolver::get_value(const Term & t) const
 {
+  SMT_TRACE_SPAN("BoolectorSolver::get_value", "backend");
   Term result;
   std::shared_ptr<BoolectorTerm> bt =
       std::static_pointer_cast<BoolectorTerm>(t);
@@ -355,7 +365,7 @@ Term BoolectorSolver::get_value(const Term & t) const
     BoolectorNode * bc = boolector_const(btor, assignment);
     boolector_free_bv_assignment(btor, assignment);
     // note: give the constant value a null PrimOp
-    result = std::make_shared<BoolectorTerm>(btor, bc);
+    result = wrap(bc);
   }
   else if (sk == ARRAY)
   {
@@ -406,7 +416,7 @@ Term BoolectorSolver::get_value(const Term & t) const
       boolector_release(btor, idx);
       boolector_release(btor, elem);
     }
-    result = std::make_shared<BoolectorTerm>(btor, stores);
+    result = wrap(stores);
 
     // free memory
     if (size)
@@ -427,6 +437,24 @@ Term BoolectorSolver::get_value(const Term & t) const
   return result;
 }
 
+void BoolectorSolver::get_bv_value(const Term & t,
+                                   std::vector<uint64_t> & out) const
+{
+  // read the assignment directly, without building a constant node
+  std::shared_ptr<BoolectorTerm> bt =
+      std::static_pointer_cast<BoolectorTerm>(t);
+  if (t->get_sort()->get_sort_kind() == ARRAY)
+  {
+    throw IncorrectUsageException("get_bv_value expects a bit-vector term");
+  }
+  const char * assignment = boolector_bv_assignment(btor, bt->node);
+  bits_to_words(assignment,
+                strlen(assignment),
+                boolector_get_width(btor, bt->node),
+                out);
+  boolector_free_bv_assignment(btor, assignment);
+}
+
 UnorderedTermMap BoolectorSolver::get_array_values(const Term & arr,
                                                    Term & out_const_base) const
 {
@@ -455,15 +483,15 @@ UnorderedTermMap BoolectorSolver::get_array_values(const Term & arr,
     if (std::string(bindices[i]) == "*")
     {
       belem = boolector_const(btor, bvalues[i]);
-      out_const_base = Term(new BoolectorTerm(btor, belem));
+      out_const_base = wrap(belem);
     }
     else
     {
       bidx = boolector_const(btor, bindices[i]);
       belem = boolector_const(btor, bvalues[i]);
 
-      Term idx = Term(new BoolectorTerm(btor, bidx));
-      Term val = Term(new BoolectorTerm(btor, belem));
+      Term idx = wrap(bidx);
+      Term val = wrap(belem);
 
       assignments[idx] = val;
     }
@@ -483,8 +511,7 @@ void BoolectorSolver::get_unsat_assumptions(UnorderedTermSet & out)
   BoolectorNode ** bcore = boolector_get_failed_assumptions(btor);
   while (*bcore)
   {
-    out.insert(std::make_shared<BoolectorTerm>(
-        btor, boolector_copy(btor, *bcore)));
+    out.insert(wrap(boolector_copy(btor, *bcore)));
     ++bcore;
   }
 }
@@ -651,7 +678,7 @@ Term BoolectorSolver::make_symbol(const std::string name, const Sort & sort)
   }
 
   // note: giving the symbol a null Op
-  Term term = std::make_shared<BoolectorTerm> (btor, n);
+  Term term = wrap(n);
   symbol_table[name] = term;
   return term;
 }
@@ -671,7 +698,7 @@ Term BoolectorSolver::make_param(const std::string name, const Sort & sort)
   std::shared_ptr<BoolectorSortBase> bs =
       std::static_pointer_cast<BoolectorSortBase>(sort);
   BoolectorNode * n = boolector_param(btor, bs->sort, name.c_str());
-  return std::make_shared<BoolectorTerm>(btor, n);
+  return wrap(n);
 }
 
 Term BoolectorSolver::make_term(Op op, const Term & t) const
@@ -720,7 +747,7 @@ Term BoolectorSolver::make_term(Op op, const Term & t) const
       msg += to_string(op.prim_op);
       throw IncorrectUsageException(msg);
     }
-    return std::make_shared<BoolectorTerm> (btor, btor_res);
+    return wrap(btor_res);
   }
 }
 
@@ -781,6 +808,8 @@ void BoolectorSolver::reset()
   boolector_release_all(btor);
   boolector_delete(btor);
   btor = boolector_new();
+  // the nodes of the old instance are gone
+  term_table_.clear();
 }
 
 void BoolectorSolver::reset_assertions()
@@ -803,6 +832,14 @@ void BoolectorSolver::reset_assertions()
   }
 }
 
+MemoryStats BoolectorSolver::get_memory_stats() const
+{
+  MemoryStats stats = AbsSmtSolver::get_memory_stats();
+  stats.live_terms = term_table_.num_live();
+  stats.cache_entries["term_intern_table"] = term_table_.size();
+  return stats;
+}
+
 Term BoolectorSolver::substitute(
     const Term term, const UnorderedTermMap & substitution_map) const
 {
@@ -834,7 +871,46 @@ Term BoolectorSolver::substitute(
   // counter
   substituted = boolector_copy(btor, substituted);
   boolector_nodemap_delete(bmap);
-  return std::make_shared<BoolectorTerm> (btor, substituted);
+  return wrap(substituted);
+}
+
+TermVec BoolectorSolver::substitute_terms(
+    const TermVec & terms, const UnorderedTermMap & substitution_map) const
+{
+  // the node map also records the substituted subterms, so sharing one
+  // map across all terms only visits shared structure once
+  BoolectorNodeMap * bmap = boolector_nodemap_new(btor);
+
+  std::shared_ptr<BoolectorTerm> key;
+  std::shared_ptr<BoolectorTerm> value;
+  for (auto elem : substitution_map)
+  {
+    key = std::static_pointer_cast<BoolectorTerm>(elem.first);
+    value = std::static_pointer_cast<BoolectorTerm>(elem.second);
+    // boolectornodemap only supports var -> term mappings
+    if (!key->is_symbol())
+    {
+      boolector_nodemap_delete(bmap);
+      throw IncorrectUsageException(
+          "boolector backend currently only supports symbol->term "
+          "substitution");
+    }
+    boolector_nodemap_map(bmap, key->node, value->node);
+  }
+
+  TermVec res;
+  res.reserve(terms.size());
+  for (const auto & t : terms)
+  {
+    std::shared_ptr<BoolectorTerm> bt =
+        std::static_pointer_cast<BoolectorTerm>(t);
+    BoolectorNode * substituted =
+        boolector_nodemap_substitute_node(btor, bmap, bt->node);
+    // copy before the map is deleted, see substitute
+    res.push_back(wrap(boolector_copy(btor, substituted)));
+  }
+  boolector_nodemap_delete(bmap);
+  return res;
 }
 
 void BoolectorSolver::dump_smt2(std::string filename) const
@@ -851,7 +927,7 @@ Term BoolectorSolver::apply_prim_op(PrimOp op, Term t) const
     std::shared_ptr<BoolectorTerm> bt =
         std::static_pointer_cast<BoolectorTerm>(t);
     BoolectorNode * result = unary_ops.at(op)(btor, bt->node);
-    return std::make_shared<BoolectorTerm> (btor, result);
+    return wrap(result);
   }
   catch (std::out_of_range & o)
   {
@@ -888,8 +964,7 @@ Term BoolectorSolver::apply_prim_op(PrimOp op, Term t0, Term t1) const
       std::shared_ptr<BoolectorTerm> bt1 =
           std::static_pointer_cast<BoolectorTerm>(t1);
       std::vector<BoolectorNode *> params({ bt0->node });
-      return std::make_shared<BoolectorTerm>(
-          btor, boolector_forall(btor, params.data(), 1, bt1->node));
+      return wrap(boolector_forall(btor, params.data(), 1, bt1->node));
     }
     else if (op == Exists)
     {
@@ -898,14 +973,13 @@ Term BoolectorSolver::apply_prim_op(PrimOp op, Term t0, Term t1) const
       std::shared_ptr<BoolectorTerm> bt1 =
           std::static_pointer_cast<BoolectorTerm>(t1);
       std::vector<BoolectorNode *> params({ bt0->node });
-      return std::make_shared<BoolectorTerm>(
-          btor, boolector_exists(btor, params.data(), 1, bt1->node));
+      return wrap(boolector_exists(btor, params.data(), 1, bt1->node));
     }
     else
     {
       result = binary_ops.at(op)(btor, bt0->node, bt1->node);
     }
-    return std::make_shared<BoolectorTerm> (btor, result);
+    return wrap(result);
   }
   catch (std::out_of_range & o)
   {
@@ -947,8 +1021,7 @@ Term BoolectorSolver::apply_prim_op(PrimOp op, Term t0, Term t1, Term t2) const
       std::shared_ptr<BoolectorTerm> bt2 =
           std::static_pointer_cast<BoolectorTerm>(t2);
       std::vector<BoolectorNode *> params({ bt0->node, bt1->node });
-      return std::make_shared<BoolectorTerm>(
-          btor, boolector_forall(btor, params.data(), 2, bt2->node));
+      return wrap(boolector_forall(btor, params.data(), 2, bt2->node));
     }
     else if (op == Exists)
     {
@@ -959,15 +1032,14 @@ Term BoolectorSolver::apply_prim_op(PrimOp op, Term t0, Term t1, Term t2) const
       std::shared_ptr<BoolectorTerm> bt2 =
           std::static_pointer_cast<BoolectorTerm>(t2);
       std::vector<BoolectorNode *> params({ bt0->node, bt1->node });
-      return std::make_shared<BoolectorTerm>(
-          btor, boolector_exists(btor, params.data(), 2, bt2->node));
+      return wrap(boolector_exists(btor, params.data(), 2, bt2->node));
     }
     else
     {
       result = ternary_ops.at(op)(btor, bt0->node, bt1->node, bt2->node);
     }
 
-    return std::make_shared<BoolectorTerm> (btor, result);
+    return wrap(result);
   }
   catch (std::out_of_range & o)
   {
@@ -1008,7 +1080,7 @@ Term BoolectorSolver::apply_prim_op(PrimOp op, TermVec terms) const
     BoolectorNode * result =
         boolector_apply(btor, args.data(), args.size(), bt0->node);
 
-    return std::make_shared<BoolectorTerm>(btor, result);
+    return wrap(result);
   }
   else if (is_variadic(op))
   {
@@ -1030,7 +1102,7 @@ Term BoolectorSolver::apply_prim_op(PrimOp op, TermVec terms) const
       boolector_release(btor, trailing_res);
       trailing_res = res;
     }
-    return std::make_shared<BoolectorTerm>(btor, res);
+    return wrap(res);
   }
   else if (op == Forall || op == Exists)
   {
@@ -1053,7 +1125,7 @@ Term BoolectorSolver::apply_prim_op(PrimOp op, TermVec terms) const
       assert(op == Exists);
       bres = boolector_exists(btor, bparams.data(), bparams.size(), bbody);
     }
-    return std::make_shared<BoolectorTerm>(btor, bres);
+    return wrap(bres);
   }
   else if (op == Distinct)
   {
@@ -24,6 +24,7 @@ extern "C"
 }
 
 #include "assert.h"
+#include <cstring>
 #include <unordered_map>
 #include "stdio.h"
 
@@ -125,6 +126,7 @@ BoolectorTermIter & BoolectorTermIter::operator=(const BoolectorTermIter & it)
   btor = it.btor;
   children = it.children;
   idx = it.idx;
+  table = it.table;
   return *this;
 };
 
@@ -139,18 +141,28 @@ const Term BoolectorTermIter::operator*()
     throw SmtException("Should never have an args node in children look up");
   }
 
+  if (table)
+  {
+    // no need to take a reference if the node is already wrapped
+    Term t = table->lookup((uintptr_t)BTOR_EXPORT_BOOLECTOR_NODE(res));
+    if (t)
+    {
+      return t;
+    }
+  }
+
   // increment internal reference counter
   res = btor_node_copy(btor, res);
   // increment external reference counter
   btor_node_inc_ext_ref_counter(btor, res);
 
   BoolectorNode * node = BTOR_EXPORT_BOOLECTOR_NODE(res);
-  return std::make_shared<BoolectorTerm> (btor, node);
+  return BoolectorTerm::wrap(btor, table, node);
 };
 
 TermIterBase * BoolectorTermIter::clone() const
 {
-  return new BoolectorTermIter(btor, children, idx);
+  return new BoolectorTermIter(btor, children, idx, table);
 }
 
 bool BoolectorTermIter::operator==(const BoolectorTermIter & it)
@@ -190,6 +202,29 @@ BoolectorTerm::BoolectorTerm(Btor * b, BoolectorNode * n)
   negated = (((((uintptr_t)node) % 2) != 0) && bn->kind != BTOR_BV_CONST_NODE);
 }
 
+Term BoolectorTerm::wrap(Btor * btor,
+                         TermInternTable * table,
+                         BoolectorNode * n)
+{
+  if (!table)
+  {
+    return std::make_shared<BoolectorTerm>(btor, n);
+  }
+  // boolector hash-conses its nodes, so equal terms have the same address
+  bool created = false;
+  Term res = table->intern((uintptr_t)n, [btor, table, n, &created]() {
+    created = true;
+    shared_ptr<BoolectorTerm> bt = std::make_shared<BoolectorTerm>(btor, n);
+    bt->intern_table = table;
+    return bt;
+  });
+  if (!created)
+  {
+    boolector_release(btor, n);
+  }
+  return res;
+}
+
 BoolectorTerm::~BoolectorTerm()
 {
   boolector_release(btor, node);
@@ -393,12 +428,25 @@ uint64_t BoolectorTerm::to_int() const
   return std::stoull(s, &sz, 2);
 }
 
+void BoolectorTerm::to_bv_words(std::vector<uint64_t> & out)
+{
+  if (!boolector_is_const(btor, node))
+  {
+    throw IncorrectUsageException(
+        "Can't get bit-vector words from a non-constant term.");
+  }
+  const char * bits = boolector_get_bits(btor, node);
+  bits_to_words(
+      bits, strlen(bits), boolector_get_width(btor, node), out);
+  boolector_free_bits(btor, bits);
+}
+
 /** Iterators for traversing the children
  */
 TermIter BoolectorTerm::begin()
 {
   collect_children();
-  return TermIter(new BoolectorTermIter(btor, children, 0));
+  return TermIter(new BoolectorTermIter(btor, children, 0, intern_table));
 }
 
 TermIter BoolectorTerm::end()
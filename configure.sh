@@ -29,6 +29,8 @@ Configures the CMAKE build environment.
 --static                create static libaries (default: off)
 --python                compile with python bindings (default: off)
 --smtlib-reader         include the smt-lib reader - requires bison/flex (default:off)
+--benchmarks            build the benchmark executables (default: off)
+--tracing               compile in the tracing spans (default: off)
 --bison-dir=STR         custom bison installation directory
 --flex-dir=STR          custom flex installation directory
 
@@ -60,6 +62,8 @@ z3_home=default
 static=default
 python=default
 smtlib_reader=default
+benchmarks=default
+tracing=default
 bison_dir=default
 flex_dir=default
 
@@ -181,6 +185,12 @@ do
         --smtlib-reader)
             smtlib_reader=yes
             ;;
+        --benchmarks)
+            benchmarks=yes
+            ;;
+        --tracing)
+            tracing=yes
+            ;;
         --bison-dir=*)
             bison_dir=${1##*=}
             # Check if bison_dir is an absolute path and if not, make it
@@ -276,6 +286,12 @@ cmake_opts="$cmake_opts -DCMAKE_BUILD_TYPE=$build_type"
 [ $smtlib_reader != default ] \
     && cmake_opts="$cmake_opts -DSMTLIB_READER=ON"
 
+[ $benchmarks != default ] \
+    && cmake_opts="$cmake_opts -DBUILD_BENCHMARKS=ON"
+
+[ $tracing != default ] \
+    && cmake_opts="$cmake_opts -DSMT_SWITCH_TRACING=ON"
+
 [ $bison_dir != default ] \
     && cmake_opts="$cmake_opts -DBISON_DIR=$bison_dir"
 
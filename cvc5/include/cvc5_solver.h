@@ -94,6 +94,7 @@ class Cvc5Solver : public AbsSmtSolver
   Term get_selector(const Sort & s,
                     std::string con,
                     std::string name) const override;
+  Sort make_unresolved_sort(const DatatypeDecl & decl) const override;
   SortVec make_datatype_sorts(
       const std::vector<DatatypeDecl> & decls) const override;
 
@@ -134,7 +135,21 @@ class Cvc5Solver : public AbsSmtSolver
 
   uint64_t context_level;
 
-  // helper function
+  std::vector<::cvc5::Term> assumption_buffer_;
+  ///< reused by check_sat_assuming* to avoid an allocation per query
+
+  // helper functions
+  template <class I>
+  inline void fill_assumption_buffer(I it, const I & end)
+  {
+    assumption_buffer_.clear();
+    for (; it != end; ++it)
+    {
+      assumption_buffer_.push_back(
+          std::static_pointer_cast<Cvc5Term>(*it)->term);
+    }
+  }
+
   inline Result check_sat_assuming(const std::vector<cvc5::Term> & cvc5assumps)
   {
     ::cvc5::Result r = solver.checkSatAssuming(cvc5assumps);
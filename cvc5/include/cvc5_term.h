@@ -65,6 +65,7 @@ class Cvc5Term : public AbsTerm
   bool is_value() const override;
   virtual std::string to_string() override;
   uint64_t to_int() const override;
+  void to_bv_words(std::vector<uint64_t> & out) override;
   /** Iterators for traversing the children
    */
   TermIter begin() override;
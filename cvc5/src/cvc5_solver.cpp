@@ -15,6 +15,7 @@
 **/
 #include <limits>
 #include "cvc5_solver.h"
+#include "trace.h"
 #include "utils.h"
 
 namespace smt {
@@ -256,6 +257,7 @@ void Cvc5Solver::assert_formula(const Term & t)
 
 Result Cvc5Solver::check_sat()
 {
+  SMT_TRACE_SPAN("Cvc5Solver::check_sat", "backend");
   try
   {
     ::cvc5::Result r = solver.checkSat();
@@ -286,17 +288,11 @@ Result Cvc5Solver::check_sat()
 
 Result Cvc5Solver::check_sat_assuming(const TermVec & assumptions)
 {
+  SMT_TRACE_SPAN("Cvc5Solver::check_sat_assuming", "backend");
   try
   {
-    std::vector<::cvc5::Term> cvc5assumps;
-    cvc5assumps.reserve(assumptions.size());
-
-    std::shared_ptr<Cvc5Term> cterm;
-    for (auto a : assumptions)
-    {
-      cvc5assumps.push_back(std::static_pointer_cast<Cvc5Term>(a)->term);
-    }
-    return check_sat_assuming(cvc5assumps);
+    fill_assumption_buffer(assumptions.begin(), assumptions.end());
+    return check_sat_assuming(assumption_buffer_);
   }
   catch (::cvc5::CVC5ApiException & e)
   {
@@ -306,17 +302,11 @@ Result Cvc5Solver::check_sat_assuming(const TermVec & assumptions)
 
 Result Cvc5Solver::check_sat_assuming_list(const TermList & assumptions)
 {
+  SMT_TRACE_SPAN("Cvc5Solver::check_sat_assuming_list", "backend");
   try
   {
-    std::vector<::cvc5::Term> cvc5assumps;
-    cvc5assumps.reserve(assumptions.size());
-
-    std::shared_ptr<Cvc5Term> cterm;
-    for (auto a : assumptions)
-    {
-      cvc5assumps.push_back(std::static_pointer_cast<Cvc5Term>(a)->term);
-    }
-    return check_sat_assuming(cvc5assumps);
+    fill_assumption_buffer(assumptions.begin(), assumptions.end());
+    return check_sat_assuming(assumption_buffer_);
   }
   catch (::cvc5::CVC5ApiException & e)
   {
@@ -326,17 +316,11 @@ Result Cvc5Solver::check_sat_assuming_list(const TermList & assumptions)
 
 Result Cvc5Solver::check_sat_assuming_set(const UnorderedTermSet & assumptions)
 {
+  SMT_TRACE_SPAN("Cvc5Solver::check_sat_assuming_set", "backend");
   try
   {
-    std::vector<::cvc5::Term> cvc5assumps;
-    cvc5assumps.reserve(assumptions.size());
-
-    std::shared_ptr<Cvc5Term> cterm;
-    for (auto a : assumptions)
-    {
-      cvc5assumps.push_back(std::static_pointer_cast<Cvc5Term>(a)->term);
-    }
-    return check_sat_assuming(cvc5assumps);
+    fill_assumption_buffer(assumptions.begin(), assumptions.end());
+    return check_sat_assuming(assumption_buffer_);
   }
   catch (::cvc5::CVC5ApiException & e)
   {
@@ -346,6 +330,7 @@ Result Cvc5Solver::check_sat_assuming_set(const UnorderedTermSet & assumptions)
 
 void Cvc5Solver::push(uint64_t num)
 {
+  SMT_TRACE_SPAN("Cvc5Solver::push", "backend");
   try
   {
     solver.push(num);
@@ -359,6 +344,7 @@ void Cvc5Solver::push(uint64_t num)
 
 void Cvc5Solver::pop(uint64_t num)
 {
+  SMT_TRACE_SPAN("Cvc5Solver::pop", "backend");
   try
   {
     solver.pop(num);
@@ -374,6 +360,7 @@ uint64_t Cvc5Solver::get_context_level() const { return context_level; }
 
 Term Cvc5Solver::get_value(const Term & t) const
 {
+  SMT_TRACE_SPAN("Cvc5Solver::get_value", "backend");
   try
   {
     std::shared_ptr<Cvc5Term> cterm = std::static_pointer_cast<Cvc5Term>(t);
@@ -841,6 +828,21 @@ Term Cvc5Solver::get_selector(const Sort & s,
   }
 };
 
+Sort Cvc5Solver::make_unresolved_sort(const DatatypeDecl & decl) const
+{
+  try
+  {
+    std::shared_ptr<Cvc5DatatypeDecl> cd =
+        std::static_pointer_cast<Cvc5DatatypeDecl>(decl);
+    return std::make_shared<Cvc5Sort>(
+        solver.mkUnresolvedDatatypeSort(cd->datatypedecl.getName()));
+  }
+  catch (::cvc5::CVC5ApiException & e)
+  {
+    throw InternalSolverException(e.what());
+  }
+}
+
 SortVec Cvc5Solver::make_datatype_sorts(
     const std::vector<DatatypeDecl> & decls) const
 {
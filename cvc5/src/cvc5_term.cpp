@@ -307,6 +307,18 @@ uint64_t Cvc5Term::to_int() const
   }
 }
 
+void Cvc5Term::to_bv_words(std::vector<uint64_t> & out)
+{
+  if (!term.isBitVectorValue())
+  {
+    throw IncorrectUsageException(
+        "Can only convert bit-vector values to words, got " + to_string());
+  }
+  std::string bits = term.getBitVectorValue(2);
+  bits_to_words(
+      bits.data(), bits.size(), term.getSort().getBitVectorSize(), out);
+}
+
 /** Iterators for traversing the children
  */
 TermIter Cvc5Term::begin() { return TermIter(new Cvc5TermIter(term, 0)); }
@@ -0,0 +1,111 @@
+/*********************                                                        */
+/*! \file aiger_reader.h
+** \verbatim
+** Top contributors (to current version):
+**   agent
+** This file is part of the smt-switch project.
+** Copyright (c) 2026 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved.  See the file LICENSE in the top-level source
+** directory for licensing information.\endverbatim
+**
+** \brief Hand-written reader for the AIGER format (ASCII and binary).
+**
+**/
+
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "smt.h"
+
+namespace smt {
+
+/** \class AigerReader
+ *         Reads an AIGER 1.9 and-inverter graph in the ASCII (aag) or
+ *          binary (aig) format and builds boolean terms directly in a
+ *          solver. Inputs and latches become boolean symbols, named
+ *          from the symbol table if present.
+ *
+ *         The graph is first read into flat literal vectors indexed by
+ *          variable, and terms are created afterwards, so AND gates of
+ *          an ASCII file need not be in topological order.
+ *
+ *         Example:
+ *            AigerReader r(solver);
+ *            r.parse("model.aig");
+ *            // HWMCC convention: outputs are bad if there is no bad section
+ *            TermVec props = r.bad().empty() ? r.outputs() : r.bad();
+ */
+class AigerReader
+{
+ public:
+  AigerReader(const SmtSolver & solver);
+
+  /** Parse an AIGER file (memory-mapped)
+   *  Throws SmtException on malformed input
+   */
+  void parse(const std::string & filename);
+
+  /** Parse AIGER contents from a string */
+  void parse_string(const std::string & input);
+
+  /** Parse AIGER contents in [begin, end) */
+  void parse_buffer(const char * begin, const char * end);
+
+  /** @return the term for an AIGER literal */
+  Term literal(uint64_t lit) const;
+
+  /** @return the input or latch with the given symbol,
+   *          or a null term if there is none
+   */
+  Term get_symbol(const std::string & name) const;
+
+  const TermVec & inputs() const { return inputs_; }
+  const TermVec & states() const { return states_; }
+  /** initial values of latches, uninitialized latches are omitted */
+  const UnorderedTermMap & init() const { return init_; }
+  const UnorderedTermMap & next() const { return next_; }
+  const TermVec & bad() const { return bad_; }
+  const TermVec & constraints() const { return constraints_; }
+  const TermVec & fairness() const { return fairness_; }
+  const std::vector<TermVec> & justice() const { return justice_; }
+  const TermVec & outputs() const { return outputs_; }
+
+ protected:
+  [[noreturn]] void error(const std::string & msg) const;
+
+  /** build the terms for all AND gates */
+  void build_ands();
+
+  SmtSolver solver_;
+  Sort boolsort_;
+
+  uint64_t max_var_;
+  /** the positive term for each variable, indexed by variable
+   *  (variable 0 is the constant false)
+   */
+  TermVec vars_;
+  /** negations of vars_, created on demand */
+  mutable TermVec neg_vars_;
+  /** the variables defined by AND gates, in file order */
+  std::vector<uint64_t> and_vars_;
+  /** AND gate inputs, indexed by variable */
+  std::vector<uint64_t> and_rhs0_;
+  std::vector<uint64_t> and_rhs1_;
+  std::unordered_map<std::string, Term> symbols_;
+
+  TermVec inputs_;
+  TermVec states_;
+  UnorderedTermMap init_;
+  UnorderedTermMap next_;
+  TermVec bad_;
+  TermVec constraints_;
+  TermVec fairness_;
+  std::vector<TermVec> justice_;
+  TermVec outputs_;
+};
+
+}  // namespace smt
@@ -0,0 +1,290 @@
+/*********************                                                        */
+/*! \file auto_solver.h
+** \verbatim
+** Top contributors (to current version):
+**   agent
+** This file is part of the smt-switch project.
+** Copyright (c) 2026 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved.  See the file LICENSE in the top-level source
+** directory for licensing information.\endverbatim
+**
+** \brief Class that picks a backend from the features of the asserted
+**        formulas.
+**/
+
+#pragma once
+
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "solver.h"
+#include "term_stats.h"
+#include "term_translator.h"
+
+namespace smt {
+
+/** A row of a BackendSelector table
+ *  A rule matches a set of formulas if all of its conditions hold.
+ */
+struct SelectionRule
+{
+  /** an SMT-LIB logic as computed by TermStats::logic, a prefix ending in
+   *  '*' (e.g. QF_* ) or just "*" for any logic
+   */
+  std::string logic = "*";
+  size_t min_dag_size = 0;
+  size_t max_dag_size = 0;    ///< 0 for unbounded
+  uint64_t max_bv_width = 0;  ///< 0 for unbounded
+  SolverEnum backend = Z3;
+};
+
+/** One run of a backend on a benchmark, used by BackendSelector::fit */
+struct TimingRecord
+{
+  std::string benchmark;  ///< identifies the instance, e.g. a file name
+  std::string logic;
+  size_t dag_size;
+  uint64_t max_bv_width;
+  SolverEnum backend;
+  double seconds;
+  bool solved;  ///< false if the run timed out or returned unknown
+};
+
+/** \class BackendSelector
+ *         Picks a backend for a set of formulas from a table of rules.
+ *
+ *         The rules are tried in order. The first rule that matches the
+ *          formulas and names a candidate backend that supports all the
+ *          theories used wins. The default table encodes the usual
+ *          wisdom (bit-vector solvers for bit-vectors, yices2 and mathsat
+ *          for linear arithmetic, z3 and cvc5 for the rest).
+ *
+ *         fit() learns a table from timing logs: for every logic and
+ *          DAG size decade, the backend with the best PAR-2 score
+ *          (unsolved runs count twice the timeout). The table can be
+ *          saved and loaded as text, one rule per line:
+ *            <logic> <min dag size> <max dag size> <max bv width> <backend>
+ */
+class BackendSelector
+{
+ public:
+  /** Creates a selector with the default rule table */
+  BackendSelector();
+
+  /** Remove all rules */
+  void clear() { rules_.clear(); }
+
+  /** Append a rule (it has lower priority than the existing rules) */
+  void add_rule(const SelectionRule & rule) { rules_.push_back(rule); }
+
+  const std::vector<SelectionRule> & get_rules() const { return rules_; }
+
+  /** Pick a backend
+   *  @param stats the features of the formulas
+   *  @param candidates the backends that can be created
+   *  @return the chosen backend. If no rule applies, the first candidate
+   *          that supports the theories
+   *  throws IncorrectUsageException if no candidate supports the theories
+   */
+  SolverEnum select(const TermStats & stats,
+                    const std::vector<SolverEnum> & candidates) const;
+
+  /** Learn rules from timing logs
+   *  The learned rules take priority over the current ones. Call clear()
+   *  first to only use the learned rules.
+   *  @param records the runs, every backend should be run on every
+   *         benchmark (backends with fewer runs in a group are ignored)
+   *  @param timeout the time limit of the runs in seconds
+   */
+  void fit(const std::vector<TimingRecord> & records, double timeout);
+
+  /** Write the rule table */
+  void save(std::ostream & os) const;
+
+  /** Replace the rule table by one written with save
+   *  throws IncorrectUsageException on a malformed table
+   */
+  void load(std::istream & is);
+
+  /** @return true iff the backend supports the theories used in stats */
+  static bool supports(SolverEnum se, const TermStats & stats);
+
+  /** @return the attributes (theories, quantifiers) required by stats
+   *  that the backend doesn't have
+   */
+  static std::vector<SolverAttribute> missing_theories(
+      SolverEnum se, const TermStats & stats);
+
+ protected:
+  bool matches(const SelectionRule & rule, const TermStats & stats) const;
+
+  std::vector<SelectionRule> rules_;
+};
+
+/** Creates a fresh backend solver, e.g. with one of the factories */
+using BackendFactory = std::function<SmtSolver(SolverEnum)>;
+
+/**
+ * A class that builds terms in a front solver and decides them with a
+ * backend picked from the features of the asserted formulas.
+ *
+ * The backend is picked by a BackendSelector at the first check_sat and
+ * is kept for the lifetime of the solver (or until reset), so later
+ * queries are incremental. The assertions are replayed on the backend
+ * with a TermTranslator, unless the backend is of the same kind as the
+ * front solver, in which case the front solver is used directly.
+ * Models and unsat assumptions are translated back to the front solver.
+ *
+ * The front solver must support term iteration (e.g. a logging solver)
+ * and term transfer. It should be cheap, since it only builds terms.
+ */
+class AutoSolver : public AbsSmtSolver
+{
+ public:
+  /** @param front the solver that builds the terms
+   *  @param candidates the backends to choose from
+   *  @param make_backend creates a solver for a candidate
+   *  @param selector the selection rules
+   */
+  AutoSolver(SmtSolver front,
+             const std::vector<SolverEnum> & candidates,
+             BackendFactory make_backend,
+             const BackendSelector & selector = BackendSelector());
+  ~AutoSolver();
+
+  /** @return true iff the backend was picked */
+  bool has_backend() const { return backend_ != nullptr; }
+
+  /** @return the backend kind, throws IncorrectUsageException if it was
+   *          not picked yet
+   */
+  SolverEnum get_backend_enum() const;
+
+  /** @return the backend solver (null if it was not picked yet) */
+  SmtSolver get_backend() const { return backend_; }
+
+  /** @return the features of the current assertions (popped ones are
+   *          dropped), empty once the backend was picked
+   */
+  const TermStats & get_stats() const { return stats_; }
+
+  /* Operators that pick or use the backend */
+  void set_opt(const std::string option, const std::string value) override;
+  void set_logic(const std::string logic) override;
+  void assert_formula(const Term & t) override;
+  Result check_sat() override;
+  Result check_sat_assuming(const TermVec & assumptions) override;
+  void push(uint64_t num = 1) override;
+  void pop(uint64_t num = 1) override;
+  uint64_t get_context_level() const override;
+  Term get_value(const Term & t) const override;
+  void get_bv_value(const Term & t, std::vector<uint64_t> & out) const override;
+  UnorderedTermMap get_array_values(const Term & arr,
+                                    Term & out_const_base) const override;
+  void get_unsat_assumptions(UnorderedTermSet & out) override;
+  void reset() override;
+  void reset_assertions() override;
+  MemoryStats get_memory_stats() const override;
+
+  /* Operators that are dispatched to the front solver */
+  Sort make_sort(const std::string name, uint64_t arity) const override;
+  Sort make_sort(const SortKind sk) const override;
+  Sort make_sort(const SortKind sk, uint64_t size) const override;
+  Sort make_sort(const SortKind sk, const Sort & sort1) const override;
+  Sort make_sort(const SortKind sk,
+                 const Sort & sort1,
+                 const Sort & sort2) const override;
+  Sort make_sort(const SortKind sk,
+                 const Sort & sort1,
+                 const Sort & sort2,
+                 const Sort & sort3) const override;
+  Sort make_sort(const SortKind sk, const SortVec & sorts) const override;
+  Sort make_sort(const Sort & sort_con, const SortVec & sorts) const override;
+  Sort make_sort(const DatatypeDecl & d) const override;
+  Sort make_unresolved_sort(const DatatypeDecl & decl) const override;
+  SortVec make_datatype_sorts(
+      const std::vector<DatatypeDecl> & decls) const override;
+  DatatypeDecl make_datatype_decl(const std::string & s) override;
+  DatatypeConstructorDecl make_datatype_constructor_decl(
+      const std::string s) override;
+  void add_constructor(DatatypeDecl & dt,
+                       const DatatypeConstructorDecl & con) const override;
+  void add_selector(DatatypeConstructorDecl & dt,
+                    const std::string & name,
+                    const Sort & s) const override;
+  void add_selector_self(DatatypeConstructorDecl & dt,
+                         const std::string & name) const override;
+  Term get_constructor(const Sort & s, std::string name) const override;
+  Term get_tester(const Sort & s, std::string name) const override;
+  Term get_selector(const Sort & s,
+                    std::string con,
+                    std::string name) const override;
+  Term make_term(bool b) const override;
+  Term make_term(int64_t i, const Sort & sort) const override;
+  Term make_term(const std::string val,
+                 const Sort & sort,
+                 uint64_t base = 10) const override;
+  Term make_term(const Term & val, const Sort & sort) const override;
+  Term make_symbol(const std::string name, const Sort & sort) override;
+  Term get_symbol(const std::string & name) override;
+  Term make_param(const std::string name, const Sort & sort) override;
+  Term make_term(const Op op, const Term & t) const override;
+  Term make_term(const Op op, const Term & t0, const Term & t1) const override;
+  Term make_term(const Op op,
+                 const Term & t0,
+                 const Term & t1,
+                 const Term & t2) const override;
+  Term make_term(const Op op, const TermVec & terms) const override;
+  Term substitute(const Term term,
+                  const UnorderedTermMap & substitution_map) const override;
+  TermVec substitute_terms(
+      const TermVec & terms,
+      const UnorderedTermMap & substitution_map) const override;
+
+ protected:
+  /** picks and initializes the backend if needed */
+  void pick_backend();
+
+  /** @return t as a term of the backend */
+  Term to_backend(const Term & t) const;
+
+  /** @return a backend term as a term of the front solver */
+  Term to_front(const Term & t) const;
+
+  SmtSolver front_;
+  std::vector<SolverEnum> candidates_;
+  BackendFactory make_backend_;
+  BackendSelector selector_;
+
+  SmtSolver backend_;
+  // null if the backend is the front solver
+  std::unique_ptr<TermTranslator> to_backend_;
+  std::unique_ptr<TermTranslator> to_front_;
+
+  // replayed on the backend when it is picked
+  std::vector<std::pair<std::string, std::string>> options_;
+  std::string logic_;
+  // the assertions of every context level, before the backend is picked
+  std::vector<TermVec> assertions_;
+
+  TermStats stats_;
+
+  // backend assumption -> assumption of the last check_sat_assuming
+  UnorderedTermMap assumption_map_;
+};
+
+/* Returns an SmtSolver that picks its backend automatically by wrapping
+ * AutoSolver's constructor.
+ */
+SmtSolver create_auto_solver(SmtSolver front,
+                             const std::vector<SolverEnum> & candidates,
+                             BackendFactory make_backend,
+                             const BackendSelector & selector =
+                                 BackendSelector());
+
+}  // namespace smt
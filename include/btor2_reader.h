@@ -0,0 +1,121 @@
+/*********************                                                        */
+/*! \file btor2_reader.h
+** \verbatim
+** Top contributors (to current version):
+**   agent
+** This file is part of the smt-switch project.
+** Copyright (c) 2026 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved.  See the file LICENSE in the top-level source
+** directory for licensing information.\endverbatim
+**
+** \brief Hand-written streaming reader for the BTOR2 format.
+**
+**/
+
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "smt.h"
+
+namespace smt {
+
+/** \class Btor2Reader
+ *         Reads a BTOR2 model and builds its terms directly in a solver.
+ *
+ *         Bit-vectors of width one are kept as bit-vector terms, as in
+ *          BTOR2. Properties (bad, constraint, fair, justice) are
+ *          converted to booleans.
+ *
+ *         Nodes are stored in vectors indexed by their line id, and
+ *          lines are tokenized in place (in the memory-mapped file), so
+ *          only symbol names and constant values allocate strings.
+ *
+ *         Example:
+ *            Btor2Reader r(solver);
+ *            r.parse("model.btor2");
+ *            for (const auto & b : r.bad()) { ... }
+ */
+class Btor2Reader
+{
+ public:
+  Btor2Reader(const SmtSolver & solver);
+
+  /** Parse a BTOR2 file (memory-mapped)
+   *  Throws SmtException on malformed input
+   */
+  void parse(const std::string & filename);
+
+  /** Parse BTOR2 text from a string */
+  void parse_string(const std::string & input);
+
+  /** Parse BTOR2 text in [begin, end) */
+  void parse_buffer(const char * begin, const char * end);
+
+  /** @return the term for node id, or a null term if there is none */
+  Term lookup(uint64_t id) const
+  {
+    return id < nodes_.size() ? nodes_[id] : Term();
+  }
+
+  /** @return the input or state with the given symbol,
+   *          or a null term if there is none
+   */
+  Term get_symbol(const std::string & name) const;
+
+  const TermVec & inputs() const { return inputs_; }
+  const TermVec & states() const { return states_; }
+  const UnorderedTermMap & init() const { return init_; }
+  const UnorderedTermMap & next() const { return next_; }
+  const TermVec & bad() const { return bad_; }
+  const TermVec & constraints() const { return constraints_; }
+  const TermVec & fairness() const { return fairness_; }
+  const std::vector<TermVec> & justice() const { return justice_; }
+  const TermVec & outputs() const { return outputs_; }
+
+ protected:
+  /** parse one line starting at p, return the position after it */
+  const char * parse_line(const char * p, const char * end);
+
+  /** throws an SmtException for the current line */
+  [[noreturn]] void error(const std::string & msg) const;
+
+  /** @return the term for a (possibly negated) argument id */
+  Term arg(int64_t id);
+
+  Sort get_sort(uint64_t sid) const;
+
+  void set_node(uint64_t id, const Term & t);
+
+  /** Convert between booleans and bit-vectors of width one */
+  Term bool_to_bv(const Term & t);
+  Term bv_to_bool(const Term & t);
+
+  SmtSolver solver_;
+  Sort bv1sort_;
+  Term bv1one_;
+  Term bv1zero_;
+
+  std::vector<Sort> sorts_;  ///< indexed by sort id
+  std::vector<Term> nodes_;  ///< indexed by node id
+  /** boolean versions of width one bit-vectors created from booleans */
+  UnorderedTermMap bool_of_;
+  std::unordered_map<std::string, Term> symbols_;
+
+  uint64_t line_num_;
+
+  TermVec inputs_;
+  TermVec states_;
+  UnorderedTermMap init_;
+  UnorderedTermMap next_;
+  TermVec bad_;
+  TermVec constraints_;
+  TermVec fairness_;
+  std::vector<TermVec> justice_;
+  TermVec outputs_;
+};
+
+}  // namespace smt
@@ -0,0 +1,298 @@
+/*********************                                                        */
+/*! \file caching_solver.h
+** \verbatim
+** Top contributors (to current version):
+**   agent
+** This file is part of the smt-switch project.
+** Copyright (c) 2026 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved.  See the file LICENSE in the top-level source
+** directory for licensing information.\endverbatim
+**
+** \brief Class that wraps another SmtSolver and memoizes the results
+**        of satisfiability queries.
+**/
+
+#pragma once
+
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "solver.h"
+
+namespace smt {
+
+/** Identifies a satisfiability query independently of term ids
+ *  first: order-independent combination of the asserted formulas
+ *  second: order-independent combination of the assumptions
+ */
+using QueryKey = std::pair<uint64_t, uint64_t>;
+
+struct QueryKeyHash
+{
+  size_t operator()(const QueryKey & k) const
+  {
+    return k.first ^ (k.second + 0x9e3779b97f4a7c15ULL + (k.first << 6)
+                      + (k.first >> 2));
+  }
+};
+
+/**
+ * A class that wraps an SMT-solver and answers repeated check_sat and
+ * check_sat_assuming queries from a cache.
+ *
+ * Queries are identified by a structural hash of the current assertion
+ * stack and the assumptions. Because the hash only depends on symbol
+ * names, sorts, values and operators, the same query built in a fresh
+ * solver (or in a later run) maps to the same key.
+ *
+ * The key is only used to find a candidate entry. A hit also requires the
+ * (sorted) structural hashes of the asserted formulas and assumptions to
+ * match the ones stored in the entry, so different queries whose keys
+ * collide are not confused.
+ *
+ * Only sat and unsat results are cached. The first get_value after a sat
+ * result records the values of all symbolic constants of the query in
+ * the entry. For a cached result:
+ *  - if the entry has the values of all symbols of the query, get_value
+ *    of a symbol is answered from the cache, and other terms are
+ *    evaluated with the symbols replaced by their cached values (this
+ *    re-runs the query on the wrapped solver once)
+ *  - otherwise the first get_value re-runs the query, and all values come
+ *    from the new model, which replaces the cached one. Values of two
+ *    different models are never mixed.
+ *  - get_unsat_assumptions is answered from the cache if it was requested
+ *    when the result was first computed, otherwise the query is re-run
+ *
+ * If a cache file is given, the cache is loaded from it on construction
+ * and written back by flush() and on destruction.
+ */
+class CachingSolver : public AbsSmtSolver
+{
+ public:
+  /** Create a CachingSolver
+   *  @param s the solver to wrap
+   *  @param capacity the maximum number of cached queries (LRU eviction)
+   *  @param cache_file a file to load / save the cache, empty for none
+   *  @param hash_capacity the maximum number of memoized structural hashes,
+   *         the memo is cleared when it is reached
+   */
+  CachingSolver(SmtSolver s,
+                size_t capacity = 1024,
+                const std::string & cache_file = "",
+                size_t hash_capacity = 1 << 20);
+  ~CachingSolver();
+
+  /* Operators that use or update the cache */
+  void assert_formula(const Term & t) override;
+  Result check_sat() override;
+  Result check_sat_assuming(const TermVec & assumptions) override;
+  Result check_sat_assuming_list(const TermList & assumptions) override;
+  Result check_sat_assuming_set(const UnorderedTermSet & assumptions) override;
+  void push(uint64_t num = 1) override;
+  void pop(uint64_t num = 1) override;
+  void reset() override;
+  void reset_assertions() override;
+  MemoryStats get_memory_stats() const override;
+  Term get_value(const Term & t) const override;
+  UnorderedTermMap get_array_values(const Term & arr,
+                                    Term & out_const_base) const override;
+  void get_unsat_assumptions(UnorderedTermSet & out) override;
+
+  /* Operators that are dispatched to the wrapped solver */
+  uint64_t get_context_level() const override;
+  void set_opt(const std::string option, const std::string value) override;
+  void set_logic(const std::string logic) override;
+  Sort make_sort(const std::string name, uint64_t arity) const override;
+  Sort make_sort(const SortKind sk) const override;
+  Sort make_sort(const SortKind sk, uint64_t size) const override;
+  Sort make_sort(const SortKind sk, const Sort & sort1) const override;
+  Sort make_sort(const SortKind sk,
+                 const Sort & sort1,
+                 const Sort & sort2) const override;
+  Sort make_sort(const SortKind sk,
+                 const Sort & sort1,
+                 const Sort & sort2,
+                 const Sort & sort3) const override;
+  Sort make_sort(const SortKind sk, const SortVec & sorts) const override;
+  Sort make_sort(const Sort & sort_con, const SortVec & sorts) const override;
+  Sort make_sort(const DatatypeDecl & d) const override;
+  Sort make_unresolved_sort(const DatatypeDecl & decl) const override;
+  SortVec make_datatype_sorts(
+      const std::vector<DatatypeDecl> & decls) const override;
+  DatatypeDecl make_datatype_decl(const std::string & s) override;
+  DatatypeConstructorDecl make_datatype_constructor_decl(
+      const std::string s) override;
+  void add_constructor(DatatypeDecl & dt,
+                       const DatatypeConstructorDecl & con) const override;
+  void add_selector(DatatypeConstructorDecl & dt,
+                    const std::string & name,
+                    const Sort & s) const override;
+  void add_selector_self(DatatypeConstructorDecl & dt,
+                         const std::string & name) const override;
+  Term get_constructor(const Sort & s, std::string name) const override;
+  Term get_tester(const Sort & s, std::string name) const override;
+  Term get_selector(const Sort & s,
+                    std::string con,
+                    std::string name) const override;
+  Term make_term(bool b) const override;
+  Term make_term(int64_t i, const Sort & sort) const override;
+  Term make_term(const std::string val,
+                 const Sort & sort,
+                 uint64_t base = 10) const override;
+  Term make_term(const Term & val, const Sort & sort) const override;
+  Term make_symbol(const std::string name, const Sort & sort) override;
+  Term get_symbol(const std::string & name) override;
+  Term make_param(const std::string name, const Sort & sort) override;
+  Term make_term(const Op op, const Term & t) const override;
+  Term make_term(const Op op, const Term & t0, const Term & t1) const override;
+  Term make_term(const Op op,
+                 const Term & t0,
+                 const Term & t1,
+                 const Term & t2) const override;
+  Term make_term(const Op op, const TermVec & terms) const override;
+  Term substitute(const Term term,
+                  const UnorderedTermMap & substitution_map) const override;
+  TermVec substitute_terms(
+      const TermVec & terms,
+      const UnorderedTermMap & substitution_map) const override;
+  Result get_interpolant(const Term & A,
+                         const Term & B,
+                         Term & out_I) const override;
+
+  /** Structural hash of a term
+   *  Depends only on the operators, symbol names, values and sorts,
+   *  not on the backend term ids. Memoized per term.
+   *  @param t the term to hash
+   *  @return a 64-bit hash
+   */
+  uint64_t structural_hash(const Term & t) const;
+
+  /** Write the cache to the cache file (if one was given) */
+  void flush() const;
+
+  /** @return the number of queries answered from the cache */
+  size_t num_hits() const { return hits_; }
+
+  /** @return the number of queries dispatched to the wrapped solver */
+  size_t num_misses() const { return misses_; }
+
+ protected:
+  /** A cached query result */
+  struct CacheEntry
+  {
+    Result result;
+    std::vector<uint64_t> assertions;   ///< sorted hashes of the assertions
+    std::vector<uint64_t> assumptions;  ///< sorted hashes of the assumptions
+    bool has_core = false;
+    std::vector<uint64_t> core;  ///< structural hashes of the core assumptions
+    UnorderedTermMap values;     ///< symbolic constant -> value
+    std::unordered_map<std::string, std::string>
+        value_strs;  ///< symbol name -> value, as read from the cache file
+  };
+  using CacheEntryPtr = std::shared_ptr<CacheEntry>;
+
+  /** runs a query, answering from the cache if possible */
+  Result cached_check(const TermVec & assumptions);
+
+  /** runs the last query on the wrapped solver if it was answered from
+   *  the cache, so that the wrapped solver has a model / core available.
+   */
+  void materialize() const;
+
+  /** @return the free symbols of the asserted formulas and of the last
+   *  assumptions
+   */
+  UnorderedTermSet query_symbols() const;
+
+  /** @return true iff the last entry has a (readable) value for every
+   *  symbol of the query, i.e. a whole model
+   */
+  bool cached_model_complete() const;
+
+  /** records the values of all symbolic constants of the query, from the
+   *  model of the wrapped solver, in the last entry
+   */
+  void record_model() const;
+
+  /** decides, once per query, where the values of a sat result come
+   *  from: the cache if it has a whole model, otherwise the wrapped
+   *  solver, whose model is then recorded
+   */
+  void prepare_values() const;
+
+  /** clears the state of the last query after an assertion-level change */
+  void invalidate_last_query();
+
+  /** looks up a key, updating the LRU order
+   *  @param key the key of the query
+   *  @param assertions the sorted hashes of the current assertions
+   *  @param assumptions the sorted hashes of the assumptions
+   *  @return the entry or nullptr, also if the entry is for a different
+   *          query with the same key
+   */
+  CacheEntryPtr lookup(const QueryKey & key,
+                       const std::vector<uint64_t> & assertions,
+                       const std::vector<uint64_t> & assumptions) const;
+
+  /** inserts an entry, evicting the least recently used one if needed */
+  void insert(const QueryKey & key, const CacheEntryPtr & entry) const;
+
+  /** value term for a symbol stored in the given entry, or nullptr */
+  Term cached_value(const CacheEntryPtr & entry, const Term & sym) const;
+
+  void load(const std::string & filename);
+
+  /* The wrapped solver */
+  SmtSolver wrapped_solver;
+
+  size_t capacity_;
+  std::string cache_file_;
+  size_t hash_capacity_;
+
+  /* per context level hashes of the assertions (level 0 is base) */
+  std::vector<std::vector<uint64_t>> assertion_hashes_;
+  /* per context level asserted formulas, for the symbols of a query */
+  std::vector<TermVec> assertion_terms_;
+
+  /* memoized structural hashes, at most hash_capacity_ */
+  mutable std::unordered_map<Term, uint64_t> hash_cache_;
+
+  /* LRU cache -- most recently used at the front */
+  mutable std::list<QueryKey> lru_;
+  mutable std::unordered_map<
+      QueryKey,
+      std::pair<CacheEntryPtr, std::list<QueryKey>::iterator>,
+      QueryKeyHash>
+      entries_;
+
+  /* state of the last query */
+  TermVec last_assumptions_;
+  mutable CacheEntryPtr last_entry_;
+  mutable bool last_from_cache_;
+  /* the wrapped solver has run the last query */
+  mutable bool last_solved_;
+  /* prepare_values was done for the last query */
+  mutable bool last_values_ready_;
+
+  size_t hits_;
+  size_t misses_;
+};
+
+/* Returns a caching SmtSolver by wrapping CachingSolver's constructor.
+ * @param wrapped_solver the solver to wrap
+ * @param capacity the maximum number of cached queries
+ * @param cache_file a file to load / save the cache, empty for none
+ * @param hash_capacity the maximum number of memoized structural hashes
+ * @return an SmtSolver that answers repeated queries from a cache
+ */
+SmtSolver create_caching_solver(SmtSolver wrapped_solver,
+                                size_t capacity = 1024,
+                                const std::string & cache_file = "",
+                                size_t hash_capacity = 1 << 20);
+
+}  // namespace smt
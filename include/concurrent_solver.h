@@ -0,0 +1,174 @@
+/*********************                                                        */
+/*! \file concurrent_solver.h
+** \verbatim
+** Top contributors (to current version):
+**   agent
+** This file is part of the smt-switch project.
+** Copyright (c) 2026 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved.  See the file LICENSE in the top-level source
+** directory for licensing information.\endverbatim
+**
+** \brief Class that wraps another SmtSolver so that it can be shared
+**        between threads.
+**/
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "solver.h"
+
+namespace smt {
+
+/**
+ * A class that wraps an SMT-solver so that one instance can be used from
+ * several threads, e.g. to build different parts of a large formula.
+ *
+ * Thread-safety contract of smt-switch:
+ *  - no solver instance (including the wrappers) may be used from several
+ *    threads at the same time, unless it is wrapped in a ConcurrentSolver
+ *  - separate instances may be used from different threads at the same
+ *    time iff the backend has the CONCURRENT_INSTANCES attribute
+ *
+ * Every call is serialized on one lock. Terms, sorts and datatype
+ * declarations returned by this solver release their backend handles
+ * while holding the lock, so they can be copied and dropped on any
+ * thread. Calls on the objects themselves (e.g. to_string, get_sort or
+ * iterating over the children) still go to the backend directly and must
+ * be done in a batch if other threads may be using the solver.
+ *
+ * Wrap the other wrappers (e.g. a LoggingSolver), not the other way
+ * around, so that their bookkeeping is also serialized.
+ */
+class ConcurrentSolver : public AbsSmtSolver
+{
+ public:
+  ConcurrentSolver(SmtSolver s);
+  ~ConcurrentSolver();
+
+  /** Run several commands while holding the lock
+   *  Other threads are blocked until f returns. f may call this solver
+   *  (the lock is reentrant) and may use the returned objects freely.
+   *  Batching is cheaper than taking the lock once per command and
+   *  keeps the commands together, e.g. for push / assert / check_sat.
+   *  @param f the commands to run
+   *  @return the result of f
+   */
+  template <class F>
+  auto batch(F && f) const -> decltype(f())
+  {
+    std::lock_guard<std::recursive_mutex> lock(*mutex_);
+    return f();
+  }
+
+  /* Serialized operators */
+  void set_opt(const std::string option, const std::string value) override;
+  void set_logic(const std::string logic) override;
+  void assert_formula(const Term & t) override;
+  Result check_sat() override;
+  Result check_sat_assuming(const TermVec & assumptions) override;
+  Result check_sat_assuming_list(const TermList & assumptions) override;
+  Result check_sat_assuming_set(const UnorderedTermSet & assumptions) override;
+  void push(uint64_t num = 1) override;
+  void pop(uint64_t num = 1) override;
+  uint64_t get_context_level() const override;
+  Term get_value(const Term & t) const override;
+  void get_bv_value(const Term & t, std::vector<uint64_t> & out) const override;
+  UnorderedTermMap get_array_values(const Term & arr,
+                                    Term & out_const_base) const override;
+  void get_unsat_assumptions(UnorderedTermSet & out) override;
+  Sort make_sort(const std::string name, uint64_t arity) const override;
+  Sort make_sort(const SortKind sk) const override;
+  Sort make_sort(const SortKind sk, uint64_t size) const override;
+  Sort make_sort(const SortKind sk, const Sort & sort1) const override;
+  Sort make_sort(const SortKind sk,
+                 const Sort & sort1,
+                 const Sort & sort2) const override;
+  Sort make_sort(const SortKind sk,
+                 const Sort & sort1,
+                 const Sort & sort2,
+                 const Sort & sort3) const override;
+  Sort make_sort(const SortKind sk, const SortVec & sorts) const override;
+  Sort make_sort(const Sort & sort_con, const SortVec & sorts) const override;
+  Sort make_sort(const DatatypeDecl & d) const override;
+  Sort make_unresolved_sort(const DatatypeDecl & decl) const override;
+  SortVec make_datatype_sorts(
+      const std::vector<DatatypeDecl> & decls) const override;
+  DatatypeDecl make_datatype_decl(const std::string & s) override;
+  DatatypeConstructorDecl make_datatype_constructor_decl(
+      const std::string s) override;
+  void add_constructor(DatatypeDecl & dt,
+                       const DatatypeConstructorDecl & con) const override;
+  void add_selector(DatatypeConstructorDecl & dt,
+                    const std::string & name,
+                    const Sort & s) const override;
+  void add_selector_self(DatatypeConstructorDecl & dt,
+                         const std::string & name) const override;
+  Term get_constructor(const Sort & s, std::string name) const override;
+  Term get_tester(const Sort & s, std::string name) const override;
+  Term get_selector(const Sort & s,
+                    std::string con,
+                    std::string name) const override;
+  Term make_term(bool b) const override;
+  Term make_term(int64_t i, const Sort & sort) const override;
+  Term make_term(const std::string val,
+                 const Sort & sort,
+                 uint64_t base = 10) const override;
+  Term make_term(const Term & val, const Sort & sort) const override;
+  Term make_symbol(const std::string name, const Sort & sort) override;
+  Term get_symbol(const std::string & name) override;
+  Term make_param(const std::string name, const Sort & sort) override;
+  Term make_term(const Op op, const Term & t) const override;
+  Term make_term(const Op op, const Term & t0, const Term & t1) const override;
+  Term make_term(const Op op,
+                 const Term & t0,
+                 const Term & t1,
+                 const Term & t2) const override;
+  Term make_term(const Op op, const TermVec & terms) const override;
+  void reset() override;
+  void reset_assertions() override;
+  MemoryStats get_memory_stats() const override;
+  Term substitute(const Term term,
+                  const UnorderedTermMap & substitution_map) const override;
+  TermVec substitute_terms(
+      const TermVec & terms,
+      const UnorderedTermMap & substitution_map) const override;
+  void dump_smt2(std::string filename) const override;
+  Result get_interpolant(const Term & A,
+                         const Term & B,
+                         Term & out_I) const override;
+  Result get_sequence_interpolants(const TermVec & formulae,
+                                   TermVec & out_I) const override;
+
+ protected:
+  /* The wrapped solver */
+  SmtSolver wrapped_solver;
+
+  // shared with the returned objects, which may outlive this solver
+  std::shared_ptr<std::recursive_mutex> mutex_;
+
+  /** Give an object returned by the wrapped solver a handle that
+   *  releases it while holding the lock
+   *  @param p the object, may be null
+   *  @return a handle to the same object
+   */
+  template <class T>
+  std::shared_ptr<T> guard(const std::shared_ptr<T> & p) const;
+
+  /* guards every element of a returned container */
+  TermVec guard_all(const TermVec & terms) const;
+  UnorderedTermMap guard_all(const UnorderedTermMap & m) const;
+};
+
+/* Returns a thread-safe SmtSolver by wrapping ConcurrentSolver's
+ * constructor.
+ * @param wrapped_solver the solver to wrap
+ * @return an SmtSolver that can be used from several threads
+ */
+SmtSolver create_concurrent_solver(SmtSolver wrapped_solver);
+
+}  // namespace smt
@@ -0,0 +1,163 @@
+/*********************                                                        */
+/*! \file cube_and_conquer.h
+** \verbatim
+** Top contributors (to current version):
+**   agent
+** This file is part of the smt-switch project.
+** Copyright (c) 2026 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved.  See the file LICENSE in the top-level source
+** directory for licensing information.\endverbatim
+**
+** \brief Parallel cube-and-conquer driver over a pool of solvers.
+**
+**/
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <iostream>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "smt.h"
+
+namespace smt {
+
+/** Heuristics for picking the next split literal of a cube */
+enum CubeHeuristic
+{
+  // split in the order the split variables were given
+  CUBE_STATIC = 0,
+  // prefer variables that occur most often in the formula
+  CUBE_OCCURRENCE,
+  // prefer variables that appeared in the most unsat cores so far
+  // (ties broken by occurrence)
+  CUBE_CORE_ACTIVITY
+};
+
+/** Statistics for a cube-and-conquer run */
+struct CubeStats
+{
+  size_t cubes_generated = 0;  ///< cubes created by splitting (incl. root)
+  size_t cubes_solved = 0;     ///< cubes sent to check_sat_assuming
+  size_t cubes_pruned = 0;     ///< cubes skipped because a core subsumed them
+  size_t cubes_unknown = 0;    ///< cubes the backend could not decide
+  size_t steals = 0;           ///< cubes taken from another worker's queue
+  std::vector<size_t> solved_per_worker;
+  double seconds = 0;  ///< wall-clock time of solve()
+};
+
+/** \class CubeAndConquer
+ *         Decides a formula by splitting it into cubes (conjunctions of
+ *          split literals) and solving the cubes on a pool of worker
+ *          solvers with check_sat_assuming, one thread per worker.
+ *
+ *         Cubes are split lazily up to a maximum depth by the worker
+ *          that picks them up, and pushed on that worker's queue.
+ *          Idle workers steal the shallowest cube of another worker.
+ *         When a cube is unsat, the unsat assumptions reported by the
+ *          backend are recorded as a core. Any queued cube that
+ *          contains a core (in particular, siblings that share the
+ *          responsible literals) is pruned without solving.
+ *
+ *         Split variables can be boolean terms or bit-vector terms;
+ *          a bit-vector of width w contributes one split literal per bit.
+ *
+ *         Like PortfolioSolver, the formula is translated to every
+ *          worker with a TermTranslator, so the workers must be fresh
+ *          solvers that support term transfer and unsat assumptions.
+ */
+class CubeAndConquer
+{
+ public:
+  /** @param workers the worker solvers, one thread each
+   *  @param formula the boolean formula to decide
+   *  @param split_vars boolean or bit-vector terms from the formula's
+   *         solver to split on. If empty, all free boolean symbolic
+   *         constants of the formula are used.
+   */
+  CubeAndConquer(std::vector<SmtSolver> workers,
+                 const Term & formula,
+                 const TermVec & split_vars = {});
+
+  /** Set the maximum number of literals in a cube (default 8) */
+  void set_max_depth(size_t depth) { max_depth_ = depth; }
+
+  /** Set the split heuristic (default CUBE_CORE_ACTIVITY) */
+  void set_heuristic(CubeHeuristic h) { heuristic_ = h; }
+
+  /** Decide the formula
+   *  Workers still solving a cube when the result is known finish
+   *  that cube before solve returns (there is no way to interrupt them).
+   *  @return sat if some cube is sat, unsat if every cube is unsat,
+   *          unknown otherwise
+   */
+  Result solve();
+
+  /** After a sat result, the index of the worker that found the model
+   *  The model can be queried from that worker's solver directly.
+   */
+  size_t get_sat_worker() const { return sat_worker_; }
+
+  /** After a sat result, the satisfiable cube as terms of the sat worker */
+  TermVec get_sat_cube() const;
+
+  const CubeStats & get_stats() const { return stats_; }
+
+  /** Print a progress / throughput report */
+  void print_report(std::ostream & os) const;
+
+ protected:
+  /** A literal is encoded as 2 * split index + (negated ? 1 : 0) */
+  using Lit = size_t;
+  /** A cube is a sorted vector of literals */
+  using Cube = std::vector<Lit>;
+
+  struct Worker
+  {
+    SmtSolver solver;
+    TermVec lits;  ///< translated literals, indexed by Lit
+    UnorderedTermSet lit_set;
+    std::unordered_map<Term, Lit> lit_of;
+    std::deque<Cube> queue;
+  };
+
+  void run_worker(size_t idx);
+
+  /** picks a cube for worker idx, waiting if needed (called with lock held)
+   *  @return false if there is no more work
+   */
+  bool next_cube(size_t idx, std::unique_lock<std::mutex> & lk, Cube & out);
+
+  /** @return true iff a known core is a subset of c (lock held) */
+  bool subsumed(const Cube & c) const;
+
+  /** @return the split index to branch on for c, or num_splits_ if none */
+  size_t pick_split(const Cube & c) const;
+
+  std::vector<Worker> workers_;
+  size_t num_splits_;
+  std::vector<size_t> occurrences_;  ///< per split index
+  std::vector<size_t> activity_;     ///< per split index, from cores
+
+  size_t max_depth_;
+  CubeHeuristic heuristic_;
+
+  // shared state, guarded by m_
+  std::mutex m_;
+  std::condition_variable cv_;
+  std::vector<Cube> cores_;
+  size_t outstanding_;  ///< queued plus in-progress cubes
+  bool done_;
+  bool proven_unsat_;  ///< the empty cube was found unsat
+  bool any_unknown_;
+  bool found_sat_;
+  size_t sat_worker_;
+  Cube sat_cube_;
+  CubeStats stats_;
+};
+
+}  // namespace smt
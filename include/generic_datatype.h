@@ -40,7 +40,10 @@ class GenericDatatypeConstructorDecl : public AbsDatatypeConstructorDecl
   // Stores a new selector in the constructor object. newSelector: the
   // SelectorComponents to be added.
   void add_new_selector(const SelectorComponents & newSelector);
-  std::vector<SelectorComponents> get_selector_vector();
+  const std::vector<SelectorComponents> & get_selector_vector() const;
+  // Returns the position of the selector named sel_name in
+  // selector_vector, or -1 if there is no such selector.
+  int get_selector_index(const std::string & sel_name) const;
   std::string get_name() const;
   // Returns the size of selector_vector
   int get_selector_count() const;
@@ -49,6 +52,8 @@ class GenericDatatypeConstructorDecl : public AbsDatatypeConstructorDecl
 
  protected:
   std::vector<SelectorComponents> selector_vector;
+  // Maps selector names to their position in selector_vector
+  std::unordered_map<std::string, size_t> selector_index;
   std::string cons_name;
   DatatypeDecl dt_decl;
   // Setter for the dt_decl member. Only to be used when a constructor
@@ -69,10 +74,16 @@ class GenericDatatype : public AbsDatatype
   // (dt_cons_decl) if the constructor is associated with the datatype
   void add_selector(const DatatypeConstructorDecl & dt_cons_decl,
                     const SelectorComponents & newSelector);
-  std::vector<DatatypeConstructorDecl> get_cons_vector();
+  const std::vector<DatatypeConstructorDecl> & get_cons_vector() const;
   std::string get_name() const override;
   int get_num_constructors() const override;
   int get_num_selectors(std::string cons) const override;
+  // Returns the position of the constructor named cons in
+  // cons_decl_vector, or -1 if there is no such constructor.
+  int get_constructor_index(const std::string & cons) const;
+  // Returns the constructor at position index of cons_decl_vector
+  std::shared_ptr<GenericDatatypeConstructorDecl> get_cons_decl(
+      size_t index) const;
   // Updates the sort of any selector whose finalized field is
   // false. The not-finalized selectors have their sorts set to new_sort.
   // This function is used only as part of the process of adding a
@@ -81,11 +92,22 @@ class GenericDatatype : public AbsDatatype
   // called when the datatype's sort is created to replace the
   // self-selector's placeholder sort with the actual datatype sort.
   void change_sort_of_selector(const Sort new_sort);
+  // Replaces the sort of any selector that is a placeholder for another
+  // datatype of a mutually recursive family (an uninterpreted sort named
+  // after it, see GenericSolver::make_unresolved_sort) with the actual
+  // datatype sort in dt_sorts.
+  void resolve_selector_sorts(
+      const std::unordered_map<std::string, Sort> & dt_sorts);
   std::hash<std::string> str_hash;
 
  protected:
   DatatypeDecl dt_decl;
   std::vector<DatatypeConstructorDecl> cons_decl_vector;
+  // Maps constructor names to their position in cons_decl_vector.
+  // Together with the selector_index of each constructor, this makes
+  // looking up constructors, selectors and testers by name independent
+  // of the number of constructors.
+  std::unordered_map<std::string, size_t> cons_index;
 
   friend class GenericSolver;
 };
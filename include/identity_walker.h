@@ -67,6 +67,18 @@ public:
   */
  smt::Term visit(smt::Term & term);
 
+ /** Bound the size of the internal cache for long runs
+  *  If the cache holds more than limit entries at the start of a call to
+  *  visit, it is reset to the entries saved outside of visit (e.g. the
+  *  substitution map of a SubstitutionWalker). Nested calls to visit
+  *  (from visit_term) never trim. A user-provided cache is never trimmed.
+  *  @param limit the maximum number of entries, 0 (default) for unbounded
+  */
+ void set_cache_limit(size_t limit) { cache_limit_ = limit; };
+
+ /** @return the number of entries in the cache in use */
+ size_t cache_size() const;
+
 protected:
  /** Visit a single term.
   *  Implement this method in a derived class to change the behavior
@@ -106,6 +118,10 @@ private:
  smt::UnorderedTermMap cache_;       /**< cache for updating terms */
  smt::UnorderedTermMap * ext_cache_; /**< external (user-provided) cache. If
                                         non-null, used instead of cache_ */
+ size_t cache_limit_ = 0; /**< trim cache_ above this size, 0 for never */
+ bool in_visit_ = false;  /**< true while visit is running */
+ smt::UnorderedTermMap pinned_; /**< entries of cache_ saved outside of visit,
+                                   kept when trimming */
 };
 
 }
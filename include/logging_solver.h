@@ -19,6 +19,7 @@
 #include "solver.h"
 #include "term_hashtable.h"
 
+#include <mutex>
 #include <string>
 
 namespace smt {
@@ -44,6 +45,9 @@ class LoggingSolver : public AbsSmtSolver
   Sort make_sort(const SortKind sk, const SortVec & sorts) const override;
   Sort make_sort(const Sort & sort_con, const SortVec & sorts) const override;
   Sort make_sort(const DatatypeDecl & d) const override;
+  Sort make_unresolved_sort(const DatatypeDecl & decl) const override;
+  SortVec make_datatype_sorts(
+      const std::vector<DatatypeDecl> & decls) const override;
 
   DatatypeDecl make_datatype_decl(const std::string & s) override;
   DatatypeConstructorDecl make_datatype_constructor_decl(
@@ -72,6 +76,7 @@ class LoggingSolver : public AbsSmtSolver
                  const Term & t2) const override;
   Term make_term(const Op op, const TermVec & terms) const override;
   Term get_value(const Term & t) const override;
+  void get_bv_value(const Term & t, std::vector<uint64_t> & out) const override;
   UnorderedTermMap get_array_values(const Term & arr,
                                     Term & out_const_base) const override;
   void get_unsat_assumptions(UnorderedTermSet & out) override;
@@ -91,10 +96,13 @@ class LoggingSolver : public AbsSmtSolver
   void pop(uint64_t num = 1) override;
   uint64_t get_context_level() const override;
   void reset_assertions() override;
+  MemoryStats get_memory_stats() const override;
 
  protected:
   SmtSolver wrapped_solver;  ///< the underlying solver
-  std::unique_ptr<TermHashTable> hashtable;
+  // hash-consing table, holds weak references so that terms are freed
+  // when the last reference outside of the solver is dropped
+  std::unique_ptr<WeakTermHashTable> hashtable;
 
   std::unordered_map<std::string, Term> symbol_table;
 
@@ -109,6 +117,25 @@ class LoggingSolver : public AbsSmtSolver
   // this was better than making them non-const because most solvers
   // can respect the const-ness of those make_term functions
   mutable size_t next_term_id;  ///< used to give LoggingTerms a unique id
+
+  // protects hashtable, next_term_id and symbol_table so that terms can
+  // be created from several threads (e.g. over a ConcurrentSolver)
+  mutable std::mutex hashtable_mutex;
+
+  /** Hash-cons a newly created LoggingTerm
+   *  If an equal term exists, res is replaced by it, otherwise res is
+   *  inserted and given the next id (the id passed to the LoggingTerm
+   *  constructor is only a placeholder)
+   *  @param res the new term, modified in place
+   */
+  void hash_cons(Term & res) const;
+
+  // true iff t is in the hash table
+  bool in_hashtable(const Term & t) const;
+
+  // wraps a datatype constructor, selector or tester of the
+  // underlying solver
+  Term make_datatype_component(const Term & wrapped) const;
 };
 
 }  // namespace smt
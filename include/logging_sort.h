@@ -35,6 +35,10 @@ Sort make_logging_sort(SortKind sk, Sort s, Sort sort1);
 Sort make_logging_sort(SortKind sk, Sort s, Sort sort1, Sort sort2);
 Sort make_logging_sort(SortKind sk, Sort s, Sort sort1, Sort sort2, Sort sort3);
 Sort make_logging_sort(SortKind sk, Sort s, SortVec sorts);
+// builds the logging sort from the structure of the underlying sort s
+// used for sorts created by the underlying solver, e.g. the sorts of
+// datatype constructors
+Sort make_logging_sort_from(Sort s);
 
 /** \class LoggingSort
  *  An abstract class for logging created Sorts
@@ -183,4 +187,26 @@ class UninterpretedLoggingSort : public LoggingSort
   SortVec param_sorts;
 };
 
+class DatatypeLoggingSort : public LoggingSort
+{
+ public:
+  DatatypeLoggingSort(Sort s);
+  ~DatatypeLoggingSort();
+
+  typedef LoggingSort super;
+
+  // the datatype does not contain sorts, so it is not wrapped
+  Datatype get_datatype() const override;
+};
+
+/** Sorts of datatype constructors, selectors and testers */
+class DatatypeComponentLoggingSort : public FunctionLoggingSort
+{
+ public:
+  DatatypeComponentLoggingSort(SortKind sk, Sort s, SortVec sorts, Sort rsort);
+  ~DatatypeComponentLoggingSort();
+
+  typedef FunctionLoggingSort super;
+};
+
 }  // namespace smt
@@ -55,6 +55,7 @@ class LoggingTerm : public AbsTerm
   std::size_t hash() const override;
   bool is_value() const override;
   uint64_t to_int() const override;
+  void to_bv_words(std::vector<uint64_t> & out) override;
   std::string print_value_as(SortKind sk) override;
 
  protected:
@@ -0,0 +1,47 @@
+/*********************                                                        */
+/*! \file mapped_file.h
+** \verbatim
+** Top contributors (to current version):
+**   agent
+** This file is part of the smt-switch project.
+** Copyright (c) 2026 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved.  See the file LICENSE in the top-level source
+** directory for licensing information.\endverbatim
+**
+** \brief Read-only view of a file's contents, memory-mapped when possible.
+**
+**/
+
+#pragma once
+
+#include <string>
+
+namespace smt {
+
+/** \class MappedFile
+ *         Maps a file into memory read-only for the lifetime of the object.
+ *         Files that cannot be mapped (e.g. pipes) are read into a buffer
+ *          instead. The contents are NOT null-terminated.
+ *         Throws IncorrectUsageException if the file cannot be opened.
+ */
+class MappedFile
+{
+ public:
+  MappedFile(const std::string & filename);
+  ~MappedFile();
+
+  MappedFile(const MappedFile &) = delete;
+  MappedFile & operator=(const MappedFile &) = delete;
+
+  const char * data() const { return data_; }
+  size_t size() const { return size_; }
+
+ private:
+  const char * data_;
+  size_t size_;
+  bool mapped_;
+  std::string buffer_;  ///< used if the file could not be mapped
+};
+
+}  // namespace smt
@@ -0,0 +1,53 @@
+/*********************                                                        */
+/*! \file memory_stats.h
+** \verbatim
+** Top contributors (to current version):
+**   agent
+** This file is part of the smt-switch project.
+** Copyright (c) 2026 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved.  See the file LICENSE in the top-level source
+** directory for licensing information.\endverbatim
+**
+** \brief Memory accounting for solvers.
+**
+**/
+
+#pragma once
+
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <string>
+
+namespace smt {
+
+/** A snapshot of the memory held by a solver, see
+ *  AbsSmtSolver::get_memory_stats
+ */
+struct MemoryStats
+{
+  /** term objects created by this solver that are still alive,
+   *  0 if the solver does not keep track of its terms
+   *  Counted when the stats are taken, from the tables that intern the
+   *  terms (see TermInternTable and LoggingSolver)
+   */
+  uint64_t live_terms = 0;
+  /** memory reported by the backend in bytes, 0 if it doesn't report it */
+  uint64_t backend_bytes = 0;
+  /** resident set size of this process in kilobytes, 0 if unknown */
+  uint64_t rss_kb = 0;
+  /** number of entries in the caches of the solver and its wrappers,
+   *  by cache name (e.g. "logging_hashtable")
+   */
+  std::map<std::string, uint64_t> cache_entries;
+};
+
+std::ostream & operator<<(std::ostream & output, const MemoryStats & stats);
+
+/** @return the current resident set size of this process in kilobytes,
+ *          or 0 where it is not available (e.g. without /proc)
+ */
+uint64_t current_rss_kb();
+
+}  // namespace smt
@@ -0,0 +1,181 @@
+/*********************                                                        */
+/*! \file model.h
+** \verbatim
+** Top contributors (to current version):
+**   agent
+** This file is part of the smt-switch project.
+** Copyright (c) 2026 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved.  See the file LICENSE in the top-level source
+** directory for licensing information.\endverbatim
+**
+** \brief Solver-independent snapshot of a model.
+**
+**/
+
+#pragma once
+
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "smt.h"
+
+namespace smt {
+
+enum ModelValueKind
+{
+  MV_BOOL = 0,
+  MV_BV,
+  MV_INT,
+  MV_REAL,
+  MV_ARRAY,
+  // any other value, kept as the backend's string representation
+  MV_OTHER
+};
+
+/** \class Model
+ *         A snapshot of the values of a set of symbols, taken once after
+ *          a sat result. It holds no terms, so it stays valid after the
+ *          solver moves on to another query or is destroyed.
+ *
+ *         Values are stored in a dense table indexed by an id per symbol:
+ *          booleans and bit-vectors as packed 64-bit words, integers and
+ *          reals as normalized decimal strings ("-3", "1/2") and arrays
+ *          as a default value plus a list of (index, element) exceptions,
+ *          where indices, elements and defaults are entries of the same
+ *          table without a name.
+ *
+ *         Boolean and bit-vector terms over the captured symbols (of
+ *          width at most 64) can be evaluated without the solver, for
+ *          backends that support term iteration.
+ *
+ *         Example:
+ *            if (solver->check_sat().is_sat())
+ *            {
+ *              Model m(solver, { x, y });
+ *              uint64_t xv = m.get_bv_word(m.get_id("x"));
+ *            }
+ */
+class Model
+{
+ public:
+  static constexpr size_t npos = static_cast<size_t>(-1);
+
+  Model() {}
+
+  /** Capture the values of symbols from solver
+   *  The solver must be in a state where get_value can be called.
+   *  @param solver the solver to query
+   *  @param symbols the symbols to capture
+   */
+  Model(const SmtSolver & solver, const TermVec & symbols);
+
+  /** @return the number of named entries (captured symbols) */
+  size_t size() const { return names_.size(); }
+
+  /** @return the id of the symbol with this name, or npos */
+  size_t get_id(const std::string & name) const
+  {
+    auto it = ids_.find(name);
+    return it == ids_.end() ? npos : it->second;
+  }
+
+  /** @return the id of the symbol, or npos */
+  size_t get_id(const Term & symbol) const
+  {
+    return get_id(symbol->to_string());
+  }
+
+  const std::string & get_name(size_t id) const { return names_[id]; }
+
+  ModelValueKind get_kind(size_t id) const { return entries_[id].kind; }
+
+  bool get_bool(size_t id) const { return words_[entries_[id].offset]; }
+
+  uint64_t get_bv_width(size_t id) const { return entries_[id].width; }
+
+  /** @return the lowest 64 bits of a bit-vector value */
+  uint64_t get_bv_word(size_t id) const { return words_[entries_[id].offset]; }
+
+  /** @return the bit-vector value as a binary string (most significant
+   *          bit first)
+   */
+  std::string get_bv_string(size_t id) const;
+
+  /** @return the value of an integer, real or other entry as a string */
+  const std::string & get_string(size_t id) const
+  {
+    return strings_[entries_[id].offset];
+  }
+
+  /** @return the entry id of an array's default value, or npos if the
+   *          backend did not report one
+   */
+  size_t get_array_default(size_t id) const
+  {
+    return slots_[entries_[id].offset];
+  }
+
+  /** @return the (index id, element id) pairs of an array */
+  std::vector<std::pair<size_t, size_t>> get_array_exceptions(
+      size_t id) const;
+
+  /** Rebuild a value as a term in any solver
+   *  @param solver the solver to create the term in
+   *  @param symbol a symbol in that solver whose name was captured
+   *  @return the value of symbol as a term of solver
+   */
+  Term get_value(const SmtSolver & solver, const Term & symbol) const;
+
+  /** Evaluate a boolean term over the captured symbols
+   *  Throws NotImplementedException for unsupported operators
+   *  and bit-vectors wider than 64 bits.
+   */
+  bool evaluate_bool(const Term & t) const;
+
+  /** Evaluate a bit-vector term of width at most 64 */
+  uint64_t evaluate_bv(const Term & t) const;
+
+  /** Write the model in a line-based text format */
+  void serialize(std::ostream & os) const;
+
+  /** Read a model written by serialize
+   *  Throws SmtException on malformed input
+   */
+  static Model deserialize(std::istream & is);
+
+ protected:
+  struct Entry
+  {
+    ModelValueKind kind;
+    uint64_t width;   ///< bit-vector width
+    size_t offset;    ///< into words_, strings_ or slots_ depending on kind
+    size_t count;     ///< words, or array exceptions
+  };
+
+  /** add an entry for a value term, returns its id */
+  size_t add_value(const Term & val);
+
+  size_t add_bv(uint64_t width, const std::vector<uint64_t> & words);
+
+  size_t add_array(const SmtSolver & solver, const Term & arr);
+
+  /** rebuild entry id with the given sort */
+  Term to_term(const SmtSolver & solver, size_t id, const Sort & sort) const;
+
+  /** evaluates t to a word (booleans are 0 or 1) */
+  uint64_t evaluate(const Term & t) const;
+
+  std::vector<Entry> entries_;  ///< named entries come first
+  std::vector<std::string> names_;
+  std::unordered_map<std::string, size_t> ids_;
+
+  std::vector<uint64_t> words_;
+  std::vector<std::string> strings_;
+  /** arrays: default id, then index id / element id pairs */
+  std::vector<size_t> slots_;
+};
+
+}  // namespace smt
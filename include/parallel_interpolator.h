@@ -0,0 +1,123 @@
+/*********************                                                        */
+/*! \file parallel_interpolator.h
+** \verbatim
+** Top contributors (to current version):
+**   agent
+** This file is part of the smt-switch project.
+** Copyright (c) 2026 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved.  See the file LICENSE in the top-level source
+** directory for licensing information.\endverbatim
+**
+** \brief Computes interpolants at many cut points of a formula sequence
+**        on a pool of interpolating solvers.
+**
+**/
+
+#pragma once
+
+#include <vector>
+
+#include "smt.h"
+
+namespace smt {
+
+/** \class ParallelInterpolator
+ *         Computes interpolants of a sequence of formulae F_0, ..., F_n-1
+ *          at a set of cut points, using a pool of interpolating solvers
+ *          (e.g. MSAT_INTERPOLATOR or CVC5_INTERPOLATOR), one thread each.
+ *
+ *         The interpolant at cut point c (0 < c < n) is an interpolant
+ *          between A = F_0 /\ ... /\ F_c-1 and B = F_c /\ ... /\ F_n-1.
+ *
+ *         The cut points are split into partitions of consecutive cut
+ *          points. Each partition is one task: a worker collapses the
+ *          formulae before the first cut and after the last cut of the
+ *          partition into single formulae and calls
+ *          get_sequence_interpolants (get_interpolant for a single cut).
+ *          The interpolants of a partition therefore form a sequence
+ *          interpolant (I_k /\ F_c_k ... => I_k+1), but interpolants
+ *          of different partitions come from different proofs and are
+ *          only guaranteed to be interpolants for their own cut point.
+ *          get_sequence_interpolants needs that property at every cut
+ *          point, so it always runs all cut points as one task.
+ *
+ *         Formulae are translated to every worker in the calling thread
+ *          and the translations are cached, so the same formulae (e.g. a
+ *          growing unrolling) are only translated once across calls.
+ *          Likewise, each worker keeps the conjunctions it built for a
+ *          prefix of the formulae while the next call starts with the
+ *          same formulae.
+ *          Interpolants are translated back to the original solver.
+ */
+class ParallelInterpolator
+{
+ public:
+  /** @param solver the solver the formulae and interpolants belong to
+   *  @param workers fresh interpolating solvers, one thread each
+   */
+  ParallelInterpolator(const SmtSolver & solver,
+                       std::vector<SmtSolver> workers);
+
+  /** Set the number of consecutive cut points per task
+   *  0 (the default) splits the cut points evenly over the workers.
+   */
+  void set_partition_size(size_t n) { partition_size_ = n; }
+
+  /** Compute interpolants at the given cut points
+   *  @param formulae the formula sequence
+   *  @param cuts strictly increasing cut points in [1, formulae.size() - 1]
+   *  @param out_I populated with one interpolant per cut point
+   *               (null for cut points where interpolation failed)
+   *  @return unsat    iff all interpolants were computed,
+   *          sat      iff the conjunction of formulae is satisfiable,
+   *          unknown  iff interpolation failed for some cut point
+   */
+  Result get_interpolants(const TermVec & formulae,
+                          const std::vector<size_t> & cuts,
+                          TermVec & out_I);
+
+  /** Compute a sequence interpolant, with the same interface as
+   *  AbsSmtSolver::get_sequence_interpolants
+   *  All cut points form a single task on one worker, regardless of the
+   *  partition size. Use get_interpolants to split the cut points over
+   *  the workers when independent interpolants are enough.
+   */
+  Result get_sequence_interpolants(const TermVec & formulae, TermVec & out_I);
+
+ protected:
+  /** get_interpolants with the given number of cut points per task */
+  Result get_interpolants(const TermVec & formulae,
+                          const std::vector<size_t> & cuts,
+                          size_t partition_size,
+                          TermVec & out_I);
+
+  struct Worker
+  {
+    SmtSolver solver;
+    TermTranslator to_worker;
+    TermTranslator from_worker;
+    TermVec formulae;  ///< translated formulae of the current call
+    /** conjunctions of the first k / last n-k formulae, built on demand
+     *  and kept across calls while those formulae are unchanged
+     */
+    TermVec prefix;
+    TermVec suffix;
+  };
+
+  struct Task
+  {
+    std::vector<size_t> cuts;
+    Result result;
+    TermVec interpolants;  ///< terms of the worker that ran the task
+    size_t worker;
+  };
+
+  void run_task(Worker & w, Task & task);
+
+  SmtSolver solver_;
+  std::vector<Worker> workers_;
+  size_t partition_size_;
+};
+
+}  // namespace smt
@@ -15,6 +15,11 @@
 
 #pragma once
 
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
 #include "solver.h"
 #include "term_hashtable.h"
 
@@ -38,11 +43,17 @@ enum PrintingStyleEnum
 /**
  * A class that wraps an SMT-solver and prints corresponding
  * SMT-LIB commands.
+ * With use_lets, the terms are printed with lets for their shared
+ * subterms (see to_smtlib_string), which keeps the output linear in the
+ * size of the term DAGs.
  */
 class PrintingSolver : public AbsSmtSolver
 {
  public:
-  PrintingSolver(SmtSolver s, std::ostream*, PrintingStyleEnum pse); 
+  PrintingSolver(SmtSolver s,
+                 std::ostream *,
+                 PrintingStyleEnum pse,
+                 bool use_lets = false);
   ~PrintingSolver();
 
   /* Operators that are printed */
@@ -63,6 +74,7 @@ class PrintingSolver : public AbsSmtSolver
   void pop(uint64_t num = 1) override;
   uint64_t get_context_level() const override;
   void reset_assertions() override;
+  MemoryStats get_memory_stats() const override;
   Result get_interpolant(const Term & A,
                          const Term & B,
                          Term & out_I) const override;
@@ -85,6 +97,9 @@ class PrintingSolver : public AbsSmtSolver
   Sort make_sort(const SortKind sk, const SortVec & sorts) const override;
   Sort make_sort(const Sort & sort_con, const SortVec & sorts) const override;
   Sort make_sort(const DatatypeDecl & d) const override;
+  Sort make_unresolved_sort(const DatatypeDecl & decl) const override;
+  SortVec make_datatype_sorts(
+      const std::vector<DatatypeDecl> & decls) const override;
   DatatypeDecl make_datatype_decl(const std::string & s) override;
   DatatypeConstructorDecl make_datatype_constructor_decl(
       const std::string s) override;
@@ -118,15 +133,44 @@ class PrintingSolver : public AbsSmtSolver
   std::ostream* out_stream; 
   /* A style to use while printing */
   PrintingStyleEnum style;
+  /* Whether to print shared subterms with lets */
+  bool use_lets;
+
+  /* the SMT-LIB representation of a term in a command */
+  std::string print_term(const Term & t) const;
+
+  /* The declarations are opaque, so the datatype declarations are recorded
+   * as they are built, to print declare-datatypes once the sorts are made.
+   * A null selector sort stands for the datatype itself.
+   */
+  struct PrintedConstructor
+  {
+    std::string name;
+    std::vector<std::pair<std::string, Sort>> selectors;
+  };
+  struct PrintedDatatype
+  {
+    std::string name;
+    std::vector<DatatypeConstructorDecl> constructors;
+  };
+  mutable std::unordered_map<DatatypeDecl, PrintedDatatype> printed_dts;
+  mutable std::unordered_map<DatatypeConstructorDecl, PrintedConstructor>
+      printed_cons;
+  /* names of the placeholders from make_unresolved_sort */
+  mutable std::unordered_map<Sort, std::string> unresolved_names;
 };
 
 /* Returns a printing SmtSolver by wrapping PrintingSmtSolver's constructor.
  * @param wrapped_solver the solver to wrap
  * @param out_stream the stream to dump SMT-LIB to
  * @param style the printing style
+ * @param use_lets whether to print shared subterms with lets
  * @return an SmtSolver that dumps to out_stream each command that is executed.
  */
 
-SmtSolver create_printing_solver(SmtSolver wrapped_solver, std::ostream* out_stream, PrintingStyleEnum style);
+SmtSolver create_printing_solver(SmtSolver wrapped_solver,
+                                 std::ostream * out_stream,
+                                 PrintingStyleEnum style,
+                                 bool use_lets = false);
 
 }  // namespace smt
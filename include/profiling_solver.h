@@ -0,0 +1,274 @@
+/*********************                                                        */
+/*! \file profiling_solver.h
+** \verbatim
+** Top contributors (to current version):
+**   agent
+** This file is part of the smt-switch project.
+** Copyright (c) 2026 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved.  See the file LICENSE in the top-level source
+** directory for licensing information.\endverbatim
+**
+** \brief Class that wraps another SmtSolver and records call counts,
+**        latencies and memory usage of the operations being performed.
+**/
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+#include "solver.h"
+
+namespace smt {
+
+/** The solver methods that are profiled
+ *  Overloads of the same method share one entry
+ */
+enum ProfiledMethod
+{
+  PROF_SET_OPT = 0,
+  PROF_SET_LOGIC,
+  PROF_ASSERT_FORMULA,
+  PROF_CHECK_SAT,
+  PROF_CHECK_SAT_ASSUMING,
+  PROF_PUSH,
+  PROF_POP,
+  PROF_GET_VALUE,
+  PROF_GET_ARRAY_VALUES,
+  PROF_GET_UNSAT_ASSUMPTIONS,
+  PROF_MAKE_SORT,
+  PROF_MAKE_VALUE,  // make_term for values
+  PROF_MAKE_SYMBOL,
+  PROF_GET_SYMBOL,
+  PROF_MAKE_PARAM,
+  PROF_MAKE_TERM,  // make_term with an operator
+  PROF_SUBSTITUTE,
+  PROF_RESET,
+  PROF_RESET_ASSERTIONS,
+  PROF_DATATYPE,  // datatype declarations and accessors
+  PROF_INTERPOLATION,
+  /** IMPORTANT: This must stay at the bottom.
+      It's only use is for sizing arrays
+  */
+  NUM_PROFILED_METHODS
+};
+
+std::string to_string(ProfiledMethod m);
+
+/** Log-linear latency histogram (in the style of HdrHistogram)
+ *  Values are bucketed by their power of two, and each power of two
+ *  is split into SUB_BUCKETS linear sub-buckets, so the relative error
+ *  of any reported quantile is at most 1 / SUB_BUCKETS.
+ */
+class LatencyHistogram
+{
+ public:
+  static constexpr size_t SUB_BUCKET_BITS = 3;
+  static constexpr size_t SUB_BUCKETS = 1 << SUB_BUCKET_BITS;
+  static constexpr size_t NUM_BUCKETS = (64 - SUB_BUCKET_BITS + 1) * SUB_BUCKETS;
+
+  LatencyHistogram() { clear(); }
+
+  /** Record a value (e.g. a latency in nanoseconds) */
+  void record(uint64_t v)
+  {
+    counts_[bucket_index(v)]++;
+    count_++;
+    total_ += v;
+    if (v < min_)
+    {
+      min_ = v;
+    }
+    if (v > max_)
+    {
+      max_ = v;
+    }
+  }
+
+  void clear();
+
+  uint64_t count() const { return count_; }
+  uint64_t total() const { return total_; }
+  uint64_t min() const { return count_ ? min_ : 0; }
+  uint64_t max() const { return max_; }
+
+  /** @param q the quantile in [0, 1]
+   *  @return an upper bound on the value at quantile q
+   */
+  uint64_t quantile(double q) const;
+
+  /** @return the largest value that maps to bucket i */
+  static uint64_t bucket_upper_bound(size_t i);
+
+  static size_t bucket_index(uint64_t v)
+  {
+    if (v < SUB_BUCKETS)
+    {
+      return v;
+    }
+    // position of the highest set bit, at least SUB_BUCKET_BITS
+    size_t msb = 63 - __builtin_clzll(v);
+    size_t shift = msb - SUB_BUCKET_BITS;
+    size_t sub = (v >> shift) & (SUB_BUCKETS - 1);
+    return (shift + 1) * SUB_BUCKETS + sub;
+  }
+
+ private:
+  std::array<uint64_t, NUM_BUCKETS> counts_;
+  uint64_t count_;
+  uint64_t total_;
+  uint64_t min_;
+  uint64_t max_;
+};
+
+/**
+ * A class that wraps an SMT-solver and records, per solver method,
+ * the number of calls and a latency histogram. It also counts the
+ * terms created per PrimOp and the change in peak resident set size
+ * around each satisfiability check.
+ *
+ * The statistics can be exported at any time with dump_json or
+ * dump_prometheus. Profiling can be switched off with set_enabled,
+ * in which case every call is a plain dispatch to the wrapped solver.
+ */
+class ProfilingSolver : public AbsSmtSolver
+{
+ public:
+  ProfilingSolver(SmtSolver s);
+  ~ProfilingSolver();
+
+  /** Enable or disable recording (enabled by default) */
+  void set_enabled(bool enabled) { enabled_ = enabled; }
+  bool is_enabled() const { return enabled_; }
+
+  /** Clear all recorded statistics */
+  void clear_stats();
+
+  const LatencyHistogram & get_histogram(ProfiledMethod m) const
+  {
+    return histograms_[m];
+  }
+
+  /** @return the number of terms created with the given operator */
+  uint64_t get_op_count(PrimOp po) const { return op_counts_[po]; }
+
+  /** @return the total growth of peak RSS (in kilobytes) observed
+   *          during satisfiability checks
+   */
+  uint64_t get_check_sat_rss_delta_kb() const { return rss_delta_kb_; }
+
+  /** Write the statistics as a JSON object */
+  void dump_json(std::ostream & os) const;
+
+  /** Write the statistics in the Prometheus text exposition format
+   *  @param prefix a prefix for all metric names
+   */
+  void dump_prometheus(std::ostream & os,
+                       const std::string & prefix = "smt_switch") const;
+
+  /* Profiled operators */
+  Sort make_sort(const std::string name, uint64_t arity) const override;
+  Term make_symbol(const std::string name, const Sort & sort) override;
+  Term make_param(const std::string name, const Sort & sort) override;
+  Term get_value(const Term & t) const override;
+  void get_bv_value(const Term & t, std::vector<uint64_t> & out) const override;
+  UnorderedTermMap get_array_values(const Term & arr,
+                                    Term & out_const_base) const override;
+  void get_unsat_assumptions(UnorderedTermSet & out) override;
+  void reset() override;
+  void set_opt(const std::string option, const std::string value) override;
+  void set_logic(const std::string logic) override;
+  void assert_formula(const Term & t) override;
+  Result check_sat() override;
+  Result check_sat_assuming(const TermVec & assumptions) override;
+  Result check_sat_assuming_list(const TermList & assumptions) override;
+  Result check_sat_assuming_set(const UnorderedTermSet & assumptions) override;
+  void push(uint64_t num = 1) override;
+  void pop(uint64_t num = 1) override;
+  uint64_t get_context_level() const override;
+  void reset_assertions() override;
+  MemoryStats get_memory_stats() const override;
+  Result get_interpolant(const Term & A,
+                         const Term & B,
+                         Term & out_I) const override;
+  Result get_sequence_interpolants(const TermVec & formulae,
+                                   TermVec & out_I) const override;
+  Term get_symbol(const std::string & name) override;
+  Sort make_sort(const SortKind sk) const override;
+  Sort make_sort(const SortKind sk, uint64_t size) const override;
+  Sort make_sort(const SortKind sk, const Sort & sort1) const override;
+  Sort make_sort(const SortKind sk,
+                 const Sort & sort1,
+                 const Sort & sort2) const override;
+  Sort make_sort(const SortKind sk,
+                 const Sort & sort1,
+                 const Sort & sort2,
+                 const Sort & sort3) const override;
+  Sort make_sort(const SortKind sk, const SortVec & sorts) const override;
+  Sort make_sort(const Sort & sort_con, const SortVec & sorts) const override;
+  Sort make_sort(const DatatypeDecl & d) const override;
+  Sort make_unresolved_sort(const DatatypeDecl & decl) const override;
+  SortVec make_datatype_sorts(
+      const std::vector<DatatypeDecl> & decls) const override;
+  DatatypeDecl make_datatype_decl(const std::string & s) override;
+  DatatypeConstructorDecl make_datatype_constructor_decl(
+      const std::string s) override;
+  void add_constructor(DatatypeDecl & dt,
+                       const DatatypeConstructorDecl & con) const override;
+  void add_selector(DatatypeConstructorDecl & dt,
+                    const std::string & name,
+                    const Sort & s) const override;
+  void add_selector_self(DatatypeConstructorDecl & dt,
+                         const std::string & name) const override;
+  Term get_constructor(const Sort & s, std::string name) const override;
+  Term get_tester(const Sort & s, std::string name) const override;
+  Term get_selector(const Sort & s,
+                    std::string con,
+                    std::string name) const override;
+  Term make_term(bool b) const override;
+  Term make_term(int64_t i, const Sort & sort) const override;
+  Term make_term(const std::string val,
+                 const Sort & sort,
+                 uint64_t base = 10) const override;
+  Term make_term(const Term & val, const Sort & sort) const override;
+  Term make_term(const Op op, const Term & t) const override;
+  Term make_term(const Op op, const Term & t0, const Term & t1) const override;
+  Term make_term(const Op op,
+                 const Term & t0,
+                 const Term & t1,
+                 const Term & t2) const override;
+  Term make_term(const Op op, const TermVec & terms) const override;
+  Term substitute(const Term term,
+                  const UnorderedTermMap & substitution_map) const override;
+  TermVec substitute_terms(
+      const TermVec & terms,
+      const UnorderedTermMap & substitution_map) const override;
+
+ protected:
+  /* The wrapped solver */
+  SmtSolver wrapped_solver;
+
+  bool enabled_;
+
+  // statistics are updated from const methods
+  mutable std::array<LatencyHistogram, NUM_PROFILED_METHODS> histograms_;
+  mutable std::array<uint64_t, NUM_OPS_AND_NULL + 1> op_counts_;
+  mutable uint64_t rss_delta_kb_;
+
+  template <class F>
+  auto profile(ProfiledMethod m, F && f) const -> decltype(f());
+
+  template <class F>
+  auto profile_check(ProfiledMethod m, F && f) const -> decltype(f());
+};
+
+/* Returns a profiling SmtSolver by wrapping ProfilingSolver's constructor.
+ * @param wrapped_solver the solver to wrap
+ * @return an SmtSolver that records statistics for each command executed.
+ */
+SmtSolver create_profiling_solver(SmtSolver wrapped_solver);
+
+}  // namespace smt
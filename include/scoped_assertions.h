@@ -0,0 +1,132 @@
+/*********************                                                        */
+/*! \file scoped_assertions.h
+** \verbatim
+** Top contributors (to current version):
+**   agent
+** This file is part of the smt-switch project.
+** Copyright (c) 2026 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved.  See the file LICENSE in the top-level source
+** directory for licensing information.\endverbatim
+**
+** \brief Emulates push / pop with activation literals.
+**
+**/
+
+#pragma once
+
+#include <vector>
+
+#include "smt.h"
+
+namespace smt {
+
+/** \class ScopedAssertions
+ *         Emulates push / pop on top of any solver that supports
+ *          check_sat_assuming, without using the solver's native scopes.
+ *         Each scope is guarded by a fresh boolean activation literal:
+ *          assertions in the scope are asserted as (=> act t), and
+ *          check_sat assumes all activation literals of open scopes.
+ *         Popping a scope retires its literal by asserting (not act).
+ *          Retired clauses stay in the solver as garbage until the
+ *          number of retired scopes reaches the garbage threshold, at
+ *          which point the solver is compacted: its assertions are
+ *          reset and only the live assertions are re-asserted. After
+ *          compaction, retired literals are recycled for new scopes.
+ *
+ *         All assertions and checks must go through this object while
+ *          it is in use; the solver's own push / pop must not be used.
+ *          The solver must be configured with incremental solving
+ *          enabled (and unsat assumptions, if get_unsat_assumptions is
+ *          used). If the backend does not implement reset_assertions,
+ *          automatic compaction is silently disabled.
+ *
+ *         Example:
+ *            ScopedAssertions sa(solver);
+ *            sa.assert_formula(init);
+ *            sa.push();
+ *            sa.assert_formula(bad);
+ *            Result r = sa.check_sat();
+ *            sa.pop();
+ */
+class ScopedAssertions
+{
+ public:
+  /** @param solver the solver to use (needs check_sat_assuming and, if
+   *         compaction is enabled, reset_assertions)
+   *  @param garbage_threshold the number of retired scopes that triggers
+   *         compaction, 0 disables compaction
+   */
+  ScopedAssertions(const SmtSolver & solver, size_t garbage_threshold = 100);
+
+  /** Open num new scopes */
+  void push(uint64_t num = 1);
+
+  /** Close the num most recent scopes
+   *  Throws IncorrectUsageException if there are fewer open scopes
+   */
+  void pop(uint64_t num = 1);
+
+  /** @return the number of open scopes */
+  uint64_t get_context_level() const { return scopes_.size(); }
+
+  /** Assert a formula in the current scope */
+  void assert_formula(const Term & t);
+
+  /** Check satisfiability of the assertions in all open scopes */
+  Result check_sat();
+
+  /** Check satisfiability of the assertions in all open scopes
+   *  under additional assumptions
+   *  @param assumptions boolean literals to assume
+   */
+  Result check_sat_assuming(const TermVec & assumptions);
+
+  /** After an unsat check_sat_assuming, populates out with a subset of
+   *  the user assumptions that is sufficient for unsatisfiability
+   *  (activation literals are filtered out)
+   */
+  void get_unsat_assumptions(UnorderedTermSet & out);
+
+  /** Reset the solver's assertions and re-assert only live assertions
+   *  Called automatically once the garbage threshold is reached
+   */
+  void compact();
+
+  /** @return true iff t is an activation literal created by this object */
+  bool is_activation_literal(const Term & t) const
+  {
+    return act_lits_.find(t) != act_lits_.end();
+  }
+
+  /** @return the number of retired scopes whose clauses are still
+   *          asserted in the solver
+   */
+  size_t num_retired() const { return retired_.size(); }
+
+  /** @return the number of activation literals ever created */
+  size_t num_activation_literals() const { return act_lits_.size(); }
+
+ protected:
+  struct Scope
+  {
+    Term act;             ///< activation literal of this scope
+    TermVec assertions;   ///< assertions, kept for compaction
+  };
+
+  /** @return an unused activation literal (recycled if possible) */
+  Term fresh_literal();
+
+  SmtSolver solver_;
+  Sort boolsort_;
+  size_t garbage_threshold_;
+
+  TermVec base_assertions_;  ///< assertions outside of any scope
+  std::vector<Scope> scopes_;
+  TermVec retired_;    ///< literals that have been asserted false
+  TermVec free_lits_;  ///< literals that can be reused
+  UnorderedTermSet act_lits_;
+  TermVec assumptions_;  ///< reused buffer for check_sat_assuming
+};
+
+}  // namespace smt
@@ -0,0 +1,171 @@
+/*********************                                                        */
+/*! \file smtlib_direct_parser.h
+** \verbatim
+** Top contributors (to current version):
+**   agent
+** This file is part of the smt-switch project.
+** Copyright (c) 2026 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved.  See the file LICENSE in the top-level source
+** directory for licensing information.\endverbatim
+**
+** \brief A hand-written SMT-LIB parser, an alternative to the bison parser
+**        of SmtLibReader.
+**
+**        It reads the same language and calls the same SmtLibReader hooks,
+**        but builds each term directly from the tokens of SmtLibLexer. Terms
+**        are parsed with an explicit stack, so deeply nested terms do not
+**        overflow the call stack.
+**
+**/
+
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "smt.h"
+#include "smtlib_lexer.h"
+#include "smtlib_reader.h"
+
+namespace smt {
+
+class SmtLibDirectParser
+{
+ public:
+  /** @param reader the reader whose hooks are called for each command,
+   *         it must outlive the parser
+   */
+  SmtLibDirectParser(SmtLibReader & reader);
+
+  /** Parse a file
+   *  @param f the file name
+   *  @return 0 on success, 1 on a syntax error (which is printed to
+   *          standard error like the bison parser does)
+   *  Exceptions from the lexer, the reader and the solver are propagated.
+   */
+  int parse(const std::string & f);
+
+  /** Parse SMT-LIB commands from memory
+   *  @param text the commands
+   *  @param name the name to use for text in error messages
+   *  @return see parse
+   */
+  int parse_string(std::string_view text,
+                   const std::string & name = "<string>");
+
+ private:
+  /** An open parenthesis in a term that still needs its arguments */
+  enum FrameKind
+  {
+    FRAME_PRIMOP = 0,    ///< (op args), op is a PrimOp
+    FRAME_INDEXED_OP,    ///< ((_ op i j) args)
+    FRAME_APPLY,         ///< (f args), f is a declared function
+    FRAME_DEFINE_FUN,    ///< (f args), f is a define-fun
+    FRAME_LET_BINDING,   ///< (let (... (name term) ...) body)
+    FRAME_LET_BODY,      ///< (let (...) body)
+    FRAME_QUANTIFIER,    ///< (forall ((x S) ...) body)
+    FRAME_ANNOTATION,    ///< (! term :attribute value ...)
+    FRAME_AS_CONST       ///< ((as const sort) value)
+  };
+
+  struct Frame
+  {
+    FrameKind kind;
+    Op op;
+    std::string name;  ///< the define-fun or let-bound symbol
+    Sort sort;         ///< the sort of a constant array
+  };
+
+  int run(std::string_view text, const std::string & name);
+
+  /** @return false after (exit) */
+  bool command();
+  Term term();
+
+  /** Opens the frame for an application, after the open parenthesis
+   *  @return the term if it was complete without arguments, e.g. (_ bv1 8)
+   */
+  Term open_frame();
+
+  /** Adds a child to the innermost frame
+   *  @return the term if the frame was closed by this child
+   */
+  Term add_child(const Term & t);
+
+  /** Closes the innermost list frame if the next token is a parenthesis
+   *  @return the term if it was closed
+   */
+  Term close_if_done();
+
+  Term atom(const SmtLibToken & tok);
+  Sort sort();
+  /** @return the (empty) buffer for the arguments of the new frame */
+  TermVec & push_frame(FrameKind kind);
+  void pop_frame();
+
+  /** Parse the sorted variables of a define-fun or quantifier, after the
+   *  open parenthesis of the list
+   */
+  void sorted_vars(bool params, TermVec & out);
+  std::pair<std::string, std::string> attribute();
+  std::string s_expr();
+
+  // token helpers
+  const SmtLibToken & peek()
+  {
+    if (tok_pos_ == tok_end_)
+    {
+      refill();
+    }
+    return toks_[tok_pos_];
+  }
+  SmtLibToken advance()
+  {
+    SmtLibToken tok = peek();
+    // stay at end of file
+    tok_pos_ += tok.kind != TOK_EOF;
+    line_ = tok.line;
+    return tok;
+  }
+  void refill();
+  void expect(SmtLibTokenKind kind, const char * what);
+  /** @return the next token, which must be a symbol (simple or quoted) */
+  std::string_view symbol(const char * what);
+  uint64_t numeral(const char * what);
+  bool is_symbol(const SmtLibToken & tok, const char * s) const
+  {
+    return tok.kind == TOK_SYMBOL && tok.text == s;
+  }
+  /** copies text into the reusable name_ buffer for the string hooks */
+  const std::string & name(std::string_view text)
+  {
+    name_.assign(text.data(), text.size());
+    return name_;
+  }
+  [[noreturn]] void syntax_error(const std::string & msg);
+
+  Sort bv_sort(uint64_t width);
+  Sort int_sort();
+
+  SmtLibReader & reader_;
+  SmtSolver solver_;
+
+  SmtLibLexer * lexer_;
+  static constexpr size_t TOKEN_BUFFER = 256;
+  SmtLibToken toks_[TOKEN_BUFFER];
+  size_t tok_pos_;
+  size_t tok_end_;
+  uint64_t line_;  ///< the line of the last token, for errors
+
+  std::vector<Frame> frames_;
+  std::vector<TermVec> children_;  ///< children_[i] holds the arguments of
+                                   ///< frames_[i], reused across terms
+  std::string name_;
+  std::unordered_map<uint64_t, Sort> bv_sorts_;
+  Sort int_sort_;
+};
+
+}  // namespace smt
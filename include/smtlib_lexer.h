@@ -0,0 +1,119 @@
+/*********************                                                        */
+/*! \file smtlib_lexer.h
+** \verbatim
+** Top contributors (to current version):
+**   agent
+** This file is part of the smt-switch project.
+** Copyright (c) 2026 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved.  See the file LICENSE in the top-level source
+** directory for licensing information.\endverbatim
+**
+** \brief A hand-written SMT-LIB lexer over an in-memory buffer.
+**
+**        The tokens point into the buffer (no copies). The input is
+**        classified 64 bytes at a time with SSE4.2 or AVX2 when the CPU
+**        supports it, and the token boundaries are found with bit
+**        operations on the resulting masks.
+**
+**/
+
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+namespace smt {
+
+enum SmtLibTokenKind
+{
+  TOK_EOF = 0,
+  TOK_LP,
+  TOK_RP,
+  /** a simple symbol, also reserved words such as assert or _ */
+  TOK_SYMBOL,
+  /** |a symbol| -- the text is without the bars */
+  TOK_QUOTED_SYMBOL,
+  /** :keyword -- the text is without the colon */
+  TOK_KEYWORD,
+  /** "a string" -- the text is without the quotes, escapes are kept */
+  TOK_STRING,
+  TOK_NUMERAL,
+  /** e.g. 1.5 */
+  TOK_DECIMAL,
+  /** #b0101 -- the text is without the #b */
+  TOK_BINARY,
+  /** #xbeef -- the text is without the #x */
+  TOK_HEX
+};
+
+struct SmtLibToken
+{
+  SmtLibTokenKind kind;
+  std::string_view text;
+  uint64_t line;  ///< the line the token starts on, from 1
+};
+
+/** The instruction sets the lexer can use, in increasing order */
+enum SmtLibLexerIsa
+{
+  LEXER_SCALAR = 0,
+  LEXER_SSE42,
+  LEXER_AVX2
+};
+
+/** The position of a SmtLibLexer, and the classification of the 64 bytes
+ *  from block, which is reused by all the tokens in the block
+ */
+struct SmtLibLexerState
+{
+  const char * pos;
+  const char * end;
+  uint64_t line;
+  const char * block;
+  uint64_t space;    ///< bit i is set iff block[i] is whitespace
+  uint64_t symbol;   ///< bit i is set iff block[i] can be in a simple symbol
+  uint64_t newline;  ///< bit i is set iff block[i] is a newline
+};
+
+/** \class SmtLibLexer
+ *  Splits a buffer into SMT-LIB tokens. The buffer must outlive the lexer
+ *  and the tokens. Throws SmtException on a malformed token.
+ */
+class SmtLibLexer
+{
+ public:
+  /** @param data the text, it does not need to be null-terminated
+   *  @param size the number of bytes in data
+   *  @param isa the instruction set to use, at most best_isa()
+   */
+  SmtLibLexer(const char * data,
+              size_t size,
+              SmtLibLexerIsa isa = best_isa());
+
+  /** @return the next token, TOK_EOF at the end (and after) */
+  SmtLibToken next();
+
+  /** Lex several tokens with one call, which is faster than calling next()
+   *  for each of them
+   *  @param out the array to write the tokens to
+   *  @param n the size of out
+   *  @return the number of tokens written, the last one is TOK_EOF if the
+   *          end was reached
+   */
+  size_t next(SmtLibToken * out, size_t n);
+
+  /** @return the current line, from 1 */
+  uint64_t line() const { return state_.line; };
+
+  SmtLibLexerIsa get_isa() const { return isa_; };
+
+  /** @return the best instruction set supported by this build and CPU */
+  static SmtLibLexerIsa best_isa();
+
+ private:
+  SmtLibLexerState state_;
+  SmtLibLexerIsa isa_;
+};
+
+}  // namespace smt
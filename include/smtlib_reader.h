@@ -46,6 +46,23 @@ enum Command
            can also be used for the number of Command enums */
 };
 
+/** Hash functor for a vector of terms
+ *  Used to memoize define-fun applications by argument tuple
+ */
+struct TermVecHash
+{
+  size_t operator()(const smt::TermVec & tv) const
+  {
+    size_t res = tv.size();
+    for (const auto & t : tv)
+    {
+      // boost-style hash combine
+      res ^= t->hash() + 0x9e3779b9 + (res << 6) + (res >> 2);
+    }
+    return res;
+  }
+};
+
 /** Basic scoped symbol map
  *  Used for arguments and parameters that have limited scope
  *  Does not support shadowing within the same mapping scope
@@ -231,9 +248,19 @@ class SmtLibReader
    *  @param args the arguments to apply it to
    *         the parameter args from the define-fun
    *         declaration will be replaced by these arguments
+   *  Applications are memoized per define-fun, so applying the same
+   *  define-fun to the same arguments again does not re-substitute
+   *  (see set_memoize_define_funs)
    */
   Term apply_define_fun(const std::string & defname, const smt::TermVec & args);
 
+  /** Enable or disable memoization of define-fun applications
+   *  Enabled by default. Disabling it also clears the existing cache,
+   *  which can be used to bound memory on very large inputs.
+   *  @param memoize whether to cache define-fun applications
+   */
+  void set_memoize_define_funs(bool memoize);
+
   /** Helper function for define-fun - similar to new_symbol
    *  Associates an argument with a temporary symbol for
    *  define-fun arguments
@@ -328,6 +355,21 @@ class SmtLibReader
   std::unordered_map<std::string, smt::TermVec>
       def_args_;  ///< keeps track of define-fun
                   ///< arguments
+
+  /** Precompiled data for applying a define-fun with arguments */
+  struct DefineFunPlan
+  {
+    smt::Term def;                ///< the definition body
+    smt::TermVec args;            ///< the (renamed) formal arguments
+    smt::UnorderedTermMap subs;   ///< substitution map keyed by args
+                                  ///< values are overwritten per application
+    std::unordered_map<smt::TermVec, smt::Term, TermVecHash>
+        applications;  ///< memoized applications by actual arguments
+  };
+
+  std::unordered_map<std::string, DefineFunPlan>
+      def_plans_;  ///< application plans for define-funs with arguments
+  bool memoize_define_funs_;  ///< cache applications in def_plans_
   std::unordered_map<smt::Sort, smt::TermVec>
       tmp_args_;  ///< temporary variables
                   ///< organized by sort
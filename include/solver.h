@@ -20,6 +20,7 @@
 #include <vector>
 
 #include "exceptions.h"
+#include "memory_stats.h"
 #include "result.h"
 #include "smt_defs.h"
 #include "solver_enums.h"
@@ -30,6 +31,12 @@ namespace smt {
 
 /**
    Abstract solver class to be implemented by each supported solver.
+
+   Solvers are not thread-safe: an instance (and the terms and sorts it
+   created) must only be used by one thread at a time. Separate instances
+   can be used concurrently iff the backend has the CONCURRENT_INSTANCES
+   attribute. To share one instance between threads, wrap it in a
+   ConcurrentSolver.
  */
 class AbsSmtSolver
 {
@@ -73,6 +80,10 @@ class AbsSmtSolver
    */
   virtual Result check_sat_assuming(const TermVec & assumptions) = 0;
 
+  /* Same as check_sat_assuming, for callers that keep their assumptions in
+   * a list or a set. Backends convert them directly into their native
+   * assumption array, the default implementation copies them into a TermVec.
+   */
   virtual Result check_sat_assuming_list(const TermList & assumptions);
 
   virtual Result check_sat_assuming_set(const UnorderedTermSet & assumptions);
@@ -102,6 +113,15 @@ class AbsSmtSolver
    */
   virtual Term get_value(const Term & t) const = 0;
 
+  /* Get the value of a bit-vector term after check_sat returns a satisfiable
+   * result, as little-endian 64-bit words (see AbsTerm::to_bv_words)
+   * The default implementation calls get_value, backends can override
+   * this to read the assignment without creating a value term.
+   * @param t the bit-vector term to get the value of
+   * @param out the output words
+   */
+  virtual void get_bv_value(const Term & t, std::vector<uint64_t> & out) const;
+
   /* Get a map of index-value pairs for an array term after check_sat returns
    * sat
    * SMTLIB: (get-value (<t>))
@@ -363,10 +383,27 @@ class AbsSmtSolver
    */
   virtual Term get_selector(const Sort & s, std::string con, std::string name) const = 0;
 
-  /** Create sorts for the corresponding DatatypeDecls.
+  /** Create a placeholder sort for the datatype declared by decl.
+   *  Selectors of one datatype in a mutually recursive family refer to
+   *  the other datatypes of the family through these placeholders, e.g.
+   *
+   *    Sort forest = s->make_unresolved_sort(forest_decl);
+   *    s->add_selector(node_cons, "children", forest);
+   *
+   *  The placeholders are replaced by the actual datatype sorts when the
+   *  whole family is created with make_datatype_sorts.
+   *
+   *  @param decl the datatype decl the placeholder stands for
+   *  @return a sort that can only be used in add_selector
+   */
+  virtual Sort make_unresolved_sort(const DatatypeDecl & decl) const;
+
+  /** Create sorts for the corresponding DatatypeDecls at once.
+   *  Needed for mutually recursive datatypes, and cheaper than creating
+   *  related datatypes one at a time (a single declare-datatypes).
    *
    *  @param decls the datatype decls
-   *  @return datatype sorts corresponding to the uninterpreted sort inputs
+   *  @return datatype sorts corresponding to decls, in the same order
    *
    */
   virtual SortVec make_datatype_sorts(
@@ -388,6 +425,13 @@ class AbsSmtSolver
   virtual Term substitute(const Term term,
                           const UnorderedTermMap & substitution_map) const;
 
+  /* Substitute in several terms at once
+   * Shared subterms are only visited once, so this is much cheaper than
+   * calling substitute on each term when the terms share structure.
+   * @param terms the terms to apply the substitution map to
+   * @param substitution_map the map to use for substitution
+   * @return the substituted terms, in the same order
+   */
   virtual TermVec substitute_terms(
       const TermVec & terms, const UnorderedTermMap & substitution_map) const;
 
@@ -433,6 +477,14 @@ class AbsSmtSolver
   virtual Result get_sequence_interpolants(const TermVec & formulae,
                                            TermVec & out_I) const;
 
+  /** Report the memory held by this solver
+   *  The default reports the live term and sort objects and the RSS of
+   *  the process. Backends add the memory they report themselves and
+   *  wrapper solvers add the sizes of their caches.
+   *  @return a snapshot of the memory statistics
+   */
+  virtual MemoryStats get_memory_stats() const;
+
   SolverEnum get_solver_enum() { return solver_enum; };
 
  protected:
@@ -72,7 +72,13 @@ enum SolverAttribute
   // aliases booleans and bit-vectors of size one
   BOOL_BV1_ALIASING,
   // supports setting a time limit
-  TIMELIMIT
+  TIMELIMIT,
+  // separate instances can be used from different threads at the same time
+  // (a single instance is never thread-safe, see ConcurrentSolver)
+  CONCURRENT_INSTANCES,
+  // equal terms are represented by the same term object while it is alive
+  // (see TermInternTable)
+  INTERNED_TERMS
 
   // TODO: when adding a new enum, also add to python interface in enums_dec.pxi
   // and enums_imp.pxi
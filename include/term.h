@@ -63,6 +63,15 @@ class AbsTerm
    *  otherwise, throws an IncorrectUsageException
    */
   virtual uint64_t to_int() const = 0;
+  /** converts a bit-vector value of any width to little-endian 64-bit
+   *  words: bit i of the value is bit (i % 64) of out[i / 64], and the
+   *  bits of the last word above the width are zero
+   *  The default implementation parses to_string, backends override it
+   *  to read the value directly.
+   *  throws an IncorrectUsageException if the term is not a bit-vector value
+   *  @param out the output vector, resized to (width + 63) / 64 words
+   */
+  virtual void to_bv_words(std::vector<uint64_t> & out);
   /** begin iterator
    *  starts iteration through Term's children
    */
@@ -0,0 +1,107 @@
+/*********************                                                        */
+/*! \file term_dag_builder.h
+** \verbatim
+** Top contributors (to current version):
+**   agent
+** This file is part of the smt-switch project.
+** Copyright (c) 2026 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved.  See the file LICENSE in the top-level source
+** directory for licensing information.\endverbatim
+**
+** \brief Builds a whole serialized term DAG with one call, for frontends
+**        where every call into the library is expensive (e.g. Python).
+**
+**/
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "smt.h"
+
+namespace smt {
+
+/** The node kinds of a TermDag */
+enum TermDagNodeKind
+{
+  /** [DAG_OP, prim_op, num_idx, idx..., num_children, child...] */
+  DAG_OP = 0,
+  /** [DAG_SYMBOL, string, sort] -- a symbol, declared unless the solver
+   *  already has a symbol with that name and sort
+   */
+  DAG_SYMBOL,
+  /** [DAG_VALUE, string, sort] -- make_term(value string, sort) */
+  DAG_VALUE,
+  /** [DAG_BOOL, 0 or 1] */
+  DAG_BOOL,
+  /** [DAG_CONST_ARRAY, sort, child] -- a constant array of sorts[sort] */
+  DAG_CONST_ARRAY
+};
+
+/** A term DAG serialized into one array of integers
+ *  Every node is a record in code, starting with its TermDagNodeKind (see
+ *  the layouts above). The nodes are numbered in order, continuing the
+ *  numbering of the nodes built before by the same TermDagBuilder, and
+ *  the children of a node must have a smaller number than the node.
+ *  The names, values and sorts of the nodes are indices into strings and
+ *  sorts.
+ */
+struct TermDag
+{
+  std::vector<int64_t> code;
+  std::vector<std::string> strings;
+  SortVec sorts;
+
+  void clear()
+  {
+    code.clear();
+    strings.clear();
+    sorts.clear();
+  }
+};
+
+/** \class TermDagBuilder
+ *  Builds the terms of TermDags and keeps them, so that later DAGs can
+ *  share the nodes of earlier ones by number. The frontend only needs
+ *  to get the terms it actually uses (e.g. the assertions) out of the
+ *  builder.
+ */
+class TermDagBuilder
+{
+ public:
+  TermDagBuilder(const SmtSolver & solver) : solver_(solver) {}
+
+  /** Build the nodes of a serialized DAG
+   *  throws IncorrectUsageException if the DAG is malformed, in which case
+   *  none of its nodes are kept (but its symbols stay declared in the
+   *  solver, and are reused by later DAGs)
+   *  @param dag the nodes to build
+   *  @return the number of the first node of dag
+   */
+  size_t build(const TermDag & dag);
+
+  /** @return the term of node id */
+  const Term & get_term(size_t id) const;
+
+  /** @return the number of nodes built so far */
+  size_t size() const { return terms_.size(); };
+
+  /** Get the model values of several nodes in one call
+   *  Only valid after a satisfiable check_sat of the solver
+   *  @param ids the nodes
+   *  @return the SMT-LIB representation of the value of each node
+   */
+  std::vector<std::string> get_values(const std::vector<size_t> & ids) const;
+
+  /** forget all nodes, the numbering starts again at 0 */
+  void clear() { terms_.clear(); };
+
+ protected:
+  SmtSolver solver_;
+  TermVec terms_;
+};
+
+}  // namespace smt
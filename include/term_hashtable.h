@@ -17,7 +17,10 @@
 
 #pragma once
 
+#include <cstdint>
+#include <memory>
 #include <unordered_map>
+#include <vector>
 
 #include "smt_defs.h"
 #include "term.h"
@@ -27,7 +30,8 @@ namespace smt {
 /** \class TermHashTable
  *  A very straightforward implementation of a Term hash table
  *  using a std::unordered_map and UnorderedTermSet
- *  The primary use of this is for hash-consing in LoggingSolver
+ *  It keeps its terms alive, see WeakTermHashTable for hash-consing
+ *  without retaining dead terms
  */
 class TermHashTable
 {
@@ -47,9 +51,133 @@ class TermHashTable
   bool lookup(Term & t);
   void erase(const Term & t);
   void clear();
+  /** @return the number of terms in the table */
+  size_t size() const;
 
  protected:
   std::unordered_map<std::size_t, UnorderedTermSet> table;
 };
 
+/** \class WeakTermHashTable
+ *  A Term hash table that does not keep its terms alive
+ *  This is the table used for hash-consing in LoggingSolver, so that
+ *  terms are freed once the user drops the last reference.
+ *
+ *  Entries of dead terms expire. Lookups skip them, an insert purges the
+ *  expired entries of its bucket, and the whole table is swept once as
+ *  many terms were inserted as were alive after the previous sweep. This
+ *  keeps the table within a constant factor of the live terms at an
+ *  amortized constant cost per insert.
+ *
+ *  A term may be dropped on another thread during a lookup (e.g. over a
+ *  ConcurrentSolver), so the table never runs code when a term dies.
+ */
+class WeakTermHashTable
+{
+ public:
+  WeakTermHashTable();
+  ~WeakTermHashTable();
+  /** insert a term, assumed not to be in the table */
+  void insert(const Term & t);
+  /** check if a live term is in the table
+   *  @param the term to check
+   *  @return true iff an equal live term is in the table
+   */
+  bool contains(const Term & t) const;
+  /** lookup a term and modify pointer in place
+   *  @param t the term to look up and modify
+   *  @return true iff an equal live term was found in the hash table
+   */
+  bool lookup(Term & t);
+  void clear();
+  /** purge all expired entries */
+  void sweep();
+  /** @return the number of entries, including expired ones that were not
+   *          purged yet
+   */
+  size_t size() const { return size_; };
+  /** @return the number of live terms in the table, visits every entry */
+  size_t num_live() const;
+
+ protected:
+  // minimum number of inserts between sweeps
+  static constexpr size_t MIN_SWEEP_INTERVAL = 1024;
+
+  std::unordered_map<std::size_t, std::vector<std::weak_ptr<AbsTerm>>> table;
+  size_t size_;
+  size_t inserts_since_sweep_;
+  size_t live_after_sweep_;
+};
+
+/** \class TermInternTable
+ *  Interns the term wrappers of a backend by their native handle, e.g. a
+ *  Z3 AST id or a MathSAT term id, so that the same backend node is
+ *  always wrapped by the same object while that object is alive.
+ *  The backends use it when creating terms and in the child iterators,
+ *  which would otherwise allocate a new wrapper on every dereference.
+ *
+ *  The table holds weak references in an open-addressed array with linear
+ *  probing. The slot of a dead wrapper keeps its key, so it does not break
+ *  the probe sequences, and is reused by the next insert that passes it.
+ *  The array is rebuilt with only the live wrappers once more than half
+ *  of the slots are in use.
+ *
+ *  Like the solvers, the table is not thread-safe. Wrappers may be
+ *  dropped on any thread, the table never runs code when they die.
+ */
+class TermInternTable
+{
+ public:
+  TermInternTable();
+  ~TermInternTable();
+  /** lookup the live wrapper for a native handle, or create it
+   *  @param key the native handle, unique among the live backend nodes
+   *  @param make creates the wrapper, only called if there is no live one
+   *  @return the wrapper for key
+   */
+  template <class F>
+  Term intern(uint64_t key, F && make)
+  {
+    Term res;
+    size_t idx = find(key, res);
+    if (!res)
+    {
+      res = make();
+      insert_at(idx, key, res);
+    }
+    return res;
+  }
+  /** @return the live wrapper for a native handle, or a null Term */
+  Term lookup(uint64_t key);
+  void clear();
+  /** @return the number of used slots, including dead wrappers */
+  size_t size() const { return used_; };
+  /** @return the number of live wrappers, visits every slot */
+  size_t num_live() const;
+  /** @return the number of slots */
+  size_t capacity() const { return slots_.size(); };
+
+ protected:
+  static constexpr size_t MIN_CAPACITY = 64;
+  static constexpr uint64_t EMPTY = UINT64_MAX;
+
+  struct Slot
+  {
+    uint64_t key = EMPTY;
+    std::weak_ptr<AbsTerm> term;
+  };
+
+  /** find the slot of key
+   *  @param key the native handle
+   *  @param res set to the live wrapper of key if there is one
+   *  @return the slot of the live wrapper, or else the slot to insert at
+   */
+  size_t find(uint64_t key, Term & res);
+  void insert_at(size_t idx, uint64_t key, const Term & t);
+  void rehash();
+
+  std::vector<Slot> slots_;
+  size_t used_;
+};
+
 }  // namespace smt
@@ -0,0 +1,56 @@
+/*********************                                                        */
+/*! \file term_printer.h
+** \verbatim
+** Top contributors (to current version):
+**   agent
+** This file is part of the smt-switch project.
+** Copyright (c) 2026 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved.  See the file LICENSE in the top-level source
+** directory for licensing information.\endverbatim
+**
+** \brief SMT-LIB printing of terms that preserves the sharing of the DAG.
+**
+**        AbsTerm::to_string prints the fully expanded tree, which is
+**        exponential in the size of a DAG with a lot of sharing.
+**
+**/
+
+#pragma once
+
+#include <string>
+
+#include "smt_defs.h"
+#include "term.h"
+
+namespace smt {
+
+/** the length after which to_diagnostic_string elides the rest */
+const size_t DIAGNOSTIC_STRING_LENGTH = 1000;
+
+/** Print a term in SMT-LIB syntax
+ *  Non-leaf subterms that occur more than once are bound with a let
+ *  (named _let_<n>) when use_lets is set, so the output is linear in the
+ *  size of the DAG. Subterms with a quantifier parameter are not
+ *  let-bound, so that they stay in the scope of their binder. Symbols
+ *  and values are printed with their own to_string.
+ *  @param t the term to print
+ *  @param use_lets whether to introduce lets for shared subterms
+ *  @param max_length if non-zero, the output is cut after this many
+ *         characters and ends with " ..." -- it is not valid SMT-LIB then
+ *  @return the SMT-LIB representation of t
+ */
+std::string to_smtlib_string(const Term & t,
+                             bool use_lets = true,
+                             size_t max_length = 0);
+
+/** Print a term for an error message or a log
+ *  Shared subterms are let-bound and the output is capped at
+ *  DIAGNOSTIC_STRING_LENGTH characters.
+ */
+inline std::string to_diagnostic_string(const Term & t)
+{
+  return to_smtlib_string(t, true, DIAGNOSTIC_STRING_LENGTH);
+}
+
+}  // namespace smt
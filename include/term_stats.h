@@ -0,0 +1,152 @@
+/*********************                                                        */
+/*! \file term_stats.h
+** \verbatim
+** Top contributors (to current version):
+**   agent
+** This file is part of the smt-switch project.
+** Copyright (c) 2026 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved.  See the file LICENSE in the top-level source
+** directory for licensing information.\endverbatim
+**
+** \brief Single-pass statistics about term DAGs.
+**
+**/
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+
+#include "smt.h"
+
+namespace smt {
+
+/** \class TermStats
+ *         Cheap structural statistics about a set of terms (typically the
+ *          assertions of a query), e.g. to pick a backend or an encoding.
+ *
+ *         Terms are added one at a time. Each add visits only the DAG
+ *          nodes that were not seen before, so the statistics can be
+ *          kept up to date as new assertions arrive at a cost proportional
+ *          to the new nodes.
+ *
+ *         Tree sizes (the size of a term with shared subterms expanded)
+ *          grow exponentially in the DAG depth, so they saturate at
+ *          UINT64_MAX instead of overflowing.
+ *
+ *         Requires a backend that supports term iteration.
+ *
+ *         Example:
+ *            TermStats stats;
+ *            for (auto a : assertions)
+ *            {
+ *              stats.add(a);
+ *            }
+ *            if (stats.has_sort_kind(ARRAY)) ...
+ */
+class TermStats
+{
+ public:
+  static constexpr uint64_t saturated = UINT64_MAX;
+
+  TermStats();
+
+  /** Add a term, e.g. an assertion */
+  void add(const Term & t);
+
+  /** Forget all terms */
+  void clear();
+
+  /** @return the number of terms added (with duplicates) */
+  size_t num_roots() const { return num_roots_; }
+
+  /** @return the number of distinct DAG nodes */
+  size_t dag_size() const { return info_.size(); }
+
+  /** @return the sum of the tree sizes of the added terms
+   *          or TermStats::saturated
+   */
+  uint64_t tree_size() const { return tree_size_; }
+
+  /** @return the tree size of t, which must be a subterm of an added term
+   *          throws IncorrectUsageException otherwise
+   */
+  uint64_t tree_size(const Term & t) const;
+
+  /** @return the maximum depth of an added term (a symbol has depth 0) */
+  uint64_t depth() const { return depth_; }
+
+  /** @return the number of DAG nodes with this primitive operator
+   *          (NUM_OPS_AND_NULL counts symbols and values)
+   */
+  size_t op_count(PrimOp po) const { return op_counts_[po]; }
+
+  /** @return the number of DAG nodes of this sort kind */
+  size_t sort_kind_count(SortKind sk) const { return sort_counts_[sk]; }
+
+  bool has_sort_kind(SortKind sk) const { return sort_counts_[sk] > 0; }
+
+  /** @return the widest bit-vector node (or array index / element), 0 if
+   *          there are none
+   */
+  uint64_t max_bv_width() const { return max_bv_width_; }
+
+  size_t num_symbols() const { return num_symbols_; }
+  size_t num_values() const { return num_values_; }
+
+  /** @return true iff an uninterpreted function is used */
+  bool has_uf() const
+  {
+    return sort_counts_[FUNCTION] || op_counts_[Apply];
+  }
+
+  bool has_arrays() const { return sort_counts_[ARRAY] > 0; }
+
+  bool has_quantifiers() const
+  {
+    return op_counts_[Forall] || op_counts_[Exists];
+  }
+
+  /** @return true iff a product, division or modulus of two non-values
+   *          occurs over integers or reals
+   */
+  bool has_nonlinear_arithmetic() const { return nonlinear_; }
+
+  /** @return the smallest SMT-LIB logic covering the terms, e.g. QF_ABV
+   *          (QF_UF for purely boolean terms)
+   */
+  std::string logic() const;
+
+  /** Print a summary */
+  void print(std::ostream & os) const;
+
+ protected:
+  struct Info
+  {
+    uint64_t tree_size;
+    uint64_t depth;
+  };
+
+  /** update the counters for a new node */
+  void count(const Term & t);
+
+  std::unordered_map<Term, Info> info_;
+
+  size_t num_roots_;
+  uint64_t tree_size_;
+  uint64_t depth_;
+  std::array<size_t, NUM_OPS_AND_NULL + 1> op_counts_;
+  std::array<size_t, NUM_SORT_KINDS> sort_counts_;
+  uint64_t max_bv_width_;
+  size_t num_symbols_;
+  size_t num_values_;
+  bool nonlinear_;
+};
+
+std::ostream & operator<<(std::ostream & output, const TermStats & stats);
+
+}  // namespace smt
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <string>
 #include <unordered_map>
 
 #include "smt_defs.h"
@@ -91,6 +92,21 @@ class TermTranslator
   /* Returns reference to cache -- can be used to populate with symbols */
   UnorderedTermMap & get_cache() { return cache; };
 
+  /** Bound the size of the cache for long runs
+   *  Once the cache grows past the limit, the translations that
+   *  transfer_term added since the limit was set are dropped after a
+   *  transfer, except those of symbols and parameters (the symbols must
+   *  keep mapping to the same terms). Entries added through get_cache are
+   *  never dropped. The limit also bounds the symbol names kept for
+   *  symbols that leave the cache.
+   *  @param limit the maximum number of entries, 0 (default) for unbounded
+   */
+  void set_cache_limit(size_t limit)
+  {
+    cache_limit = limit;
+    next_trim = limit;
+  };
+
   /* Returns a reference to the solver this object translates terms to */
   const SmtSolver & get_solver() { return solver; };
 
@@ -150,6 +166,25 @@ class TermTranslator
   // it can still call non-const methods of the solver
   SmtSolver solver;  ///< solver to translate terms to
   UnorderedTermMap cache;
+  size_t cache_limit = 0;  ///< see set_cache_limit
+  // size of the cache that triggers the next trim, the entries that
+  // survive a trim don't count against the limit
+  size_t next_trim = 0;
+  // the non-symbol terms transfer_term added to the cache since the last
+  // trim, only recorded while the cache is bounded
+  TermVec trimmable;
+
+  /** drops the cached translations in trimmable */
+  void trim_cache();
+
+  /** the name of a symbol or parameter of the other solver
+   *  to_string is only called the first time a symbol is seen, the
+   *  names survive clearing the cache. With a cache limit, they are
+   *  dropped by a trim once there are more names than the limit.
+   */
+  const std::string & symbol_name(const Term & t);
+  std::unordered_map<Term, std::string> symbol_names;
+
   // map from uninterpreted sort names to the sort in the destination solver
   // necessary because it needs to be the same exact uninterpreted sort
   // cannot recreate it with the same name and get the same object back
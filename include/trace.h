@@ -0,0 +1,129 @@
+/*********************                                                        */
+/*! \file trace.h
+** \verbatim
+** Top contributors (to current version):
+**   agent
+** This file is part of the smt-switch project.
+** Copyright (c) 2026 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved.  See the file LICENSE in the top-level source
+** directory for licensing information.\endverbatim
+**
+** \brief Scoped tracing spans that can be exported as a Chrome trace.
+**
+**/
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+/** Tracing
+ *
+ *  The library marks expensive operations (parsing, term translation,
+ *  walkers and the backend check_sat / push / pop / get_value calls) with
+ *  SMT_TRACE_SPAN. The spans are only compiled in if smt-switch is
+ *  configured with --tracing (-DSMT_SWITCH_TRACING=ON); otherwise the
+ *  macro expands to nothing.
+ *
+ *  When compiled in, recording is still off until trace::enable is
+ *  called, or the environment variable SMT_SWITCH_TRACE names a file,
+ *  in which case the trace is written there at exit. A disabled span
+ *  costs one relaxed atomic load.
+ *
+ *  Every thread records into its own buffer, so spans from a
+ *  PortfolioSolver or CubeAndConquer run show up as separate rows when
+ *  the trace is opened in chrome://tracing or https://ui.perfetto.dev.
+ *
+ *  Spans can also be added in user code:
+ *    {
+ *      SMT_TRACE_SPAN("encode", "user");
+ *      ...
+ *    }
+ */
+
+#define SMT_TRACE_CONCAT_(a, b) a##b
+#define SMT_TRACE_CONCAT(a, b) SMT_TRACE_CONCAT_(a, b)
+
+#ifdef SMT_SWITCH_TRACING
+/** Record the enclosing scope as a span
+ *  @param name the name of the span, must be a string literal
+ *  @param category the category of the span, must be a string literal
+ */
+#define SMT_TRACE_SPAN(name, category) \
+  ::smt::trace::Span SMT_TRACE_CONCAT(smt_trace_span_, __LINE__)(name, category)
+#else
+#define SMT_TRACE_SPAN(name, category)
+#endif
+
+namespace smt {
+
+namespace trace {
+
+/** @return true iff the library was built with the spans compiled in */
+bool compiled_in();
+
+extern std::atomic<bool> recording;
+
+/** Start or stop recording spans */
+void enable(bool on = true);
+
+inline bool enabled() { return recording.load(std::memory_order_relaxed); }
+
+/** Drop the spans recorded so far */
+void clear();
+
+/** @return the number of spans recorded so far (in all threads) */
+size_t num_spans();
+
+/** Write the recorded spans in the Chrome trace event format
+ *  Spans that are still open are not included.
+ */
+void write_chrome_trace(std::ostream & os);
+
+/** Write the recorded spans to a file
+ *  throws IncorrectUsageException if the file cannot be written
+ */
+void write_chrome_trace(const std::string & filename);
+
+/** A span that is recorded when it goes out of scope (see SMT_TRACE_SPAN)
+ *  The name and category are not copied.
+ */
+class Span
+{
+ public:
+  Span(const char * name, const char * category)
+      : name_(name), category_(category), start_(enabled() ? now() : 0)
+  {
+  }
+
+  ~Span()
+  {
+    if (start_)
+    {
+      record(name_, category_, start_, now());
+    }
+  }
+
+  Span(const Span &) = delete;
+  Span & operator=(const Span &) = delete;
+
+  /** @return nanoseconds on a monotonic clock, never 0 */
+  static uint64_t now();
+
+ protected:
+  static void record(const char * name,
+                     const char * category,
+                     uint64_t start,
+                     uint64_t end);
+
+  const char * name_;
+  const char * category_;
+  uint64_t start_;  ///< 0 if not recording
+};
+
+}  // namespace trace
+
+}  // namespace smt
@@ -19,6 +19,7 @@
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include "assert.h"
 #include "smt.h"
@@ -109,6 +110,37 @@ Term to_cnf(Term formula, SmtSolver s);
 // Returns true if the formula is in cnf form, else false
 bool is_cnf(Term formula);
 
+/** Pack a binary string (most significant bit first) into little-endian
+ *  64-bit words, see AbsTerm::to_bv_words
+ *  @param bits the binary digits
+ *  @param len the number of digits
+ *  @param width the bit-width, digits beyond it are ignored
+ *  @param out the output words, resized to (width + 63) / 64
+ */
+void bits_to_words(const char * bits,
+                   size_t len,
+                   uint64_t width,
+                   std::vector<uint64_t> & out);
+
+/** Convert a decimal string into little-endian 64-bit words
+ *  @param digits the decimal digits, parsing stops at the first non-digit
+ *  @param len the number of characters
+ *  @param width the bit-width, the value is truncated to it
+ *  @param out the output words, resized to (width + 63) / 64
+ */
+void decimal_to_words(const char * digits,
+                      size_t len,
+                      uint64_t width,
+                      std::vector<uint64_t> & out);
+
+/** Convert a printed bit-vector value (#b..., #x... or (_ bvN w))
+ *  into little-endian 64-bit words
+ *  throws IncorrectUsageException for any other string
+ */
+void bv_string_to_words(const std::string & s,
+                        uint64_t width,
+                        std::vector<uint64_t> & out);
+
 // -----------------------------------------------------------------------------
 
 /** \class
@@ -133,6 +133,7 @@ class MsatSolver : public AbsSmtSolver
   Term make_term(Op op, const TermVec & terms) const override;
   void reset() override;
   void reset_assertions() override;
+  MemoryStats get_memory_stats() const override;
   Term substitute(const Term term,
                   const UnorderedTermMap & substitution_map) const override;
 
@@ -175,6 +176,17 @@ class MsatSolver : public AbsSmtSolver
                                ///< get_unsat_assumptions interface (will
                                ///< complain if not called after
                                ///< check-sat-assuming).
+  mutable TermInternTable term_table_;  ///< one wrapper per live msat term
+
+  // helpers for creating the term wrappers
+  Term wrap(msat_term t) const
+  {
+    return MsatTerm::wrap(env, &term_table_, t);
+  }
+  Term wrap(msat_decl d) const
+  {
+    return MsatTerm::wrap(env, &term_table_, d);
+  }
 
   // clears assumption clauses
   // needed to simulate the same check_sat_assuming interface as other solvers
@@ -209,27 +221,33 @@ class MsatSolver : public AbsSmtSolver
   // helper function for creating labels for assumptions
   msat_term label(msat_term p) const;
 
-  inline Result check_sat_assuming_msatvec(std::vector<msat_term> & m_assumps)
+  std::vector<msat_term> label_buffer_;
+  ///< reused by check_sat_assuming* to avoid an allocation per query
+
+  // labels each assumption in [it, end) and solves under the labels
+  template <class I>
+  inline Result check_sat_assuming_internal(I it, const I & end)
   {
+    initialize_env();
+    last_query_assuming = true;
+    clear_assumption_clauses();
     msat_term lbl;
     assumption_map_.clear();
-    std::vector<msat_term> lbls;
-    lbls.reserve(m_assumps.size());
-    for (const auto & ma : m_assumps)
+    label_buffer_.clear();
+    for (; it != end; ++it)
     {
+      msat_term ma = std::static_pointer_cast<MsatTerm>(*it)->term;
       lbl = label(ma);
       // check that label is cached correctly
       assert(msat_term_id(lbl) == msat_term_id(label(ma)));
       msat_assert_formula(env, msat_make_or(env, msat_make_not(env, lbl), ma));
       num_assump_clauses_++;
       assumption_map_[msat_term_id(lbl)] = ma;
-      lbls.push_back(lbl);
+      label_buffer_.push_back(lbl);
     }
 
-    assert(lbls.size() == m_assumps.size());
-
-    msat_result mres =
-        msat_solve_with_assumptions(env, lbls.data(), lbls.size());
+    msat_result mres = msat_solve_with_assumptions(
+        env, label_buffer_.data(), label_buffer_.size());
 
     if (mres == MSAT_SAT)
     {
@@ -244,6 +262,30 @@ class MsatSolver : public AbsSmtSolver
       return Result(UNKNOWN);
     }
   }
+
+  // throws an IncorrectUsageException unless every term in [it, end)
+  // is a (possibly negated) boolean symbol
+  template <class I>
+  inline void check_indicator_literals(I it, const I & end) const
+  {
+    for (; it != end; ++it)
+    {
+      const Term & a = *it;
+      if (!a->is_symbolic_const() || a->get_sort()->get_sort_kind() != BOOL)
+      {
+        if (a->get_op() == Not && (*a->begin())->is_symbolic_const())
+        {
+          continue;
+        }
+        else
+        {
+          throw IncorrectUsageException(
+              "Expecting boolean indicator literals but got: "
+              + a->to_string());
+        }
+      }
+    }
+  }
 };
 
 // Interpolating Solver
@@ -17,6 +17,7 @@
 #pragma once
 
 #include "term.h"
+#include "term_hashtable.h"
 #include "utils.h"
 
 #include "mathsat.h"
@@ -31,8 +32,11 @@ class MsatTermIter : public TermIterBase
 {
  public:
   // TODO: consider making env const everywhere
-  MsatTermIter(msat_env e, const msat_term t, uint32_t p)
-      : env(e), term(t), pos(p){};
+  MsatTermIter(msat_env e,
+               const msat_term t,
+               uint32_t p,
+               TermInternTable * table = nullptr)
+      : env(e), term(t), pos(p), table(table){};
   MsatTermIter(const MsatTermIter & it);
   ~MsatTermIter(){};
   MsatTermIter & operator=(const MsatTermIter & it);
@@ -49,6 +53,7 @@ class MsatTermIter : public TermIterBase
   msat_env env;
   msat_term term;
   uint32_t pos;
+  TermInternTable * table;  ///< interns the children, may be null
 };
 
 class MsatTerm : public AbsTerm
@@ -76,6 +81,7 @@ class MsatTerm : public AbsTerm
   bool is_value() const override;
   virtual std::string to_string() override;
   uint64_t to_int() const override;
+  void to_bv_words(std::vector<uint64_t> & out) override;
   /** Iterators for traversing the children
    */
   TermIter begin() override;
@@ -108,9 +114,18 @@ class MsatTerm : public AbsTerm
   msat_decl decl;
   bool is_uf;  ///< set to true if wrapping a msat_decl (e.g. an uninterpreted
                ///< function)
+  /** the table of the solver that created this term, if any
+   *  the children are interned in the same table
+   */
+  TermInternTable * intern_table = nullptr;
+
+  /** wrap a MathSAT object, interned by its id if table is not null */
+  static Term wrap(msat_env env, TermInternTable * table, msat_term t);
+  static Term wrap(msat_env env, TermInternTable * table, msat_decl d);
 
   friend class MsatSolver;
   friend class MsatInterpolatingSolver;
+  friend class MsatTermIter;
 };
 
 }  // namespace smt
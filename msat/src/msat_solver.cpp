@@ -26,6 +26,7 @@
 #include "exceptions.h"
 #include "result.h"
 #include "solver_utils.h"
+#include "trace.h"
 
 using namespace std;
 
@@ -192,6 +193,7 @@ void MsatSolver::assert_formula(const Term & t)
 
 Result MsatSolver::check_sat()
 {
+  SMT_TRACE_SPAN("MsatSolver::check_sat", "backend");
   initialize_env();
   last_query_assuming = false;
   clear_assumption_clauses();
@@ -213,93 +215,29 @@ Result MsatSolver::check_sat()
 
 Result MsatSolver::check_sat_assuming(const TermVec & assumptions)
 {
-  initialize_env();
-  last_query_assuming = true;
-  clear_assumption_clauses();
-  size_t num_assumps = assumptions.size();
-  vector<msat_term> m_assumps;
-  m_assumps.reserve(num_assumps);
-
-  msat_term ma;
-  for (size_t i = 0; i < num_assumps; ++i)
-  {
-    ma = static_pointer_cast<MsatTerm>(assumptions[i])->term;
-    m_assumps.push_back(ma);
-  }
-
-  return check_sat_assuming_msatvec(m_assumps);
+  SMT_TRACE_SPAN("MsatSolver::check_sat_assuming", "backend");
+  return check_sat_assuming_internal(assumptions.begin(), assumptions.end());
 }
 
 Result MsatSolver::check_sat_assuming_list(const TermList & assumptions)
 {
-  initialize_env();
-  clear_assumption_clauses();
+  SMT_TRACE_SPAN("MsatSolver::check_sat_assuming_list", "backend");
   // expecting (possibly negated) boolean literals
-  for (const auto & a : assumptions)
-  {
-    if (!a->is_symbolic_const() || a->get_sort()->get_sort_kind() != BOOL)
-    {
-      if (a->get_op() == Not && (*a->begin())->is_symbolic_const())
-      {
-        continue;
-      }
-      else
-      {
-        throw IncorrectUsageException(
-            "Expecting boolean indicator literals but got: " + a->to_string());
-      }
-    }
-  }
-
-  vector<msat_term> m_assumps;
-  m_assumps.reserve(assumptions.size());
-
-  shared_ptr<MsatTerm> ma;
-  for (const auto & a : assumptions)
-  {
-    ma = static_pointer_cast<MsatTerm>(a);
-    m_assumps.push_back(ma->term);
-  }
-
-  return check_sat_assuming_msatvec(m_assumps);
+  check_indicator_literals(assumptions.begin(), assumptions.end());
+  return check_sat_assuming_internal(assumptions.begin(), assumptions.end());
 }
 
 Result MsatSolver::check_sat_assuming_set(const UnorderedTermSet & assumptions)
 {
-  initialize_env();
-  clear_assumption_clauses();
+  SMT_TRACE_SPAN("MsatSolver::check_sat_assuming_set", "backend");
   // expecting (possibly negated) boolean literals
-  for (const auto & a : assumptions)
-  {
-    if (!a->is_symbolic_const() || a->get_sort()->get_sort_kind() != BOOL)
-    {
-      if (a->get_op() == Not && (*a->begin())->is_symbolic_const())
-      {
-        continue;
-      }
-      else
-      {
-        throw IncorrectUsageException(
-            "Expecting boolean indicator literals but got: " + a->to_string());
-      }
-    }
-  }
-
-  vector<msat_term> m_assumps;
-  m_assumps.reserve(assumptions.size());
-
-  shared_ptr<MsatTerm> ma;
-  for (const auto & a : assumptions)
-  {
-    ma = static_pointer_cast<MsatTerm>(a);
-    m_assumps.push_back(ma->term);
-  }
-
-  return check_sat_assuming_msatvec(m_assumps);
+  check_indicator_literals(assumptions.begin(), assumptions.end());
+  return check_sat_assuming_internal(assumptions.begin(), assumptions.end());
 }
 
 void MsatSolver::push(uint64_t num)
 {
+  SMT_TRACE_SPAN("MsatSolver::push", "backend");
   initialize_env();
   for (uint64_t i = 0; i < num; i++)
   {
@@ -309,6 +247,7 @@ void MsatSolver::push(uint64_t num)
 
 void MsatSolver::pop(uint64_t num)
 {
+  SMT_TRACE_SPAN("MsatSolver::pop", "backend");
   initialize_env();
   for (uint64_t i = 0; i < num; i++)
   {
@@ -323,6 +262,7 @@ uint64_t MsatSolver::get_context_level() const
 
 Term MsatSolver::get_value(const Term & t) const
 {
+  SMT_TRACE_SPAN("MsatSolver::get_value", "backend");
   initialize_env();
   shared_ptr<MsatTerm> mterm = static_pointer_cast<MsatTerm>(t);
   msat_term val = msat_get_model_value(env, mterm->term);
@@ -337,7 +277,7 @@ Term MsatSolver::get_value(const Term & t) const
     throw IncorrectUsageException(msg);
   }
 
-  return std::make_shared<MsatTerm> (env, val);
+  return wrap(val);
 }
 
 UnorderedTermMap MsatSolver::get_array_values(const Term & arr,
@@ -354,16 +294,15 @@ UnorderedTermMap MsatSolver::get_array_values(const Term & arr,
   Term val;
   while (msat_term_is_array_write(env, mval))
   {
-    idx = std::make_shared<MsatTerm>(env, msat_term_get_arg(mval, 1));
-    val = std::make_shared<MsatTerm>(env, msat_term_get_arg(mval, 2));
+    idx = wrap(msat_term_get_arg(mval, 1));
+    val = wrap(msat_term_get_arg(mval, 2));
     assignments[idx] = val;
     mval = msat_term_get_arg(mval, 0);
   }
 
   if (msat_term_is_array_const(env, mval))
   {
-    out_const_base =
-        std::make_shared<MsatTerm>(env, msat_term_get_arg(mval, 0));
+    out_const_base = wrap(msat_term_get_arg(mval, 0));
   }
 
   return assignments;
@@ -388,7 +327,7 @@ void MsatSolver::get_unsat_assumptions(UnorderedTermSet & out)
     {
       throw InternalSolverException("got an error term in the unsat core");
     }
-    out.insert(std::make_shared<MsatTerm>(env, assumption_map_.at(msat_term_id(*mcore_iter))));
+    out.insert(wrap(assumption_map_.at(msat_term_id(*mcore_iter))));
     ++mcore_iter;
   }
   msat_free(mcore);
@@ -603,11 +542,11 @@ Term MsatSolver::make_term(bool b) const
   initialize_env();
   if (b)
   {
-    return std::make_shared<MsatTerm> (env, msat_make_true(env));
+    return wrap(msat_make_true(env));
   }
   else
   {
-    return std::make_shared<MsatTerm> (env, msat_make_false(env));
+    return wrap(msat_make_false(env));
   }
 }
 
@@ -626,7 +565,7 @@ Term MsatSolver::make_term(int64_t i, const Sort & sort) const
       {
         throw IncorrectUsageException("");
       }
-      return std::make_shared<MsatTerm> (env, mval);
+      return wrap(mval);
     }
     else if (sk == REAL || sk == INT)
     {
@@ -635,7 +574,7 @@ Term MsatSolver::make_term(int64_t i, const Sort & sort) const
       {
         throw IncorrectUsageException("");
       }
-      return std::make_shared<MsatTerm> (env, mval);
+      return wrap(mval);
     }
     else
     {
@@ -667,7 +606,7 @@ Term MsatSolver::make_term(const std::string val,
       {
         throw IncorrectUsageException("");
       }
-      return std::make_shared<MsatTerm> (env, mval);
+      return wrap(mval);
     }
     else if (sk == REAL || sk == INT)
     {
@@ -682,7 +621,7 @@ Term MsatSolver::make_term(const std::string val,
       {
         throw IncorrectUsageException("");
       }
-      return std::make_shared<MsatTerm> (env, mval);
+      return wrap(mval);
     }
     else
     {
@@ -709,8 +648,7 @@ Term MsatSolver::make_term(const Term & val, const Sort & sort) const
   }
   shared_ptr<MsatSort> msort = static_pointer_cast<MsatSort>(sort);
   shared_ptr<MsatTerm> mval = static_pointer_cast<MsatTerm>(val);
-  return std::make_shared<MsatTerm>
-      (env, msat_make_array_const(env, msort->type, mval->term));
+  return wrap(msat_make_array_const(env, msort->type, mval->term));
 }
 
 Term MsatSolver::make_symbol(const string name, const Sort & sort)
@@ -746,7 +684,7 @@ Term MsatSolver::make_symbol(const string name, const Sort & sort)
 
   if (sort->get_sort_kind() == FUNCTION)
   {
-    return std::make_shared<MsatTerm> (env, decl);
+    return wrap(decl);
   }
   else
   {
@@ -755,7 +693,7 @@ Term MsatSolver::make_symbol(const string name, const Sort & sort)
     {
       throw InternalSolverException("Got error term.");
     }
-    return std::make_shared<MsatTerm> (env, res);
+    return wrap(res);
   }
 }
 
@@ -775,9 +713,9 @@ Term MsatSolver::get_symbol(const std::string & name)
   if (MSAT_ERROR_TERM(res))
   {
     // assume it is a function
-    return std::make_shared<MsatTerm>(env, decl);
+    return wrap(decl);
   }
-  return std::make_shared<MsatTerm>(env, res);
+  return wrap(res);
 }
 
 Term MsatSolver::make_param(const std::string name, const Sort & sort)
@@ -785,7 +723,7 @@ Term MsatSolver::make_param(const std::string name, const Sort & sort)
   initialize_env();
   shared_ptr<MsatSort> msort = static_pointer_cast<MsatSort>(sort);
   msat_term var = msat_make_variable(env, name.c_str(), msort->type);
-  return std::make_shared<MsatTerm>(env, var);
+  return wrap(var);
 }
 
 Term MsatSolver::make_term(Op op, const Term & t) const
@@ -887,7 +825,7 @@ Term MsatSolver::make_term(Op op, const Term & t) const
   }
   else
   {
-    return std::make_shared<MsatTerm> (env, res);
+    return wrap(res);
   }
 }
 
@@ -937,7 +875,7 @@ Term MsatSolver::make_term(Op op, const Term & t0, const Term & t1) const
   }
   else
   {
-    return std::make_shared<MsatTerm> (env, res);
+    return wrap(res);
   }
 }
 
@@ -1002,7 +940,7 @@ Term MsatSolver::make_term(Op op,
   }
   else
   {
-    return std::make_shared<MsatTerm> (env, res);
+    return wrap(res);
   }
 }
 
@@ -1064,7 +1002,7 @@ Term MsatSolver::make_term(Op op, const TermVec & terms) const
       }
       throw InternalSolverException(msg);
     }
-    return make_shared<MsatTerm>(env, res);
+    return wrap(res);
   }
   else if (is_variadic(op.prim_op))
   {
@@ -1082,7 +1020,7 @@ Term MsatSolver::make_term(Op op, const TermVec & terms) const
     {
       res = msat_fun(env, res, margs[i]);
     }
-    return make_shared<MsatTerm>(env, res);
+    return wrap(res);
   }
   else if (op == Forall || op == Exists)
   {
@@ -1108,7 +1046,7 @@ Term MsatSolver::make_term(Op op, const TermVec & terms) const
         res = msat_make_exists(env, t, res);
       }
     }
-    return make_shared<MsatTerm>(env, res);
+    return wrap(res);
   }
   else if (op.prim_op == Distinct)
   {
@@ -1137,6 +1075,8 @@ void MsatSolver::reset()
 
   cfg = msat_create_config();
   env = msat_create_env(cfg);
+  // the ids of the old environment may be reused
+  term_table_.clear();
 }
 
 void MsatSolver::reset_assertions()
@@ -1146,6 +1086,14 @@ void MsatSolver::reset_assertions()
   base_assertions_.clear();
 }
 
+MemoryStats MsatSolver::get_memory_stats() const
+{
+  MemoryStats stats = AbsSmtSolver::get_memory_stats();
+  stats.live_terms = term_table_.num_live();
+  stats.cache_entries["term_intern_table"] = term_table_.size();
+  return stats;
+}
+
 Term MsatSolver::substitute(const Term term,
                             const UnorderedTermMap & substitution_map) const
 {
@@ -1183,7 +1131,7 @@ Term MsatSolver::substitute(const Term term,
   msat_term res = msat_apply_substitution(
       env, mterm->term, to_subst.size(), &to_subst[0], &values[0]);
 
-  return Term(new MsatTerm(env, res));
+  return wrap(res);
 }
 
 void MsatSolver::dump_smt2(std::string filename) const
@@ -1247,18 +1195,21 @@ void MsatInterpolatingSolver::assert_formula(const Term & t)
 
 Result MsatInterpolatingSolver::check_sat()
 {
+  SMT_TRACE_SPAN("MsatInterpolatingSolver::check_sat", "backend");
   throw IncorrectUsageException(
       "Can't call check_sat from interpolating solver");
 }
 
 Result MsatInterpolatingSolver::check_sat_assuming(const TermVec & assumptions)
 {
+  SMT_TRACE_SPAN("MsatInterpolatingSolver::check_sat_assuming", "backend");
   throw IncorrectUsageException(
       "Can't call check_sat_assuming from interpolating solver");
 }
 
 Term MsatInterpolatingSolver::get_value(const Term & t) const
 {
+  SMT_TRACE_SPAN("MsatInterpolatingSolver::get_value", "backend");
   throw IncorrectUsageException("Can't get values from interpolating solver");
 }
 
@@ -1298,7 +1249,7 @@ Result MsatInterpolatingSolver::get_interpolant(const Term & A,
     }
     else
     {
-      out_I = make_shared<MsatTerm>(env, itp);
+      out_I = wrap(itp);
       return Result(UNSAT);
     }
   }
@@ -1358,7 +1309,7 @@ Result MsatInterpolatingSolver::get_sequence_interpolants(
     }
     else
     {
-      out_I.push_back(make_shared<MsatTerm>(env, mI));
+      out_I.push_back(wrap(mI));
     }
   }
 
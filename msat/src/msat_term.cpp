@@ -123,14 +123,18 @@ const std::unordered_map<msat_symbol_tag, PrimOp> tag2op({
 
 MsatTermIter::MsatTermIter(const MsatTermIter & it)
 {
+  env = it.env;
   term = it.term;
   pos = it.pos;
+  table = it.table;
 }
 
 MsatTermIter & MsatTermIter::operator=(const MsatTermIter & it)
 {
+  env = it.env;
   term = it.term;
   pos = it.pos;
+  table = it.table;
   return *this;
 }
 
@@ -140,7 +144,7 @@ const Term MsatTermIter::operator*()
 {
   if (!pos && msat_term_is_uf(env, term))
   {
-    return std::make_shared<MsatTerm> (env, msat_term_get_decl(term));
+    return MsatTerm::wrap(env, table, msat_term_get_decl(term));
   }
   else
   {
@@ -150,13 +154,13 @@ const Term MsatTermIter::operator*()
       actual_idx--;
     }
 
-    return std::make_shared<MsatTerm>(env, msat_term_get_arg(term, actual_idx));
+    return MsatTerm::wrap(env, table, msat_term_get_arg(term, actual_idx));
   }
 }
 
 TermIterBase * MsatTermIter::clone() const
 {
-  return new MsatTermIter(env, term, pos);
+  return new MsatTermIter(env, term, pos, table);
 }
 
 bool MsatTermIter::operator==(const MsatTermIter & it)
@@ -211,6 +215,33 @@ bool MsatTermIter::equal(const TermIterBase & other) const
 
 // MsatTerm implementation
 
+Term MsatTerm::wrap(msat_env env, TermInternTable * table, msat_term t)
+{
+  if (!table)
+  {
+    return std::make_shared<MsatTerm>(env, t);
+  }
+  // terms and declarations have separate ids
+  return table->intern(msat_term_id(t) << 1, [env, table, t]() {
+    shared_ptr<MsatTerm> res = std::make_shared<MsatTerm>(env, t);
+    res->intern_table = table;
+    return res;
+  });
+}
+
+Term MsatTerm::wrap(msat_env env, TermInternTable * table, msat_decl d)
+{
+  if (!table)
+  {
+    return std::make_shared<MsatTerm>(env, d);
+  }
+  return table->intern((msat_decl_id(d) << 1) | 1, [env, table, d]() {
+    shared_ptr<MsatTerm> res = std::make_shared<MsatTerm>(env, d);
+    res->intern_table = table;
+    return res;
+  });
+}
+
 size_t MsatTerm::hash() const { return get_id(); }
 
 size_t MsatTerm::get_id() const
@@ -595,7 +626,29 @@ uint64_t MsatTerm::to_int() const
   }
 }
 
-TermIter MsatTerm::begin() { return TermIter(new MsatTermIter(env, term, 0)); }
+void MsatTerm::to_bv_words(std::vector<uint64_t> & out)
+{
+  size_t width;
+  if (is_uf || !msat_term_is_number(env, term)
+      || !msat_is_bv_type(env, msat_term_get_type(term), &width))
+  {
+    throw IncorrectUsageException(
+        "Can only convert bit-vector values to words, got " + to_string());
+  }
+  // bit-vector numbers are non-negative integers below 2^width
+  mpq_t mval;
+  mpq_init(mval);
+  msat_term_to_number(env, term, mval);
+  out.assign((width + 63) / 64, 0);
+  size_t count;
+  mpz_export(out.data(), &count, -1, sizeof(uint64_t), 0, 0, mpq_numref(mval));
+  mpq_clear(mval);
+}
+
+TermIter MsatTerm::begin()
+{
+  return TermIter(new MsatTermIter(env, term, 0, intern_table));
+}
 
 TermIter MsatTerm::end()
 {
@@ -52,6 +52,8 @@ cdef extern from "solver_enums.h" namespace "smt":
     cdef c_SolverAttribute c_QUANTIFIERS "smt::QUANTIFIERS"
     cdef c_SolverAttribute c_BOOL_BV1_ALIASING "smt::BOOL_BV1_ALIASING"
     cdef c_SolverAttribute c_TIMELIMIT "smt::TIMELIMIT"
+    cdef c_SolverAttribute c_CONCURRENT_INSTANCES "smt::CONCURRENT_INSTANCES"
+    cdef c_SolverAttribute c_INTERNED_TERMS "smt::INTERNED_TERMS"
 
     string to_string(c_SolverAttribute sa) except +
 
@@ -199,6 +199,14 @@ cdef SolverAttribute TIMELIMIT = SolverAttribute()
 TIMELIMIT.sa = c_TIMELIMIT
 setattr(solverattr, "TIMELIMIT", TIMELIMIT)
 
+cdef SolverAttribute CONCURRENT_INSTANCES = SolverAttribute()
+CONCURRENT_INSTANCES.sa = c_CONCURRENT_INSTANCES
+setattr(solverattr, "CONCURRENT_INSTANCES", CONCURRENT_INSTANCES)
+
+cdef SolverAttribute INTERNED_TERMS = SolverAttribute()
+INTERNED_TERMS.sa = c_INTERNED_TERMS
+setattr(solverattr, "INTERNED_TERMS", INTERNED_TERMS)
+
 ################################################ PrimOps #################################################
 cdef class PrimOp:
     def __cinit__(self):
@@ -1,4 +1,3 @@
-from collections import ChainMap
 import fractions
 import functools as ft
 import gc
@@ -14,9 +13,9 @@ from pysmt.solvers.solver import (IncrementalTrackingSolver, UnsatCoreSolver,
                                   Converter, SolverOptions)
 from pysmt.solvers.smtlib import SmtLibBasicSolver, SmtLibIgnoreMixin
 from pysmt.solvers.eager import EagerModel
-from pysmt.walkers import DagWalker
 from pysmt.decorators import clear_pending_pop, catch_conversion_error
 from pysmt.logics import get_logic, SMTLIB2_LOGICS
+from pysmt import operators as op
 from pysmt import typing as pysmt_types
 
 
@@ -71,7 +70,7 @@ def _parse_real(s):
         else:
             return tree[0](*tree[1:])
 
-    return _parse(iter(repr(s)))
+    return _parse(iter(str(s)))
 
 
 class _SwitchSolver(IncrementalTrackingSolver,
@@ -91,22 +90,15 @@ class _SwitchSolver(IncrementalTrackingSolver,
         self.converter = SwitchConverter(environment,  self.solver, self.mgr)
 
     def get_model(self):
-        assignment = {}
-        for s in self.converter.declared_vars:
-            v = self.get_value(s)
-            assignment[s] = v
+        symbols = list(self.converter.declared_vars)
+        values = self.converter.get_values(symbols)
+        assignment = dict(zip(symbols, values))
         return EagerModel(assignment=assignment, environment=self.environment)
 
     def get_value(self, item):
         self._assert_no_function_type(item)
-        sort = item.get_type()
-        c_item = self.converter.convert(item)
-        val = self.solver.get_value(c_item)
-        # HACK because smt-switch sometimes loses sorts
-        # we can't use back
-        # should be: `r_val = self.converter.back(val)`
-        r_val = self.converter.back_walker._convert_value(val, sort)
-        assert r_val.get_type() == sort
+        r_val, = self.converter.get_values([item])
+        assert r_val.get_type() == item.get_type()
         return r_val
 
     @clear_pending_pop
@@ -128,9 +120,10 @@ class _SwitchSolver(IncrementalTrackingSolver,
         other_ass = []
         for x in assumptions:
             if x.is_literal():
-                bool_ass.append(self.converter.convert(x))
+                bool_ass.append(x)
             else:
                 other_ass.append(x)
+        bool_ass = self.converter.convert_all(bool_ass)
 
         if other_ass:
             self.push()
@@ -244,58 +237,157 @@ if 'cvc5' in ss.solvers:
     SWITCH_SOLVERS['cvc5'] = SwitchCvc5
 
 
-def check_args(cmp, n):
-    def wrapper(f):
-        @ft.wraps(f)
-        def walk_op(self, formula, args, **kwargs):
-            if not cmp(len(args), n):
-                raise ConvertExpressionError('Incorrect number of arguments')
-            return f(self, formula, args, **kwargs)
-        return walk_op
-    return wrapper
-
-
-def make_walk_nary(n, primop):
-    @check_args(operator.eq, n)
-    def walk_op(self, formula, args, **kwargs):
-        res = self.make_term(primop, *args)
-        return res
-    return walk_op
-
-
-make_walk_unary = ft.partial(make_walk_nary, 1)
-make_walk_binary = ft.partial(make_walk_nary, 2)
-
-
-def make_walk_variadic(n, primop):
-    @check_args(operator.ge, n)
-    def walk_op(self, formula, args, **kwargs):
-        builder = ft.partial(self.make_term, primop)
-        res = ft.reduce(builder, args)
-        return res
-    return walk_op
-
-
-class SwitchConverter(Converter, DagWalker):
+def _parse_int(s):
+    # model values of bit-vector and integer sorts, same notations as
+    # smt_switch.Term.__int__ (bit-vectors are read as unsigned)
+    if s[-1:] == 's':
+        # notation from z3 for signed bv
+        s = s[:-1]
+    if s[:2] == '#b':
+        return int(s[2:], 2)
+    elif s[:2] == '#x':
+        return int(s[2:], 16)
+    elif s[:5] == '(_ bv':
+        return int(s[5:s.find(' ', 5)])
+    elif s[:2] == '(-':
+        return -int(s[3:-1])
+    return int(s)
+
+
+def _op_table():
+    # pysmt node type -> (primop, number of arguments or None if variadic)
+    P = ss.primops
+    table = {
+        # Bool operators
+        op.AND: (P.And, None),
+        op.OR: (P.Or, None),
+        op.NOT: (P.Not, 1),
+        op.IFF: (P.Equal, None),
+        op.IMPLIES: (P.Implies, 2),
+        # Polymorphic Operators
+        op.ITE: (P.Ite, 3),
+        op.EQUALS: (P.Equal, 2),
+        # Int / real operators
+        op.LT: (P.Lt, 2),
+        op.LE: (P.Le, 2),
+        op.PLUS: (P.Plus, None),
+        op.TIMES: (P.Mult, None),
+        op.MINUS: (P.Minus, 2),
+        op.DIV: (P.Div, 2),
+        op.POW: (P.Pow, 2),
+        op.TOREAL: (P.To_Real, 1),
+        # BV Operators
+        op.BV_ADD: (P.BVAdd, 2),
+        op.BV_AND: (P.BVAnd, 2),
+        op.BV_ASHR: (P.BVAshr, 2),
+        op.BV_COMP: (P.BVComp, 2),
+        op.BV_CONCAT: (P.Concat, 2),
+        op.BV_LSHL: (P.BVShl, 2),
+        op.BV_LSHR: (P.BVLshr, 2),
+        op.BV_MUL: (P.BVMul, 2),
+        op.BV_NEG: (P.BVNeg, 1),
+        op.BV_NOT: (P.BVNot, 1),
+        op.BV_OR: (P.BVOr, 2),
+        op.BV_SDIV: (P.BVSdiv, 2),
+        op.BV_SLE: (P.BVSle, 2),
+        op.BV_SLT: (P.BVSlt, 2),
+        op.BV_SREM: (P.BVSrem, 2),
+        op.BV_SUB: (P.BVSub, 2),
+        op.BV_TONATURAL: (P.BV_To_Nat, 1),
+        op.BV_UDIV: (P.BVUdiv, 2),
+        op.BV_ULE: (P.BVUle, 2),
+        op.BV_ULT: (P.BVUlt, 2),
+        op.BV_UREM: (P.BVUrem, 2),
+        op.BV_XOR: (P.BVXor, 2),
+        # Indexed BV operators, the indices are added by _emit
+        op.BV_EXTRACT: (P.Extract, 1),
+        op.BV_ROL: (P.Rotate_Left, 1),
+        op.BV_ROR: (P.Rotate_Right, 1),
+        op.BV_SEXT: (P.Sign_Extend, 1),
+        op.BV_ZEXT: (P.Zero_Extend, 1),
+        # array operators
+        op.ARRAY_SELECT: (P.Select, 2),
+        op.ARRAY_STORE: (P.Store, 3),
+    }
+    return {k: (po.as_int(), n) for k, (po, n) in table.items()}
+
+
+_OP_TABLE = _op_table()
+_APPLY = ss.primops.Apply.as_int()
+_STORE = ss.primops.Store.as_int()
+
+
+class SwitchConverter(Converter):
+    '''
+    Converts pysmt formulas by flattening all their new nodes into one
+    ss.TermDagBuilder.build call, rather than one make_term call (and one
+    Term object) per node.
+    '''
     def __init__(self, environment, solver, mgr):
-        DagWalker.__init__(self, environment)
+        self.env = environment
         self.solver = solver
-        self.make_term = solver.make_term
-        self.make_symbol = solver.make_symbol
         self.make_sort = solver.make_sort
-        self.declared_funs = fs = {}
-        self.declared_vars = vs = {}
-        self.declared_syms = ChainMap(vs, fs)
+        self.builder = ss.TermDagBuilder(solver)
+        self.nodes = {}          # pysmt formula -> builder node
+        self.declared_funs = {}  # pysmt symbol -> builder node
+        self.declared_vars = {}  # pysmt symbol -> builder node
         self.declared_sorts = {}
         self.back_walker = BackVisitor(mgr)
 
     @catch_conversion_error
     def convert(self, formula):
-        return self.walk(formula)
+        return self.convert_all((formula,))[0]
+
+    @catch_conversion_error
+    def convert_all(self, formulas):
+        '''
+        Convert several formulas with a single call into the library.
+        '''
+        nodes = self._build(formulas)
+        return [self.builder.get_term(nodes[f]) for f in formulas]
 
     def back(self, expr):
         return self.back_walker.walk_dag(expr)
 
+    def get_values(self, formulas):
+        '''
+        Get the model values of several formulas as pysmt constants.
+
+        The values are fetched with one call into the library and parsed
+        from their SMT-LIB representation, except for arrays which go
+        through the term walker.
+        '''
+        nodes = self._build(formulas)
+        res = [None] * len(formulas)
+        batch = []
+        for i, f in enumerate(formulas):
+            sort = f.get_type()
+            if sort.is_array_type():
+                # HACK because smt-switch sometimes loses sorts
+                # we can't use back
+                val = self.solver.get_value(self.builder.get_term(nodes[f]))
+                res[i] = self.back_walker._convert_value(val, sort)
+            else:
+                batch.append(i)
+
+        values = self.builder.get_values([nodes[formulas[i]] for i in batch])
+        for i, val in zip(batch, values):
+            res[i] = self._parse_value(val, formulas[i].get_type())
+        return res
+
+    def _parse_value(self, val, sort):
+        mgr = self.back_walker.mgr
+        if sort.is_bool_type():
+            return mgr.Bool(val == 'true')
+        elif sort.is_bv_type():
+            return mgr.BV(_parse_int(val), sort.width)
+        elif sort.is_int_type():
+            return mgr.Int(_parse_int(val))
+        elif sort.is_real_type():
+            return mgr.Real(_parse_real(val))
+        else:
+            raise ConvertExpressionError(f'Unsupported sort: {sort}')
+
     def _convert_sort(self, sort):
         try:
             return self.declared_sorts[sort]
@@ -325,147 +417,141 @@ class SwitchConverter(Converter, DagWalker):
 
         return self.declared_sorts.setdefault(sort, c_sort)
 
+    def _build(self, formulas):
+        '''
+        Build the nodes of formulas which are not built yet and return the
+        map from formulas to nodes.
+        '''
+        nodes = self.nodes
+        dag = _DagWriter(self, len(self.builder))
+        stack = [(f, False) for f in formulas]
+        while stack:
+            f, expanded = stack.pop()
+            if f in nodes or f in dag.nodes:
+                continue
+            if expanded:
+                dag.emit(f)
+                continue
+            stack.append((f, True))
+            if f.is_function_application():
+                stack.append((f.function_name(), False))
+            stack.extend((a, False) for a in f.args())
+
+        if dag.code:
+            self.builder.build(dag.code, dag.strings, dag.sorts)
+            nodes.update(dag.nodes)
+            for s, n in dag.symbols:
+                if s.symbol_type().is_function_type():
+                    self.declared_funs[s] = n
+                else:
+                    self.declared_vars[s] = n
+        return nodes
+
+
+class _DagWriter:
+    '''
+    Serializes pysmt nodes into the code of a ss.TermDagBuilder (see
+    term_dag_builder.h). The children of a node must be emitted first.
+    '''
+    def __init__(self, converter, first):
+        self.converter = converter
+        self.next = first
+        self.code = []
+        self.strings = []
+        self.sorts = []
+        self.sort_idx = {}
+        self.nodes = {}
+        self.symbols = []
+
+    def node(self, f):
+        try:
+            return self.nodes[f]
+        except KeyError:
+            return self.converter.nodes[f]
 
-    # Declarations
-    @check_args(operator.eq, 0)
-    def walk_symbol(self, formula, args, **kwargs):
+    def sort(self, sort):
         try:
-            return self.declared_syms[formula]
+            return self.sort_idx[sort]
         except KeyError:
             pass
-
-        sort_i = formula.symbol_type()
-        sort = self._convert_sort(sort_i)
-        res = self.make_symbol(formula.symbol_name(), sort)
-
-        if sort_i.is_function_type():
-            return self.declared_funs.setdefault(formula, res)
-        else:
-            return self.declared_vars.setdefault(formula, res)
-
-    @check_args(operator.eq, 0)
-    def _walk_constant(self, formula, args, **kwargs):
-        sort = self._convert_sort(formula.constant_type())
-        if formula.constant_type().is_bool_type():
-            res = self.make_term(bool(formula.constant_value()))
-        elif formula.constant_type().is_real_type():
-            val = formula.constant_value()
-            res = self.make_term(f'{val.numerator}/{val.denominator}', sort)
+        self.sorts.append(self.converter._convert_sort(sort))
+        return self.sort_idx.setdefault(sort, len(self.sorts) - 1)
+
+    def string(self, s):
+        self.strings.append(s)
+        return len(self.strings) - 1
+
+    def new_node(self):
+        self.next += 1
+        return self.next - 1
+
+    def emit(self, f):
+        code = self.code
+        if f.is_symbol():
+            code += (ss.DAG_SYMBOL, self.string(f.symbol_name()),
+                     self.sort(f.symbol_type()))
+            self.symbols.append((f, self.next))
+        elif f.is_bool_constant():
+            code += (ss.DAG_BOOL, int(f.constant_value()))
+        elif f.is_constant():
+            T = f.constant_type()
+            val = f.constant_value()
+            if T.is_real_type():
+                val = f'{val.numerator}/{val.denominator}'
+            else:
+                val = repr(val)
+            code += (ss.DAG_VALUE, self.string(val), self.sort(T))
+        elif f.is_function_application():
+            args = f.args()
+            code += (ss.DAG_OP, _APPLY, 0, len(args) + 1,
+                     self.node(f.function_name()))
+            code.extend(self.node(a) for a in args)
+        elif f.is_array_value():
+            # constant array with the assigned values stored on top
+            code += (ss.DAG_CONST_ARRAY, self.sort(f.get_type()),
+                     self.node(f.array_value_default()))
+            for idx, val in f.array_value_assigned_values_map().items():
+                prev = self.new_node()
+                code += (ss.DAG_OP, _STORE, 0, 3, prev, self.node(idx),
+                         self.node(val))
         else:
-            res = self.make_term(repr(formula.constant_value()), sort)
-        return res
-
-    walk_bool_constant = _walk_constant
-    walk_bv_constant = _walk_constant
-    walk_int_constant = _walk_constant
-    walk_real_constant = _walk_constant
-
-    # Bool operators
-    walk_and = make_walk_variadic(2, ss.primops.And)
-    walk_or = make_walk_variadic(2, ss.primops.Or)
-    walk_not = make_walk_unary(ss.primops.Not)
-    walk_iff = make_walk_variadic(2, ss.primops.Equal)
-    walk_implies = make_walk_binary(ss.primops.Implies)
-
-    # Polymorphic Operators
-    walk_ite = make_walk_nary(3, ss.primops.Ite)
-
-    def walk_function(self, formula, args, **kwargs):
-        name = formula.function_name()
-        f = self.walk_symbol(name, name.args())
-        res = self.make_term(ss.primops.Apply, [f, *args])
-        return res
-
-    # Int / real operatos
-    walk_lt = make_walk_binary(ss.primops.Lt)
-    walk_le = make_walk_binary(ss.primops.Le)
-    walk_equals = make_walk_binary(ss.primops.Equal)
-    walk_ge = make_walk_binary(ss.primops.Ge)
-    walk_gt = make_walk_binary(ss.primops.Gt)
-
-    walk_plus = make_walk_variadic(2, ss.primops.Plus)
-    walk_times = make_walk_variadic(2, ss.primops.Mult)
-
-    walk_minus = make_walk_binary(ss.primops.Minus)
-    walk_div = make_walk_binary(ss.primops.Div)
-    walk_pow = make_walk_binary(ss.primops.Pow)
-
-    walk_toreal = make_walk_unary(ss.primops.To_Real)
-
-    # BV Operators
-    walk_bv_add = make_walk_binary(ss.primops.BVAdd)
-    walk_bv_and = make_walk_binary(ss.primops.BVAnd)
-    walk_bv_ashr = make_walk_binary(ss.primops.BVAshr)
-    walk_bv_comp = make_walk_binary(ss.primops.BVComp)
-    walk_bv_concat = make_walk_binary(ss.primops.Concat)
-
-    @check_args(operator.eq, 1)
-    def walk_bv_extract(self, formula, args, **kwargs):
-        res = self.make_term(
-            ss.Op(
-                ss.primops.Extract,
-                formula.bv_extract_end(),
-                formula.bv_extract_start(),
-            ),
-            *args
-        )
-        return res
-
-    walk_bv_lshl = make_walk_binary(ss.primops.BVShl)
-    walk_bv_lshr = make_walk_binary(ss.primops.BVLshr)
-    walk_bv_mul = make_walk_binary(ss.primops.BVMul)
-    walk_bv_neg = make_walk_unary(ss.primops.BVNeg)
-    walk_bv_not = make_walk_unary(ss.primops.BVNot)
-    walk_bv_or = make_walk_binary(ss.primops.BVOr)
-
-    @check_args(operator.eq, 1)
-    def walk_bv_rol(self, formula, args, **kwargs):
-        res = self.make_term(
-            ss.Op(ss.primops.Rotate_Left, formula.bv_rotation_step()),
-            *args
-        )
-        return res
-
-    @check_args(operator.eq, 1)
-    def walk_bv_ror(self, formula, args, **kwargs):
-        res = self.make_term(
-            ss.Op(ss.primops.Rotate_Right, formula.bv_rotation_step()),
-            *args
-        )
-        return res
-
-    walk_bv_sdiv = make_walk_binary(ss.primops.BVSdiv)
+            self._emit_op(f)
+        self.nodes[f] = self.new_node()
 
-    @check_args(operator.eq, 1)
-    def walk_bv_sext(self, formula, args, **kwargs):
-        res = self.make_term(
-            ss.Op(ss.primops.Sign_Extend, formula.bv_extend_step()),
-            *args
-        )
-        return res
-
-    walk_bv_sle = make_walk_binary(ss.primops.BVSle)
-    walk_bv_slt = make_walk_binary(ss.primops.BVSlt)
-    walk_bv_srem = make_walk_binary(ss.primops.BVSrem)
-    walk_bv_sub = make_walk_binary(ss.primops.BVSub)
-    walk_bv_tonatural = make_walk_unary(ss.primops.BV_To_Nat)
-    walk_bv_udiv = make_walk_binary(ss.primops.BVUdiv)
-    walk_bv_ule = make_walk_binary(ss.primops.BVUle)
-    walk_bv_ult = make_walk_binary(ss.primops.BVUlt)
-    walk_bv_urem = make_walk_binary(ss.primops.BVUrem)
-    walk_bv_xor = make_walk_binary(ss.primops.BVXor)
-
-    @check_args(operator.eq, 1)
-    def walk_bv_zext(self, formula, args, **kwargs):
-        res = self.make_term(
-            ss.Op(ss.primops.Zero_Extend, formula.bv_extend_step()),
-            *args
-        )
-        return res
-
-    #array operators
-    walk_array_select = make_walk_binary(ss.primops.Select)
-    walk_array_store = make_walk_nary(3, ss.primops.Store)
+    def _emit_op(self, f):
+        try:
+            po, n = _OP_TABLE[f.node_type()]
+        except KeyError:
+            raise ConvertExpressionError(
+                f'Unsupported operator: {op.op_to_str(f.node_type())}'
+            ) from None
+
+        code = self.code
+        args = [self.node(a) for a in f.args()]
+        if n is None:
+            if len(args) < 2:
+                raise ConvertExpressionError('Incorrect number of arguments')
+            # left-associated chain of binary applications
+            acc = args[0]
+            for a in args[1:-1]:
+                code += (ss.DAG_OP, po, 0, 2, acc, a)
+                acc = self.new_node()
+            code += (ss.DAG_OP, po, 0, 2, acc, args[-1])
+            return
+        elif len(args) != n:
+            raise ConvertExpressionError('Incorrect number of arguments')
+
+        if f.is_bv_extract():
+            code += (ss.DAG_OP, po, 2, f.bv_extract_end(),
+                     f.bv_extract_start())
+        elif f.is_bv_rol() or f.is_bv_ror():
+            code += (ss.DAG_OP, po, 1, f.bv_rotation_step())
+        elif f.is_bv_sext() or f.is_bv_zext():
+            code += (ss.DAG_OP, po, 1, f.bv_extend_step())
+        else:
+            code += (ss.DAG_OP, po, 0)
+        code.append(n)
+        code.extend(args)
 
 
 _INDEXED_OPERATORS = frozenset((
@@ -576,7 +662,7 @@ class BackVisitor(ss.TermDagVisitor):
         else:
             assert term.get_sort().get_sort_kind() is ss.sortkinds.FUNCTION
             sort = self._convert_sort(term.get_sort())
-            return slf.mgr.Symbol(str(term), sort)
+            return self.mgr.Symbol(str(term), sort)
 
     def _convert_sort(self, sort):
         kind = sort.get_sort_kind()
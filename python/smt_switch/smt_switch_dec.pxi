@@ -129,6 +129,29 @@ cdef extern from "sorting_network.h" namespace "smt":
         c_TermVec sorting_network(const c_TermVec & unsorted) except +
 
 
+cdef extern from "term_dag_builder.h" namespace "smt":
+    cdef enum c_TermDagNodeKind "smt::TermDagNodeKind":
+        c_DAG_OP "smt::DAG_OP"
+        c_DAG_SYMBOL "smt::DAG_SYMBOL"
+        c_DAG_VALUE "smt::DAG_VALUE"
+        c_DAG_BOOL "smt::DAG_BOOL"
+        c_DAG_CONST_ARRAY "smt::DAG_CONST_ARRAY"
+
+    cdef cppclass c_TermDag "smt::TermDag":
+        c_TermDag() except +
+        vector[int64_t] code
+        vector[string] strings
+        c_SortVec sorts
+
+    cdef cppclass c_TermDagBuilder "smt::TermDagBuilder":
+        c_TermDagBuilder(const c_SmtSolver & solver) except +
+        size_t build(const c_TermDag & dag) except +
+        c_Term get_term(size_t id) except +
+        size_t size() except +
+        vector[string] get_values(const vector[size_t] & ids) except +
+        void clear() except +
+
+
 cdef extern from "utils.h" namespace "smt":
     void get_free_symbolic_consts(const c_Term & term, c_UnorderedTermSet & out) except +
     void get_free_symbols(const c_Term & term, c_UnorderedTermSet & out) except +
@@ -156,3 +179,7 @@ cdef class SmtSolver:
 cdef class SortingNetwork:
     cdef c_SortingNetwork * csn
     cdef SmtSolver _solver
+
+cdef class TermDagBuilder:
+    cdef c_TermDagBuilder * ctdb
+    cdef SmtSolver _solver
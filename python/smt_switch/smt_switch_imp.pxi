@@ -16,6 +16,8 @@ from smt_switch cimport c_UnorderedTermMap
 from smt_switch cimport c_TermIter
 from smt_switch cimport c_PrimOp, c_SortKind, c_BOOL
 from smt_switch cimport c_SortingNetwork
+from smt_switch cimport c_TermDag, c_TermDagBuilder
+from smt_switch cimport c_DAG_OP, c_DAG_SYMBOL, c_DAG_VALUE, c_DAG_BOOL, c_DAG_CONST_ARRAY
 
 from smt_switch cimport get_free_symbolic_consts as c_get_free_symbolic_consts
 from smt_switch cimport get_free_symbols as c_get_free_symbols
@@ -461,6 +463,62 @@ cdef class SortingNetwork:
         return res
 
 
+# node kinds of the code passed to TermDagBuilder.build
+DAG_OP = <int> c_DAG_OP
+DAG_SYMBOL = <int> c_DAG_SYMBOL
+DAG_VALUE = <int> c_DAG_VALUE
+DAG_BOOL = <int> c_DAG_BOOL
+DAG_CONST_ARRAY = <int> c_DAG_CONST_ARRAY
+
+
+cdef class TermDagBuilder:
+    '''
+    Builds whole term DAGs with one call into the library, instead of one
+    make_term call per node. The layout of the code is documented in
+    term_dag_builder.h, e.g. x + 3 with x a new symbol is:
+      code = [DAG_SYMBOL, 0, 0,
+              DAG_VALUE, 1, 0,
+              DAG_OP, primops.BVAdd.as_int(), 0, 2, n, n + 1]
+      strings = ['x', '3'], sorts = [bvsort]
+    where n is the number of nodes built before (len(builder)).
+    '''
+    def __cinit__(self, SmtSolver solver):
+        self.ctdb = new c_TermDagBuilder(solver.css)
+        self._solver = solver
+
+    def __dealloc__(self):
+        del self.ctdb
+
+    def build(self, list code, list strings, list sorts):
+        '''
+        Build the serialized nodes and return the number of the first one.
+        '''
+        cdef c_TermDag dag
+        dag.code = code
+        for st in strings:
+            dag.strings.push_back((<str?> st).encode())
+        for so in sorts:
+            dag.sorts.push_back((<Sort?> so).cs)
+        return dref(self.ctdb).build(dag)
+
+    def get_term(self, size_t node):
+        cdef Term term = Term(self._solver)
+        term.ct = dref(self.ctdb).get_term(node)
+        return term
+
+    def get_values(self, list nodes):
+        '''
+        Return the SMT-LIB strings of the model values of several nodes.
+        '''
+        return [v.decode() for v in dref(self.ctdb).get_values(nodes)]
+
+    def clear(self):
+        dref(self.ctdb).clear()
+
+    def __len__(self):
+        return dref(self.ctdb).size()
+
+
 # Utils
 
 def get_free_symbolic_consts(Term term):
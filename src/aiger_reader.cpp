@@ -0,0 +1,402 @@
+/*********************                                                        */
+/*! \file aiger_reader.cpp
+** \verbatim
+** Top contributors (to current version):
+**   agent
+** This file is part of the smt-switch project.
+** Copyright (c) 2026 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved.  See the file LICENSE in the top-level source
+** directory for licensing information.\endverbatim
+**
+** \brief Hand-written reader for the AIGER format (ASCII and binary).
+**
+**/
+
+#include "aiger_reader.h"
+
+#include <cstring>
+
+#include "mapped_file.h"
+
+using namespace std;
+
+namespace smt {
+
+AigerReader::AigerReader(const SmtSolver & solver)
+    : solver_(solver), boolsort_(solver->make_sort(BOOL)), max_var_(0)
+{
+}
+
+void AigerReader::parse(const std::string & filename)
+{
+  MappedFile f(filename);
+  parse_buffer(f.data(), f.data() + f.size());
+}
+
+void AigerReader::parse_string(const std::string & input)
+{
+  parse_buffer(input.data(), input.data() + input.size());
+}
+
+void AigerReader::error(const std::string & msg) const
+{
+  throw SmtException("aiger: " + msg);
+}
+
+Term AigerReader::literal(uint64_t lit) const
+{
+  uint64_t v = lit >> 1;
+  if (v > max_var_ || !vars_[v])
+  {
+    error("undefined literal " + std::to_string(lit));
+  }
+  if (!(lit & 1))
+  {
+    return vars_[v];
+  }
+  Term & neg = neg_vars_[v];
+  if (!neg)
+  {
+    neg = solver_->make_term(Not, vars_[v]);
+  }
+  return neg;
+}
+
+Term AigerReader::get_symbol(const std::string & name) const
+{
+  auto it = symbols_.find(name);
+  return it == symbols_.end() ? Term() : it->second;
+}
+
+void AigerReader::parse_buffer(const char * begin, const char * end)
+{
+  const char * p = begin;
+
+  auto read_uint = [&]() -> uint64_t {
+    while (p < end && *p == ' ')
+    {
+      ++p;
+    }
+    if (p == end || *p < '0' || *p > '9')
+    {
+      error("expected an unsigned integer at offset "
+            + std::to_string(p - begin));
+    }
+    uint64_t v = 0;
+    while (p < end && *p >= '0' && *p <= '9')
+    {
+      v = v * 10 + (*p++ - '0');
+    }
+    return v;
+  };
+  auto at_eol = [&]() {
+    while (p < end && (*p == ' ' || *p == '\r'))
+    {
+      ++p;
+    }
+    return p == end || *p == '\n';
+  };
+  auto read_eol = [&]() {
+    if (!at_eol())
+    {
+      error("expected end of line at offset " + std::to_string(p - begin));
+    }
+    if (p < end)
+    {
+      ++p;
+    }
+  };
+  auto read_lits = [&](uint64_t n, vector<uint64_t> & out) {
+    out.resize(n);
+    for (uint64_t i = 0; i < n; ++i)
+    {
+      out[i] = read_uint();
+      read_eol();
+    }
+  };
+
+  // header: aag|aig M I L O A [B C J F]
+  if (end - p < 4 || (memcmp(p, "aag ", 4) && memcmp(p, "aig ", 4)))
+  {
+    error("expected aag or aig header");
+  }
+  bool binary = p[1] == 'i';
+  p += 3;
+  max_var_ = read_uint();
+  uint64_t num_inputs = read_uint();
+  uint64_t num_latches = read_uint();
+  uint64_t num_outputs = read_uint();
+  uint64_t num_ands = read_uint();
+  uint64_t header[4] = { 0, 0, 0, 0 };  // B C J F
+  for (size_t i = 0; i < 4 && !at_eol(); ++i)
+  {
+    header[i] = read_uint();
+  }
+  read_eol();
+  uint64_t num_bad = header[0];
+  uint64_t num_constraints = header[1];
+  uint64_t num_justice = header[2];
+  uint64_t num_fairness = header[3];
+
+  if (binary && max_var_ != num_inputs + num_latches + num_ands)
+  {
+    error("binary header requires M = I + L + A");
+  }
+
+  vars_.assign(max_var_ + 1, Term());
+  neg_vars_.assign(max_var_ + 1, Term());
+  vars_[0] = solver_->make_term(false);
+  and_rhs0_.assign(max_var_ + 1, 0);
+  and_rhs1_.assign(max_var_ + 1, 0);
+
+  // read the structure as plain literals
+  vector<uint64_t> input_lits(num_inputs);
+  vector<uint64_t> latch_lits(num_latches);
+  vector<uint64_t> latch_next(num_latches);
+  vector<uint64_t> latch_reset(num_latches, 0);
+  for (uint64_t i = 0; i < num_inputs; ++i)
+  {
+    if (binary)
+    {
+      input_lits[i] = 2 * (i + 1);
+    }
+    else
+    {
+      input_lits[i] = read_uint();
+      read_eol();
+    }
+  }
+  for (uint64_t i = 0; i < num_latches; ++i)
+  {
+    latch_lits[i] = binary ? 2 * (num_inputs + i + 1) : read_uint();
+    latch_next[i] = read_uint();
+    if (!at_eol())
+    {
+      latch_reset[i] = read_uint();
+    }
+    read_eol();
+  }
+
+  vector<uint64_t> output_lits, bad_lits, constraint_lits, fairness_lits;
+  vector<uint64_t> justice_sizes;
+  read_lits(num_outputs, output_lits);
+  read_lits(num_bad, bad_lits);
+  read_lits(num_constraints, constraint_lits);
+  read_lits(num_justice, justice_sizes);
+  vector<vector<uint64_t>> justice_lits(num_justice);
+  for (uint64_t i = 0; i < num_justice; ++i)
+  {
+    read_lits(justice_sizes[i], justice_lits[i]);
+  }
+  read_lits(num_fairness, fairness_lits);
+
+  and_vars_.assign(num_ands, 0);
+  for (uint64_t i = 0; i < num_ands; ++i)
+  {
+    uint64_t lhs, rhs0, rhs1;
+    if (binary)
+    {
+      // delta encoding: lhs > rhs0 >= rhs1
+      auto decode = [&]() -> uint64_t {
+        uint64_t x = 0;
+        unsigned shift = 0;
+        while (true)
+        {
+          if (p == end || shift > 63)
+          {
+            error("truncated binary AND gate");
+          }
+          uint8_t ch = *p++;
+          x |= uint64_t(ch & 0x7f) << shift;
+          if (!(ch & 0x80))
+          {
+            return x;
+          }
+          shift += 7;
+        }
+      };
+      lhs = 2 * (num_inputs + num_latches + i + 1);
+      rhs0 = lhs - decode();
+      rhs1 = rhs0 - decode();
+    }
+    else
+    {
+      lhs = read_uint();
+      rhs0 = read_uint();
+      rhs1 = read_uint();
+      read_eol();
+    }
+    uint64_t v = lhs >> 1;
+    if ((lhs & 1) || v == 0 || v > max_var_ || (rhs0 >> 1) > max_var_
+        || (rhs1 >> 1) > max_var_)
+    {
+      error("invalid AND gate " + std::to_string(lhs));
+    }
+    and_vars_[i] = v;
+    and_rhs0_[v] = rhs0;
+    and_rhs1_[v] = rhs1;
+  }
+
+  // symbol table, terminated by an optional comment section
+  vector<string> input_names(num_inputs), latch_names(num_latches);
+  while (p < end && *p != '\n')
+  {
+    char kind = *p;
+    if (kind == 'c' && (p + 1 == end || p[1] == '\n' || p[1] == '\r'))
+    {
+      break;
+    }
+    ++p;
+    uint64_t pos = read_uint();
+    if (p < end && *p == ' ')
+    {
+      ++p;
+    }
+    const char * name_begin = p;
+    while (p < end && *p != '\n')
+    {
+      ++p;
+    }
+    if (kind == 'i' && pos < num_inputs)
+    {
+      input_names[pos].assign(name_begin, p);
+    }
+    else if (kind == 'l' && pos < num_latches)
+    {
+      latch_names[pos].assign(name_begin, p);
+    }
+    if (p < end)
+    {
+      ++p;
+    }
+  }
+
+  // create the symbols
+  for (uint64_t i = 0; i < num_inputs; ++i)
+  {
+    string name =
+        input_names[i].empty() ? "i" + std::to_string(i) : input_names[i];
+    Term t = solver_->make_symbol(name, boolsort_);
+    vars_[input_lits[i] >> 1] = t;
+    symbols_[name] = t;
+    inputs_.push_back(t);
+  }
+  for (uint64_t i = 0; i < num_latches; ++i)
+  {
+    string name =
+        latch_names[i].empty() ? "l" + std::to_string(i) : latch_names[i];
+    Term t = solver_->make_symbol(name, boolsort_);
+    vars_[latch_lits[i] >> 1] = t;
+    symbols_[name] = t;
+    states_.push_back(t);
+  }
+
+  // build the AND gates, in order for binary files
+  if (binary)
+  {
+    for (uint64_t v : and_vars_)
+    {
+      vars_[v] = solver_->make_term(
+          And, literal(and_rhs0_[v]), literal(and_rhs1_[v]));
+    }
+  }
+  else
+  {
+    build_ands();
+  }
+
+  for (uint64_t i = 0; i < num_latches; ++i)
+  {
+    Term latch = states_[i];
+    next_[latch] = literal(latch_next[i]);
+    if (latch_reset[i] != latch_lits[i])
+    {
+      init_[latch] = literal(latch_reset[i]);
+    }
+  }
+  for (auto lit : output_lits)
+  {
+    outputs_.push_back(literal(lit));
+  }
+  for (auto lit : bad_lits)
+  {
+    bad_.push_back(literal(lit));
+  }
+  for (auto lit : constraint_lits)
+  {
+    constraints_.push_back(literal(lit));
+  }
+  for (const auto & lits : justice_lits)
+  {
+    TermVec conds;
+    for (auto lit : lits)
+    {
+      conds.push_back(literal(lit));
+    }
+    justice_.push_back(conds);
+  }
+  for (auto lit : fairness_lits)
+  {
+    fairness_.push_back(literal(lit));
+  }
+}
+
+void AigerReader::build_ands()
+{
+  // iterative DFS, ASCII AND gates may appear in any order
+  enum
+  {
+    UNVISITED = 0,
+    IN_PROGRESS,
+    DONE
+  };
+  vector<uint8_t> state(max_var_ + 1, UNVISITED);
+  vector<bool> is_and(max_var_ + 1, false);
+  for (uint64_t v : and_vars_)
+  {
+    is_and[v] = true;
+  }
+
+  vector<uint64_t> stack;
+  for (uint64_t v : and_vars_)
+  {
+    stack.push_back(v);
+    while (stack.size())
+    {
+      uint64_t u = stack.back();
+      if (state[u] == DONE)
+      {
+        stack.pop_back();
+      }
+      else if (state[u] == UNVISITED)
+      {
+        state[u] = IN_PROGRESS;
+        for (uint64_t c : { and_rhs0_[u] >> 1, and_rhs1_[u] >> 1 })
+        {
+          if (c && !vars_[c])
+          {
+            if (!is_and[c])
+            {
+              error("undefined literal " + std::to_string(2 * c));
+            }
+            if (state[c] == IN_PROGRESS)
+            {
+              error("cyclic AND gate " + std::to_string(2 * c));
+            }
+            stack.push_back(c);
+          }
+        }
+      }
+      else
+      {
+        stack.pop_back();
+        vars_[u] = solver_->make_term(
+            And, literal(and_rhs0_[u]), literal(and_rhs1_[u]));
+        state[u] = DONE;
+      }
+    }
+  }
+}
+
+}  // namespace smt
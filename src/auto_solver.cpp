@@ -0,0 +1,797 @@
+/*********************                                                        */
+/*! \file auto_solver.cpp
+** \verbatim
+** Top contributors (to current version):
+**   agent
+** This file is part of the smt-switch project.
+** Copyright (c) 2026 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved.  See the file LICENSE in the top-level source
+** directory for licensing information.\endverbatim
+**
+** \brief Class that picks a backend from the features of the asserted
+**        formulas.
+**/
+
+#include "auto_solver.h"
+
+#include <algorithm>
+#include <map>
+#include <sstream>
+
+#include "exceptions.h"
+
+using namespace std;
+
+namespace smt {
+
+namespace {
+
+// the backends to try in order for each group of logics
+const vector<pair<vector<string>, vector<SolverEnum>>> default_rules = {
+  { { "QF_BV", "QF_ABV", "QF_UFBV", "QF_AUFBV" }, { BZLA, BTOR, YICES2 } },
+  { { "QF_UF" }, { YICES2, BTOR, BZLA } },
+  { { "QF_LIA",
+      "QF_LRA",
+      "QF_LIRA",
+      "QF_UFLIA",
+      "QF_UFLRA",
+      "QF_ALIA",
+      "QF_AUFLIA" },
+    { YICES2, MSAT } },
+  { { "QF_NIA", "QF_NRA", "QF_NIRA", "QF_UFNIA", "QF_UFNRA" },
+    { Z3, CVC5, YICES2 } },
+  { { "*" }, { Z3, CVC5, YICES2, MSAT, BZLA, BTOR } }
+};
+
+// SolverEnum values that can be named in a rule table
+const vector<SolverEnum> backend_enums = { BTOR, BZLA, CVC5, MSAT, YICES2, Z3 };
+
+size_t decade(size_t n)
+{
+  size_t d = 0;
+  while (n >= 10)
+  {
+    n /= 10;
+    ++d;
+  }
+  return d;
+}
+
+size_t power_of_ten(size_t d)
+{
+  size_t res = 1;
+  while (d--)
+  {
+    res *= 10;
+  }
+  return res;
+}
+
+// the rule that picks the backend with the best PAR-2 score
+// returns false if there are no runs
+bool best_rule(const vector<const TimingRecord *> & runs,
+               double timeout,
+               SelectionRule & rule)
+{
+  map<SolverEnum, pair<size_t, double>> scores;
+  for (auto r : runs)
+  {
+    auto & s = scores[r->backend];
+    ++s.first;
+    s.second += r->solved ? r->seconds : 2 * timeout;
+  }
+
+  size_t max_runs = 0;
+  for (const auto & elem : scores)
+  {
+    max_runs = max(max_runs, elem.second.first);
+  }
+
+  bool found = false;
+  double best = 0;
+  for (const auto & elem : scores)
+  {
+    // a backend that skipped some benchmarks cannot be compared
+    if (elem.second.first == max_runs && (!found || elem.second.second < best))
+    {
+      found = true;
+      best = elem.second.second;
+      rule.backend = elem.first;
+    }
+  }
+  return found;
+}
+
+}  // namespace
+
+/* BackendSelector implementation */
+
+BackendSelector::BackendSelector()
+{
+  for (const auto & group : default_rules)
+  {
+    for (const auto & logic : group.first)
+    {
+      for (auto se : group.second)
+      {
+        SelectionRule rule;
+        rule.logic = logic;
+        rule.backend = se;
+        rules_.push_back(rule);
+      }
+    }
+  }
+}
+
+vector<SolverAttribute> BackendSelector::missing_theories(
+    SolverEnum se, const TermStats & stats)
+{
+  const vector<pair<SortKind, SolverAttribute>> required = {
+    { BV, THEORY_BV },
+    { INT, THEORY_INT },
+    { REAL, THEORY_REAL },
+    { DATATYPE, THEORY_DATATYPE },
+    { UNINTERPRETED, UNINTERP_SORT },
+    { UNINTERPRETED_CONS, PARAM_UNINTERP_SORT }
+  };
+  vector<SolverAttribute> missing;
+  for (const auto & elem : required)
+  {
+    if (stats.has_sort_kind(elem.first)
+        && !solver_has_attribute(se, elem.second))
+    {
+      missing.push_back(elem.second);
+    }
+  }
+  if (stats.has_quantifiers() && !solver_has_attribute(se, QUANTIFIERS))
+  {
+    missing.push_back(QUANTIFIERS);
+  }
+  return missing;
+}
+
+bool BackendSelector::supports(SolverEnum se, const TermStats & stats)
+{
+  return missing_theories(se, stats).empty();
+}
+
+bool BackendSelector::matches(const SelectionRule & rule,
+                              const TermStats & stats) const
+{
+  const string & logic = rule.logic;
+  if (logic != "*" && logic != stats.logic())
+  {
+    // a prefix pattern like QF_*
+    size_t len = logic.size() - 1;
+    if (logic.empty() || logic.back() != '*'
+        || stats.logic().compare(0, len, logic, 0, len))
+    {
+      return false;
+    }
+  }
+
+  size_t size = stats.dag_size();
+  if (size < rule.min_dag_size
+      || (rule.max_dag_size && size > rule.max_dag_size))
+  {
+    return false;
+  }
+
+  return !rule.max_bv_width || stats.max_bv_width() <= rule.max_bv_width;
+}
+
+SolverEnum BackendSelector::select(const TermStats & stats,
+                                   const vector<SolverEnum> & candidates) const
+{
+  if (candidates.empty())
+  {
+    throw IncorrectUsageException("BackendSelector needs a candidate backend");
+  }
+
+  for (const auto & rule : rules_)
+  {
+    if (find(candidates.begin(), candidates.end(), rule.backend)
+            != candidates.end()
+        && supports(rule.backend, stats) && matches(rule, stats))
+    {
+      return rule.backend;
+    }
+  }
+
+  for (auto se : candidates)
+  {
+    if (supports(se, stats))
+    {
+      return se;
+    }
+  }
+
+  ostringstream msg;
+  msg << "BackendSelector: no candidate backend supports the formulas";
+  const char * sep = " (";
+  for (auto se : candidates)
+  {
+    msg << sep << se << " lacks";
+    for (auto sa : missing_theories(se, stats))
+    {
+      msg << " " << sa;
+    }
+    sep = ", ";
+  }
+  msg << ")";
+  throw IncorrectUsageException(msg.str());
+}
+
+void BackendSelector::fit(const vector<TimingRecord> & records, double timeout)
+{
+  // std::map keeps the learned table in a deterministic order
+  map<pair<string, size_t>, vector<const TimingRecord *>> by_size;
+  map<string, vector<const TimingRecord *>> by_logic;
+  for (const auto & r : records)
+  {
+    by_size[{ r.logic, decade(r.dag_size) }].push_back(&r);
+    by_logic[r.logic].push_back(&r);
+  }
+
+  vector<SelectionRule> learned;
+  for (const auto & elem : by_size)
+  {
+    SelectionRule rule;
+    rule.logic = elem.first.first;
+    size_t d = elem.first.second;
+    rule.min_dag_size = d ? power_of_ten(d) : 0;
+    rule.max_dag_size = power_of_ten(d + 1) - 1;
+    if (best_rule(elem.second, timeout, rule))
+    {
+      learned.push_back(rule);
+    }
+  }
+  // fallbacks for sizes that were not in the logs
+  for (const auto & elem : by_logic)
+  {
+    SelectionRule rule;
+    rule.logic = elem.first;
+    if (best_rule(elem.second, timeout, rule))
+    {
+      learned.push_back(rule);
+    }
+  }
+
+  rules_.insert(rules_.begin(), learned.begin(), learned.end());
+}
+
+void BackendSelector::save(ostream & os) const
+{
+  os << "# logic min_dag_size max_dag_size max_bv_width backend" << endl;
+  for (const auto & rule : rules_)
+  {
+    os << rule.logic << " " << rule.min_dag_size << " " << rule.max_dag_size
+       << " " << rule.max_bv_width << " " << rule.backend << endl;
+  }
+}
+
+void BackendSelector::load(istream & is)
+{
+  vector<SelectionRule> rules;
+  string line;
+  while (getline(is, line))
+  {
+    if (line.empty() || line[0] == '#')
+    {
+      continue;
+    }
+
+    istringstream ss(line);
+    SelectionRule rule;
+    string backend;
+    if (!(ss >> rule.logic >> rule.min_dag_size >> rule.max_dag_size
+          >> rule.max_bv_width >> backend))
+    {
+      throw IncorrectUsageException("Malformed backend selection rule: "
+                                    + line);
+    }
+
+    auto it = find_if(
+        backend_enums.begin(), backend_enums.end(), [&backend](SolverEnum se) {
+          return to_string(se) == backend;
+        });
+    if (it == backend_enums.end())
+    {
+      throw IncorrectUsageException("Unknown backend in selection rule: "
+                                    + line);
+    }
+    rule.backend = *it;
+    rules.push_back(rule);
+  }
+  rules_ = rules;
+}
+
+/* AutoSolver implementation */
+
+AutoSolver::AutoSolver(SmtSolver front,
+                       const vector<SolverEnum> & candidates,
+                       BackendFactory make_backend,
+                       const BackendSelector & selector)
+    : AbsSmtSolver(front->get_solver_enum()),
+      front_(front),
+      candidates_(candidates),
+      make_backend_(make_backend),
+      selector_(selector),
+      assertions_(1)
+{
+}
+
+AutoSolver::~AutoSolver() {}
+
+SolverEnum AutoSolver::get_backend_enum() const
+{
+  if (!backend_)
+  {
+    throw IncorrectUsageException(
+        "AutoSolver picks its backend at the first check_sat");
+  }
+  return backend_->get_solver_enum();
+}
+
+void AutoSolver::pick_backend()
+{
+  if (backend_)
+  {
+    return;
+  }
+
+  SolverEnum se = selector_.select(stats_, candidates_);
+  if (se == front_->get_solver_enum())
+  {
+    backend_ = front_;
+  }
+  else
+  {
+    backend_ = make_backend_(se);
+    to_backend_.reset(new TermTranslator(backend_));
+    to_front_.reset(new TermTranslator(front_));
+  }
+
+  for (const auto & opt : options_)
+  {
+    backend_->set_opt(opt.first, opt.second);
+  }
+  if (!logic_.empty() && backend_ != front_)
+  {
+    backend_->set_logic(logic_);
+  }
+
+  for (size_t i = 0; i < assertions_.size(); ++i)
+  {
+    if (i)
+    {
+      backend_->push();
+    }
+    for (const auto & a : assertions_[i])
+    {
+      backend_->assert_formula(to_backend(a));
+    }
+  }
+  assertions_.clear();
+  // only needed for the selection
+  stats_.clear();
+}
+
+Term AutoSolver::to_backend(const Term & t) const
+{
+  if (!to_backend_)
+  {
+    return t;
+  }
+  Sort sort = t->get_sort();
+  return sort->get_sort_kind() == BOOL ? to_backend_->transfer_term(t, BOOL)
+                                       : to_backend_->transfer_term(t);
+}
+
+Term AutoSolver::to_front(const Term & t) const
+{
+  if (!to_front_)
+  {
+    return t;
+  }
+  return to_front_->transfer_term(t);
+}
+
+void AutoSolver::set_opt(const std::string option, const std::string value)
+{
+  if (backend_)
+  {
+    backend_->set_opt(option, value);
+  }
+  else
+  {
+    options_.push_back({ option, value });
+  }
+}
+
+void AutoSolver::set_logic(const std::string logic)
+{
+  // the front solver may need the logic to build terms
+  front_->set_logic(logic);
+  if (backend_ && backend_ != front_)
+  {
+    backend_->set_logic(logic);
+  }
+  logic_ = logic;
+}
+
+void AutoSolver::assert_formula(const Term & t)
+{
+  if (backend_)
+  {
+    backend_->assert_formula(to_backend(t));
+  }
+  else
+  {
+    stats_.add(t);
+    assertions_.back().push_back(t);
+  }
+}
+
+Result AutoSolver::check_sat()
+{
+  pick_backend();
+  return backend_->check_sat();
+}
+
+Result AutoSolver::check_sat_assuming(const TermVec & assumptions)
+{
+  if (!backend_)
+  {
+    for (const auto & a : assumptions)
+    {
+      stats_.add(a);
+    }
+    pick_backend();
+  }
+
+  assumption_map_.clear();
+  TermVec backend_assumptions;
+  backend_assumptions.reserve(assumptions.size());
+  for (const auto & a : assumptions)
+  {
+    Term ba = to_backend(a);
+    assumption_map_[ba] = a;
+    backend_assumptions.push_back(ba);
+  }
+  return backend_->check_sat_assuming(backend_assumptions);
+}
+
+void AutoSolver::push(uint64_t num)
+{
+  if (backend_)
+  {
+    backend_->push(num);
+    return;
+  }
+  for (uint64_t i = 0; i < num; ++i)
+  {
+    assertions_.push_back({});
+  }
+}
+
+void AutoSolver::pop(uint64_t num)
+{
+  if (backend_)
+  {
+    backend_->pop(num);
+    return;
+  }
+  if (num >= assertions_.size())
+  {
+    throw IncorrectUsageException("Popped more contexts than were pushed");
+  }
+  assertions_.resize(assertions_.size() - num);
+
+  // the selection only sees the assertions that are still there
+  stats_.clear();
+  for (const auto & level : assertions_)
+  {
+    for (const auto & a : level)
+    {
+      stats_.add(a);
+    }
+  }
+}
+
+uint64_t AutoSolver::get_context_level() const
+{
+  return backend_ ? backend_->get_context_level() : assertions_.size() - 1;
+}
+
+Term AutoSolver::get_value(const Term & t) const
+{
+  if (!backend_)
+  {
+    throw IncorrectUsageException("Cannot get a value before check_sat");
+  }
+  return to_front(backend_->get_value(to_backend(t)));
+}
+
+void AutoSolver::get_bv_value(const Term & t, std::vector<uint64_t> & out) const
+{
+  if (!backend_)
+  {
+    throw IncorrectUsageException("Cannot get a value before check_sat");
+  }
+  backend_->get_bv_value(to_backend(t), out);
+}
+
+UnorderedTermMap AutoSolver::get_array_values(const Term & arr,
+                                              Term & out_const_base) const
+{
+  if (!backend_)
+  {
+    throw IncorrectUsageException("Cannot get a value before check_sat");
+  }
+  Term base;
+  UnorderedTermMap values = backend_->get_array_values(to_backend(arr), base);
+  if (base)
+  {
+    out_const_base = to_front(base);
+  }
+  if (!to_front_)
+  {
+    return values;
+  }
+
+  UnorderedTermMap res;
+  for (const auto & elem : values)
+  {
+    res[to_front(elem.first)] = to_front(elem.second);
+  }
+  return res;
+}
+
+void AutoSolver::get_unsat_assumptions(UnorderedTermSet & out)
+{
+  if (!backend_)
+  {
+    throw IncorrectUsageException(
+        "Cannot get unsat assumptions before check_sat_assuming");
+  }
+  if (!to_backend_)
+  {
+    backend_->get_unsat_assumptions(out);
+    return;
+  }
+
+  UnorderedTermSet core;
+  backend_->get_unsat_assumptions(core);
+  for (const auto & a : core)
+  {
+    out.insert(assumption_map_.at(a));
+  }
+}
+
+void AutoSolver::reset()
+{
+  front_->reset();
+  backend_ = nullptr;
+  to_backend_.reset();
+  to_front_.reset();
+  options_.clear();
+  logic_.clear();
+  assertions_.assign(1, {});
+  stats_.clear();
+  assumption_map_.clear();
+}
+
+void AutoSolver::reset_assertions()
+{
+  if (backend_)
+  {
+    backend_->reset_assertions();
+  }
+  else
+  {
+    assertions_.assign(1, {});
+  }
+  stats_.clear();
+}
+
+MemoryStats AutoSolver::get_memory_stats() const
+{
+  MemoryStats stats = front_->get_memory_stats();
+  if (backend_ && backend_ != front_)
+  {
+    stats.backend_bytes += backend_->get_memory_stats().backend_bytes;
+  }
+  stats.cache_entries["auto_translations"] =
+      to_backend_ ? to_backend_->get_cache().size() : 0;
+  return stats;
+}
+
+Sort AutoSolver::make_sort(const std::string name, uint64_t arity) const
+{
+  return front_->make_sort(name, arity);
+}
+
+Sort AutoSolver::make_sort(const SortKind sk) const
+{
+  return front_->make_sort(sk);
+}
+
+Sort AutoSolver::make_sort(const SortKind sk, uint64_t size) const
+{
+  return front_->make_sort(sk, size);
+}
+
+Sort AutoSolver::make_sort(const SortKind sk, const Sort & sort1) const
+{
+  return front_->make_sort(sk, sort1);
+}
+
+Sort AutoSolver::make_sort(const SortKind sk,
+                           const Sort & sort1,
+                           const Sort & sort2) const
+{
+  return front_->make_sort(sk, sort1, sort2);
+}
+
+Sort AutoSolver::make_sort(const SortKind sk,
+                           const Sort & sort1,
+                           const Sort & sort2,
+                           const Sort & sort3) const
+{
+  return front_->make_sort(sk, sort1, sort2, sort3);
+}
+
+Sort AutoSolver::make_sort(const SortKind sk, const SortVec & sorts) const
+{
+  return front_->make_sort(sk, sorts);
+}
+
+Sort AutoSolver::make_sort(const Sort & sort_con, const SortVec & sorts) const
+{
+  return front_->make_sort(sort_con, sorts);
+}
+
+Sort AutoSolver::make_sort(const DatatypeDecl & d) const
+{
+  return front_->make_sort(d);
+}
+
+Sort AutoSolver::make_unresolved_sort(const DatatypeDecl & decl) const
+{
+  return front_->make_unresolved_sort(decl);
+}
+
+SortVec AutoSolver::make_datatype_sorts(
+    const std::vector<DatatypeDecl> & decls) const
+{
+  return front_->make_datatype_sorts(decls);
+}
+
+DatatypeDecl AutoSolver::make_datatype_decl(const std::string & s)
+{
+  return front_->make_datatype_decl(s);
+}
+
+DatatypeConstructorDecl AutoSolver::make_datatype_constructor_decl(
+    const std::string s)
+{
+  return front_->make_datatype_constructor_decl(s);
+}
+
+void AutoSolver::add_constructor(DatatypeDecl & dt,
+                                 const DatatypeConstructorDecl & con) const
+{
+  front_->add_constructor(dt, con);
+}
+
+void AutoSolver::add_selector(DatatypeConstructorDecl & dt,
+                              const std::string & name,
+                              const Sort & s) const
+{
+  front_->add_selector(dt, name, s);
+}
+
+void AutoSolver::add_selector_self(DatatypeConstructorDecl & dt,
+                                   const std::string & name) const
+{
+  front_->add_selector_self(dt, name);
+}
+
+Term AutoSolver::get_constructor(const Sort & s, std::string name) const
+{
+  return front_->get_constructor(s, name);
+}
+
+Term AutoSolver::get_tester(const Sort & s, std::string name) const
+{
+  return front_->get_tester(s, name);
+}
+
+Term AutoSolver::get_selector(const Sort & s,
+                              std::string con,
+                              std::string name) const
+{
+  return front_->get_selector(s, con, name);
+}
+
+Term AutoSolver::make_term(bool b) const { return front_->make_term(b); }
+
+Term AutoSolver::make_term(int64_t i, const Sort & sort) const
+{
+  return front_->make_term(i, sort);
+}
+
+Term AutoSolver::make_term(const std::string val,
+                           const Sort & sort,
+                           uint64_t base) const
+{
+  return front_->make_term(val, sort, base);
+}
+
+Term AutoSolver::make_term(const Term & val, const Sort & sort) const
+{
+  return front_->make_term(val, sort);
+}
+
+Term AutoSolver::make_symbol(const std::string name, const Sort & sort)
+{
+  return front_->make_symbol(name, sort);
+}
+
+Term AutoSolver::get_symbol(const std::string & name)
+{
+  return front_->get_symbol(name);
+}
+
+Term AutoSolver::make_param(const std::string name, const Sort & sort)
+{
+  return front_->make_param(name, sort);
+}
+
+Term AutoSolver::make_term(const Op op, const Term & t) const
+{
+  return front_->make_term(op, t);
+}
+
+Term AutoSolver::make_term(const Op op, const Term & t0, const Term & t1) const
+{
+  return front_->make_term(op, t0, t1);
+}
+
+Term AutoSolver::make_term(const Op op,
+                           const Term & t0,
+                           const Term & t1,
+                           const Term & t2) const
+{
+  return front_->make_term(op, t0, t1, t2);
+}
+
+Term AutoSolver::make_term(const Op op, const TermVec & terms) const
+{
+  return front_->make_term(op, terms);
+}
+
+Term AutoSolver::substitute(const Term term,
+                            const UnorderedTermMap & substitution_map) const
+{
+  return front_->substitute(term, substitution_map);
+}
+
+TermVec AutoSolver::substitute_terms(
+    const TermVec & terms, const UnorderedTermMap & substitution_map) const
+{
+  return front_->substitute_terms(terms, substitution_map);
+}
+
+SmtSolver create_auto_solver(SmtSolver front,
+                             const std::vector<SolverEnum> & candidates,
+                             BackendFactory make_backend,
+                             const BackendSelector & selector)
+{
+  return std::make_shared<AutoSolver>(
+      front, candidates, make_backend, selector);
+}
+
+}  // namespace smt
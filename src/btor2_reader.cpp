@@ -0,0 +1,706 @@
+/*********************                                                        */
+/*! \file btor2_reader.cpp
+** \verbatim
+** Top contributors (to current version):
+**   agent
+** This file is part of the smt-switch project.
+** Copyright (c) 2026 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved.  See the file LICENSE in the top-level source
+** directory for licensing information.\endverbatim
+**
+** \brief Hand-written streaming reader for the BTOR2 format.
+**
+**/
+
+#include "btor2_reader.h"
+
+#include <string_view>
+
+#include "mapped_file.h"
+
+using namespace std;
+
+namespace smt {
+
+namespace {
+
+enum Btor2Tag
+{
+  // declarations
+  B_SORT = 0,
+  B_INPUT,
+  B_STATE,
+  B_CONST,
+  B_CONSTD,
+  B_CONSTH,
+  B_ZERO,
+  B_ONE,
+  B_ONES,
+  B_INIT,
+  B_NEXT,
+  B_BAD,
+  B_CONSTRAINT,
+  B_FAIR,
+  B_JUSTICE,
+  B_OUTPUT,
+  // unary
+  B_NOT,
+  B_INC,
+  B_DEC,
+  B_NEG,
+  B_REDAND,
+  B_REDOR,
+  B_REDXOR,
+  // indexed
+  B_SEXT,
+  B_UEXT,
+  B_SLICE,
+  // binary with a direct bit-vector operator
+  B_BVOP,
+  // binary with a boolean result
+  B_CMP,
+  // other binary
+  B_IFF,
+  B_IMPLIES,
+  B_EQ,
+  B_NEQ,
+  B_ROL,
+  B_ROR,
+  B_SADDO,
+  B_UADDO,
+  B_SDIVO,
+  B_UDIVO,
+  B_SMULO,
+  B_UMULO,
+  B_SSUBO,
+  B_USUBO,
+  B_CONCAT,
+  B_READ,
+  // ternary
+  B_ITE,
+  B_WRITE
+};
+
+struct TagInfo
+{
+  Btor2Tag tag;
+  PrimOp op;  ///< for B_BVOP and B_CMP
+};
+
+const unordered_map<string_view, TagInfo> & tag_table()
+{
+  static const unordered_map<string_view, TagInfo> table({
+      { "sort", { B_SORT, NUM_OPS_AND_NULL } },
+      { "input", { B_INPUT, NUM_OPS_AND_NULL } },
+      { "state", { B_STATE, NUM_OPS_AND_NULL } },
+      { "const", { B_CONST, NUM_OPS_AND_NULL } },
+      { "constd", { B_CONSTD, NUM_OPS_AND_NULL } },
+      { "consth", { B_CONSTH, NUM_OPS_AND_NULL } },
+      { "zero", { B_ZERO, NUM_OPS_AND_NULL } },
+      { "one", { B_ONE, NUM_OPS_AND_NULL } },
+      { "ones", { B_ONES, NUM_OPS_AND_NULL } },
+      { "init", { B_INIT, NUM_OPS_AND_NULL } },
+      { "next", { B_NEXT, NUM_OPS_AND_NULL } },
+      { "bad", { B_BAD, NUM_OPS_AND_NULL } },
+      { "constraint", { B_CONSTRAINT, NUM_OPS_AND_NULL } },
+      { "fair", { B_FAIR, NUM_OPS_AND_NULL } },
+      { "justice", { B_JUSTICE, NUM_OPS_AND_NULL } },
+      { "output", { B_OUTPUT, NUM_OPS_AND_NULL } },
+      { "not", { B_NOT, NUM_OPS_AND_NULL } },
+      { "inc", { B_INC, NUM_OPS_AND_NULL } },
+      { "dec", { B_DEC, NUM_OPS_AND_NULL } },
+      { "neg", { B_NEG, NUM_OPS_AND_NULL } },
+      { "redand", { B_REDAND, NUM_OPS_AND_NULL } },
+      { "redor", { B_REDOR, NUM_OPS_AND_NULL } },
+      { "redxor", { B_REDXOR, NUM_OPS_AND_NULL } },
+      { "sext", { B_SEXT, NUM_OPS_AND_NULL } },
+      { "uext", { B_UEXT, NUM_OPS_AND_NULL } },
+      { "slice", { B_SLICE, NUM_OPS_AND_NULL } },
+      { "and", { B_BVOP, BVAnd } },
+      { "nand", { B_BVOP, BVNand } },
+      { "nor", { B_BVOP, BVNor } },
+      { "or", { B_BVOP, BVOr } },
+      { "xnor", { B_BVOP, BVXnor } },
+      { "xor", { B_BVOP, BVXor } },
+      { "sll", { B_BVOP, BVShl } },
+      { "sra", { B_BVOP, BVAshr } },
+      { "srl", { B_BVOP, BVLshr } },
+      { "add", { B_BVOP, BVAdd } },
+      { "mul", { B_BVOP, BVMul } },
+      { "sdiv", { B_BVOP, BVSdiv } },
+      { "udiv", { B_BVOP, BVUdiv } },
+      { "smod", { B_BVOP, BVSmod } },
+      { "srem", { B_BVOP, BVSrem } },
+      { "urem", { B_BVOP, BVUrem } },
+      { "sub", { B_BVOP, BVSub } },
+      { "sgt", { B_CMP, BVSgt } },
+      { "ugt", { B_CMP, BVUgt } },
+      { "sgte", { B_CMP, BVSge } },
+      { "ugte", { B_CMP, BVUge } },
+      { "slt", { B_CMP, BVSlt } },
+      { "ult", { B_CMP, BVUlt } },
+      { "slte", { B_CMP, BVSle } },
+      { "ulte", { B_CMP, BVUle } },
+      { "iff", { B_IFF, NUM_OPS_AND_NULL } },
+      { "implies", { B_IMPLIES, NUM_OPS_AND_NULL } },
+      { "eq", { B_EQ, NUM_OPS_AND_NULL } },
+      { "neq", { B_NEQ, NUM_OPS_AND_NULL } },
+      { "rol", { B_ROL, NUM_OPS_AND_NULL } },
+      { "ror", { B_ROR, NUM_OPS_AND_NULL } },
+      { "saddo", { B_SADDO, NUM_OPS_AND_NULL } },
+      { "uaddo", { B_UADDO, NUM_OPS_AND_NULL } },
+      { "sdivo", { B_SDIVO, NUM_OPS_AND_NULL } },
+      { "udivo", { B_UDIVO, NUM_OPS_AND_NULL } },
+      { "smulo", { B_SMULO, NUM_OPS_AND_NULL } },
+      { "umulo", { B_UMULO, NUM_OPS_AND_NULL } },
+      { "ssubo", { B_SSUBO, NUM_OPS_AND_NULL } },
+      { "usubo", { B_USUBO, NUM_OPS_AND_NULL } },
+      { "concat", { B_CONCAT, NUM_OPS_AND_NULL } },
+      { "read", { B_READ, NUM_OPS_AND_NULL } },
+      { "ite", { B_ITE, NUM_OPS_AND_NULL } },
+      { "write", { B_WRITE, NUM_OPS_AND_NULL } },
+  });
+  return table;
+}
+
+inline const char * skip_blanks(const char * p, const char * end)
+{
+  while (p < end && (*p == ' ' || *p == '\t' || *p == '\r'))
+  {
+    ++p;
+  }
+  return p;
+}
+
+inline bool at_eol(const char * p, const char * end)
+{
+  return p == end || *p == '\n' || *p == ';';
+}
+
+/** @return the next whitespace-delimited token, advancing p */
+inline string_view next_token(const char *& p, const char * end)
+{
+  p = skip_blanks(p, end);
+  const char * start = p;
+  while (p < end && *p != ' ' && *p != '\t' && *p != '\r' && *p != '\n'
+         && *p != ';')
+  {
+    ++p;
+  }
+  return string_view(start, p - start);
+}
+
+}  // namespace
+
+Btor2Reader::Btor2Reader(const SmtSolver & solver)
+    : solver_(solver),
+      bv1sort_(solver->make_sort(BV, 1)),
+      bv1one_(solver->make_term(1, bv1sort_)),
+      bv1zero_(solver->make_term(0, bv1sort_)),
+      line_num_(0)
+{
+}
+
+void Btor2Reader::parse(const std::string & filename)
+{
+  MappedFile f(filename);
+  parse_buffer(f.data(), f.data() + f.size());
+}
+
+void Btor2Reader::parse_string(const std::string & input)
+{
+  parse_buffer(input.data(), input.data() + input.size());
+}
+
+void Btor2Reader::parse_buffer(const char * begin, const char * end)
+{
+  // BTOR2 lines are typically ~16 bytes, and ids are roughly line numbers
+  size_t estimate = (end - begin) / 16 + 1;
+  if (nodes_.size() < estimate)
+  {
+    nodes_.reserve(estimate);
+    sorts_.reserve(estimate);
+  }
+
+  line_num_ = 0;
+  const char * p = begin;
+  while (p < end)
+  {
+    line_num_++;
+    p = parse_line(p, end);
+  }
+}
+
+Term Btor2Reader::get_symbol(const std::string & name) const
+{
+  auto it = symbols_.find(name);
+  return it == symbols_.end() ? Term() : it->second;
+}
+
+void Btor2Reader::error(const std::string & msg) const
+{
+  throw SmtException("btor2 line " + std::to_string(line_num_) + ": " + msg);
+}
+
+Term Btor2Reader::arg(int64_t id)
+{
+  uint64_t abs_id = id < 0 ? -id : id;
+  if (abs_id >= nodes_.size() || !nodes_[abs_id])
+  {
+    error("undefined node " + std::to_string(abs_id));
+  }
+  const Term & t = nodes_[abs_id];
+  if (id >= 0)
+  {
+    return t;
+  }
+  auto it = bool_of_.find(t);
+  return it != bool_of_.end()
+             ? bool_to_bv(solver_->make_term(Not, it->second))
+             : solver_->make_term(BVNot, t);
+}
+
+Sort Btor2Reader::get_sort(uint64_t sid) const
+{
+  if (sid >= sorts_.size() || !sorts_[sid])
+  {
+    error("undefined sort " + std::to_string(sid));
+  }
+  return sorts_[sid];
+}
+
+void Btor2Reader::set_node(uint64_t id, const Term & t)
+{
+  if (id >= nodes_.size())
+  {
+    nodes_.resize(std::max<size_t>(id + 1, 2 * nodes_.size()));
+  }
+  nodes_[id] = t;
+}
+
+Term Btor2Reader::bool_to_bv(const Term & t)
+{
+  Term res = solver_->make_term(Ite, t, bv1one_, bv1zero_);
+  bool_of_[res] = t;
+  return res;
+}
+
+Term Btor2Reader::bv_to_bool(const Term & t)
+{
+  auto it = bool_of_.find(t);
+  if (it != bool_of_.end())
+  {
+    return it->second;
+  }
+  return solver_->make_term(Equal, t, bv1one_);
+}
+
+const char * Btor2Reader::parse_line(const char * p, const char * end)
+{
+  // reads an unsigned integer token
+  auto read_uint = [&]() -> uint64_t {
+    p = skip_blanks(p, end);
+    if (p == end || *p < '0' || *p > '9')
+    {
+      error("expected an unsigned integer");
+    }
+    uint64_t v = 0;
+    while (p < end && *p >= '0' && *p <= '9')
+    {
+      v = v * 10 + (*p++ - '0');
+    }
+    return v;
+  };
+  // reads a possibly negated node id
+  auto read_arg = [&]() -> Term {
+    p = skip_blanks(p, end);
+    bool neg = p < end && *p == '-';
+    if (neg)
+    {
+      ++p;
+    }
+    int64_t id = read_uint();
+    return arg(neg ? -id : id);
+  };
+
+  p = skip_blanks(p, end);
+  if (at_eol(p, end))
+  {
+    // empty line or comment
+    while (p < end && *p++ != '\n')
+      ;
+    return p;
+  }
+
+  uint64_t id = read_uint();
+  string_view kw = next_token(p, end);
+  auto it = tag_table().find(kw);
+  if (it == tag_table().end())
+  {
+    error("unknown keyword " + string(kw));
+  }
+  const TagInfo & info = it->second;
+
+  Term res;
+  Sort sort;
+  // ids of everything except properties and init / next start with a sort
+  switch (info.tag)
+  {
+    case B_SORT:
+    case B_BAD:
+    case B_CONSTRAINT:
+    case B_FAIR:
+    case B_JUSTICE:
+    case B_OUTPUT: break;
+    default: sort = get_sort(read_uint());
+  }
+
+  switch (info.tag)
+  {
+    case B_SORT:
+    {
+      string_view kind = next_token(p, end);
+      if (kind == "bitvec")
+      {
+        uint64_t width = read_uint();
+        sort = width == 1 ? bv1sort_ : solver_->make_sort(BV, width);
+      }
+      else if (kind == "array")
+      {
+        Sort idx = get_sort(read_uint());
+        Sort elem = get_sort(read_uint());
+        sort = solver_->make_sort(ARRAY, idx, elem);
+      }
+      else
+      {
+        error("unknown sort kind " + string(kind));
+      }
+      if (id >= sorts_.size())
+      {
+        sorts_.resize(std::max<size_t>(id + 1, 2 * sorts_.size()));
+      }
+      sorts_[id] = sort;
+      break;
+    }
+    case B_INPUT:
+    case B_STATE:
+    {
+      string_view sym = next_token(p, end);
+      string name = sym.empty() ? (info.tag == B_INPUT ? "input" : "state")
+                                      + std::to_string(id)
+                                : string(sym);
+      res = solver_->make_symbol(name, sort);
+      symbols_[name] = res;
+      (info.tag == B_INPUT ? inputs_ : states_).push_back(res);
+      break;
+    }
+    case B_CONST:
+    case B_CONSTD:
+    case B_CONSTH:
+    {
+      string_view val = next_token(p, end);
+      uint64_t base =
+          info.tag == B_CONST ? 2 : (info.tag == B_CONSTD ? 10 : 16);
+      bool neg = !val.empty() && val[0] == '-';
+      if (neg)
+      {
+        val.remove_prefix(1);
+      }
+      if (val.empty())
+      {
+        error("expected a constant value");
+      }
+      res = solver_->make_term(string(val), sort, base);
+      if (neg)
+      {
+        res = solver_->make_term(BVNeg, res);
+      }
+      break;
+    }
+    case B_ZERO: res = solver_->make_term(0, sort); break;
+    case B_ONE: res = solver_->make_term(1, sort); break;
+    case B_ONES:
+      res = solver_->make_term(BVNot, solver_->make_term(0, sort));
+      break;
+    case B_INIT:
+    case B_NEXT:
+    {
+      Term state = read_arg();
+      Term val = read_arg();
+      if (state->get_sort()->get_sort_kind() == ARRAY
+          && val->get_sort()->get_sort_kind() != ARRAY)
+      {
+        // constant array initialization
+        val = solver_->make_term(val, state->get_sort());
+      }
+      (info.tag == B_INIT ? init_ : next_)[state] = val;
+      break;
+    }
+    case B_BAD: bad_.push_back(bv_to_bool(read_arg())); break;
+    case B_CONSTRAINT: constraints_.push_back(bv_to_bool(read_arg())); break;
+    case B_FAIR: fairness_.push_back(bv_to_bool(read_arg())); break;
+    case B_OUTPUT: outputs_.push_back(read_arg()); break;
+    case B_JUSTICE:
+    {
+      uint64_t n = read_uint();
+      TermVec conds;
+      for (uint64_t i = 0; i < n; ++i)
+      {
+        conds.push_back(bv_to_bool(read_arg()));
+      }
+      justice_.push_back(conds);
+      break;
+    }
+    case B_NOT:
+    {
+      Term a = read_arg();
+      auto b = bool_of_.find(a);
+      res = b != bool_of_.end()
+                ? bool_to_bv(solver_->make_term(Not, b->second))
+                : solver_->make_term(BVNot, a);
+      break;
+    }
+    case B_INC:
+    case B_DEC:
+    {
+      Term a = read_arg();
+      res = solver_->make_term(info.tag == B_INC ? BVAdd : BVSub,
+                               a,
+                               solver_->make_term(1, a->get_sort()));
+      break;
+    }
+    case B_NEG: res = solver_->make_term(BVNeg, read_arg()); break;
+    case B_REDAND:
+    case B_REDOR:
+    {
+      Term a = read_arg();
+      Term zero = solver_->make_term(0, a->get_sort());
+      if (info.tag == B_REDAND)
+      {
+        res = bool_to_bv(solver_->make_term(
+            Equal, a, solver_->make_term(BVNot, zero)));
+      }
+      else
+      {
+        res = bool_to_bv(
+            solver_->make_term(Not, solver_->make_term(Equal, a, zero)));
+      }
+      break;
+    }
+    case B_REDXOR:
+    {
+      Term a = read_arg();
+      res = solver_->make_term(Op(Extract, 0, 0), a);
+      for (uint64_t i = 1; i < a->get_sort()->get_width(); ++i)
+      {
+        res = solver_->make_term(
+            BVXor, res, solver_->make_term(Op(Extract, i, i), a));
+      }
+      break;
+    }
+    case B_SEXT:
+    case B_UEXT:
+    {
+      Term a = read_arg();
+      uint64_t n = read_uint();
+      res = n ? solver_->make_term(
+                Op(info.tag == B_SEXT ? Sign_Extend : Zero_Extend, n), a)
+              : a;
+      break;
+    }
+    case B_SLICE:
+    {
+      Term a = read_arg();
+      uint64_t upper = read_uint();
+      uint64_t lower = read_uint();
+      res = solver_->make_term(Op(Extract, upper, lower), a);
+      break;
+    }
+    case B_BVOP:
+    {
+      Term a = read_arg();
+      Term b = read_arg();
+      auto ba = bool_of_.find(a);
+      auto bb = bool_of_.find(b);
+      if (ba != bool_of_.end() && bb != bool_of_.end()
+          && (info.op == BVAnd || info.op == BVOr || info.op == BVXor))
+      {
+        // keep boolean structure for the boolean connectives
+        PrimOp po = info.op == BVAnd ? And : (info.op == BVOr ? Or : Xor);
+        res = bool_to_bv(solver_->make_term(po, ba->second, bb->second));
+      }
+      else
+      {
+        res = solver_->make_term(info.op, a, b);
+      }
+      break;
+    }
+    case B_CMP:
+    {
+      Term a = read_arg();
+      Term b = read_arg();
+      res = bool_to_bv(solver_->make_term(info.op, a, b));
+      break;
+    }
+    case B_IFF:
+    case B_EQ:
+    case B_NEQ:
+    {
+      Term a = read_arg();
+      Term b = read_arg();
+      Term eq = solver_->make_term(Equal, a, b);
+      res = bool_to_bv(info.tag == B_NEQ ? solver_->make_term(Not, eq) : eq);
+      break;
+    }
+    case B_IMPLIES:
+    {
+      Term a = bv_to_bool(read_arg());
+      Term b = bv_to_bool(read_arg());
+      res = bool_to_bv(solver_->make_term(Implies, a, b));
+      break;
+    }
+    case B_ROL:
+    case B_ROR:
+    {
+      Term a = read_arg();
+      Term b = read_arg();
+      uint64_t width = a->get_sort()->get_width();
+      if (width == 1)
+      {
+        res = a;
+        break;
+      }
+      Term w = solver_->make_term(width, a->get_sort());
+      Term amt = solver_->make_term(BVUrem, b, w);
+      Term rest = solver_->make_term(BVSub, w, amt);
+      PrimOp first = info.tag == B_ROL ? BVShl : BVLshr;
+      PrimOp second = info.tag == B_ROL ? BVLshr : BVShl;
+      res = solver_->make_term(BVOr,
+                               solver_->make_term(first, a, amt),
+                               solver_->make_term(second, a, rest));
+      break;
+    }
+    case B_SADDO:
+    case B_SSUBO:
+    {
+      Term a = read_arg();
+      Term b = read_arg();
+      uint64_t msb = a->get_sort()->get_width() - 1;
+      Op sign(Extract, msb, msb);
+      Term sa = solver_->make_term(sign, a);
+      Term sb = solver_->make_term(sign, b);
+      Term sr = solver_->make_term(
+          sign, solver_->make_term(info.tag == B_SADDO ? BVAdd : BVSub, a, b));
+      // add: operands agree in sign, sub: operands differ in sign
+      // and in both cases the result sign differs from a
+      Term same = solver_->make_term(Equal, sa, sb);
+      Term operands = info.tag == B_SADDO ? same : solver_->make_term(Not, same);
+      res = bool_to_bv(solver_->make_term(
+          And,
+          operands,
+          solver_->make_term(Not, solver_->make_term(Equal, sr, sa))));
+      break;
+    }
+    case B_UADDO:
+    {
+      Term a = read_arg();
+      Term b = read_arg();
+      uint64_t width = a->get_sort()->get_width();
+      Op ext(Zero_Extend, 1);
+      Term sum = solver_->make_term(
+          BVAdd, solver_->make_term(ext, a), solver_->make_term(ext, b));
+      res = solver_->make_term(Op(Extract, width, width), sum);
+      break;
+    }
+    case B_USUBO:
+    {
+      Term a = read_arg();
+      Term b = read_arg();
+      res = bool_to_bv(solver_->make_term(BVUlt, a, b));
+      break;
+    }
+    case B_UMULO:
+    case B_SMULO:
+    {
+      Term a = read_arg();
+      Term b = read_arg();
+      uint64_t width = a->get_sort()->get_width();
+      Op ext(info.tag == B_UMULO ? Zero_Extend : Sign_Extend, width);
+      Term prod = solver_->make_term(
+          BVMul, solver_->make_term(ext, a), solver_->make_term(ext, b));
+      // overflow iff the double-width product is not the extension
+      // of its lower half
+      Term low = solver_->make_term(Op(Extract, width - 1, 0), prod);
+      res = bool_to_bv(solver_->make_term(
+          Not,
+          solver_->make_term(Equal, prod, solver_->make_term(ext, low))));
+      break;
+    }
+    case B_SDIVO:
+    {
+      Term a = read_arg();
+      Term b = read_arg();
+      Sort s = a->get_sort();
+      uint64_t width = s->get_width();
+      // INT_MIN / -1
+      Term int_min = solver_->make_term(
+          "1" + std::string(width - 1, '0'), s, 2);
+      Term minus_one = solver_->make_term(BVNot, solver_->make_term(0, s));
+      res = bool_to_bv(
+          solver_->make_term(And,
+                             solver_->make_term(Equal, a, int_min),
+                             solver_->make_term(Equal, b, minus_one)));
+      break;
+    }
+    case B_UDIVO:
+    {
+      read_arg();
+      read_arg();
+      res = bv1zero_;
+      break;
+    }
+    case B_CONCAT:
+    {
+      Term a = read_arg();
+      Term b = read_arg();
+      res = solver_->make_term(Concat, a, b);
+      break;
+    }
+    case B_READ:
+    {
+      Term a = read_arg();
+      Term b = read_arg();
+      res = solver_->make_term(Select, a, b);
+      break;
+    }
+    case B_ITE:
+    {
+      Term c = bv_to_bool(read_arg());
+      Term a = read_arg();
+      Term b = read_arg();
+      res = solver_->make_term(Ite, c, a, b);
+      break;
+    }
+    case B_WRITE:
+    {
+      Term a = read_arg();
+      Term i = read_arg();
+      Term e = read_arg();
+      res = solver_->make_term(Store, a, i, e);
+      break;
+    }
+  }
+
+  if (res)
+  {
+    set_node(id, res);
+  }
+
+  // skip an optional symbol and a trailing comment
+  while (p < end && *p++ != '\n')
+    ;
+  return p;
+}
+
+}  // namespace smt
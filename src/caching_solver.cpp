@@ -0,0 +1,990 @@
+/*********************                                                        */
+/*! \file caching_solver.cpp
+** \verbatim
+** Top contributors (to current version):
+**   agent
+** This file is part of the smt-switch project.
+** Copyright (c) 2026 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved.  See the file LICENSE in the top-level source
+** directory for licensing information.\endverbatim
+**
+** \brief Class that wraps another SmtSolver and memoizes the results
+**        of satisfiability queries.
+**/
+
+#include "caching_solver.h"
+
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include <sstream>
+
+#include "assert.h"
+#include "term_translator.h"
+#include "utils.h"
+
+using namespace std;
+
+namespace smt {
+
+namespace {
+
+// FNV-1a -- stable across runs and platforms, unlike std::hash
+uint64_t fnv1a(const string & s, uint64_t h = 0xcbf29ce484222325ULL)
+{
+  for (unsigned char c : s)
+  {
+    h ^= c;
+    h *= 0x100000001b3ULL;
+  }
+  return h;
+}
+
+// splitmix64 finalizer
+uint64_t mix(uint64_t h)
+{
+  h ^= h >> 30;
+  h *= 0xbf58476d1ce4e5b9ULL;
+  h ^= h >> 27;
+  h *= 0x94d049bb133111ebULL;
+  h ^= h >> 31;
+  return h;
+}
+
+uint64_t combine(uint64_t seed, uint64_t h)
+{
+  return mix(seed ^ (h + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2)));
+}
+
+uint64_t primop_hash(PrimOp po)
+{
+  // hash the name rather than the enum value so that cache files
+  // stay valid if new operators are added
+  static const array<uint64_t, NUM_OPS_AND_NULL + 1> hashes = []() {
+    array<uint64_t, NUM_OPS_AND_NULL + 1> res;
+    for (size_t i = 0; i < NUM_OPS_AND_NULL; ++i)
+    {
+      res[i] = fnv1a(to_string(static_cast<PrimOp>(i)));
+    }
+    res[NUM_OPS_AND_NULL] = fnv1a("null");
+    return res;
+  }();
+  return hashes[po];
+}
+
+// distinguishes assumptions from assertions with the same hash
+const uint64_t ASSUMPTION_TAG = 0x5bd1e9955bd1e995ULL;
+
+// first line of a cache file, files in another format are ignored
+const char * CACHE_FILE_HEADER = "smt-switch-caching-solver 2";
+
+// exposes the value parser of TermTranslator for reading cached values
+class ValueReader : public TermTranslator
+{
+ public:
+  ValueReader(const SmtSolver & s) : TermTranslator(s) {}
+  using TermTranslator::value_from_smt2;
+};
+
+// length-prefixed strings so values / names can contain whitespace
+void write_str(ostream & os, const string & s)
+{
+  os << s.size() << ":" << s;
+}
+
+bool read_str(istream & is, string & s)
+{
+  size_t len;
+  char colon;
+  if (!(is >> len) || !is.get(colon) || colon != ':')
+  {
+    return false;
+  }
+  s.resize(len);
+  return len == 0 || static_cast<bool>(is.read(&s[0], len));
+}
+
+}  // namespace
+
+/* CachingSolver */
+
+CachingSolver::CachingSolver(SmtSolver s,
+                             size_t capacity,
+                             const string & cache_file,
+                             size_t hash_capacity)
+    : AbsSmtSolver(s->get_solver_enum()),
+      wrapped_solver(s),
+      capacity_(capacity),
+      cache_file_(cache_file),
+      hash_capacity_(hash_capacity),
+      assertion_hashes_(1),
+      assertion_terms_(1),
+      last_from_cache_(false),
+      last_solved_(false),
+      last_values_ready_(false),
+      hits_(0),
+      misses_(0)
+{
+  if (!capacity_ || !hash_capacity_)
+  {
+    throw IncorrectUsageException("CachingSolver requires a nonzero capacity");
+  }
+  if (!cache_file_.empty())
+  {
+    load(cache_file_);
+  }
+}
+
+CachingSolver::~CachingSolver()
+{
+  try
+  {
+    flush();
+  }
+  catch (std::exception &)
+  {
+    // never throw from a destructor
+  }
+}
+
+uint64_t CachingSolver::structural_hash(const Term & term) const
+{
+  auto it = hash_cache_.find(term);
+  if (it != hash_cache_.end())
+  {
+    return it->second;
+  }
+  if (hash_cache_.size() >= hash_capacity_)
+  {
+    // the memo keeps its terms alive, don't let it grow without bound
+    hash_cache_.clear();
+  }
+
+  TermVec to_visit{ term };
+  unordered_set<Term> visited;
+  Term t;
+  while (to_visit.size())
+  {
+    t = to_visit.back();
+    if (hash_cache_.find(t) != hash_cache_.end())
+    {
+      to_visit.pop_back();
+      continue;
+    }
+
+    if (visited.find(t) == visited.end())
+    {
+      visited.insert(t);
+      for (auto c : t)
+      {
+        to_visit.push_back(c);
+      }
+      continue;
+    }
+
+    to_visit.pop_back();
+    Op op = t->get_op();
+    uint64_t h;
+    if (op.is_null())
+    {
+      // leaf: symbol, parameter, value or other special term
+      uint64_t kind = t->is_symbol() ? 1 : (t->is_param() ? 2 : 3);
+      h = combine(kind, fnv1a(t->to_string()));
+      h = combine(h, fnv1a(t->get_sort()->to_string()));
+      // values with children (e.g. constant arrays) are handled below
+      for (auto c : t)
+      {
+        h = combine(h, hash_cache_.at(c));
+      }
+    }
+    else
+    {
+      h = combine(primop_hash(op.prim_op), op.num_idx);
+      if (op.num_idx > 0)
+      {
+        h = combine(h, op.idx0);
+      }
+      if (op.num_idx > 1)
+      {
+        h = combine(h, op.idx1);
+      }
+      for (auto c : t)
+      {
+        h = combine(h, hash_cache_.at(c));
+      }
+    }
+    hash_cache_[t] = h;
+  }
+
+  return hash_cache_.at(term);
+}
+
+void CachingSolver::assert_formula(const Term & t)
+{
+  wrapped_solver->assert_formula(t);
+  assertion_hashes_.back().push_back(structural_hash(t));
+  assertion_terms_.back().push_back(t);
+  invalidate_last_query();
+}
+
+Result CachingSolver::check_sat() { return cached_check({}); }
+
+Result CachingSolver::check_sat_assuming(const TermVec & assumptions)
+{
+  return cached_check(assumptions);
+}
+
+Result CachingSolver::check_sat_assuming_list(const TermList & assumptions)
+{
+  return cached_check(TermVec(assumptions.begin(), assumptions.end()));
+}
+
+Result CachingSolver::check_sat_assuming_set(
+    const UnorderedTermSet & assumptions)
+{
+  return cached_check(TermVec(assumptions.begin(), assumptions.end()));
+}
+
+Result CachingSolver::cached_check(const TermVec & assumptions)
+{
+  // sums make the key independent of the order, the sorted lists are
+  // compared on a hit
+  vector<uint64_t> assertion_list;
+  uint64_t assertions_key = mix(get_solver_enum());
+  for (const auto & level : assertion_hashes_)
+  {
+    for (auto h : level)
+    {
+      assertion_list.push_back(h);
+      assertions_key += mix(h);
+    }
+  }
+  vector<uint64_t> assumption_list;
+  uint64_t assumptions_key = ASSUMPTION_TAG;
+  for (auto a : assumptions)
+  {
+    uint64_t h = structural_hash(a);
+    assumption_list.push_back(h);
+    assumptions_key += mix(h ^ ASSUMPTION_TAG);
+  }
+  sort(assertion_list.begin(), assertion_list.end());
+  sort(assumption_list.begin(), assumption_list.end());
+  QueryKey key(assertions_key, assumptions_key);
+
+  last_assumptions_ = assumptions;
+
+  CacheEntryPtr entry = lookup(key, assertion_list, assumption_list);
+  if (entry)
+  {
+    hits_++;
+    last_entry_ = entry;
+    last_from_cache_ = true;
+    last_solved_ = false;
+    last_values_ready_ = false;
+    return entry->result;
+  }
+
+  misses_++;
+  Result r = assumptions.empty()
+                 ? wrapped_solver->check_sat()
+                 : wrapped_solver->check_sat_assuming(assumptions);
+  last_from_cache_ = false;
+  last_solved_ = true;
+  last_values_ready_ = false;
+  last_entry_ = nullptr;
+  if (r.is_sat() || r.is_unsat())
+  {
+    last_entry_ = make_shared<CacheEntry>();
+    last_entry_->result = r;
+    last_entry_->assertions = std::move(assertion_list);
+    last_entry_->assumptions = std::move(assumption_list);
+    insert(key, last_entry_);
+  }
+  return r;
+}
+
+void CachingSolver::materialize() const
+{
+  if (last_solved_)
+  {
+    return;
+  }
+  Result r = last_assumptions_.empty()
+                 ? wrapped_solver->check_sat()
+                 : wrapped_solver->check_sat_assuming(last_assumptions_);
+  if (r.result != last_entry_->result.result)
+  {
+    throw SmtException("CachingSolver: cached result "
+                       + last_entry_->result.to_string()
+                       + " does not match re-computed result "
+                       + r.to_string());
+  }
+  last_solved_ = true;
+}
+
+UnorderedTermSet CachingSolver::query_symbols() const
+{
+  UnorderedTermSet syms;
+  for (const auto & level : assertion_terms_)
+  {
+    for (const auto & a : level)
+    {
+      get_free_symbols(a, syms);
+    }
+  }
+  for (const auto & a : last_assumptions_)
+  {
+    get_free_symbols(a, syms);
+  }
+  return syms;
+}
+
+bool CachingSolver::cached_model_complete() const
+{
+  for (const auto & sym : query_symbols())
+  {
+    // values of functions are not cached
+    if (!sym->is_symbolic_const() || !cached_value(last_entry_, sym))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+void CachingSolver::record_model() const
+{
+  for (const auto & sym : query_symbols())
+  {
+    if (!sym->is_symbolic_const()
+        || last_entry_->values.find(sym) != last_entry_->values.end())
+    {
+      continue;
+    }
+    Term val;
+    try
+    {
+      val = wrapped_solver->get_value(sym);
+    }
+    catch (SmtException &)
+    {
+      // e.g. no values for this sort, the entry stays incomplete
+      continue;
+    }
+    last_entry_->values[sym] = val;
+    last_entry_->value_strs[sym->to_string()] = val->to_string();
+  }
+}
+
+void CachingSolver::prepare_values() const
+{
+  if (last_values_ready_)
+  {
+    return;
+  }
+  last_values_ready_ = true;
+  if (last_from_cache_ && !cached_model_complete())
+  {
+    // partial cached values can't be combined with a new model, so all
+    // values come from the new model, including the cached ones
+    materialize();
+    last_from_cache_ = false;
+    last_entry_->values.clear();
+    last_entry_->value_strs.clear();
+  }
+  if (!last_from_cache_)
+  {
+    record_model();
+  }
+}
+
+void CachingSolver::invalidate_last_query()
+{
+  last_entry_ = nullptr;
+  last_from_cache_ = false;
+  last_solved_ = false;
+  last_values_ready_ = false;
+  last_assumptions_.clear();
+}
+
+Term CachingSolver::cached_value(const CacheEntryPtr & entry,
+                                 const Term & sym) const
+{
+  auto it = entry->values.find(sym);
+  if (it != entry->values.end())
+  {
+    return it->second;
+  }
+
+  auto sit = entry->value_strs.find(sym->to_string());
+  if (sit == entry->value_strs.end())
+  {
+    return nullptr;
+  }
+
+  Term val;
+  try
+  {
+    ValueReader reader(wrapped_solver);
+    val = reader.value_from_smt2(sit->second, sym->get_sort());
+  }
+  catch (SmtException &)
+  {
+    // can't rebuild this value -- fall back to solving
+    return nullptr;
+  }
+  entry->values[sym] = val;
+  return val;
+}
+
+Term CachingSolver::get_value(const Term & t) const
+{
+  if (!last_entry_ || !last_entry_->result.is_sat())
+  {
+    if (last_entry_)
+    {
+      materialize();
+    }
+    return wrapped_solver->get_value(t);
+  }
+
+  prepare_values();
+  if (!last_from_cache_)
+  {
+    return wrapped_solver->get_value(t);
+  }
+
+  auto it = last_entry_->values.find(t);
+  if (it != last_entry_->values.end())
+  {
+    return it->second;
+  }
+  // with the symbols of the query replaced by their cached values, the
+  // value doesn't depend on the model of the wrapped solver
+  materialize();
+  Term val = wrapped_solver->get_value(
+      wrapped_solver->substitute(t, last_entry_->values));
+  if (t->is_symbolic_const())
+  {
+    // not constrained by the query, keep it for later terms over it
+    last_entry_->values[t] = val;
+  }
+  return val;
+}
+
+UnorderedTermMap CachingSolver::get_array_values(const Term & arr,
+                                                 Term & out_const_base) const
+{
+  if (!last_entry_)
+  {
+    return wrapped_solver->get_array_values(arr, out_const_base);
+  }
+
+  materialize();
+  if (last_entry_->result.is_sat())
+  {
+    prepare_values();
+    if (last_from_cache_)
+    {
+      return wrapped_solver->get_array_values(
+          wrapped_solver->substitute(arr, last_entry_->values),
+          out_const_base);
+    }
+  }
+  return wrapped_solver->get_array_values(arr, out_const_base);
+}
+
+void CachingSolver::get_unsat_assumptions(UnorderedTermSet & out)
+{
+  if (last_entry_ && last_from_cache_ && last_entry_->has_core)
+  {
+    unordered_map<uint64_t, Term> by_hash;
+    for (auto a : last_assumptions_)
+    {
+      by_hash[structural_hash(a)] = a;
+    }
+
+    bool complete = true;
+    UnorderedTermSet core;
+    for (auto h : last_entry_->core)
+    {
+      auto it = by_hash.find(h);
+      if (it == by_hash.end())
+      {
+        complete = false;
+        break;
+      }
+      core.insert(it->second);
+    }
+
+    if (complete)
+    {
+      out.insert(core.begin(), core.end());
+      return;
+    }
+  }
+
+  if (last_entry_)
+  {
+    materialize();
+  }
+
+  UnorderedTermSet core;
+  wrapped_solver->get_unsat_assumptions(core);
+  if (last_entry_)
+  {
+    last_entry_->has_core = true;
+    last_entry_->core.clear();
+    for (auto a : core)
+    {
+      last_entry_->core.push_back(structural_hash(a));
+    }
+  }
+  out.insert(core.begin(), core.end());
+}
+
+void CachingSolver::push(uint64_t num)
+{
+  wrapped_solver->push(num);
+  assertion_hashes_.resize(assertion_hashes_.size() + num);
+  assertion_terms_.resize(assertion_terms_.size() + num);
+  invalidate_last_query();
+}
+
+void CachingSolver::pop(uint64_t num)
+{
+  wrapped_solver->pop(num);
+  assert(num < assertion_hashes_.size());
+  assertion_hashes_.resize(assertion_hashes_.size() - num);
+  assertion_terms_.resize(assertion_terms_.size() - num);
+  invalidate_last_query();
+}
+
+void CachingSolver::reset()
+{
+  wrapped_solver->reset();
+  // terms are destroyed by a reset, but cached results stay valid
+  // because they are keyed by structure
+  hash_cache_.clear();
+  for (auto & elem : entries_)
+  {
+    elem.second.first->values.clear();
+  }
+  assertion_hashes_.assign(1, {});
+  assertion_terms_.assign(1, {});
+  invalidate_last_query();
+}
+
+void CachingSolver::reset_assertions()
+{
+  wrapped_solver->reset_assertions();
+  for (auto & level : assertion_hashes_)
+  {
+    level.clear();
+  }
+  for (auto & level : assertion_terms_)
+  {
+    level.clear();
+  }
+  invalidate_last_query();
+}
+
+MemoryStats CachingSolver::get_memory_stats() const
+{
+  MemoryStats stats = wrapped_solver->get_memory_stats();
+  stats.cache_entries["caching_queries"] = entries_.size();
+  stats.cache_entries["caching_hashes"] = hash_cache_.size();
+  return stats;
+}
+
+CachingSolver::CacheEntryPtr CachingSolver::lookup(
+    const QueryKey & key,
+    const vector<uint64_t> & assertions,
+    const vector<uint64_t> & assumptions) const
+{
+  auto it = entries_.find(key);
+  if (it == entries_.end())
+  {
+    return nullptr;
+  }
+  const CacheEntryPtr & entry = it->second.first;
+  if (entry->assertions != assertions || entry->assumptions != assumptions)
+  {
+    // a different query with the same key
+    return nullptr;
+  }
+  // move to the front
+  lru_.splice(lru_.begin(), lru_, it->second.second);
+  return it->second.first;
+}
+
+void CachingSolver::insert(const QueryKey & key,
+                           const CacheEntryPtr & entry) const
+{
+  auto it = entries_.find(key);
+  if (it != entries_.end())
+  {
+    it->second.first = entry;
+    lru_.splice(lru_.begin(), lru_, it->second.second);
+    return;
+  }
+
+  if (entries_.size() >= capacity_)
+  {
+    entries_.erase(lru_.back());
+    lru_.pop_back();
+  }
+  lru_.push_front(key);
+  entries_[key] = { entry, lru_.begin() };
+}
+
+// Cache file format, CACHE_FILE_HEADER then one entry per line, least
+// recently used first:
+// <assertions key> <assumptions key> <sat|unsat> <has core> <core size>
+//   <core hashes...> <model size> (<len>:<name> <len>:<value>)...
+//   <number of assertions> <assertion hashes...>
+//   <number of assumptions> <assumption hashes...>
+void CachingSolver::load(const string & filename)
+{
+  ifstream in(filename);
+  if (!in.is_open())
+  {
+    // no cache yet
+    return;
+  }
+
+  string line;
+  if (!getline(in, line) || line != CACHE_FILE_HEADER)
+  {
+    // written by an older version, start with an empty cache
+    return;
+  }
+  while (getline(in, line))
+  {
+    istringstream iss(line);
+    QueryKey key;
+    string res;
+    size_t core_size, model_size;
+    auto entry = make_shared<CacheEntry>();
+    if (!(iss >> key.first >> key.second >> res >> entry->has_core
+          >> core_size))
+    {
+      throw SmtException("CachingSolver: malformed cache file " + filename);
+    }
+
+    if (res == "sat")
+    {
+      entry->result = Result(SAT);
+    }
+    else if (res == "unsat")
+    {
+      entry->result = Result(UNSAT);
+    }
+    else
+    {
+      throw SmtException("CachingSolver: unexpected result " + res
+                         + " in cache file " + filename);
+    }
+
+    entry->core.resize(core_size);
+    for (size_t i = 0; i < core_size; ++i)
+    {
+      iss >> entry->core[i];
+    }
+
+    iss >> model_size;
+    for (size_t i = 0; i < model_size; ++i)
+    {
+      string name, val;
+      // separated by single spaces
+      iss.get();
+      bool ok = read_str(iss, name);
+      iss.get();
+      if (!ok || !read_str(iss, val))
+      {
+        throw SmtException("CachingSolver: malformed model in cache file "
+                           + filename);
+      }
+      entry->value_strs[name] = val;
+    }
+
+    for (auto list : { &entry->assertions, &entry->assumptions })
+    {
+      size_t size = 0;
+      iss >> size;
+      list->resize(size);
+      for (size_t i = 0; i < size; ++i)
+      {
+        iss >> (*list)[i];
+      }
+    }
+
+    if (!iss)
+    {
+      throw SmtException("CachingSolver: malformed cache file " + filename);
+    }
+    insert(key, entry);
+  }
+}
+
+void CachingSolver::flush() const
+{
+  if (cache_file_.empty())
+  {
+    return;
+  }
+
+  ofstream out(cache_file_, ios::trunc);
+  if (!out.is_open())
+  {
+    throw SmtException("CachingSolver: could not open cache file "
+                       + cache_file_);
+  }
+
+  out << CACHE_FILE_HEADER << endl;
+  for (auto it = lru_.rbegin(); it != lru_.rend(); ++it)
+  {
+    const CacheEntryPtr & entry = entries_.at(*it).first;
+    out << it->first << " " << it->second << " "
+        << entry->result.to_string() << " " << entry->has_core << " "
+        << entry->core.size();
+    for (auto h : entry->core)
+    {
+      out << " " << h;
+    }
+    out << " " << entry->value_strs.size();
+    for (const auto & elem : entry->value_strs)
+    {
+      out << " ";
+      write_str(out, elem.first);
+      out << " ";
+      write_str(out, elem.second);
+    }
+    for (auto list : { &entry->assertions, &entry->assumptions })
+    {
+      out << " " << list->size();
+      for (auto h : *list)
+      {
+        out << " " << h;
+      }
+    }
+    out << endl;
+  }
+}
+
+// dispatched to underlying solver
+
+uint64_t CachingSolver::get_context_level() const
+{
+  return wrapped_solver->get_context_level();
+}
+
+void CachingSolver::set_opt(const string option, const string value)
+{
+  wrapped_solver->set_opt(option, value);
+}
+
+void CachingSolver::set_logic(const string logic)
+{
+  wrapped_solver->set_logic(logic);
+}
+
+Sort CachingSolver::make_sort(const string name, uint64_t arity) const
+{
+  return wrapped_solver->make_sort(name, arity);
+}
+
+Sort CachingSolver::make_sort(const SortKind sk) const
+{
+  return wrapped_solver->make_sort(sk);
+}
+
+Sort CachingSolver::make_sort(const SortKind sk, uint64_t size) const
+{
+  return wrapped_solver->make_sort(sk, size);
+}
+
+Sort CachingSolver::make_sort(const SortKind sk, const Sort & sort1) const
+{
+  return wrapped_solver->make_sort(sk, sort1);
+}
+
+Sort CachingSolver::make_sort(const SortKind sk,
+                              const Sort & sort1,
+                              const Sort & sort2) const
+{
+  return wrapped_solver->make_sort(sk, sort1, sort2);
+}
+
+Sort CachingSolver::make_sort(const SortKind sk,
+                              const Sort & sort1,
+                              const Sort & sort2,
+                              const Sort & sort3) const
+{
+  return wrapped_solver->make_sort(sk, sort1, sort2, sort3);
+}
+
+Sort CachingSolver::make_sort(const SortKind sk, const SortVec & sorts) const
+{
+  return wrapped_solver->make_sort(sk, sorts);
+}
+
+Sort CachingSolver::make_sort(const Sort & sort_con,
+                              const SortVec & sorts) const
+{
+  return wrapped_solver->make_sort(sort_con, sorts);
+}
+
+Sort CachingSolver::make_sort(const DatatypeDecl & d) const
+{
+  return wrapped_solver->make_sort(d);
+}
+
+Sort CachingSolver::make_unresolved_sort(const DatatypeDecl & decl) const
+{
+  return wrapped_solver->make_unresolved_sort(decl);
+}
+
+SortVec CachingSolver::make_datatype_sorts(
+    const std::vector<DatatypeDecl> & decls) const
+{
+  return wrapped_solver->make_datatype_sorts(decls);
+}
+
+DatatypeDecl CachingSolver::make_datatype_decl(const string & s)
+{
+  return wrapped_solver->make_datatype_decl(s);
+}
+
+DatatypeConstructorDecl CachingSolver::make_datatype_constructor_decl(
+    const string s)
+{
+  return wrapped_solver->make_datatype_constructor_decl(s);
+}
+
+void CachingSolver::add_constructor(DatatypeDecl & dt,
+                                    const DatatypeConstructorDecl & con) const
+{
+  wrapped_solver->add_constructor(dt, con);
+}
+
+void CachingSolver::add_selector(DatatypeConstructorDecl & dt,
+                                 const string & name,
+                                 const Sort & s) const
+{
+  wrapped_solver->add_selector(dt, name, s);
+}
+
+void CachingSolver::add_selector_self(DatatypeConstructorDecl & dt,
+                                      const string & name) const
+{
+  wrapped_solver->add_selector_self(dt, name);
+}
+
+Term CachingSolver::get_constructor(const Sort & s, string name) const
+{
+  return wrapped_solver->get_constructor(s, name);
+}
+
+Term CachingSolver::get_tester(const Sort & s, string name) const
+{
+  return wrapped_solver->get_tester(s, name);
+}
+
+Term CachingSolver::get_selector(const Sort & s, string con, string name) const
+{
+  return wrapped_solver->get_selector(s, con, name);
+}
+
+Term CachingSolver::make_term(bool b) const
+{
+  return wrapped_solver->make_term(b);
+}
+
+Term CachingSolver::make_term(int64_t i, const Sort & sort) const
+{
+  return wrapped_solver->make_term(i, sort);
+}
+
+Term CachingSolver::make_term(const string val,
+                              const Sort & sort,
+                              uint64_t base) const
+{
+  return wrapped_solver->make_term(val, sort, base);
+}
+
+Term CachingSolver::make_term(const Term & val, const Sort & sort) const
+{
+  return wrapped_solver->make_term(val, sort);
+}
+
+Term CachingSolver::make_symbol(const string name, const Sort & sort)
+{
+  return wrapped_solver->make_symbol(name, sort);
+}
+
+Term CachingSolver::get_symbol(const string & name)
+{
+  return wrapped_solver->get_symbol(name);
+}
+
+Term CachingSolver::make_param(const string name, const Sort & sort)
+{
+  return wrapped_solver->make_param(name, sort);
+}
+
+Term CachingSolver::make_term(const Op op, const Term & t) const
+{
+  return wrapped_solver->make_term(op, t);
+}
+
+Term CachingSolver::make_term(const Op op,
+                              const Term & t0,
+                              const Term & t1) const
+{
+  return wrapped_solver->make_term(op, t0, t1);
+}
+
+Term CachingSolver::make_term(const Op op,
+                              const Term & t0,
+                              const Term & t1,
+                              const Term & t2) const
+{
+  return wrapped_solver->make_term(op, t0, t1, t2);
+}
+
+Term CachingSolver::make_term(const Op op, const TermVec & terms) const
+{
+  return wrapped_solver->make_term(op, terms);
+}
+
+Term CachingSolver::substitute(const Term term,
+                               const UnorderedTermMap & substitution_map) const
+{
+  return wrapped_solver->substitute(term, substitution_map);
+}
+
+TermVec CachingSolver::substitute_terms(
+    const TermVec & terms, const UnorderedTermMap & substitution_map) const
+{
+  return wrapped_solver->substitute_terms(terms, substitution_map);
+}
+
+Result CachingSolver::get_interpolant(const Term & A,
+                                      const Term & B,
+                                      Term & out_I) const
+{
+  return wrapped_solver->get_interpolant(A, B, out_I);
+}
+
+SmtSolver create_caching_solver(SmtSolver wrapped_solver,
+                                size_t capacity,
+                                const string & cache_file,
+                                size_t hash_capacity)
+{
+  return std::make_shared<CachingSolver>(
+      wrapped_solver, capacity, cache_file, hash_capacity);
+}
+
+}  // namespace smt
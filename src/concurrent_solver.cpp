@@ -0,0 +1,406 @@
+/*********************                                                        */
+/*! \file concurrent_solver.cpp
+** \verbatim
+** Top contributors (to current version):
+**   agent
+** This file is part of the smt-switch project.
+** Copyright (c) 2026 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved.  See the file LICENSE in the top-level source
+** directory for licensing information.\endverbatim
+**
+** \brief Class that wraps another SmtSolver so that it can be shared
+**        between threads.
+**/
+
+#include "concurrent_solver.h"
+
+using namespace std;
+
+namespace smt {
+
+ConcurrentSolver::ConcurrentSolver(SmtSolver s)
+    : AbsSmtSolver(s->get_solver_enum()),
+      wrapped_solver(s),
+      mutex_(make_shared<recursive_mutex>())
+{
+}
+
+ConcurrentSolver::~ConcurrentSolver() {}
+
+template <class T>
+shared_ptr<T> ConcurrentSolver::guard(const shared_ptr<T> & p) const
+{
+  if (!p)
+  {
+    return p;
+  }
+  // the backend reference counts (e.g. Z3_dec_ref) are not thread-safe,
+  // so the last handle drops the wrapped object under the lock
+  shared_ptr<recursive_mutex> m = mutex_;
+  return shared_ptr<T>(p.get(), [m, held = p](T *) mutable {
+    lock_guard<recursive_mutex> lock(*m);
+    held.reset();
+  });
+}
+
+TermVec ConcurrentSolver::guard_all(const TermVec & terms) const
+{
+  TermVec res;
+  res.reserve(terms.size());
+  for (const auto & t : terms)
+  {
+    res.push_back(guard(t));
+  }
+  return res;
+}
+
+UnorderedTermMap ConcurrentSolver::guard_all(const UnorderedTermMap & m) const
+{
+  UnorderedTermMap res;
+  res.reserve(m.size());
+  for (const auto & elem : m)
+  {
+    res.emplace(guard(elem.first), guard(elem.second));
+  }
+  return res;
+}
+
+void ConcurrentSolver::set_opt(const std::string option,
+                               const std::string value)
+{
+  batch([&]() { wrapped_solver->set_opt(option, value); });
+}
+
+void ConcurrentSolver::set_logic(const std::string logic)
+{
+  batch([&]() { wrapped_solver->set_logic(logic); });
+}
+
+void ConcurrentSolver::assert_formula(const Term & t)
+{
+  batch([&]() { wrapped_solver->assert_formula(t); });
+}
+
+Result ConcurrentSolver::check_sat()
+{
+  return batch([&]() { return wrapped_solver->check_sat(); });
+}
+
+Result ConcurrentSolver::check_sat_assuming(const TermVec & assumptions)
+{
+  return batch(
+      [&]() { return wrapped_solver->check_sat_assuming(assumptions); });
+}
+
+Result ConcurrentSolver::check_sat_assuming_list(const TermList & assumptions)
+{
+  return batch(
+      [&]() { return wrapped_solver->check_sat_assuming_list(assumptions); });
+}
+
+Result ConcurrentSolver::check_sat_assuming_set(
+    const UnorderedTermSet & assumptions)
+{
+  return batch(
+      [&]() { return wrapped_solver->check_sat_assuming_set(assumptions); });
+}
+
+void ConcurrentSolver::push(uint64_t num)
+{
+  batch([&]() { wrapped_solver->push(num); });
+}
+
+void ConcurrentSolver::pop(uint64_t num)
+{
+  batch([&]() { wrapped_solver->pop(num); });
+}
+
+uint64_t ConcurrentSolver::get_context_level() const
+{
+  return batch([&]() { return wrapped_solver->get_context_level(); });
+}
+
+Term ConcurrentSolver::get_value(const Term & t) const
+{
+  return guard(batch([&]() { return wrapped_solver->get_value(t); }));
+}
+
+void ConcurrentSolver::get_bv_value(const Term & t,
+                                    std::vector<uint64_t> & out) const
+{
+  batch([&]() { wrapped_solver->get_bv_value(t, out); });
+}
+
+UnorderedTermMap ConcurrentSolver::get_array_values(const Term & arr,
+                                                    Term & out_const_base) const
+{
+  return batch([&]() {
+    UnorderedTermMap res = guard_all(
+        wrapped_solver->get_array_values(arr, out_const_base));
+    out_const_base = guard(out_const_base);
+    return res;
+  });
+}
+
+void ConcurrentSolver::get_unsat_assumptions(UnorderedTermSet & out)
+{
+  batch([&]() {
+    UnorderedTermSet core;
+    wrapped_solver->get_unsat_assumptions(core);
+    for (const auto & a : core)
+    {
+      out.insert(guard(a));
+    }
+  });
+}
+
+Sort ConcurrentSolver::make_sort(const std::string name, uint64_t arity) const
+{
+  return guard(batch([&]() { return wrapped_solver->make_sort(name, arity); }));
+}
+
+Sort ConcurrentSolver::make_sort(const SortKind sk) const
+{
+  return guard(batch([&]() { return wrapped_solver->make_sort(sk); }));
+}
+
+Sort ConcurrentSolver::make_sort(const SortKind sk, uint64_t size) const
+{
+  return guard(batch([&]() { return wrapped_solver->make_sort(sk, size); }));
+}
+
+Sort ConcurrentSolver::make_sort(const SortKind sk, const Sort & sort1) const
+{
+  return guard(batch([&]() { return wrapped_solver->make_sort(sk, sort1); }));
+}
+
+Sort ConcurrentSolver::make_sort(const SortKind sk,
+                                 const Sort & sort1,
+                                 const Sort & sort2) const
+{
+  return guard(
+      batch([&]() { return wrapped_solver->make_sort(sk, sort1, sort2); }));
+}
+
+Sort ConcurrentSolver::make_sort(const SortKind sk,
+                                 const Sort & sort1,
+                                 const Sort & sort2,
+                                 const Sort & sort3) const
+{
+  return guard(batch(
+      [&]() { return wrapped_solver->make_sort(sk, sort1, sort2, sort3); }));
+}
+
+Sort ConcurrentSolver::make_sort(const SortKind sk, const SortVec & sorts) const
+{
+  return guard(batch([&]() { return wrapped_solver->make_sort(sk, sorts); }));
+}
+
+Sort ConcurrentSolver::make_sort(const Sort & sort_con,
+                                 const SortVec & sorts) const
+{
+  return guard(
+      batch([&]() { return wrapped_solver->make_sort(sort_con, sorts); }));
+}
+
+Sort ConcurrentSolver::make_sort(const DatatypeDecl & d) const
+{
+  return guard(batch([&]() { return wrapped_solver->make_sort(d); }));
+}
+
+Sort ConcurrentSolver::make_unresolved_sort(const DatatypeDecl & decl) const
+{
+  return guard(
+      batch([&]() { return wrapped_solver->make_unresolved_sort(decl); }));
+}
+
+SortVec ConcurrentSolver::make_datatype_sorts(
+    const std::vector<DatatypeDecl> & decls) const
+{
+  SortVec sorts =
+      batch([&]() { return wrapped_solver->make_datatype_sorts(decls); });
+  for (auto & s : sorts)
+  {
+    s = guard(s);
+  }
+  return sorts;
+}
+
+DatatypeDecl ConcurrentSolver::make_datatype_decl(const std::string & s)
+{
+  return guard(batch([&]() { return wrapped_solver->make_datatype_decl(s); }));
+}
+
+DatatypeConstructorDecl ConcurrentSolver::make_datatype_constructor_decl(
+    const std::string s)
+{
+  return guard(batch(
+      [&]() { return wrapped_solver->make_datatype_constructor_decl(s); }));
+}
+
+void ConcurrentSolver::add_constructor(DatatypeDecl & dt,
+                                       const DatatypeConstructorDecl & con) const
+{
+  batch([&]() { wrapped_solver->add_constructor(dt, con); });
+}
+
+void ConcurrentSolver::add_selector(DatatypeConstructorDecl & dt,
+                                    const std::string & name,
+                                    const Sort & s) const
+{
+  batch([&]() { wrapped_solver->add_selector(dt, name, s); });
+}
+
+void ConcurrentSolver::add_selector_self(DatatypeConstructorDecl & dt,
+                                         const std::string & name) const
+{
+  batch([&]() { wrapped_solver->add_selector_self(dt, name); });
+}
+
+Term ConcurrentSolver::get_constructor(const Sort & s, std::string name) const
+{
+  return guard(
+      batch([&]() { return wrapped_solver->get_constructor(s, name); }));
+}
+
+Term ConcurrentSolver::get_tester(const Sort & s, std::string name) const
+{
+  return guard(batch([&]() { return wrapped_solver->get_tester(s, name); }));
+}
+
+Term ConcurrentSolver::get_selector(const Sort & s,
+                                    std::string con,
+                                    std::string name) const
+{
+  return guard(
+      batch([&]() { return wrapped_solver->get_selector(s, con, name); }));
+}
+
+Term ConcurrentSolver::make_term(bool b) const
+{
+  return guard(batch([&]() { return wrapped_solver->make_term(b); }));
+}
+
+Term ConcurrentSolver::make_term(int64_t i, const Sort & sort) const
+{
+  return guard(batch([&]() { return wrapped_solver->make_term(i, sort); }));
+}
+
+Term ConcurrentSolver::make_term(const std::string val,
+                                 const Sort & sort,
+                                 uint64_t base) const
+{
+  return guard(
+      batch([&]() { return wrapped_solver->make_term(val, sort, base); }));
+}
+
+Term ConcurrentSolver::make_term(const Term & val, const Sort & sort) const
+{
+  return guard(batch([&]() { return wrapped_solver->make_term(val, sort); }));
+}
+
+Term ConcurrentSolver::make_symbol(const std::string name, const Sort & sort)
+{
+  return guard(
+      batch([&]() { return wrapped_solver->make_symbol(name, sort); }));
+}
+
+Term ConcurrentSolver::get_symbol(const std::string & name)
+{
+  return guard(batch([&]() { return wrapped_solver->get_symbol(name); }));
+}
+
+Term ConcurrentSolver::make_param(const std::string name, const Sort & sort)
+{
+  return guard(batch([&]() { return wrapped_solver->make_param(name, sort); }));
+}
+
+Term ConcurrentSolver::make_term(const Op op, const Term & t) const
+{
+  return guard(batch([&]() { return wrapped_solver->make_term(op, t); }));
+}
+
+Term ConcurrentSolver::make_term(const Op op,
+                                 const Term & t0,
+                                 const Term & t1) const
+{
+  return guard(batch([&]() { return wrapped_solver->make_term(op, t0, t1); }));
+}
+
+Term ConcurrentSolver::make_term(const Op op,
+                                 const Term & t0,
+                                 const Term & t1,
+                                 const Term & t2) const
+{
+  return guard(
+      batch([&]() { return wrapped_solver->make_term(op, t0, t1, t2); }));
+}
+
+Term ConcurrentSolver::make_term(const Op op, const TermVec & terms) const
+{
+  return guard(batch([&]() { return wrapped_solver->make_term(op, terms); }));
+}
+
+void ConcurrentSolver::reset()
+{
+  batch([&]() { wrapped_solver->reset(); });
+}
+
+void ConcurrentSolver::reset_assertions()
+{
+  batch([&]() { wrapped_solver->reset_assertions(); });
+}
+
+MemoryStats ConcurrentSolver::get_memory_stats() const
+{
+  return batch([&]() { return wrapped_solver->get_memory_stats(); });
+}
+
+Term ConcurrentSolver::substitute(const Term term,
+                                  const UnorderedTermMap & substitution_map) const
+{
+  return guard(batch(
+      [&]() { return wrapped_solver->substitute(term, substitution_map); }));
+}
+
+TermVec ConcurrentSolver::substitute_terms(
+    const TermVec & terms, const UnorderedTermMap & substitution_map) const
+{
+  return batch([&]() {
+    return guard_all(wrapped_solver->substitute_terms(terms, substitution_map));
+  });
+}
+
+void ConcurrentSolver::dump_smt2(std::string filename) const
+{
+  batch([&]() { wrapped_solver->dump_smt2(filename); });
+}
+
+Result ConcurrentSolver::get_interpolant(const Term & A,
+                                         const Term & B,
+                                         Term & out_I) const
+{
+  return batch([&]() {
+    Result r = wrapped_solver->get_interpolant(A, B, out_I);
+    out_I = guard(out_I);
+    return r;
+  });
+}
+
+Result ConcurrentSolver::get_sequence_interpolants(const TermVec & formulae,
+                                                   TermVec & out_I) const
+{
+  return batch([&]() {
+    Result r = wrapped_solver->get_sequence_interpolants(formulae, out_I);
+    out_I = guard_all(out_I);
+    return r;
+  });
+}
+
+SmtSolver create_concurrent_solver(SmtSolver wrapped_solver)
+{
+  return std::make_shared<ConcurrentSolver>(wrapped_solver);
+}
+
+}  // namespace smt
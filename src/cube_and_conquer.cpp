@@ -0,0 +1,451 @@
+/*********************                                                        */
+/*! \file cube_and_conquer.cpp
+** \verbatim
+** Top contributors (to current version):
+**   agent
+** This file is part of the smt-switch project.
+** Copyright (c) 2026 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved.  See the file LICENSE in the top-level source
+** directory for licensing information.\endverbatim
+**
+** \brief Parallel cube-and-conquer driver over a pool of solvers.
+**
+**/
+
+#include "cube_and_conquer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+#include "term_translator.h"
+#include "utils.h"
+
+using namespace std;
+
+namespace smt {
+
+CubeAndConquer::CubeAndConquer(std::vector<SmtSolver> workers,
+                               const Term & formula,
+                               const TermVec & split_vars)
+    : max_depth_(8),
+      heuristic_(CUBE_CORE_ACTIVITY),
+      outstanding_(0),
+      done_(false),
+      proven_unsat_(false),
+      any_unknown_(false),
+      found_sat_(false),
+      sat_worker_(0)
+{
+  if (workers.empty())
+  {
+    throw IncorrectUsageException("CubeAndConquer needs at least one worker");
+  }
+
+  TermVec vars = split_vars;
+  if (vars.empty())
+  {
+    UnorderedTermSet free_vars;
+    get_free_symbolic_consts(formula, free_vars);
+    for (const auto & v : free_vars)
+    {
+      if (v->get_sort()->get_sort_kind() == BOOL)
+      {
+        vars.push_back(v);
+      }
+    }
+    // deterministic split order
+    std::sort(vars.begin(), vars.end(), [](const Term & a, const Term & b) {
+      return a->to_string() < b->to_string();
+    });
+  }
+
+  // count how often each variable is used in the formula
+  std::unordered_map<Term, size_t> var_occurrences;
+  for (const auto & v : vars)
+  {
+    SortKind sk = v->get_sort()->get_sort_kind();
+    if (sk != BOOL && sk != BV)
+    {
+      throw IncorrectUsageException("Can only split on boolean or bit-vector "
+                                    "terms but got "
+                                    + v->to_string());
+    }
+    var_occurrences[v] = 0;
+  }
+  UnorderedTermSet visited;
+  TermVec to_visit({ formula });
+  while (to_visit.size())
+  {
+    Term t = to_visit.back();
+    to_visit.pop_back();
+    if (!visited.insert(t).second)
+    {
+      continue;
+    }
+    for (const auto & c : t)
+    {
+      auto it = var_occurrences.find(c);
+      if (it != var_occurrences.end())
+      {
+        it->second++;
+      }
+      to_visit.push_back(c);
+    }
+  }
+
+  // one split index per boolean variable, or per bit of a bit-vector
+  // splits[k] = (variable, bit) where bit is only used for bit-vectors
+  vector<pair<Term, uint64_t>> splits;
+  for (const auto & v : vars)
+  {
+    uint64_t num_bits = v->get_sort()->get_sort_kind() == BOOL
+                            ? 1
+                            : v->get_sort()->get_width();
+    for (uint64_t i = 0; i < num_bits; ++i)
+    {
+      splits.push_back({ v, i });
+      occurrences_.push_back(var_occurrences.at(v));
+    }
+  }
+  num_splits_ = splits.size();
+  activity_.assign(num_splits_, 0);
+
+  // translate the formula and the split literals to every worker
+  for (auto & s : workers)
+  {
+    Worker w;
+    w.solver = s;
+    s->set_opt("incremental", "true");
+    s->set_opt("produce-unsat-assumptions", "true");
+
+    TermTranslator to_s(s);
+    s->assert_formula(to_s.transfer_term(formula, BOOL));
+
+    Sort bv1sort = s->make_sort(BV, 1);
+    Term bv1 = s->make_term(1, bv1sort);
+    for (const auto & sp : splits)
+    {
+      Term pos;
+      if (sp.first->get_sort()->get_sort_kind() == BOOL)
+      {
+        pos = to_s.transfer_term(sp.first, BOOL);
+      }
+      else
+      {
+        Term v = to_s.transfer_term(sp.first);
+        Op ext(Extract, sp.second, sp.second);
+        pos = s->make_term(Equal, s->make_term(ext, v), bv1);
+      }
+      Term neg = s->make_term(Not, pos);
+      for (const auto & l : { pos, neg })
+      {
+        w.lit_of[l] = w.lits.size();
+        w.lits.push_back(l);
+        w.lit_set.insert(l);
+      }
+    }
+    workers_.push_back(std::move(w));
+  }
+}
+
+Result CubeAndConquer::solve()
+{
+  auto start = chrono::steady_clock::now();
+
+  for (auto & w : workers_)
+  {
+    w.queue.clear();
+  }
+  cores_.clear();
+  activity_.assign(num_splits_, 0);
+  done_ = false;
+  proven_unsat_ = false;
+  any_unknown_ = false;
+  found_sat_ = false;
+  sat_worker_ = 0;
+  sat_cube_.clear();
+  stats_ = CubeStats();
+  stats_.solved_per_worker.assign(workers_.size(), 0);
+
+  // the root cube is the empty conjunction
+  workers_[0].queue.push_back({});
+  outstanding_ = 1;
+  stats_.cubes_generated = 1;
+
+  vector<thread> threads;
+  for (size_t i = 0; i < workers_.size(); ++i)
+  {
+    threads.emplace_back(&CubeAndConquer::run_worker, this, i);
+  }
+  for (auto & t : threads)
+  {
+    t.join();
+  }
+
+  stats_.seconds =
+      chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+  if (found_sat_)
+  {
+    return Result(SAT);
+  }
+  if (proven_unsat_ || !any_unknown_)
+  {
+    return Result(UNSAT);
+  }
+  return Result(UNKNOWN);
+}
+
+TermVec CubeAndConquer::get_sat_cube() const
+{
+  TermVec res;
+  const Worker & w = workers_[sat_worker_];
+  for (const auto & l : sat_cube_)
+  {
+    res.push_back(w.lits[l]);
+  }
+  return res;
+}
+
+void CubeAndConquer::print_report(std::ostream & os) const
+{
+  os << "cube-and-conquer: " << workers_.size() << " workers, "
+     << num_splits_ << " split literals, max depth " << max_depth_ << endl;
+  os << "  cubes generated: " << stats_.cubes_generated << endl;
+  os << "  cubes solved:    " << stats_.cubes_solved << endl;
+  os << "  cubes pruned:    " << stats_.cubes_pruned << endl;
+  os << "  cubes unknown:   " << stats_.cubes_unknown << endl;
+  os << "  unsat cores:     " << cores_.size() << endl;
+  os << "  steals:          " << stats_.steals << endl;
+  for (size_t i = 0; i < stats_.solved_per_worker.size(); ++i)
+  {
+    os << "  worker " << i << " solved: " << stats_.solved_per_worker[i]
+       << endl;
+  }
+  os << "  time:            " << stats_.seconds << "s";
+  if (stats_.seconds > 0)
+  {
+    os << " (" << (stats_.cubes_solved / stats_.seconds) << " cubes/s)";
+  }
+  os << endl;
+}
+
+void CubeAndConquer::run_worker(size_t idx)
+{
+  Worker & w = workers_[idx];
+  TermVec assumptions;
+  UnorderedTermSet core_terms;
+
+  unique_lock<mutex> lk(m_);
+  Cube c;
+  while (next_cube(idx, lk, c))
+  {
+    if (subsumed(c))
+    {
+      stats_.cubes_pruned++;
+      if (--outstanding_ == 0)
+      {
+        cv_.notify_all();
+      }
+      continue;
+    }
+
+    size_t split = c.size() < max_depth_ ? pick_split(c) : num_splits_;
+    if (split < num_splits_)
+    {
+      // the positive child is pushed last so it is solved first
+      for (Lit l : { 2 * split + 1, 2 * split })
+      {
+        Cube child = c;
+        child.insert(std::upper_bound(child.begin(), child.end(), l), l);
+        w.queue.push_back(std::move(child));
+      }
+      outstanding_ += 1;  // two children replace c
+      stats_.cubes_generated += 2;
+      cv_.notify_all();
+      continue;
+    }
+
+    lk.unlock();
+
+    assumptions.clear();
+    for (Lit l : c)
+    {
+      assumptions.push_back(w.lits[l]);
+    }
+
+    Result r;
+    Cube core;
+    try
+    {
+      r = assumptions.empty() ? w.solver->check_sat()
+                              : w.solver->check_sat_assuming(assumptions);
+      if (r.is_unsat() && !assumptions.empty())
+      {
+        core_terms.clear();
+        w.solver->get_unsat_assumptions(core_terms);
+        for (const auto & t : core_terms)
+        {
+          auto it = w.lit_of.find(t);
+          if (it == w.lit_of.end())
+          {
+            // the backend reported a term that is not one of our literals
+            // (e.g. a rewritten assumption), so only the cube is known to
+            // be refuted
+            core.clear();
+            break;
+          }
+          core.push_back(it->second);
+        }
+        if (core.empty())
+        {
+          // an empty core only proves unsat when the cube was empty
+          core = c;
+        }
+        std::sort(core.begin(), core.end());
+      }
+    }
+    catch (SmtException & e)
+    {
+      r = Result(UNKNOWN, e.what());
+    }
+
+    lk.lock();
+    stats_.cubes_solved++;
+    stats_.solved_per_worker[idx]++;
+    outstanding_--;
+
+    if (r.is_sat())
+    {
+      if (!found_sat_)
+      {
+        found_sat_ = true;
+        sat_worker_ = idx;
+        sat_cube_ = c;
+      }
+      done_ = true;
+    }
+    else if (r.is_unsat())
+    {
+      for (Lit l : core)
+      {
+        activity_[l / 2]++;
+      }
+      if (core.empty())
+      {
+        // the empty cube is unsat, so is the formula
+        proven_unsat_ = true;
+        done_ = true;
+      }
+      cores_.push_back(std::move(core));
+    }
+    else
+    {
+      stats_.cubes_unknown++;
+      any_unknown_ = true;
+    }
+
+    if (done_ || outstanding_ == 0)
+    {
+      cv_.notify_all();
+    }
+  }
+}
+
+bool CubeAndConquer::next_cube(size_t idx,
+                               std::unique_lock<std::mutex> & lk,
+                               Cube & out)
+{
+  while (!done_)
+  {
+    deque<Cube> & own = workers_[idx].queue;
+    if (own.size())
+    {
+      // depth-first on the own queue
+      out = std::move(own.back());
+      own.pop_back();
+      return true;
+    }
+
+    for (size_t i = 1; i < workers_.size(); ++i)
+    {
+      deque<Cube> & other = workers_[(idx + i) % workers_.size()].queue;
+      if (other.size())
+      {
+        // steal the shallowest cube, it has the most work below it
+        out = std::move(other.front());
+        other.pop_front();
+        stats_.steals++;
+        return true;
+      }
+    }
+
+    if (outstanding_ == 0)
+    {
+      done_ = true;
+      cv_.notify_all();
+      break;
+    }
+    cv_.wait(lk);
+  }
+  return false;
+}
+
+bool CubeAndConquer::subsumed(const Cube & c) const
+{
+  for (const auto & core : cores_)
+  {
+    if (core.size() <= c.size()
+        && std::includes(c.begin(), c.end(), core.begin(), core.end()))
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+size_t CubeAndConquer::pick_split(const Cube & c) const
+{
+  vector<bool> used(num_splits_, false);
+  for (Lit l : c)
+  {
+    used[l / 2] = true;
+  }
+
+  size_t best = num_splits_;
+  for (size_t i = 0; i < num_splits_; ++i)
+  {
+    if (used[i])
+    {
+      continue;
+    }
+    if (best == num_splits_)
+    {
+      best = i;
+      if (heuristic_ == CUBE_STATIC)
+      {
+        break;
+      }
+      continue;
+    }
+
+    bool better = false;
+    if (heuristic_ == CUBE_CORE_ACTIVITY && activity_[i] != activity_[best])
+    {
+      better = activity_[i] > activity_[best];
+    }
+    else
+    {
+      better = occurrences_[i] > occurrences_[best];
+    }
+    if (better)
+    {
+      best = i;
+    }
+  }
+  return best;
+}
+
+}  // namespace smt
@@ -26,23 +26,27 @@ GenericDatatypeConstructorDecl::GenericDatatypeConstructorDecl(
 void GenericDatatypeConstructorDecl::add_new_selector(
     const SelectorComponents & newSelector)
 {
-  for (unsigned int i = 0; i < selector_vector.size(); ++i)
+  // Checks if the selector has already been added
+  if (!selector_index.emplace(newSelector.name, selector_vector.size()).second)
   {
-    // Checks if the selector has already been added
-    if (selector_vector[i].name == (newSelector).name)
-    {
-      throw "Can't add selector. It already exists in this datatype!";
-    }
+    throw "Can't add selector. It already exists in this datatype!";
   }
   selector_vector.push_back(newSelector);
 }
 
-std::vector<SelectorComponents>
-GenericDatatypeConstructorDecl::get_selector_vector()
+const std::vector<SelectorComponents> &
+GenericDatatypeConstructorDecl::get_selector_vector() const
 {
   return selector_vector;
 }
 
+int GenericDatatypeConstructorDecl::get_selector_index(
+    const std::string & sel_name) const
+{
+  auto it = selector_index.find(sel_name);
+  return it == selector_index.end() ? -1 : it->second;
+}
+
 std::string GenericDatatypeConstructorDecl::get_name() const
 {
   return cons_name;
@@ -79,14 +83,23 @@ GenericDatatype::GenericDatatype(const DatatypeDecl & dt_declaration)
 void GenericDatatype::add_constructor(
     const DatatypeConstructorDecl & dt_cons_decl)
 {
-  // Checks if dt_cons_decl is already associated with the datatype
-  if (std::find(cons_decl_vector.begin(), cons_decl_vector.end(), dt_cons_decl)
-      != cons_decl_vector.end())
+  // Only generic declarations can be read by name, a declaration of a
+  // backend solver can't be a constructor of a GenericDatatype
+  shared_ptr<GenericDatatypeConstructorDecl> gdt_cons =
+      dynamic_pointer_cast<GenericDatatypeConstructorDecl>(dt_cons_decl);
+  if (!gdt_cons)
+  {
+    throw InternalSolverException(
+        "Can't add constructor. It is not a generic constructor "
+        "declaration!");
+  }
+  // Checks if a constructor with this name is already associated with the
+  // datatype
+  if (!cons_index.emplace(gdt_cons->get_name(), cons_decl_vector.size())
+           .second)
   {
     throw "Can't add constructor. It already has been added!";
   }
-  shared_ptr<GenericDatatypeConstructorDecl> gdt_cons =
-      static_pointer_cast<GenericDatatypeConstructorDecl>(dt_cons_decl);
   // Links the constructor to the datatype_decl of the datatype
   gdt_cons->update_stored_dt(dt_decl);
   // Links the datatype to the new constructor
@@ -96,27 +109,22 @@ void GenericDatatype::add_constructor(
 void GenericDatatype::add_selector(const DatatypeConstructorDecl & dt_cons_decl,
                                    const SelectorComponents & newSelector)
 {
-  // Boolean used to keep track of if a successful match was found.
-  bool success = false;
-  for (unsigned int i = 0; i < cons_decl_vector.size(); ++i)
-  {
-    // If the constructor is associated with the datatype
-    if (cons_decl_vector[i] == dt_cons_decl)
-    {
-      // Adds the selector to the correct constructor
-      static_pointer_cast<GenericDatatypeConstructorDecl>(cons_decl_vector[i])
-          ->add_new_selector(newSelector);
-      success = true;
-      break;
-    }
-  }
-  if (!success)
+  // A declaration that isn't generic can't be a member either
+  shared_ptr<GenericDatatypeConstructorDecl> gdt_cons =
+      dynamic_pointer_cast<GenericDatatypeConstructorDecl>(dt_cons_decl);
+  int idx = gdt_cons ? get_constructor_index(gdt_cons->get_name()) : -1;
+  // If the constructor is associated with the datatype
+  if (idx < 0 || cons_decl_vector[idx] != dt_cons_decl)
   {
     throw InternalSolverException(
         "Can't add selector. The constructor is not a member of the datatype!");
   }
+  // Adds the selector to the correct constructor
+  gdt_cons->add_new_selector(newSelector);
 }
-std::vector<DatatypeConstructorDecl> GenericDatatype::get_cons_vector()
+
+const std::vector<DatatypeConstructorDecl> & GenericDatatype::get_cons_vector()
+    const
 {
   return cons_decl_vector;
 }
@@ -133,29 +141,26 @@ int GenericDatatype::get_num_constructors() const
 
 int GenericDatatype::get_num_selectors(std::string cons) const
 {
-  // Used to keep track of the number of selectors in the constructor
-  int num_selectors = 0;
-  bool found = false;
-  for (unsigned int i = 0; i < cons_decl_vector.size(); ++i)
-  // Searches for a matching constructor
-  {
-    if (static_pointer_cast<GenericDatatypeConstructorDecl>(cons_decl_vector[i])
-            ->get_name()
-        == cons)
-    {
-      found = true;
-      // Calls the constructor's get_selector_count() function
-      num_selectors = static_pointer_cast<GenericDatatypeConstructorDecl>(
-                          cons_decl_vector[i])
-                          ->get_selector_count();
-      break;
-    }
-  }
-  if (!found)
+  int idx = get_constructor_index(cons);
+  if (idx < 0)
   {
     throw InternalSolverException("Constructor not found");
   }
-  return num_selectors;
+  return get_cons_decl(idx)->get_selector_count();
+}
+
+int GenericDatatype::get_constructor_index(const std::string & cons) const
+{
+  auto it = cons_index.find(cons);
+  return it == cons_index.end() ? -1 : it->second;
+}
+
+shared_ptr<GenericDatatypeConstructorDecl> GenericDatatype::get_cons_decl(
+    size_t index) const
+{
+  assert(index < cons_decl_vector.size());
+  return static_pointer_cast<GenericDatatypeConstructorDecl>(
+      cons_decl_vector[index]);
 }
 
 /*
@@ -166,19 +171,36 @@ with new_sort
 void GenericDatatype::change_sort_of_selector(const Sort new_sort)
 {
   // For every constructor
-  for (unsigned int i = 0; i < cons_decl_vector.size(); ++i)
+  for (size_t i = 0; i < cons_decl_vector.size(); ++i)
   {
-    std::shared_ptr<GenericDatatypeConstructorDecl> cons_cast =
-        static_pointer_cast<GenericDatatypeConstructorDecl>(
-            cons_decl_vector[i]);
     // For every selector
-    for (unsigned int f = 0; f < get_num_selectors(cons_cast->get_name()); ++f)
+    for (auto & sel : get_cons_decl(i)->selector_vector)
     {
-      if (cons_cast->selector_vector[f].finalized == false)
+      if (sel.finalized == false)
       {
         // Updates the selector's members
-        cons_cast->selector_vector[f].sort = new_sort;
-        cons_cast->selector_vector[f].finalized = true;
+        sel.sort = new_sort;
+        sel.finalized = true;
+      }
+    }
+  }
+}
+
+void GenericDatatype::resolve_selector_sorts(
+    const std::unordered_map<std::string, Sort> & dt_sorts)
+{
+  for (size_t i = 0; i < cons_decl_vector.size(); ++i)
+  {
+    for (auto & sel : get_cons_decl(i)->selector_vector)
+    {
+      if (sel.sort->get_sort_kind() != UNINTERPRETED)
+      {
+        continue;
+      }
+      auto it = dt_sorts.find(sel.sort->get_uninterpreted_name());
+      if (it != dt_sorts.end())
+      {
+        sel.sort = it->second;
       }
     }
   }
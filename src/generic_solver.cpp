@@ -39,6 +39,7 @@
 #include "smtlib_utils.h"
 #include "sort.h"
 #include "sort_inference.h"
+#include "trace.h"
 #include "utils.h"
 
 using namespace std;
@@ -511,67 +512,86 @@ Sort GenericSolver::make_sort(SortKind sk, const SortVec & sorts) const
 
 Sort GenericSolver::make_sort(const DatatypeDecl & d) const
 {
-  shared_ptr<GenericDatatypeDecl> gdt_decl =
-      static_pointer_cast<GenericDatatypeDecl>(d);
-  string dt_decl_name = gdt_decl->get_name();
-  assert(name_datatype_map->find(dt_decl_name) != name_datatype_map->end());
-  shared_ptr<GenericDatatype> curr_dt = (*name_datatype_map)[dt_decl_name];
-  if (name_sort_map->find(dt_decl_name) == name_sort_map->end())
+  return make_datatype_sorts({ d })[0];
+}
+
+Sort GenericSolver::make_unresolved_sort(const DatatypeDecl & decl) const
+{
+  // not declared to the solver, replaced in make_datatype_sorts
+  return make_uninterpreted_generic_sort(
+      static_pointer_cast<GenericDatatypeDecl>(decl)->get_name(), 0);
+}
+
+SortVec GenericSolver::make_datatype_sorts(
+    const std::vector<DatatypeDecl> & decls) const
+{
+  vector<shared_ptr<GenericDatatype>> dts;
+  dts.reserve(decls.size());
+  SortVec dt_sorts;
+  dt_sorts.reserve(decls.size());
+  unordered_map<string, Sort> resolved;
+  for (const auto & d : decls)
   {
+    string dt_decl_name =
+        static_pointer_cast<GenericDatatypeDecl>(d)->get_name();
+    assert(name_datatype_map->find(dt_decl_name) != name_datatype_map->end());
+    if (name_sort_map->find(dt_decl_name) != name_sort_map->end()
+        || resolved.find(dt_decl_name) != resolved.end())
+    {
+      throw IncorrectUsageException(string("sort name: ") + dt_decl_name
+                                    + string(" already taken"));
+    }
+    shared_ptr<GenericDatatype> curr_dt = (*name_datatype_map)[dt_decl_name];
     Sort dt_sort = make_generic_sort(curr_dt);
     // Replaces the sort of any selectors with a false finalized field
     // with dt_sort and sets finalized to true.
     curr_dt->change_sort_of_selector(dt_sort);
+    resolved[dt_decl_name] = dt_sort;
+    dts.push_back(curr_dt);
+    dt_sorts.push_back(dt_sort);
+  }
 
-    std::string to_solver = "(" + DECLARE_DATATYPE_STR + " ((";
-    to_solver += dt_decl_name;
-    to_solver += " 0)) (\n";
+  // one declare-datatypes for the whole family
+  std::string to_solver = "(" + DECLARE_DATATYPE_STR + " (";
+  for (size_t i = 0; i < dts.size(); ++i)
+  {
+    to_solver += i ? " (" : "(";
+    to_solver += dts[i]->get_name();
+    to_solver += " 0)";
+  }
+  to_solver += ") (\n";
+  for (const auto & curr_dt : dts)
+  {
+    curr_dt->resolve_selector_sorts(resolved);
     to_solver += "(";
     // build string for each constructor
-    for (unsigned long i = 0; i < curr_dt->get_cons_vector().size(); ++i)
+    for (const auto & curr_dt_cons_decl : curr_dt->get_cons_vector())
     {
-      DatatypeConstructorDecl curr_dt_cons_decl = curr_dt->get_cons_vector()[i];
-      to_solver += " ("
-                   + static_pointer_cast<GenericDatatypeConstructorDecl>(
-                         curr_dt_cons_decl)
-                         ->get_name();
+      shared_ptr<GenericDatatypeConstructorDecl> gdt_cons =
+          static_pointer_cast<GenericDatatypeConstructorDecl>(
+              curr_dt_cons_decl);
+      to_solver += " (" + gdt_cons->get_name();
       // Adjust string for each selector
-      for (unsigned long f = 0;
-           f < static_pointer_cast<GenericDatatypeConstructorDecl>(
-                   curr_dt_cons_decl)
-                   ->get_selector_vector()
-                   .size();
-           ++f)
+      for (const auto & sel : gdt_cons->get_selector_vector())
       {
-        to_solver += " ( "
-                     + static_pointer_cast<GenericDatatypeConstructorDecl>(
-                           curr_dt_cons_decl)
-                           ->get_selector_vector()[f]
-                           .name;
-        to_solver += " "
-                     + (static_pointer_cast<GenericDatatypeConstructorDecl>(
-                            curr_dt_cons_decl)
-                            ->get_selector_vector()[f]
-                            .sort)
-                           ->to_string()
-                     + " )";
+        to_solver += " ( " + sel.name;
+        to_solver += " " + sel.sort->to_string() + " )";
       }
 
       to_solver += ")";
     }
-    to_solver += ")\n))";
-    assert(name_sort_map->find(dt_decl_name) == name_sort_map->end());
-    (*name_sort_map)[dt_decl_name] = dt_sort;
-    (*sort_name_map)[dt_sort] = dt_decl_name;
-    run_command(to_solver);
-
-    return dt_sort;
+    to_solver += ")\n";
   }
-  else
+  to_solver += "))";
+
+  for (size_t i = 0; i < dts.size(); ++i)
   {
-    throw IncorrectUsageException(string("sort name: ") + dt_decl_name
-                                  + string(" already taken"));
+    (*name_sort_map)[dts[i]->get_name()] = dt_sorts[i];
+    (*sort_name_map)[dt_sorts[i]] = dts[i]->get_name();
   }
+  run_command(to_solver);
+
+  return dt_sorts;
 }
 
 DatatypeDecl GenericSolver::make_datatype_decl(const std::string & s)
@@ -637,19 +657,7 @@ Term GenericSolver::get_constructor(const Sort & s, std::string name) const
 {
   shared_ptr<GenericDatatype> dt =
       static_pointer_cast<GenericDatatype>(s->get_datatype());
-  bool found = false;
-  for (int i = 0; i < dt->get_num_constructors(); ++i)
-  {
-    if (static_pointer_cast<GenericDatatypeConstructorDecl>(
-            dt->get_cons_vector()[i])
-            ->get_name()
-        == name)
-    {
-      found = true;
-      break;
-    }
-  }
-  if (!found)
+  if (dt->get_constructor_index(name) < 0)
   {
     throw InternalSolverException("Constructor not in datatype");
   }
@@ -666,19 +674,7 @@ Term GenericSolver::get_tester(const Sort & s, std::string name) const
 {
   shared_ptr<GenericDatatype> dt =
       static_pointer_cast<GenericDatatype>(s->get_datatype());
-  bool found = false;
-  for (int i = 0; i < dt->get_num_constructors(); ++i)
-  {
-    if (static_pointer_cast<GenericDatatypeConstructorDecl>(
-            dt->get_cons_vector()[i])
-            ->get_name()
-        == name)
-    {
-      found = true;
-      break;
-    }
-  }
-  if (!found)
+  if (dt->get_constructor_index(name) < 0)
   {
     throw InternalSolverException("Constructor not in datatype");
   }
@@ -695,31 +691,16 @@ Term GenericSolver::get_selector(const Sort & s, std::string con, std::string na
 {
   shared_ptr<GenericDatatype> dt =
       static_pointer_cast<GenericDatatype>(s->get_datatype());
-  bool found = false;
-  Sort cons_sort = make_generic_sort(SELECTOR, name, s);
-  for (int i = 0; i < dt->get_num_constructors(); ++i)
-  {
-    shared_ptr<GenericDatatypeConstructorDecl> curr_con =
-        static_pointer_cast<GenericDatatypeConstructorDecl>(
-            dt->get_cons_vector()[i]);
-    if (curr_con->get_name() == con)
-    {
-      for (int f = 0; f < curr_con->get_selector_count(); ++f)
-      {
-        if (((curr_con->get_selector_vector())[f]).name == name)
-        {
-          found = true;
-          static_pointer_cast<DatatypeComponentSort>(cons_sort)
-              ->set_selector_sort(((curr_con->get_selector_vector())[f]).sort);
-          break;
-        }
-      }
-    }
-  }
-  if (!found)
+  int con_idx = dt->get_constructor_index(con);
+  int sel_idx =
+      con_idx < 0 ? -1 : dt->get_cons_decl(con_idx)->get_selector_index(name);
+  if (sel_idx < 0)
   {
     throw InternalSolverException("Selector not in datatype");
   }
+  Sort cons_sort = make_generic_sort(SELECTOR, name, s);
+  static_pointer_cast<DatatypeComponentSort>(cons_sort)->set_selector_sort(
+      dt->get_cons_decl(con_idx)->get_selector_vector()[sel_idx].sort);
   Term new_term =
       std::make_shared<GenericTerm>(cons_sort, Op(), TermVec{}, name, true);
   (*name_term_map)[name] = new_term;
@@ -1017,6 +998,7 @@ Term GenericSolver::make_term(const Op op, const TermVec & terms) const
 
 Term GenericSolver::get_value(const Term & t) const
 {
+  SMT_TRACE_SPAN("GenericSolver::get_value", "backend");
   // we do not support getting array values, function values, and uninterpreted
   // values.
   Sort sort = t->get_sort();
@@ -1286,6 +1268,7 @@ Result GenericSolver::str_to_result(string result) const
 
 Result GenericSolver::check_sat()
 {
+  SMT_TRACE_SPAN("GenericSolver::check_sat", "backend");
   string result = run_command("(" + CHECK_SAT_STR + ")", false);
   Result r = str_to_result(result);
   return r;
@@ -1293,6 +1276,7 @@ Result GenericSolver::check_sat()
 
 Result GenericSolver::check_sat_assuming(const TermVec & assumptions)
 {
+  SMT_TRACE_SPAN("GenericSolver::check_sat_assuming", "backend");
   string names;
   for (Term t : assumptions)
   {
@@ -1324,6 +1308,7 @@ void GenericSolver::push(uint64_t num)
 
 void GenericSolver::pop(uint64_t num)
 {
+  SMT_TRACE_SPAN("GenericSolver::pop", "backend");
   string result = run_command("(" + POP_STR + " " + std::to_string(num) + ")");
   context_level_ -= num;
 }
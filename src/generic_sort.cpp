@@ -413,17 +413,12 @@ SortVec DatatypeComponentSort::get_domain_sorts() const
         static_pointer_cast<GenericDatatypeSort>(dt_sort);
     shared_ptr<GenericDatatype> gdt =
         static_pointer_cast<GenericDatatype>(cast_dt_sort->get_datatype());
-    for (int i = 0; i < gdt->get_num_constructors(); ++i)
+    int idx = gdt->get_constructor_index(name);
+    if (idx >= 0)
     {
-      shared_ptr<GenericDatatypeConstructorDecl> curr_con =
-          static_pointer_cast<GenericDatatypeConstructorDecl>(
-              gdt->get_cons_vector()[i]);
-      if (curr_con->get_name() == name)
+      for (const auto & sel : gdt->get_cons_decl(idx)->get_selector_vector())
       {
-        for (int f = 0; f < curr_con->get_selector_count(); ++f)
-        {
-          domain_sorts.push_back(curr_con->get_selector_vector()[f].sort);
-        }
+        domain_sorts.push_back(sel.sort);
       }
     }
   }
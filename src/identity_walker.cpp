@@ -16,6 +16,8 @@
 
 #include "identity_walker.h"
 
+#include "trace.h"
+
 using namespace smt;
 using namespace std;
 
@@ -24,6 +26,7 @@ namespace smt
 
 Term IdentityWalker::visit(Term & term)
 {
+  SMT_TRACE_SPAN("IdentityWalker::visit", "walker");
   if (clear_cache_)
   {
     cache_.clear();
@@ -33,6 +36,22 @@ Term IdentityWalker::visit(Term & term)
       ext_cache_->clear();
     }
   }
+  else if (!in_visit_ && cache_limit_ && cache_.size() > cache_limit_)
+  {
+    // only trim at the outermost call, a nested call from visit_term
+    // would drop children already rebuilt by the enclosing traversal
+    cache_ = pinned_;
+  }
+
+  // entries saved during the traversal are not pinned
+  // restores the previous value on return (visit_term may call visit)
+  struct InVisit
+  {
+    bool & flag;
+    bool prev;
+    ~InVisit() { flag = prev; }
+  } in_visit{ in_visit_, in_visit_ };
+  in_visit_ = true;
 
   Term out = term;
   if (query_cache(term, out))
@@ -169,6 +188,15 @@ void IdentityWalker::save_in_cache(const Term & key, const Term & val)
   else
   {
     cache_[key] = val;
+    if (!in_visit_)
+    {
+      pinned_[key] = val;
+    }
   }
 }
+
+size_t IdentityWalker::cache_size() const
+{
+  return ext_cache_ ? ext_cache_->size() : cache_.size();
+}
 }
@@ -43,7 +43,7 @@ const unordered_set<SortKind> supported_sortkinds_for_get_value(
 LoggingSolver::LoggingSolver(SmtSolver s)
     : AbsSmtSolver(s->get_solver_enum()),
       wrapped_solver(s),
-      hashtable(new TermHashTable()),
+      hashtable(new WeakTermHashTable()),
       assumption_cache(new UnorderedTermMap()),
       next_term_id(0)
 {
@@ -131,56 +131,128 @@ Sort LoggingSolver::make_sort(const Sort & sort_con,
                                          sorts);
 }
 
-Sort LoggingSolver::make_sort(const DatatypeDecl & d) const {
-  throw NotImplementedException("LoggingSolver::make_sort");
-};
-DatatypeDecl LoggingSolver::make_datatype_decl(const std::string & s)  {
-    throw NotImplementedException("LoggingSolver::make_datatype_decl");
+Sort LoggingSolver::make_sort(const DatatypeDecl & d) const
+{
+  return make_datatype_sorts({ d })[0];
+}
+
+Sort LoggingSolver::make_unresolved_sort(const DatatypeDecl & decl) const
+{
+  // only used in add_selector, which unwraps it again
+  Sort wrapped = wrapped_solver->make_unresolved_sort(decl);
+  return make_uninterpreted_logging_sort(wrapped, wrapped->to_string(), 0);
+}
+
+SortVec LoggingSolver::make_datatype_sorts(
+    const std::vector<DatatypeDecl> & decls) const
+{
+  SortVec dt_sorts;
+  dt_sorts.reserve(decls.size());
+  for (const auto & s : wrapped_solver->make_datatype_sorts(decls))
+  {
+    dt_sorts.push_back(std::make_shared<DatatypeLoggingSort>(s));
+  }
+  return dt_sorts;
+}
+
+// datatype declarations don't contain logging objects, so they are not
+// wrapped
+
+DatatypeDecl LoggingSolver::make_datatype_decl(const std::string & s)
+{
+  return wrapped_solver->make_datatype_decl(s);
 }
+
 DatatypeConstructorDecl LoggingSolver::make_datatype_constructor_decl(
     const std::string s)
 {
-  throw NotImplementedException(
-      "LoggingSolver::make_datatype_constructor_decl");
-};
-void LoggingSolver::add_constructor(DatatypeDecl & dt, const DatatypeConstructorDecl & con) const {
-  throw NotImplementedException("LoggingSolver::add_constructor");
-};
-void LoggingSolver::add_selector(DatatypeConstructorDecl & dt, const std::string & name, const Sort & s) const {
-  throw NotImplementedException("LoggingSolver::add_selector");
-};
-void LoggingSolver::add_selector_self(DatatypeConstructorDecl & dt, const std::string & name) const {
-  throw NotImplementedException("LoggingSolver::add_selector_self");
-};
-
-Term LoggingSolver::get_constructor(const Sort & s, std::string name) const  {
-  throw NotImplementedException("LoggingSolver::get_constructor");
-};
-Term LoggingSolver::get_tester(const Sort & s, std::string name) const  {
-  throw NotImplementedException("LoggingSolver::get_testeer");
-};
-
-Term LoggingSolver::get_selector(const Sort & s, std::string con, std::string name) const  {
-  throw NotImplementedException("LoggingSolver::get_selector");
-};
+  return wrapped_solver->make_datatype_constructor_decl(s);
+}
 
+void LoggingSolver::add_constructor(DatatypeDecl & dt,
+                                    const DatatypeConstructorDecl & con) const
+{
+  wrapped_solver->add_constructor(dt, con);
+}
 
-Term LoggingSolver::make_term(bool b) const
+void LoggingSolver::add_selector(DatatypeConstructorDecl & dt,
+                                 const std::string & name,
+                                 const Sort & s) const
 {
-  Term wrapped_res = wrapped_solver->make_term(b);
-  Sort boolsort = make_logging_sort(BOOL, wrapped_res->get_sort());
-  Term res = std::make_shared<LoggingTerm>(
-      wrapped_res, boolsort, Op(), TermVec{}, next_term_id);
+  shared_ptr<LoggingSort> ls = static_pointer_cast<LoggingSort>(s);
+  wrapped_solver->add_selector(dt, name, ls->wrapped_sort);
+}
+
+void LoggingSolver::add_selector_self(DatatypeConstructorDecl & dt,
+                                      const std::string & name) const
+{
+  wrapped_solver->add_selector_self(dt, name);
+}
+
+Term LoggingSolver::get_constructor(const Sort & s, std::string name) const
+{
+  shared_ptr<LoggingSort> ls = static_pointer_cast<LoggingSort>(s);
+  return make_datatype_component(
+      wrapped_solver->get_constructor(ls->wrapped_sort, name));
+}
+
+Term LoggingSolver::get_tester(const Sort & s, std::string name) const
+{
+  shared_ptr<LoggingSort> ls = static_pointer_cast<LoggingSort>(s);
+  return make_datatype_component(
+      wrapped_solver->get_tester(ls->wrapped_sort, name));
+}
 
-  // check hash table
+Term LoggingSolver::get_selector(const Sort & s,
+                                 std::string con,
+                                 std::string name) const
+{
+  shared_ptr<LoggingSort> ls = static_pointer_cast<LoggingSort>(s);
+  return make_datatype_component(
+      wrapped_solver->get_selector(ls->wrapped_sort, con, name));
+}
+
+void LoggingSolver::hash_cons(Term & res) const
+{
+  std::lock_guard<std::mutex> lock(hashtable_mutex);
   // lookup modifies term in place and returns true if it's a known term
   // i.e. returns existing term and destroys the unnecessary new one
   if (!hashtable->lookup(res))
   {
     // this is the first time this term was created
+    static_pointer_cast<LoggingTerm>(res)->id_ = next_term_id++;
     hashtable->insert(res);
-    next_term_id++;
   }
+}
+
+bool LoggingSolver::in_hashtable(const Term & t) const
+{
+  std::lock_guard<std::mutex> lock(hashtable_mutex);
+  return hashtable->contains(t);
+}
+
+Term LoggingSolver::make_datatype_component(const Term & wrapped) const
+{
+  Term res = std::make_shared<LoggingTerm>(
+      wrapped,
+      make_logging_sort_from(wrapped->get_sort()),
+      Op(),
+      TermVec{},
+      0);
+
+  hash_cons(res);
+
+  return res;
+}
+
+Term LoggingSolver::make_term(bool b) const
+{
+  Term wrapped_res = wrapped_solver->make_term(b);
+  Sort boolsort = make_logging_sort(BOOL, wrapped_res->get_sort());
+  Term res = std::make_shared<LoggingTerm>(
+      wrapped_res, boolsort, Op(), TermVec{}, 0);
+
+  hash_cons(res);
 
   return res;
 }
@@ -190,17 +262,9 @@ Term LoggingSolver::make_term(int64_t i, const Sort & sort) const
   shared_ptr<LoggingSort> lsort = static_pointer_cast<LoggingSort>(sort);
   Term wrapped_res = wrapped_solver->make_term(i, lsort->wrapped_sort);
   Term res = std::make_shared<LoggingTerm>(
-      wrapped_res, sort, Op(), TermVec{}, next_term_id);
+      wrapped_res, sort, Op(), TermVec{}, 0);
 
-  // check hash table
-  // lookup modifies term in place and returns true if it's a known term
-  // i.e. returns existing term and destroying the unnecessary new one
-  if (!hashtable->lookup(res))
-  {
-    // this is the first time this term was created
-    hashtable->insert(res);
-    next_term_id++;
-  }
+  hash_cons(res);
 
   return res;
 }
@@ -212,17 +276,9 @@ Term LoggingSolver::make_term(const string name,
   shared_ptr<LoggingSort> lsort = static_pointer_cast<LoggingSort>(sort);
   Term wrapped_res = wrapped_solver->make_term(name, lsort->wrapped_sort, base);
   Term res = std::make_shared<LoggingTerm>(
-      wrapped_res, sort, Op(), TermVec{}, next_term_id);
+      wrapped_res, sort, Op(), TermVec{}, 0);
 
-  // check hash table
-  // lookup modifies term in place and returns true if it's a known term
-  // i.e. returns existing term and destroying the unnecessary new one
-  if (!hashtable->lookup(res))
-  {
-    // this is the first time this term was created
-    hashtable->insert(res);
-    next_term_id++;
-  }
+  hash_cons(res);
 
   return res;
 }
@@ -243,17 +299,9 @@ Term LoggingSolver::make_term(const Term & val, const Sort & sort) const
   }
   // the constant value must be the child
   Term res = std::make_shared<LoggingTerm>(
-      wrapped_res, sort, Op(), TermVec{ val }, next_term_id);
+      wrapped_res, sort, Op(), TermVec{ val }, 0);
 
-  // check hash table
-  // lookup modifies term in place and returns true if it's a known term
-  // i.e. returns existing term and destroying the unnecessary new one
-  if (!hashtable->lookup(res))
-  {
-    // this is the first time this term was created
-    hashtable->insert(res);
-    next_term_id++;
-  }
+  hash_cons(res);
 
   return res;
 }
@@ -264,18 +312,11 @@ Term LoggingSolver::make_symbol(const string name, const Sort & sort)
   Term wrapped_sym = wrapped_solver->make_symbol(name, lsort->wrapped_sort);
   // bool true means it's a symbol
   Term res = std::make_shared<LoggingTerm>(
-      wrapped_sym, sort, Op(), TermVec{}, name, true, next_term_id);
+      wrapped_sym, sort, Op(), TermVec{}, name, true, 0);
 
-  // check hash table
-  // lookup modifies term in place and returns true if it's a known term
-  // i.e. returns existing term and destroying the unnecessary new one
-  if (!hashtable->lookup(res))
-  {
-    // this is the first time this term was created
-    hashtable->insert(res);
-    next_term_id++;
-  }
+  hash_cons(res);
 
+  std::lock_guard<std::mutex> lock(hashtable_mutex);
   symbol_table[name] = res;
 
   return res;
@@ -283,6 +324,7 @@ Term LoggingSolver::make_symbol(const string name, const Sort & sort)
 
 Term LoggingSolver::get_symbol(const std::string & name)
 {
+  std::lock_guard<std::mutex> lock(hashtable_mutex);
   auto it = symbol_table.find(name);
   if (it == symbol_table.end())
   {
@@ -297,17 +339,9 @@ Term LoggingSolver::make_param(const string name, const Sort & sort)
   Term wrapped_param = wrapped_solver->make_param(name, lsort->wrapped_sort);
   // bool false means it's not a symbol
   Term res = std::make_shared<LoggingTerm>(
-      wrapped_param, sort, Op(), TermVec{}, name, false, next_term_id);
+      wrapped_param, sort, Op(), TermVec{}, name, false, 0);
 
-  // check hash table
-  // lookup modifies term in place and returns true if it's a known term
-  // i.e. returns existing term and destroying the unnecessary new one
-  if (!hashtable->lookup(res))
-  {
-    // this is the first time this term was created
-    hashtable->insert(res);
-    next_term_id++;
-  }
+  hash_cons(res);
 
   return res;
 }
@@ -319,20 +353,12 @@ Term LoggingSolver::make_term(const Op op, const Term & t) const
   Sort res_logging_sort = compute_sort(op, this, { t->get_sort() });
 
   // check that child is already in hash table
-  assert(hashtable->contains(t));
+  assert(in_hashtable(t));
 
   Term res = std::make_shared<LoggingTerm>(
-      wrapped_res, res_logging_sort, op, TermVec{ t }, next_term_id);
+      wrapped_res, res_logging_sort, op, TermVec{ t }, 0);
 
-  // check hash table
-  // lookup modifies term in place and returns true if it's a known term
-  // i.e. returns existing term and destroying the unnecessary new one
-  if (!hashtable->lookup(res))
-  {
-    // this is the first time this term was created
-    hashtable->insert(res);
-    next_term_id++;
-  }
+  hash_cons(res);
 
   return res;
 }
@@ -349,20 +375,12 @@ Term LoggingSolver::make_term(const Op op,
       compute_sort(op, this, { t1->get_sort(), t2->get_sort() });
 
   // check that children are already in hash table
-  assert(hashtable->contains(t1));
-  assert(hashtable->contains(t2));
+  assert(in_hashtable(t1));
+  assert(in_hashtable(t2));
 
   Term res = std::make_shared<LoggingTerm>(
-      wrapped_res, res_logging_sort, op, TermVec({ t1, t2 }), next_term_id);
-  // check hash table
-  // lookup modifies term in place and returns true if it's a known term
-  // i.e. returns existing term and destroying the unnecessary new one
-  if (!hashtable->lookup(res))
-  {
-    // this is the first time this term was created
-    hashtable->insert(res);
-    next_term_id++;
-  }
+      wrapped_res, res_logging_sort, op, TermVec({ t1, t2 }), 0);
+  hash_cons(res);
 
   return res;
 }
@@ -381,22 +399,14 @@ Term LoggingSolver::make_term(const Op op,
       op, this, { t1->get_sort(), t2->get_sort(), t3->get_sort() });
 
   // check that children are already in hash table
-  assert(hashtable->contains(t1));
-  assert(hashtable->contains(t2));
-  assert(hashtable->contains(t3));
+  assert(in_hashtable(t1));
+  assert(in_hashtable(t2));
+  assert(in_hashtable(t3));
 
   Term res = std::make_shared<LoggingTerm>(
-      wrapped_res, res_logging_sort, op, TermVec{ t1, t2, t3 }, next_term_id);
+      wrapped_res, res_logging_sort, op, TermVec{ t1, t2, t3 }, 0);
 
-  // check hash table
-  // lookup modifies term in place and returns true if it's a known term
-  // i.e. returns existing term and destroying the unnecessary new one
-  if (!hashtable->lookup(res))
-  {
-    // this is the first time this term was created
-    hashtable->insert(res);
-    next_term_id++;
-  }
+  hash_cons(res);
 
   return res;
 }
@@ -410,28 +420,28 @@ Term LoggingSolver::make_term(const Op op, const TermVec & terms) const
     lterms.push_back(ltt->wrapped_term);
 
     // check that children are already in the hash table
-    assert(hashtable->contains(tt));
+    assert(in_hashtable(tt));
   }
   Term wrapped_res = wrapped_solver->make_term(op, lterms);
   // Note: for convenience there's a version of compute_sort that takes terms
   // since these are already in a vector, just let it unpack the sorts
   Sort res_logging_sort = compute_sort(op, this, terms);
   Term res = std::make_shared<LoggingTerm>(
-      wrapped_res, res_logging_sort, op, terms, next_term_id);
+      wrapped_res, res_logging_sort, op, terms, 0);
 
-  // check hash table
-  // lookup modifies term in place and returns true if it's a known term
-  // i.e. returns existing term and destroying the unnecessary new one
-  if (!hashtable->lookup(res))
-  {
-    // this is the first time this term was created
-    hashtable->insert(res);
-    next_term_id++;
-  }
+  hash_cons(res);
 
   return res;
 }
 
+void LoggingSolver::get_bv_value(const Term & t,
+                                 std::vector<uint64_t> & out) const
+{
+  // no value term is created, so nothing to log
+  shared_ptr<LoggingTerm> lt = static_pointer_cast<LoggingTerm>(t);
+  wrapped_solver->get_bv_value(lt->wrapped_term, out);
+}
+
 Term LoggingSolver::get_value(const Term & t) const
 {
   Term res;
@@ -448,17 +458,9 @@ Term LoggingSolver::get_value(const Term & t) const
   {
     Term wrapped_val = wrapped_solver->get_value(lt->wrapped_term);
     res = std::make_shared<LoggingTerm>(
-        wrapped_val, t->get_sort(), Op(), TermVec{}, next_term_id);
+        wrapped_val, t->get_sort(), Op(), TermVec{}, 0);
 
-    // check hash table
-    // lookup modifies term in place and returns true if it's a known term
-    // i.e. returns existing term and destroying the unnecessary new one
-    if (!hashtable->lookup(res))
-    {
-      // this is the first time this term was created
-      hashtable->insert(res);
-      next_term_id++;
-    }
+    hash_cons(res);
   }
   else
   {
@@ -520,16 +522,8 @@ UnorderedTermMap LoggingSolver::get_array_values(const Term & arr,
           "LoggingSolver");
     }
     out_const_base = std::make_shared<LoggingTerm>(
-        wrapped_out_const_base, elemsort, Op(), TermVec{}, next_term_id);
-    // check hash table
-    // lookup modifies term in place and returns true if it's a known term
-    // i.e. returns existing term and destroys the unnecessary new one
-    if (!hashtable->lookup(out_const_base))
-    {
-      // this is the first time this term was created
-      hashtable->insert(out_const_base);
-      next_term_id++;
-    }
+        wrapped_out_const_base, elemsort, Op(), TermVec{}, 0);
+    hash_cons(out_const_base);
   }
 
   Term idx;
@@ -541,22 +535,12 @@ UnorderedTermMap LoggingSolver::get_array_values(const Term & arr,
     Assert(elem.second->is_value());
 
     idx = std::make_shared<LoggingTerm>(
-        elem.first, idxsort, Op(), TermVec{}, next_term_id);
-    if (!hashtable->lookup(idx))
-    {
-      // this is the first time this term was created
-      hashtable->insert(idx);
-      next_term_id++;
-    }
+        elem.first, idxsort, Op(), TermVec{}, 0);
+    hash_cons(idx);
 
     val = std::make_shared<LoggingTerm>(
-        elem.second, elemsort, Op(), TermVec{}, next_term_id);
-    if (!hashtable->lookup(val))
-    {
-      // this is the first time this term was created
-      hashtable->insert(val);
-      next_term_id++;
-    }
+        elem.second, elemsort, Op(), TermVec{}, 0);
+    hash_cons(val);
 
     assignments[idx] = val;
   }
@@ -564,9 +548,22 @@ UnorderedTermMap LoggingSolver::get_array_values(const Term & arr,
   return assignments;
 }
 
+MemoryStats LoggingSolver::get_memory_stats() const
+{
+  MemoryStats stats = wrapped_solver->get_memory_stats();
+  std::lock_guard<std::mutex> lock(hashtable_mutex);
+  // the logging terms, not the ones of the wrapped solver
+  stats.live_terms = hashtable->num_live();
+  stats.cache_entries["logging_hashtable"] = hashtable->size();
+  stats.cache_entries["logging_symbols"] = symbol_table.size();
+  stats.cache_entries["logging_assumptions"] = assumption_cache->size();
+  return stats;
+}
+
 void LoggingSolver::reset()
 {
   wrapped_solver->reset();
+  std::lock_guard<std::mutex> lock(hashtable_mutex);
   hashtable->clear();
 }
 
@@ -120,6 +120,50 @@ Sort make_logging_sort(SortKind sk, Sort s, SortVec sorts)
   }
 }
 
+Sort make_logging_sort_from(Sort s)
+{
+  SortKind sk = s->get_sort_kind();
+  switch (sk)
+  {
+    case BOOL:
+    case INT:
+    case REAL: return make_logging_sort(sk, s);
+    case BV: return make_logging_sort(sk, s, s->get_width());
+    case ARRAY:
+      return make_logging_sort(sk,
+                               s,
+                               make_logging_sort_from(s->get_indexsort()),
+                               make_logging_sort_from(s->get_elemsort()));
+    case UNINTERPRETED:
+      return make_uninterpreted_logging_sort(s, s->get_uninterpreted_name(), 0);
+    case DATATYPE: return std::make_shared<DatatypeLoggingSort>(s);
+    case FUNCTION:
+    case CONSTRUCTOR:
+    case SELECTOR:
+    case TESTER:
+    {
+      SortVec domain_sorts;
+      for (const auto & ds : s->get_domain_sorts())
+      {
+        domain_sorts.push_back(make_logging_sort_from(ds));
+      }
+      Sort codomain_sort = make_logging_sort_from(s->get_codomain_sort());
+      if (sk == FUNCTION)
+      {
+        return std::make_shared<FunctionLoggingSort>(
+            s, domain_sorts, codomain_sort);
+      }
+      return std::make_shared<DatatypeComponentLoggingSort>(
+          sk, s, domain_sorts, codomain_sort);
+    }
+    default:
+    {
+      throw NotImplementedException("Can't make logging sort from "
+                                    + to_string(sk));
+    }
+  }
+}
+
 // implementations
 SortKind LoggingSort::get_sort_kind() const { return sk; }
 
@@ -172,8 +216,13 @@ bool LoggingSort::compare(const Sort & s) const
       return get_uninterpreted_name() == s->get_uninterpreted_name();
     }
     case DATATYPE:
+    case CONSTRUCTOR:
+    case SELECTOR:
+    case TESTER:
     {
-      throw NotImplementedException("LoggingSort::compare");
+      // created by the underlying solver, compare there
+      return wrapped_sort
+             == std::static_pointer_cast<LoggingSort>(s)->wrapped_sort;
     }
     case NUM_SORT_KINDS: {
       // null sorts should not be equal
@@ -265,4 +314,28 @@ SortVec UninterpretedLoggingSort::get_uninterpreted_param_sorts() const
   return param_sorts;
 }
 
+// DatatypeLoggingSort
+
+DatatypeLoggingSort::DatatypeLoggingSort(Sort s) : super(DATATYPE, s) {}
+
+DatatypeLoggingSort::~DatatypeLoggingSort() {}
+
+Datatype DatatypeLoggingSort::get_datatype() const
+{
+  return wrapped_sort->get_datatype();
+}
+
+// DatatypeComponentLoggingSort
+
+DatatypeComponentLoggingSort::DatatypeComponentLoggingSort(SortKind sk,
+                                                           Sort s,
+                                                           SortVec sorts,
+                                                           Sort rsort)
+    : super(s, sorts, rsort)
+{
+  this->sk = sk;
+}
+
+DatatypeComponentLoggingSort::~DatatypeComponentLoggingSort() {}
+
 }  // namespace smt
@@ -197,6 +197,11 @@ bool LoggingTerm::is_value() const { return op.is_null() && wrapped_term->is_val
 
 uint64_t LoggingTerm::to_int() const { return wrapped_term->to_int(); }
 
+void LoggingTerm::to_bv_words(std::vector<uint64_t> & out)
+{
+  wrapped_term->to_bv_words(out);
+}
+
 std::string LoggingTerm::print_value_as(SortKind sk)
 {
   return wrapped_term->print_value_as(sk);
@@ -0,0 +1,73 @@
+/*********************                                                        */
+/*! \file mapped_file.cpp
+** \verbatim
+** Top contributors (to current version):
+**   agent
+** This file is part of the smt-switch project.
+** Copyright (c) 2026 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved.  See the file LICENSE in the top-level source
+** directory for licensing information.\endverbatim
+**
+** \brief Read-only view of a file's contents, memory-mapped when possible.
+**
+**/
+
+#include "mapped_file.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <fstream>
+#include <sstream>
+
+#include "exceptions.h"
+
+namespace smt {
+
+MappedFile::MappedFile(const std::string & filename)
+    : data_(nullptr), size_(0), mapped_(false)
+{
+  int fd = open(filename.c_str(), O_RDONLY);
+  if (fd < 0)
+  {
+    throw IncorrectUsageException("Could not open file " + filename);
+  }
+
+  struct stat st;
+  if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0)
+  {
+    void * p = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (p != MAP_FAILED)
+    {
+      // files are scanned front to back
+      madvise(p, st.st_size, MADV_SEQUENTIAL);
+      data_ = static_cast<const char *>(p);
+      size_ = st.st_size;
+      mapped_ = true;
+    }
+  }
+  close(fd);
+
+  if (!mapped_)
+  {
+    std::ifstream in(filename, std::ios::binary);
+    std::ostringstream ss;
+    ss << in.rdbuf();
+    buffer_ = ss.str();
+    data_ = buffer_.data();
+    size_ = buffer_.size();
+  }
+}
+
+MappedFile::~MappedFile()
+{
+  if (mapped_)
+  {
+    munmap(const_cast<char *>(data_), size_);
+  }
+}
+
+}  // namespace smt
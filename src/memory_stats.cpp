@@ -0,0 +1,59 @@
+/*********************                                                        */
+/*! \file memory_stats.cpp
+** \verbatim
+** Top contributors (to current version):
+**   agent
+** This file is part of the smt-switch project.
+** Copyright (c) 2026 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved.  See the file LICENSE in the top-level source
+** directory for licensing information.\endverbatim
+**
+** \brief Memory accounting for solvers.
+**
+**/
+
+#include "memory_stats.h"
+
+#include <unistd.h>
+
+#include <fstream>
+
+using namespace std;
+
+namespace smt {
+
+std::ostream & operator<<(std::ostream & output, const MemoryStats & stats)
+{
+  output << "live terms: " << stats.live_terms << endl;
+  output << "backend bytes: " << stats.backend_bytes << endl;
+  output << "rss (kB): ";
+  if (stats.rss_kb)
+  {
+    output << stats.rss_kb << endl;
+  }
+  else
+  {
+    output << "unknown" << endl;
+  }
+  for (const auto & elem : stats.cache_entries)
+  {
+    output << elem.first << ": " << elem.second << endl;
+  }
+  return output;
+}
+
+uint64_t current_rss_kb()
+{
+  // second field is the number of resident pages
+  ifstream statm("/proc/self/statm");
+  uint64_t size, resident;
+  if (statm >> size >> resident)
+  {
+    return resident * (sysconf(_SC_PAGESIZE) / 1024);
+  }
+  // getrusage only reports the peak, which is not a current size
+  return 0;
+}
+
+}  // namespace smt
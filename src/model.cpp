@@ -0,0 +1,709 @@
+/*********************                                                        */
+/*! \file model.cpp
+** \verbatim
+** Top contributors (to current version):
+**   agent
+** This file is part of the smt-switch project.
+** Copyright (c) 2026 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved.  See the file LICENSE in the top-level source
+** directory for licensing information.\endverbatim
+**
+** \brief Solver-independent snapshot of a model.
+**
+**/
+
+#include "model.h"
+
+#include <sstream>
+
+#include "term_printer.h"
+
+using namespace std;
+
+namespace smt {
+
+namespace {
+
+/** Normalize an SMT-LIB arithmetic value, e.g. (- (/ 1 2)) to -1/2 */
+string normalize_number(const string & s)
+{
+  bool neg = false;
+  bool div = false;
+  vector<string> nums;
+  string tok;
+  auto flush = [&]() {
+    if (tok == "-")
+    {
+      neg = !neg;
+    }
+    else if (tok == "/")
+    {
+      div = true;
+    }
+    else if (tok.size())
+    {
+      if (tok[0] == '-')
+      {
+        neg = !neg;
+        tok = tok.substr(1);
+      }
+      size_t slash = tok.find('/');
+      if (slash != string::npos)
+      {
+        div = true;
+        nums.push_back(tok.substr(0, slash));
+        nums.push_back(tok.substr(slash + 1));
+      }
+      else
+      {
+        nums.push_back(tok);
+      }
+    }
+    tok.clear();
+  };
+  for (char c : s)
+  {
+    if (c == '(' || c == ')' || c == ' ')
+    {
+      flush();
+    }
+    else
+    {
+      tok += c;
+    }
+  }
+  flush();
+
+  if (nums.empty() || nums.size() > 2 || (nums.size() == 2 && !div))
+  {
+    throw SmtException("Unexpected arithmetic value: " + s);
+  }
+  for (auto & n : nums)
+  {
+    // 2.0 -> 2
+    size_t dot = n.find('.');
+    if (dot != string::npos
+        && n.find_first_not_of('0', dot + 1) == string::npos)
+    {
+      n.resize(dot);
+    }
+  }
+  string res = (neg && nums[0] != "0") ? "-" + nums[0] : nums[0];
+  if (nums.size() == 2 && nums[1] != "1")
+  {
+    res += "/" + nums[1];
+  }
+  return res;
+}
+
+inline uint64_t mask(uint64_t v, uint64_t width)
+{
+  return width >= 64 ? v : v & ((1ULL << width) - 1);
+}
+
+inline int64_t to_signed(uint64_t v, uint64_t width)
+{
+  return width >= 64 ? (int64_t)v
+                     : ((int64_t)(v << (64 - width))) >> (64 - width);
+}
+
+/** length-prefixed string, as used by the serialization format */
+void write_string(ostream & os, const string & s)
+{
+  os << s.size() << ":" << s;
+}
+
+string read_string(istream & is)
+{
+  size_t len;
+  char colon;
+  if (!(is >> len) || !is.get(colon) || colon != ':')
+  {
+    throw SmtException("Malformed model: expected a string");
+  }
+  string s(len, '\0');
+  is.read(&s[0], len);
+  if (!is)
+  {
+    throw SmtException("Malformed model: truncated string");
+  }
+  return s;
+}
+
+}  // namespace
+
+Model::Model(const SmtSolver & solver, const TermVec & symbols)
+{
+  // named entries first, so that their ids are 0 ... n-1
+  entries_.resize(symbols.size());
+  names_.reserve(symbols.size());
+  for (const auto & sym : symbols)
+  {
+    string name = sym->to_string();
+    if (!ids_.emplace(name, names_.size()).second)
+    {
+      throw IncorrectUsageException("Symbol captured twice in model: "
+                                    + name);
+    }
+    names_.push_back(name);
+  }
+
+  vector<uint64_t> bv_words;
+  for (size_t i = 0; i < symbols.size(); ++i)
+  {
+    if (symbols[i]->get_sort()->get_sort_kind() == ARRAY)
+    {
+      size_t id = add_array(solver, symbols[i]);
+      entries_[i] = entries_[id];
+      entries_.pop_back();
+    }
+    else if (symbols[i]->get_sort()->get_sort_kind() == BV)
+    {
+      // read the words directly, without a value term
+      solver->get_bv_value(symbols[i], bv_words);
+      add_bv(symbols[i]->get_sort()->get_width(), bv_words);
+      entries_[i] = entries_.back();
+      entries_.pop_back();
+    }
+    else
+    {
+      size_t id = add_value(solver->get_value(symbols[i]));
+      entries_[i] = entries_[id];
+      entries_.pop_back();
+    }
+  }
+}
+
+size_t Model::add_bv(uint64_t width, const vector<uint64_t> & words)
+{
+  Entry e;
+  e.kind = MV_BV;
+  e.width = width;
+  e.offset = words_.size();
+  e.count = words.size();
+  words_.insert(words_.end(), words.begin(), words.end());
+  entries_.push_back(e);
+  return entries_.size() - 1;
+}
+
+size_t Model::add_value(const Term & val)
+{
+  Sort sort = val->get_sort();
+  SortKind sk = sort->get_sort_kind();
+  if (sk == BV)
+  {
+    vector<uint64_t> words;
+    val->to_bv_words(words);
+    return add_bv(sort->get_width(), words);
+  }
+
+  Entry e;
+  string s = val->to_string();
+  e.width = 0;
+  e.count = 0;
+  if (sk == BOOL)
+  {
+    e.kind = MV_BOOL;
+    e.offset = words_.size();
+    e.count = 1;
+    words_.push_back(s == "true" || s == "#b1");
+  }
+  else if (sk == INT || sk == REAL)
+  {
+    e.kind = sk == INT ? MV_INT : MV_REAL;
+    e.offset = strings_.size();
+    strings_.push_back(normalize_number(s));
+  }
+  else
+  {
+    // including nested arrays, e.g. array elements
+    e.kind = MV_OTHER;
+    e.offset = strings_.size();
+    strings_.push_back(s);
+  }
+  entries_.push_back(e);
+  return entries_.size() - 1;
+}
+
+size_t Model::add_array(const SmtSolver & solver, const Term & arr)
+{
+  UnorderedTermMap values;
+  Term const_base;
+  try
+  {
+    values = solver->get_array_values(arr, const_base);
+  }
+  catch (SmtException &)
+  {
+    // backend can't enumerate array values, keep the string
+    return add_value(solver->get_value(arr));
+  }
+
+  vector<size_t> slots;
+  slots.push_back(const_base ? add_value(const_base) : npos);
+  for (const auto & elem : values)
+  {
+    slots.push_back(add_value(elem.first));
+    slots.push_back(add_value(elem.second));
+  }
+
+  Entry e;
+  e.kind = MV_ARRAY;
+  e.width = 0;
+  e.offset = slots_.size();
+  e.count = values.size();
+  slots_.insert(slots_.end(), slots.begin(), slots.end());
+  entries_.push_back(e);
+  return entries_.size() - 1;
+}
+
+std::string Model::get_bv_string(size_t id) const
+{
+  const Entry & e = entries_[id];
+  string res(e.width, '0');
+  for (uint64_t i = 0; i < e.width; ++i)
+  {
+    if ((words_[e.offset + i / 64] >> (i % 64)) & 1)
+    {
+      res[e.width - 1 - i] = '1';
+    }
+  }
+  return res;
+}
+
+std::vector<std::pair<size_t, size_t>> Model::get_array_exceptions(
+    size_t id) const
+{
+  const Entry & e = entries_[id];
+  vector<pair<size_t, size_t>> res;
+  for (size_t i = 0; i < e.count; ++i)
+  {
+    res.push_back(
+        { slots_[e.offset + 1 + 2 * i], slots_[e.offset + 2 + 2 * i] });
+  }
+  return res;
+}
+
+Term Model::get_value(const SmtSolver & solver, const Term & symbol) const
+{
+  size_t id = get_id(symbol);
+  if (id == npos)
+  {
+    throw IncorrectUsageException("Symbol not captured in model: "
+                                  + symbol->to_string());
+  }
+  return to_term(solver, id, symbol->get_sort());
+}
+
+Term Model::to_term(const SmtSolver & solver,
+                    size_t id,
+                    const Sort & sort) const
+{
+  const Entry & e = entries_[id];
+  switch (e.kind)
+  {
+    case MV_BOOL:
+      if (sort->get_sort_kind() == BV)
+      {
+        // backends that alias booleans and bit-vectors of width one
+        return solver->make_term(get_bool(id) ? 1 : 0, sort);
+      }
+      return solver->make_term(get_bool(id));
+    case MV_BV: return solver->make_term(get_bv_string(id), sort, 2);
+    case MV_INT: return solver->make_term(get_string(id), sort);
+    case MV_REAL:
+    {
+      const string & s = get_string(id);
+      size_t slash = s.find('/');
+      if (slash == string::npos)
+      {
+        return solver->make_term(s, sort);
+      }
+      return solver->make_term(Div,
+                               solver->make_term(s.substr(0, slash), sort),
+                               solver->make_term(s.substr(slash + 1), sort));
+    }
+    case MV_ARRAY:
+    {
+      Sort idx_sort = sort->get_indexsort();
+      Sort elem_sort = sort->get_elemsort();
+      size_t def = get_array_default(id);
+      if (def == npos)
+      {
+        throw NotImplementedException(
+            "Cannot rebuild an array value without a default element");
+      }
+      Term res = solver->make_term(to_term(solver, def, elem_sort), sort);
+      for (const auto & exc : get_array_exceptions(id))
+      {
+        res = solver->make_term(Store,
+                                res,
+                                to_term(solver, exc.first, idx_sort),
+                                to_term(solver, exc.second, elem_sort));
+      }
+      return res;
+    }
+    default:
+      throw NotImplementedException("Cannot rebuild model value "
+                                    + get_string(id));
+  }
+}
+
+bool Model::evaluate_bool(const Term & t) const
+{
+  if (t->get_sort()->get_sort_kind() != BOOL)
+  {
+    throw IncorrectUsageException("Expecting a boolean term but got "
+                                  + to_diagnostic_string(t));
+  }
+  return evaluate(t);
+}
+
+uint64_t Model::evaluate_bv(const Term & t) const
+{
+  Sort sort = t->get_sort();
+  if (sort->get_sort_kind() != BV)
+  {
+    throw IncorrectUsageException("Expecting a bit-vector term but got "
+                                  + to_diagnostic_string(t));
+  }
+  return evaluate(t);
+}
+
+uint64_t Model::evaluate(const Term & t) const
+{
+  unordered_map<Term, uint64_t> cache;
+  TermVec to_visit({ t });
+  TermVec children;
+  vector<uint64_t> args;
+  vector<uint64_t> value_words;
+
+  auto width_of = [](const Term & x) -> uint64_t {
+    Sort s = x->get_sort();
+    if (s->get_sort_kind() == BOOL)
+    {
+      return 1;
+    }
+    if (s->get_sort_kind() != BV)
+    {
+      throw NotImplementedException("Model evaluation only supports boolean "
+                                    "and bit-vector terms, got "
+                                    + to_diagnostic_string(x));
+    }
+    uint64_t w = s->get_width();
+    if (w > 64)
+    {
+      throw NotImplementedException(
+          "Model evaluation supports bit-vectors up to width 64");
+    }
+    return w;
+  };
+
+  while (to_visit.size())
+  {
+    Term x = to_visit.back();
+    if (cache.find(x) != cache.end())
+    {
+      to_visit.pop_back();
+      continue;
+    }
+
+    if (x->is_symbolic_const())
+    {
+      size_t id = get_id(x);
+      if (id == npos)
+      {
+        throw IncorrectUsageException("Symbol not captured in model: "
+                                      + x->to_string());
+      }
+      width_of(x);
+      cache[x] = words_[entries_[id].offset];
+      to_visit.pop_back();
+      continue;
+    }
+
+    if (x->is_value())
+    {
+      width_of(x);
+      if (x->get_sort()->get_sort_kind() == BOOL)
+      {
+        cache[x] = x->to_string() == "true";
+      }
+      else
+      {
+        x->to_bv_words(value_words);
+        cache[x] = value_words[0];
+      }
+      to_visit.pop_back();
+      continue;
+    }
+
+    Op op = x->get_op();
+    children.clear();
+    for (const auto & c : x)
+    {
+      children.push_back(c);
+    }
+    bool ready = true;
+    for (size_t i = 0; i < children.size(); ++i)
+    {
+      // array reads are evaluated directly on the captured table,
+      // so only the index is needed
+      if (op.prim_op == Select && i == 0)
+      {
+        continue;
+      }
+      if (cache.find(children[i]) == cache.end())
+      {
+        ready = false;
+        to_visit.push_back(children[i]);
+      }
+    }
+    if (!ready)
+    {
+      continue;
+    }
+    to_visit.pop_back();
+
+    args.clear();
+    for (size_t i = 0; i < children.size(); ++i)
+    {
+      args.push_back(op.prim_op == Select && i == 0 ? 0
+                                                    : cache.at(children[i]));
+    }
+    uint64_t w = width_of(x);
+    uint64_t res = 0;
+    uint64_t cw = children.empty() ? 0 : width_of(children.back());
+
+    switch (op.prim_op)
+    {
+      case And:
+        res = 1;
+        for (auto a : args) res &= a;
+        break;
+      case Or:
+        for (auto a : args) res |= a;
+        break;
+      case Xor:
+        for (auto a : args) res ^= a;
+        break;
+      case Not: res = !args[0]; break;
+      case Implies: res = !args[0] || args[1]; break;
+      case Ite: res = args[0] ? args[1] : args[2]; break;
+      case Equal:
+        res = 1;
+        for (size_t i = 1; i < args.size(); ++i) res &= args[i] == args[0];
+        break;
+      case Distinct:
+        res = 1;
+        for (size_t i = 0; i < args.size(); ++i)
+          for (size_t j = i + 1; j < args.size(); ++j)
+            res &= args[i] != args[j];
+        break;
+      case Concat:
+        res = 0;
+        for (size_t i = 0; i < args.size(); ++i)
+        {
+          uint64_t ciw = width_of(children[i]);
+          res = (ciw >= 64 ? 0 : res << ciw) | args[i];
+        }
+        break;
+      case Extract: res = args[0] >> op.idx1; break;
+      case BVNot: res = ~args[0]; break;
+      case BVNeg: res = -args[0]; break;
+      case BVAnd:
+        res = ~0ULL;
+        for (auto a : args) res &= a;
+        break;
+      case BVOr:
+        for (auto a : args) res |= a;
+        break;
+      case BVXor:
+        for (auto a : args) res ^= a;
+        break;
+      case BVNand: res = ~(args[0] & args[1]); break;
+      case BVNor: res = ~(args[0] | args[1]); break;
+      case BVXnor: res = ~(args[0] ^ args[1]); break;
+      case BVAdd:
+        for (auto a : args) res += a;
+        break;
+      case BVSub: res = args[0] - args[1]; break;
+      case BVMul:
+        res = 1;
+        for (auto a : args) res *= a;
+        break;
+      case BVUdiv: res = args[1] ? args[0] / args[1] : ~0ULL; break;
+      case BVUrem: res = args[1] ? args[0] % args[1] : args[0]; break;
+      case BVShl: res = args[1] >= w ? 0 : args[0] << args[1]; break;
+      case BVLshr: res = args[1] >= w ? 0 : args[0] >> args[1]; break;
+      case BVAshr:
+      {
+        int64_t a = to_signed(args[0], w);
+        res = a >> (args[1] >= w ? w - 1 : args[1]);
+        break;
+      }
+      case BVComp: res = args[0] == args[1]; break;
+      case BVUlt: res = args[0] < args[1]; break;
+      case BVUle: res = args[0] <= args[1]; break;
+      case BVUgt: res = args[0] > args[1]; break;
+      case BVUge: res = args[0] >= args[1]; break;
+      case BVSlt: res = to_signed(args[0], cw) < to_signed(args[1], cw); break;
+      case BVSle: res = to_signed(args[0], cw) <= to_signed(args[1], cw); break;
+      case BVSgt: res = to_signed(args[0], cw) > to_signed(args[1], cw); break;
+      case BVSge: res = to_signed(args[0], cw) >= to_signed(args[1], cw); break;
+      case Zero_Extend: res = args[0]; break;
+      case Sign_Extend: res = to_signed(args[0], cw); break;
+      case Repeat:
+        for (uint64_t i = 0; i < op.idx0; ++i) res = (res << cw) | args[0];
+        break;
+      case Rotate_Left:
+      case Rotate_Right:
+      {
+        uint64_t n = op.idx0 % w;
+        if (op.prim_op == Rotate_Right)
+        {
+          n = (w - n) % w;
+        }
+        res = n ? (args[0] << n) | (args[0] >> (w - n)) : args[0];
+        break;
+      }
+      case Select:
+      {
+        size_t id = get_id(children[0]);
+        if (id == npos || entries_[id].kind != MV_ARRAY)
+        {
+          throw NotImplementedException("Cannot evaluate array read "
+                                        + to_diagnostic_string(x));
+        }
+        bool found = false;
+        for (const auto & exc : get_array_exceptions(id))
+        {
+          if (words_[entries_[exc.first].offset] == args[1])
+          {
+            res = words_[entries_[exc.second].offset];
+            found = true;
+            break;
+          }
+        }
+        if (!found)
+        {
+          size_t def = get_array_default(id);
+          if (def == npos)
+          {
+            throw NotImplementedException("Array " + children[0]->to_string()
+                                          + " has no default value");
+          }
+          res = words_[entries_[def].offset];
+        }
+        break;
+      }
+      default:
+        throw NotImplementedException("Model evaluation does not support "
+                                      + op.to_string());
+    }
+    cache[x] = mask(res, w);
+  }
+
+  return cache.at(t);
+}
+
+void Model::serialize(std::ostream & os) const
+{
+  os << "smt-switch-model " << entries_.size() << " " << names_.size()
+     << "\n";
+  for (size_t id = 0; id < entries_.size(); ++id)
+  {
+    const Entry & e = entries_[id];
+    os << e.kind << " " << e.width << " " << e.count << " ";
+    write_string(os, id < names_.size() ? names_[id] : "");
+    switch (e.kind)
+    {
+      case MV_BOOL:
+      case MV_BV:
+        os << hex;
+        for (size_t i = 0; i < e.count; ++i)
+        {
+          os << " " << words_[e.offset + i];
+        }
+        os << dec;
+        break;
+      case MV_ARRAY:
+        for (size_t i = 0; i < 1 + 2 * e.count; ++i)
+        {
+          size_t slot = slots_[e.offset + i];
+          os << " " << (slot == npos ? -1 : (int64_t)slot);
+        }
+        break;
+      default: os << " "; write_string(os, strings_[e.offset]);
+    }
+    os << "\n";
+  }
+}
+
+Model Model::deserialize(std::istream & is)
+{
+  string magic;
+  size_t num_entries, num_names;
+  if (!(is >> magic >> num_entries >> num_names) || magic != "smt-switch-model"
+      || num_names > num_entries)
+  {
+    throw SmtException("Malformed model header");
+  }
+
+  Model m;
+  m.entries_.resize(num_entries);
+  for (size_t id = 0; id < num_entries; ++id)
+  {
+    Entry & e = m.entries_[id];
+    int kind;
+    if (!(is >> kind >> e.width >> e.count) || kind < MV_BOOL
+        || kind > MV_OTHER)
+    {
+      throw SmtException("Malformed model entry " + std::to_string(id));
+    }
+    e.kind = static_cast<ModelValueKind>(kind);
+    string name = read_string(is);
+    if (id < num_names)
+    {
+      m.ids_[name] = id;
+      m.names_.push_back(name);
+    }
+    switch (e.kind)
+    {
+      case MV_BOOL:
+      case MV_BV:
+        e.offset = m.words_.size();
+        for (size_t i = 0; i < e.count; ++i)
+        {
+          uint64_t w;
+          is >> hex >> w >> dec;
+          m.words_.push_back(w);
+        }
+        break;
+      case MV_ARRAY:
+        e.offset = m.slots_.size();
+        for (size_t i = 0; i < 1 + 2 * e.count; ++i)
+        {
+          int64_t slot;
+          is >> slot;
+          if (slot >= (int64_t)num_entries)
+          {
+            throw SmtException("Malformed model array entry");
+          }
+          m.slots_.push_back(slot < 0 ? npos : slot);
+        }
+        break;
+      default:
+        e.offset = m.strings_.size();
+        m.strings_.push_back(read_string(is));
+    }
+    if (!is)
+    {
+      throw SmtException("Malformed model entry " + std::to_string(id));
+    }
+  }
+  return m;
+}
+
+}  // namespace smt
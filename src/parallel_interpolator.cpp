@@ -0,0 +1,284 @@
+/*********************                                                        */
+/*! \file parallel_interpolator.cpp
+** \verbatim
+** Top contributors (to current version):
+**   agent
+** This file is part of the smt-switch project.
+** Copyright (c) 2026 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved.  See the file LICENSE in the top-level source
+** directory for licensing information.\endverbatim
+**
+** \brief Computes interpolants at many cut points of a formula sequence
+**        on a pool of interpolating solvers.
+**
+**/
+
+#include "parallel_interpolator.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+using namespace std;
+
+namespace smt {
+
+ParallelInterpolator::ParallelInterpolator(const SmtSolver & solver,
+                                           std::vector<SmtSolver> workers)
+    : solver_(solver), partition_size_(0)
+{
+  if (workers.empty())
+  {
+    throw IncorrectUsageException(
+        "ParallelInterpolator needs at least one worker");
+  }
+  for (auto & s : workers)
+  {
+    workers_.push_back(
+        { s, TermTranslator(s), TermTranslator(solver), {}, {}, {} });
+  }
+}
+
+Result ParallelInterpolator::get_sequence_interpolants(
+    const TermVec & formulae, TermVec & out_I)
+{
+  vector<size_t> cuts;
+  for (size_t i = 1; i < formulae.size(); ++i)
+  {
+    cuts.push_back(i);
+  }
+  // interpolants of separate tasks don't form a sequence interpolant
+  return get_interpolants(formulae, cuts, cuts.size(), out_I);
+}
+
+Result ParallelInterpolator::get_interpolants(const TermVec & formulae,
+                                              const std::vector<size_t> & cuts,
+                                              TermVec & out_I)
+{
+  return get_interpolants(formulae, cuts, partition_size_, out_I);
+}
+
+Result ParallelInterpolator::get_interpolants(const TermVec & formulae,
+                                              const std::vector<size_t> & cuts,
+                                              size_t partition_size,
+                                              TermVec & out_I)
+{
+  size_t n = formulae.size();
+  if (n < 2)
+  {
+    throw IncorrectUsageException(
+        "Require at least two formulae for interpolation");
+  }
+  for (size_t i = 0; i < cuts.size(); ++i)
+  {
+    if (cuts[i] == 0 || cuts[i] >= n || (i && cuts[i] <= cuts[i - 1]))
+    {
+      throw IncorrectUsageException(
+          "Cut points must be strictly increasing and in [1, "
+          + std::to_string(n - 1) + "]");
+    }
+  }
+  if (cuts.empty())
+  {
+    return Result(UNSAT);
+  }
+
+  // translate in this thread, the original solver is not thread-safe
+  TermVec translated;
+  for (auto & w : workers_)
+  {
+    translated.clear();
+    for (const auto & f : formulae)
+    {
+      translated.push_back(w.to_worker.transfer_term(f, BOOL));
+    }
+    // symbols must map back to the original symbols
+    UnorderedTermMap & back = w.from_worker.get_cache();
+    for (const auto & elem : w.to_worker.get_cache())
+    {
+      back.emplace(elem.second, elem.first);
+    }
+
+    // prefix[k] stays valid while the first k formulae are unchanged,
+    // suffix[k] while the formulae from k on are unchanged
+    size_t old_n = w.formulae.size();
+    size_t same_prefix = 0;
+    while (same_prefix < std::min(n, old_n)
+           && translated[same_prefix] == w.formulae[same_prefix])
+    {
+      ++same_prefix;
+    }
+    w.prefix.resize(n + 1);
+    std::fill(w.prefix.begin() + same_prefix + 1, w.prefix.end(), Term());
+
+    size_t same_from = n;
+    if (n == old_n)
+    {
+      while (same_from > 0
+             && translated[same_from - 1] == w.formulae[same_from - 1])
+      {
+        --same_from;
+      }
+    }
+    w.suffix.resize(n + 1);
+    std::fill(w.suffix.begin(), w.suffix.begin() + same_from, Term());
+
+    w.formulae.swap(translated);
+  }
+
+  if (!partition_size)
+  {
+    partition_size = (cuts.size() + workers_.size() - 1) / workers_.size();
+  }
+  vector<Task> tasks;
+  for (size_t i = 0; i < cuts.size(); i += partition_size)
+  {
+    Task t;
+    t.cuts.assign(cuts.begin() + i,
+                  cuts.begin() + std::min(i + partition_size, cuts.size()));
+    tasks.push_back(t);
+  }
+
+  atomic<size_t> next_task(0);
+  mutex m;
+  exception_ptr error;
+  auto run_worker = [&](size_t idx) {
+    size_t k;
+    while ((k = next_task++) < tasks.size())
+    {
+      try
+      {
+        tasks[k].worker = idx;
+        run_task(workers_[idx], tasks[k]);
+      }
+      catch (...)
+      {
+        lock_guard<mutex> lk(m);
+        if (!error)
+        {
+          error = current_exception();
+        }
+        next_task = tasks.size();
+      }
+    }
+  };
+
+  size_t num_threads = std::min(workers_.size(), tasks.size());
+  if (num_threads == 1)
+  {
+    run_worker(0);
+  }
+  else
+  {
+    vector<thread> threads;
+    for (size_t i = 0; i < num_threads; ++i)
+    {
+      threads.emplace_back(run_worker, i);
+    }
+    for (auto & t : threads)
+    {
+      t.join();
+    }
+  }
+  if (error)
+  {
+    rethrow_exception(error);
+  }
+
+  Result r(UNSAT);
+  for (const auto & t : tasks)
+  {
+    if (t.result.is_sat())
+    {
+      return t.result;
+    }
+    else if (t.result.is_unknown())
+    {
+      r = Result(UNKNOWN,
+                 "Had at least one interpolation failure in "
+                 "ParallelInterpolator.");
+    }
+  }
+
+  for (auto & t : tasks)
+  {
+    Worker & w = workers_[t.worker];
+    for (size_t i = 0; i < t.cuts.size(); ++i)
+    {
+      const Term & I = i < t.interpolants.size() ? t.interpolants[i] : Term();
+      out_I.push_back(I ? w.from_worker.transfer_term(I, BOOL) : Term());
+    }
+  }
+  return r;
+}
+
+void ParallelInterpolator::run_task(Worker & w, Task & task)
+{
+  const SmtSolver & s = w.solver;
+  const TermVec & f = w.formulae;
+  size_t n = f.size();
+
+  // extend the cached conjunctions from the nearest computed one
+  auto prefix = [&](size_t c) {
+    size_t k = c;
+    while (k > 1 && !w.prefix[k])
+    {
+      --k;
+    }
+    if (!w.prefix[k])
+    {
+      w.prefix[k] = f[0];
+    }
+    for (; k < c; ++k)
+    {
+      w.prefix[k + 1] = s->make_term(And, w.prefix[k], f[k]);
+    }
+    return w.prefix[c];
+  };
+  auto suffix = [&](size_t c) {
+    size_t k = c;
+    while (k < n - 1 && !w.suffix[k])
+    {
+      ++k;
+    }
+    if (!w.suffix[k])
+    {
+      w.suffix[k] = f[k];
+    }
+    for (; k > c; --k)
+    {
+      w.suffix[k - 1] = s->make_term(And, f[k - 1], w.suffix[k]);
+    }
+    return w.suffix[c];
+  };
+  auto segment = [&](size_t b, size_t e) {
+    Term res = f[b];
+    for (size_t i = b + 1; i < e; ++i)
+    {
+      res = s->make_term(And, res, f[i]);
+    }
+    return res;
+  };
+
+  const vector<size_t> & cuts = task.cuts;
+  if (cuts.size() == 1)
+  {
+    Term I;
+    task.result = s->get_interpolant(prefix(cuts[0]), suffix(cuts[0]), I);
+    task.interpolants = { I };
+    return;
+  }
+
+  TermVec seq({ prefix(cuts[0]) });
+  for (size_t i = 1; i < cuts.size(); ++i)
+  {
+    seq.push_back(segment(cuts[i - 1], cuts[i]));
+  }
+  seq.push_back(suffix(cuts.back()));
+  task.result = s->get_sequence_interpolants(seq, task.interpolants);
+}
+
+}  // namespace smt
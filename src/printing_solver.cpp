@@ -18,6 +18,7 @@
 #include "printing_solver.h"
 #include "utils.h"
 #include "smtlib_utils.h"
+#include "term_printer.h"
 
 using namespace std;
 
@@ -26,9 +27,15 @@ namespace smt {
 /* PrintingSolver */
 
 // implementations
-PrintingSolver::PrintingSolver(SmtSolver s, std::ostream* os, PrintingStyleEnum pse)
+PrintingSolver::PrintingSolver(SmtSolver s,
+                               std::ostream * os,
+                               PrintingStyleEnum pse,
+                               bool lets)
     : AbsSmtSolver(s->get_solver_enum()),
-      wrapped_solver(s), out_stream(os), style(pse)
+      wrapped_solver(s),
+      out_stream(os),
+      style(pse),
+      use_lets(lets)
 {
 }
 
@@ -86,39 +93,113 @@ Sort PrintingSolver::make_sort(const Sort & sort_con,
   return wrapped_solver->make_sort(sort_con, sorts);
 }
 
-Sort PrintingSolver::make_sort(const DatatypeDecl & d) const {
-  throw NotImplementedException("PrintingSolver::make_sort");
-};
-DatatypeDecl PrintingSolver::make_datatype_decl(const std::string & s)  {
-    throw NotImplementedException("PrintingSolver::make_datatype_decl");
+Sort PrintingSolver::make_sort(const DatatypeDecl & d) const
+{
+  return make_datatype_sorts({ d })[0];
+}
+
+Sort PrintingSolver::make_unresolved_sort(const DatatypeDecl & decl) const
+{
+  Sort s = wrapped_solver->make_unresolved_sort(decl);
+  unresolved_names[s] = printed_dts.at(decl).name;
+  return s;
+}
+
+SortVec PrintingSolver::make_datatype_sorts(
+    const std::vector<DatatypeDecl> & decls) const
+{
+  (*out_stream) << "(" << DECLARE_DATATYPE_STR << " (";
+  for (size_t i = 0; i < decls.size(); ++i)
+  {
+    (*out_stream) << (i ? " (" : "(") << printed_dts.at(decls[i]).name
+                  << " 0)";
+  }
+  (*out_stream) << ") (";
+  for (size_t i = 0; i < decls.size(); ++i)
+  {
+    const PrintedDatatype & pdt = printed_dts.at(decls[i]);
+    (*out_stream) << (i ? " (" : "(");
+    for (size_t j = 0; j < pdt.constructors.size(); ++j)
+    {
+      const PrintedConstructor & pc = printed_cons.at(pdt.constructors[j]);
+      (*out_stream) << (j ? " (" : "(") << pc.name;
+      for (const auto & sel : pc.selectors)
+      {
+        (*out_stream) << " (" << sel.first << " ";
+        if (!sel.second)
+        {
+          (*out_stream) << pdt.name;
+        }
+        else
+        {
+          auto it = unresolved_names.find(sel.second);
+          (*out_stream) << (it != unresolved_names.end()
+                                ? it->second
+                                : sel.second->to_string());
+        }
+        (*out_stream) << ")";
+      }
+      (*out_stream) << ")";
+    }
+    (*out_stream) << ")";
+  }
+  (*out_stream) << "))" << endl;
+  return wrapped_solver->make_datatype_sorts(decls);
 }
+
+DatatypeDecl PrintingSolver::make_datatype_decl(const std::string & s)
+{
+  DatatypeDecl d = wrapped_solver->make_datatype_decl(s);
+  printed_dts[d].name = s;
+  return d;
+}
+
 DatatypeConstructorDecl PrintingSolver::make_datatype_constructor_decl(
     const std::string s)
 {
-  throw NotImplementedException(
-      "PrintingSolver::make_datatype_constructor_decl");
-};
-void PrintingSolver::add_constructor(DatatypeDecl & dt, const DatatypeConstructorDecl & con) const {
-  throw NotImplementedException("PrintingSolver::add_constructor");
-};
-void PrintingSolver::add_selector(DatatypeConstructorDecl & dt, const std::string & name, const Sort & s) const {
-  throw NotImplementedException("PrintingSolver::add_selector");
-};
-void PrintingSolver::add_selector_self(DatatypeConstructorDecl & dt, const std::string & name) const {
-  throw NotImplementedException("PrintingSolver::add_selector_self");
-};
-
-Term PrintingSolver::get_constructor(const Sort & s, std::string name) const  {
-  throw NotImplementedException("PrintingSolver::get_constructor");
-};
-Term PrintingSolver::get_tester(const Sort & s, std::string name) const  {
-  throw NotImplementedException("PrintingSolver::get_testeer");
-};
-
-Term PrintingSolver::get_selector(const Sort & s, std::string con, std::string name) const  {
-  throw NotImplementedException("PrintingSolver::get_selector");
-};
+  DatatypeConstructorDecl c = wrapped_solver->make_datatype_constructor_decl(s);
+  printed_cons[c].name = s;
+  return c;
+}
+
+void PrintingSolver::add_constructor(DatatypeDecl & dt,
+                                     const DatatypeConstructorDecl & con) const
+{
+  wrapped_solver->add_constructor(dt, con);
+  printed_dts.at(dt).constructors.push_back(con);
+}
+
+void PrintingSolver::add_selector(DatatypeConstructorDecl & dt,
+                                  const std::string & name,
+                                  const Sort & s) const
+{
+  wrapped_solver->add_selector(dt, name, s);
+  printed_cons.at(dt).selectors.emplace_back(name, s);
+}
+
+void PrintingSolver::add_selector_self(DatatypeConstructorDecl & dt,
+                                       const std::string & name) const
+{
+  wrapped_solver->add_selector_self(dt, name);
+  printed_cons.at(dt).selectors.emplace_back(name, nullptr);
+}
+
+Term PrintingSolver::get_constructor(const Sort & s, std::string name) const
+{
+  return wrapped_solver->get_constructor(s, name);
+}
 
+Term PrintingSolver::get_tester(const Sort & s, std::string name) const
+{
+  return wrapped_solver->get_tester(s, name);
+}
+
+Term PrintingSolver::get_selector(const Sort & s,
+                                  std::string con,
+                                  std::string name) const
+{
+  return wrapped_solver->get_selector(s, con, name);
+}
 
 Term PrintingSolver::make_term(bool b) const
 {
@@ -192,7 +273,8 @@ Term PrintingSolver::make_term(const Op op, const TermVec & terms) const
 
 Term PrintingSolver::get_value(const Term & t) const
 {
-  (*out_stream) << "(" << GET_VALUE_STR << " (" << t << "))" << endl;
+  (*out_stream) << "(" << GET_VALUE_STR << " (" << print_term(t) << "))"
+                << endl;
   return wrapped_solver->get_value(t);
 }
 
@@ -205,7 +287,7 @@ void PrintingSolver::get_unsat_assumptions(UnorderedTermSet & out)
 UnorderedTermMap PrintingSolver::get_array_values(const Term & arr,
                                                  Term & out_const_base) const
 {
-  (*out_stream) << "(get-value (" << arr << "))" << endl;
+  (*out_stream) << "(get-value (" << print_term(arr) << "))" << endl;
   return wrapped_solver->get_array_values(arr, out_const_base);
 }
 
@@ -231,7 +313,7 @@ void PrintingSolver::set_logic(const std::string logic)
 
 void PrintingSolver::assert_formula(const Term & t)
 {
-  (*out_stream) << "(" << ASSERT_STR << " " << t->to_string() << ")" << endl;
+  (*out_stream) << "(" << ASSERT_STR << " " << print_term(t) << ")" << endl;
   wrapped_solver->assert_formula(t);
 }
 
@@ -245,7 +327,7 @@ Result PrintingSolver::check_sat_assuming(const TermVec & assumptions)
 {
   string assumptions_str;
   for (Term a : assumptions) {
-    assumptions_str += a->to_string() + " ";
+    assumptions_str += print_term(a) + " ";
   }
   (*out_stream) << "(" << CHECK_SAT_ASSUMING_STR << " (" << assumptions_str << "))" << endl;
   return wrapped_solver->check_sat_assuming(assumptions);
@@ -271,6 +353,14 @@ void PrintingSolver::reset_assertions() {
   wrapped_solver->reset_assertions(); 
 }
 
+MemoryStats PrintingSolver::get_memory_stats() const
+{
+  MemoryStats stats = wrapped_solver->get_memory_stats();
+  stats.cache_entries["printing_datatypes"] =
+      printed_dts.size() + printed_cons.size();
+  return stats;
+}
+
 Result PrintingSolver::get_interpolant(const Term & A,
                                        const Term & B,
                                        Term & out_I) const
@@ -280,23 +370,33 @@ Result PrintingSolver::get_interpolant(const Term & A,
    * in which the assertions are labeled by interpolation groups
    */
   if (style == PrintingStyleEnum::MSAT_STYLE) {
-    (*out_stream) << "(" << ASSERT_STR << " (! " << A << " :" << INTERPOLATION_GROUP_STR << " g1))" << endl;
-    (*out_stream) << "(" << ASSERT_STR << " (! " << B << " :" << INTERPOLATION_GROUP_STR << " g2))" << endl;;
+    (*out_stream) << "(" << ASSERT_STR << " (! " << print_term(A) << " :" << INTERPOLATION_GROUP_STR << " g1))" << endl;
+    (*out_stream) << "(" << ASSERT_STR << " (! " << print_term(B) << " :" << INTERPOLATION_GROUP_STR << " g2))" << endl;;
     (*out_stream) << "(" << CHECK_SAT_STR << ")" << endl;
     (*out_stream) << "(" << MSAT_GET_INTERPOLANT_STR << " (g1)" << ")" << endl;
     (*out_stream) << "; when running mathsat, use `-interpolation=true` flag" << endl;
   } else {
     assert(style == PrintingStyleEnum::CVC5_STYLE);
-    (*out_stream) << "(" << ASSERT_STR << " " << A << ")" << endl;
-    (*out_stream) << "(" << CVC5_GET_INTERPOLANT_STR << " I (not " << B << "))"
+    (*out_stream) << "(" << ASSERT_STR << " " << print_term(A) << ")" << endl;
+    (*out_stream) << "(" << CVC5_GET_INTERPOLANT_STR << " I (not "
+                  << print_term(B) << "))"
                   << endl;
   }
   return wrapped_solver->get_interpolant(A, B, out_I);
 }
 
-SmtSolver create_printing_solver(SmtSolver wrapped_solver, std::ostream* out_stream, PrintingStyleEnum style) {
-  return std::make_shared<PrintingSolver>(wrapped_solver, out_stream, style);
+std::string PrintingSolver::print_term(const Term & t) const
+{
+  return use_lets ? to_smtlib_string(t) : t->to_string();
+}
 
+SmtSolver create_printing_solver(SmtSolver wrapped_solver,
+                                 std::ostream * out_stream,
+                                 PrintingStyleEnum style,
+                                 bool use_lets)
+{
+  return std::make_shared<PrintingSolver>(
+      wrapped_solver, out_stream, style, use_lets);
 }
 
 }  // namespace smt
@@ -0,0 +1,647 @@
+/*********************                                                        */
+/*! \file profiling_solver.cpp
+** \verbatim
+** Top contributors (to current version):
+**   agent
+** This file is part of the smt-switch project.
+** Copyright (c) 2026 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved.  See the file LICENSE in the top-level source
+** directory for licensing information.\endverbatim
+**
+** \brief Class that wraps another SmtSolver and records call counts,
+**        latencies and memory usage of the operations being performed.
+**/
+
+#include "profiling_solver.h"
+
+#include <sys/resource.h>
+
+#include <chrono>
+
+using namespace std;
+
+namespace smt {
+
+const std::array<std::string, NUM_PROFILED_METHODS> profiled_method2str = {
+  "set_opt",
+  "set_logic",
+  "assert_formula",
+  "check_sat",
+  "check_sat_assuming",
+  "push",
+  "pop",
+  "get_value",
+  "get_array_values",
+  "get_unsat_assumptions",
+  "make_sort",
+  "make_value",
+  "make_symbol",
+  "get_symbol",
+  "make_param",
+  "make_term",
+  "substitute",
+  "reset",
+  "reset_assertions",
+  "datatype",
+  "interpolation"
+};
+
+std::string to_string(ProfiledMethod m)
+{
+  if (m >= NUM_PROFILED_METHODS)
+  {
+    throw IncorrectUsageException("Unknown ProfiledMethod");
+  }
+  return profiled_method2str[m];
+}
+
+namespace {
+
+/** peak resident set size of this process in kilobytes */
+uint64_t peak_rss_kb()
+{
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage))
+  {
+    return 0;
+  }
+#ifdef __APPLE__
+  // reported in bytes on macOS
+  return usage.ru_maxrss / 1024;
+#else
+  return usage.ru_maxrss;
+#endif
+}
+
+}  // namespace
+
+/* LatencyHistogram */
+
+void LatencyHistogram::clear()
+{
+  counts_.fill(0);
+  count_ = 0;
+  total_ = 0;
+  min_ = UINT64_MAX;
+  max_ = 0;
+}
+
+uint64_t LatencyHistogram::bucket_upper_bound(size_t i)
+{
+  if (i < SUB_BUCKETS)
+  {
+    return i;
+  }
+  size_t shift = i / SUB_BUCKETS - 1;
+  uint64_t lower = (SUB_BUCKETS + i % SUB_BUCKETS) << shift;
+  return lower + ((uint64_t)1 << shift) - 1;
+}
+
+uint64_t LatencyHistogram::quantile(double q) const
+{
+  if (!count_)
+  {
+    return 0;
+  }
+  if (q < 0 || q > 1)
+  {
+    throw IncorrectUsageException("Quantile must be in [0, 1]");
+  }
+
+  uint64_t target = q * count_;
+  if (target < 1)
+  {
+    target = 1;
+  }
+  uint64_t seen = 0;
+  for (size_t i = 0; i < NUM_BUCKETS; ++i)
+  {
+    seen += counts_[i];
+    if (seen >= target)
+    {
+      // never report more than the observed maximum
+      return std::min(bucket_upper_bound(i), max_);
+    }
+  }
+  return max_;
+}
+
+/* ProfilingSolver */
+
+ProfilingSolver::ProfilingSolver(SmtSolver s)
+    : AbsSmtSolver(s->get_solver_enum()), wrapped_solver(s), enabled_(true)
+{
+  clear_stats();
+}
+
+ProfilingSolver::~ProfilingSolver() {}
+
+void ProfilingSolver::clear_stats()
+{
+  for (auto & h : histograms_)
+  {
+    h.clear();
+  }
+  op_counts_.fill(0);
+  rss_delta_kb_ = 0;
+}
+
+template <class F>
+auto ProfilingSolver::profile(ProfiledMethod m, F && f) const -> decltype(f())
+{
+  if (!enabled_)
+  {
+    return f();
+  }
+
+  // records the latency even if f throws
+  struct Timer
+  {
+    LatencyHistogram & hist;
+    chrono::steady_clock::time_point start;
+    ~Timer()
+    {
+      hist.record(chrono::duration_cast<chrono::nanoseconds>(
+                      chrono::steady_clock::now() - start)
+                      .count());
+    }
+  } timer{ histograms_[m], chrono::steady_clock::now() };
+  return f();
+}
+
+template <class F>
+auto ProfilingSolver::profile_check(ProfiledMethod m, F && f) const
+    -> decltype(f())
+{
+  if (!enabled_)
+  {
+    return f();
+  }
+
+  uint64_t rss_before = peak_rss_kb();
+  auto res = profile(m, f);
+  uint64_t rss_after = peak_rss_kb();
+  if (rss_after > rss_before)
+  {
+    rss_delta_kb_ += rss_after - rss_before;
+  }
+  return res;
+}
+
+void ProfilingSolver::dump_json(std::ostream & os) const
+{
+  os << "{" << endl;
+  os << "  \"solver\": \"" << to_string(solver_enum) << "\"," << endl;
+  os << "  \"methods\": {";
+  bool first = true;
+  for (size_t i = 0; i < NUM_PROFILED_METHODS; ++i)
+  {
+    const LatencyHistogram & h = histograms_[i];
+    if (!h.count())
+    {
+      continue;
+    }
+    os << (first ? "" : ",") << endl;
+    first = false;
+    os << "    \"" << to_string((ProfiledMethod)i) << "\": { "
+       << "\"calls\": " << h.count() << ", \"total_ns\": " << h.total()
+       << ", \"min_ns\": " << h.min() << ", \"p50_ns\": " << h.quantile(0.5)
+       << ", \"p90_ns\": " << h.quantile(0.9)
+       << ", \"p99_ns\": " << h.quantile(0.99) << ", \"max_ns\": " << h.max()
+       << " }";
+  }
+  os << endl << "  }," << endl;
+
+  os << "  \"ops\": {";
+  first = true;
+  for (size_t i = 0; i < NUM_OPS_AND_NULL; ++i)
+  {
+    if (!op_counts_[i])
+    {
+      continue;
+    }
+    os << (first ? "" : ",") << endl;
+    first = false;
+    os << "    \"" << to_string((PrimOp)i) << "\": " << op_counts_[i];
+  }
+  os << endl << "  }," << endl;
+  os << "  \"check_sat_peak_rss_delta_kb\": " << rss_delta_kb_ << endl;
+  os << "}" << endl;
+}
+
+void ProfilingSolver::dump_prometheus(std::ostream & os,
+                                      const std::string & prefix) const
+{
+  string solver_label = "solver=\"" + to_string(solver_enum) + "\"";
+
+  string calls = prefix + "_calls_total";
+  os << "# TYPE " << calls << " counter" << endl;
+  for (size_t i = 0; i < NUM_PROFILED_METHODS; ++i)
+  {
+    os << calls << "{" << solver_label << ",method=\""
+       << to_string((ProfiledMethod)i) << "\"} " << histograms_[i].count()
+       << endl;
+  }
+
+  // latencies as a summary with a few quantiles
+  string lat = prefix + "_latency_seconds";
+  os << "# TYPE " << lat << " summary" << endl;
+  for (size_t i = 0; i < NUM_PROFILED_METHODS; ++i)
+  {
+    const LatencyHistogram & h = histograms_[i];
+    if (!h.count())
+    {
+      continue;
+    }
+    string labels = solver_label + ",method=\""
+                    + to_string((ProfiledMethod)i) + "\"";
+    for (double q : { 0.5, 0.9, 0.99 })
+    {
+      os << lat << "{" << labels << ",quantile=\"" << q << "\"} "
+         << h.quantile(q) * 1e-9 << endl;
+    }
+    os << lat << "_sum{" << labels << "} " << h.total() * 1e-9 << endl;
+    os << lat << "_count{" << labels << "} " << h.count() << endl;
+  }
+
+  string terms = prefix + "_terms_total";
+  os << "# TYPE " << terms << " counter" << endl;
+  for (size_t i = 0; i < NUM_OPS_AND_NULL; ++i)
+  {
+    if (!op_counts_[i])
+    {
+      continue;
+    }
+    os << terms << "{" << solver_label << ",op=\"" << to_string((PrimOp)i)
+       << "\"} " << op_counts_[i] << endl;
+  }
+
+  string rss = prefix + "_check_sat_peak_rss_delta_bytes";
+  os << "# TYPE " << rss << " counter" << endl;
+  os << rss << "{" << solver_label << "} " << rss_delta_kb_ * 1024 << endl;
+}
+
+// profiled methods
+
+Term ProfilingSolver::get_symbol(const string & name)
+{
+  return profile(PROF_GET_SYMBOL,
+                 [&]() { return wrapped_solver->get_symbol(name); });
+}
+
+Sort ProfilingSolver::make_sort(const string name, uint64_t arity) const
+{
+  return profile(PROF_MAKE_SORT,
+                 [&]() { return wrapped_solver->make_sort(name, arity); });
+}
+
+Sort ProfilingSolver::make_sort(const SortKind sk) const
+{
+  return profile(PROF_MAKE_SORT,
+                 [&]() { return wrapped_solver->make_sort(sk); });
+}
+
+Sort ProfilingSolver::make_sort(const SortKind sk, uint64_t size) const
+{
+  return profile(PROF_MAKE_SORT,
+                 [&]() { return wrapped_solver->make_sort(sk, size); });
+}
+
+Sort ProfilingSolver::make_sort(const SortKind sk, const Sort & sort1) const
+{
+  return profile(PROF_MAKE_SORT,
+                 [&]() { return wrapped_solver->make_sort(sk, sort1); });
+}
+
+Sort ProfilingSolver::make_sort(const SortKind sk,
+                                const Sort & sort1,
+                                const Sort & sort2) const
+{
+  return profile(PROF_MAKE_SORT, [&]() {
+    return wrapped_solver->make_sort(sk, sort1, sort2);
+  });
+}
+
+Sort ProfilingSolver::make_sort(const SortKind sk,
+                                const Sort & sort1,
+                                const Sort & sort2,
+                                const Sort & sort3) const
+{
+  return profile(PROF_MAKE_SORT, [&]() {
+    return wrapped_solver->make_sort(sk, sort1, sort2, sort3);
+  });
+}
+
+Sort ProfilingSolver::make_sort(const SortKind sk, const SortVec & sorts) const
+{
+  return profile(PROF_MAKE_SORT,
+                 [&]() { return wrapped_solver->make_sort(sk, sorts); });
+}
+
+Sort ProfilingSolver::make_sort(const Sort & sort_con,
+                                const SortVec & sorts) const
+{
+  return profile(PROF_MAKE_SORT,
+                 [&]() { return wrapped_solver->make_sort(sort_con, sorts); });
+}
+
+Sort ProfilingSolver::make_sort(const DatatypeDecl & d) const
+{
+  return profile(PROF_MAKE_SORT,
+                 [&]() { return wrapped_solver->make_sort(d); });
+}
+
+Sort ProfilingSolver::make_unresolved_sort(const DatatypeDecl & decl) const
+{
+  return profile(PROF_DATATYPE,
+                 [&]() { return wrapped_solver->make_unresolved_sort(decl); });
+}
+
+SortVec ProfilingSolver::make_datatype_sorts(
+    const std::vector<DatatypeDecl> & decls) const
+{
+  return profile(PROF_MAKE_SORT,
+                 [&]() { return wrapped_solver->make_datatype_sorts(decls); });
+}
+
+DatatypeDecl ProfilingSolver::make_datatype_decl(const string & s)
+{
+  return profile(PROF_DATATYPE,
+                 [&]() { return wrapped_solver->make_datatype_decl(s); });
+}
+
+DatatypeConstructorDecl ProfilingSolver::make_datatype_constructor_decl(
+    const string s)
+{
+  return profile(PROF_DATATYPE, [&]() {
+    return wrapped_solver->make_datatype_constructor_decl(s);
+  });
+}
+
+void ProfilingSolver::add_constructor(DatatypeDecl & dt,
+                                      const DatatypeConstructorDecl & con) const
+{
+  profile(PROF_DATATYPE,
+          [&]() { wrapped_solver->add_constructor(dt, con); });
+}
+
+void ProfilingSolver::add_selector(DatatypeConstructorDecl & dt,
+                                   const string & name,
+                                   const Sort & s) const
+{
+  profile(PROF_DATATYPE,
+          [&]() { wrapped_solver->add_selector(dt, name, s); });
+}
+
+void ProfilingSolver::add_selector_self(DatatypeConstructorDecl & dt,
+                                        const string & name) const
+{
+  profile(PROF_DATATYPE,
+          [&]() { wrapped_solver->add_selector_self(dt, name); });
+}
+
+Term ProfilingSolver::get_constructor(const Sort & s, string name) const
+{
+  return profile(PROF_DATATYPE,
+                 [&]() { return wrapped_solver->get_constructor(s, name); });
+}
+
+Term ProfilingSolver::get_tester(const Sort & s, string name) const
+{
+  return profile(PROF_DATATYPE,
+                 [&]() { return wrapped_solver->get_tester(s, name); });
+}
+
+Term ProfilingSolver::get_selector(const Sort & s,
+                                   string con,
+                                   string name) const
+{
+  return profile(PROF_DATATYPE, [&]() {
+    return wrapped_solver->get_selector(s, con, name);
+  });
+}
+
+Term ProfilingSolver::make_term(bool b) const
+{
+  return profile(PROF_MAKE_VALUE,
+                 [&]() { return wrapped_solver->make_term(b); });
+}
+
+Term ProfilingSolver::make_term(int64_t i, const Sort & sort) const
+{
+  return profile(PROF_MAKE_VALUE,
+                 [&]() { return wrapped_solver->make_term(i, sort); });
+}
+
+Term ProfilingSolver::make_term(const string val,
+                                const Sort & sort,
+                                uint64_t base) const
+{
+  return profile(PROF_MAKE_VALUE,
+                 [&]() { return wrapped_solver->make_term(val, sort, base); });
+}
+
+Term ProfilingSolver::make_term(const Term & val, const Sort & sort) const
+{
+  return profile(PROF_MAKE_VALUE,
+                 [&]() { return wrapped_solver->make_term(val, sort); });
+}
+
+Term ProfilingSolver::make_symbol(const string name, const Sort & sort)
+{
+  return profile(PROF_MAKE_SYMBOL,
+                 [&]() { return wrapped_solver->make_symbol(name, sort); });
+}
+
+Term ProfilingSolver::make_param(const string name, const Sort & sort)
+{
+  return profile(PROF_MAKE_PARAM,
+                 [&]() { return wrapped_solver->make_param(name, sort); });
+}
+
+Term ProfilingSolver::make_term(const Op op, const Term & t) const
+{
+  if (enabled_)
+  {
+    op_counts_[op.prim_op]++;
+  }
+  return profile(PROF_MAKE_TERM,
+                 [&]() { return wrapped_solver->make_term(op, t); });
+}
+
+Term ProfilingSolver::make_term(const Op op,
+                                const Term & t0,
+                                const Term & t1) const
+{
+  if (enabled_)
+  {
+    op_counts_[op.prim_op]++;
+  }
+  return profile(PROF_MAKE_TERM,
+                 [&]() { return wrapped_solver->make_term(op, t0, t1); });
+}
+
+Term ProfilingSolver::make_term(const Op op,
+                                const Term & t0,
+                                const Term & t1,
+                                const Term & t2) const
+{
+  if (enabled_)
+  {
+    op_counts_[op.prim_op]++;
+  }
+  return profile(PROF_MAKE_TERM,
+                 [&]() { return wrapped_solver->make_term(op, t0, t1, t2); });
+}
+
+Term ProfilingSolver::make_term(const Op op, const TermVec & terms) const
+{
+  if (enabled_)
+  {
+    op_counts_[op.prim_op]++;
+  }
+  return profile(PROF_MAKE_TERM,
+                 [&]() { return wrapped_solver->make_term(op, terms); });
+}
+
+Term ProfilingSolver::substitute(const Term term,
+                                 const UnorderedTermMap & substitution_map) const
+{
+  return profile(PROF_SUBSTITUTE, [&]() {
+    return wrapped_solver->substitute(term, substitution_map);
+  });
+}
+
+TermVec ProfilingSolver::substitute_terms(
+    const TermVec & terms, const UnorderedTermMap & substitution_map) const
+{
+  return profile(PROF_SUBSTITUTE, [&]() {
+    return wrapped_solver->substitute_terms(terms, substitution_map);
+  });
+}
+
+Term ProfilingSolver::get_value(const Term & t) const
+{
+  return profile(PROF_GET_VALUE,
+                 [&]() { return wrapped_solver->get_value(t); });
+}
+
+void ProfilingSolver::get_bv_value(const Term & t,
+                                   std::vector<uint64_t> & out) const
+{
+  // counted as a get_value
+  profile(PROF_GET_VALUE, [&]() { wrapped_solver->get_bv_value(t, out); });
+}
+
+void ProfilingSolver::get_unsat_assumptions(UnorderedTermSet & out)
+{
+  profile(PROF_GET_UNSAT_ASSUMPTIONS,
+          [&]() { wrapped_solver->get_unsat_assumptions(out); });
+}
+
+UnorderedTermMap ProfilingSolver::get_array_values(const Term & arr,
+                                                   Term & out_const_base) const
+{
+  return profile(PROF_GET_ARRAY_VALUES, [&]() {
+    return wrapped_solver->get_array_values(arr, out_const_base);
+  });
+}
+
+void ProfilingSolver::reset()
+{
+  profile(PROF_RESET, [&]() { wrapped_solver->reset(); });
+}
+
+void ProfilingSolver::set_opt(const string option, const string value)
+{
+  profile(PROF_SET_OPT, [&]() { wrapped_solver->set_opt(option, value); });
+}
+
+void ProfilingSolver::set_logic(const string logic)
+{
+  profile(PROF_SET_LOGIC, [&]() { wrapped_solver->set_logic(logic); });
+}
+
+void ProfilingSolver::assert_formula(const Term & t)
+{
+  profile(PROF_ASSERT_FORMULA, [&]() { wrapped_solver->assert_formula(t); });
+}
+
+Result ProfilingSolver::check_sat()
+{
+  return profile_check(PROF_CHECK_SAT,
+                       [&]() { return wrapped_solver->check_sat(); });
+}
+
+Result ProfilingSolver::check_sat_assuming(const TermVec & assumptions)
+{
+  return profile_check(PROF_CHECK_SAT_ASSUMING, [&]() {
+    return wrapped_solver->check_sat_assuming(assumptions);
+  });
+}
+
+Result ProfilingSolver::check_sat_assuming_list(const TermList & assumptions)
+{
+  return profile_check(PROF_CHECK_SAT_ASSUMING, [&]() {
+    return wrapped_solver->check_sat_assuming_list(assumptions);
+  });
+}
+
+Result ProfilingSolver::check_sat_assuming_set(
+    const UnorderedTermSet & assumptions)
+{
+  return profile_check(PROF_CHECK_SAT_ASSUMING, [&]() {
+    return wrapped_solver->check_sat_assuming_set(assumptions);
+  });
+}
+
+void ProfilingSolver::push(uint64_t num)
+{
+  profile(PROF_PUSH, [&]() { wrapped_solver->push(num); });
+}
+
+void ProfilingSolver::pop(uint64_t num)
+{
+  profile(PROF_POP, [&]() { wrapped_solver->pop(num); });
+}
+
+uint64_t ProfilingSolver::get_context_level() const
+{
+  return wrapped_solver->get_context_level();
+}
+
+void ProfilingSolver::reset_assertions()
+{
+  profile(PROF_RESET_ASSERTIONS,
+          [&]() { wrapped_solver->reset_assertions(); });
+}
+
+MemoryStats ProfilingSolver::get_memory_stats() const
+{
+  return wrapped_solver->get_memory_stats();
+}
+
+Result ProfilingSolver::get_interpolant(const Term & A,
+                                        const Term & B,
+                                        Term & out_I) const
+{
+  return profile_check(PROF_INTERPOLATION, [&]() {
+    return wrapped_solver->get_interpolant(A, B, out_I);
+  });
+}
+
+Result ProfilingSolver::get_sequence_interpolants(const TermVec & formulae,
+                                                  TermVec & out_I) const
+{
+  return profile_check(PROF_INTERPOLATION, [&]() {
+    return wrapped_solver->get_sequence_interpolants(formulae, out_I);
+  });
+}
+
+SmtSolver create_profiling_solver(SmtSolver wrapped_solver)
+{
+  return std::make_shared<ProfilingSolver>(wrapped_solver);
+}
+
+}  // namespace smt
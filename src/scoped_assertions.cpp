@@ -0,0 +1,156 @@
+/*********************                                                        */
+/*! \file scoped_assertions.cpp
+** \verbatim
+** Top contributors (to current version):
+**   agent
+** This file is part of the smt-switch project.
+** Copyright (c) 2026 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved.  See the file LICENSE in the top-level source
+** directory for licensing information.\endverbatim
+**
+** \brief Emulates push / pop with activation literals.
+**
+**/
+
+#include "scoped_assertions.h"
+
+#include "assert.h"
+
+using namespace std;
+
+namespace smt {
+
+ScopedAssertions::ScopedAssertions(const SmtSolver & solver,
+                                   size_t garbage_threshold)
+    : solver_(solver),
+      boolsort_(solver->make_sort(BOOL)),
+      garbage_threshold_(garbage_threshold)
+{
+}
+
+Term ScopedAssertions::fresh_literal()
+{
+  if (free_lits_.size())
+  {
+    Term act = free_lits_.back();
+    free_lits_.pop_back();
+    return act;
+  }
+
+  Term act = solver_->make_symbol(
+      "__scoped_act_" + std::to_string(act_lits_.size()), boolsort_);
+  act_lits_.insert(act);
+  return act;
+}
+
+void ScopedAssertions::push(uint64_t num)
+{
+  for (uint64_t i = 0; i < num; ++i)
+  {
+    scopes_.push_back({ fresh_literal(), {} });
+  }
+}
+
+void ScopedAssertions::pop(uint64_t num)
+{
+  if (num > scopes_.size())
+  {
+    throw IncorrectUsageException("Cannot pop " + std::to_string(num)
+                                  + " scopes at context level "
+                                  + std::to_string(scopes_.size()));
+  }
+
+  for (uint64_t i = 0; i < num; ++i)
+  {
+    Term act = scopes_.back().act;
+    scopes_.pop_back();
+    // permanently disable the clauses of this scope
+    solver_->assert_formula(solver_->make_term(Not, act));
+    retired_.push_back(act);
+  }
+
+  if (garbage_threshold_ && retired_.size() >= garbage_threshold_)
+  {
+    try
+    {
+      compact();
+    }
+    catch (NotImplementedException & e)
+    {
+      // backend can't reset assertions -- keep the garbage
+      garbage_threshold_ = 0;
+    }
+  }
+}
+
+void ScopedAssertions::assert_formula(const Term & t)
+{
+  if (scopes_.empty())
+  {
+    base_assertions_.push_back(t);
+    solver_->assert_formula(t);
+  }
+  else
+  {
+    Scope & scope = scopes_.back();
+    scope.assertions.push_back(t);
+    solver_->assert_formula(solver_->make_term(Implies, scope.act, t));
+  }
+}
+
+Result ScopedAssertions::check_sat() { return check_sat_assuming({}); }
+
+Result ScopedAssertions::check_sat_assuming(const TermVec & assumptions)
+{
+  if (scopes_.empty() && assumptions.empty())
+  {
+    return solver_->check_sat();
+  }
+
+  assumptions_.clear();
+  for (const auto & scope : scopes_)
+  {
+    assumptions_.push_back(scope.act);
+  }
+  assumptions_.insert(
+      assumptions_.end(), assumptions.begin(), assumptions.end());
+  return solver_->check_sat_assuming(assumptions_);
+}
+
+void ScopedAssertions::get_unsat_assumptions(UnorderedTermSet & out)
+{
+  UnorderedTermSet core;
+  solver_->get_unsat_assumptions(core);
+  for (const auto & a : core)
+  {
+    if (!is_activation_literal(a))
+    {
+      out.insert(a);
+    }
+  }
+}
+
+void ScopedAssertions::compact()
+{
+  solver_->reset_assertions();
+
+  for (const auto & a : base_assertions_)
+  {
+    solver_->assert_formula(a);
+  }
+
+  for (const auto & scope : scopes_)
+  {
+    for (const auto & a : scope.assertions)
+    {
+      solver_->assert_formula(solver_->make_term(Implies, scope.act, a));
+    }
+  }
+
+  // (not act) is no longer asserted, so retired literals are free again
+  free_lits_.insert(free_lits_.end(), retired_.begin(), retired_.end());
+  retired_.clear();
+}
+
+}  // namespace smt
@@ -0,0 +1,774 @@
+/*********************                                                        */
+/*! \file smtlib_direct_parser.cpp
+** \verbatim
+** Top contributors (to current version):
+**   agent
+** This file is part of the smt-switch project.
+** Copyright (c) 2026 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved.  See the file LICENSE in the top-level source
+** directory for licensing information.\endverbatim
+**
+** \brief A hand-written SMT-LIB parser, an alternative to the bison parser
+**        of SmtLibReader.
+**
+**/
+
+#include "smtlib_direct_parser.h"
+
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+
+#include "assert.h"
+#include "mapped_file.h"
+#include "trace.h"
+
+using namespace std;
+
+namespace smt {
+
+namespace {
+
+/** Thrown for a syntax error and caught by SmtLibDirectParser::run, which
+ *  reports it like the bison parser instead of propagating it
+ */
+struct SyntaxError : public std::runtime_error
+{
+  SyntaxError(const string & msg) : std::runtime_error(msg) {}
+};
+
+string describe(const SmtLibToken & tok)
+{
+  switch (tok.kind)
+  {
+    case TOK_EOF: return "end of file";
+    case TOK_LP: return "'('";
+    case TOK_RP: return "')'";
+    case TOK_QUOTED_SYMBOL: return "'|" + string(tok.text) + "|'";
+    case TOK_KEYWORD: return "':" + string(tok.text) + "'";
+    case TOK_STRING: return "'\"" + string(tok.text) + "\"'";
+    case TOK_BINARY: return "'#b" + string(tok.text) + "'";
+    case TOK_HEX: return "'#x" + string(tok.text) + "'";
+    default: return "'" + string(tok.text) + "'";
+  }
+}
+
+}  // namespace
+
+SmtLibDirectParser::SmtLibDirectParser(SmtLibReader & reader)
+    : reader_(reader),
+      solver_(reader.solver()),
+      lexer_(nullptr),
+      tok_pos_(0),
+      tok_end_(0),
+      line_(1)
+{
+}
+
+int SmtLibDirectParser::parse(const string & f)
+{
+  if (f.empty() || f == "-")
+  {
+    string text(istreambuf_iterator<char>(cin), {});
+    return run(text, f);
+  }
+  MappedFile mf(f);
+  return run(string_view(mf.data(), mf.size()), f);
+}
+
+int SmtLibDirectParser::parse_string(string_view text, const string & name)
+{
+  return run(text, name);
+}
+
+int SmtLibDirectParser::run(string_view text, const string & name)
+{
+  SMT_TRACE_SPAN("SmtLibDirectParser::parse", "parser");
+  reader_.file = name;
+  SmtLibLexer lexer(text.data(), text.size());
+  lexer_ = &lexer;
+  tok_pos_ = tok_end_ = 0;
+  line_ = 1;
+
+  auto reset = [this]() {
+    lexer_ = nullptr;
+    while (!frames_.empty())
+    {
+      pop_frame();
+    }
+    // leave the reader in the top-level scope, even after an error inside
+    // a let, quantifier or define-fun
+    while (reader_.current_scope())
+    {
+      reader_.pop_scope();
+    }
+  };
+
+  try
+  {
+    while (peek().kind != TOK_EOF && command())
+    {
+    }
+  }
+  catch (const SyntaxError & e)
+  {
+    reset();
+    cerr << name << ":" << line_ << ": " << e.what() << endl;
+    return 1;
+  }
+  catch (...)
+  {
+    reset();
+    throw;
+  }
+  reset();
+  return 0;
+}
+
+bool SmtLibDirectParser::command()
+{
+  expect(TOK_LP, "'(' to start a command");
+  SmtLibToken tok = advance();
+  if (tok.kind != TOK_SYMBOL)
+  {
+    syntax_error("Expected a command, got " + describe(tok));
+  }
+
+  // most commands of a large benchmark are asserts
+  string_view cmd = tok.text;
+  bool more = true;
+  if (cmd == "assert")
+  {
+    reader_.assert_formula(term());
+  }
+  else if (cmd == "declare-fun")
+  {
+    string fun(symbol("function name"));
+    expect(TOK_LP, "'(' to start the argument sorts");
+    SortVec sorts;
+    while (peek().kind != TOK_RP)
+    {
+      sorts.push_back(sort());
+    }
+    advance();
+    Sort symsort = sort();
+    if (sorts.size())
+    {
+      sorts.push_back(symsort);
+      symsort = solver_->make_sort(FUNCTION, sorts);
+    }
+    reader_.new_symbol(fun, symsort);
+  }
+  else if (cmd == "declare-const")
+  {
+    string sym(symbol("constant name"));
+    reader_.new_symbol(sym, sort());
+  }
+  else if (cmd == "define-fun")
+  {
+    // new scope for arguments
+    reader_.push_scope();
+    string fun(symbol("function name"));
+    expect(TOK_LP, "'(' to start the arguments");
+    TermVec args;
+    sorted_vars(false, args);
+    // the return sort is not checked, like in the bison parser
+    sort();
+    Term def = term();
+    reader_.define_fun(fun, def, args);
+    reader_.pop_scope();
+    assert(!reader_.current_scope());
+  }
+  else if (cmd == "check-sat")
+  {
+    reader_.check_sat();
+  }
+  else if (cmd == "check-sat-assuming")
+  {
+    expect(TOK_LP, "'(' to start the assumptions");
+    TermVec assumptions;
+    while (peek().kind != TOK_RP)
+    {
+      assumptions.push_back(term());
+    }
+    advance();
+    reader_.check_sat_assuming(assumptions);
+  }
+  else if (cmd == "push" || cmd == "pop")
+  {
+    uint64_t num = peek().kind == TOK_NUMERAL ? numeral("scopes") : 1;
+    if (cmd == "push")
+    {
+      reader_.push(num);
+    }
+    else
+    {
+      reader_.pop(num);
+    }
+  }
+  else if (cmd == "set-logic")
+  {
+    reader_.set_logic(name(symbol("logic")));
+  }
+  else if (cmd == "set-option")
+  {
+    auto attr = attribute();
+    reader_.set_opt(attr.first, attr.second);
+  }
+  else if (cmd == "set-info")
+  {
+    auto attr = attribute();
+    reader_.set_info(attr.first, attr.second);
+  }
+  else if (cmd == "declare-sort")
+  {
+    string sym(symbol("sort name"));
+    uint64_t arity = numeral("arity");
+    reader_.define_sort(sym, solver_->make_sort(sym, arity));
+  }
+  else if (cmd == "define-sort")
+  {
+    // only supports 0-arity define-sorts
+    string sym(symbol("sort name"));
+    expect(TOK_LP, "'(' (only 0-arity define-sort is supported)");
+    expect(TOK_RP, "')' (only 0-arity define-sort is supported)");
+    reader_.define_sort(sym, sort());
+  }
+  else if (cmd == "get-value")
+  {
+    expect(TOK_LP, "'(' to start the terms");
+    TermVec terms;
+    while (peek().kind != TOK_RP)
+    {
+      terms.push_back(term());
+    }
+    advance();
+    cout << "(";
+    for (const auto & t : terms)
+    {
+      cout << "(" << t << " " << solver_->get_value(t) << ") " << endl;
+    }
+    cout << ")" << endl;
+  }
+  else if (cmd == "get-unsat-assumptions")
+  {
+    UnorderedTermSet core;
+    solver_->get_unsat_assumptions(core);
+    cout << "(";
+    for (const auto & c : core)
+    {
+      cout << c << endl;
+    }
+    cout << ")" << endl;
+  }
+  else if (cmd == "echo")
+  {
+    SmtLibToken str = advance();
+    if (str.kind != TOK_STRING && str.kind != TOK_SYMBOL
+        && str.kind != TOK_QUOTED_SYMBOL)
+    {
+      syntax_error("Expected a string, got " + describe(str));
+    }
+    cout << str.text << endl;
+  }
+  else if (cmd == "exit")
+  {
+    more = false;
+  }
+  else
+  {
+    syntax_error("Unsupported command: " + string(cmd));
+  }
+  expect(TOK_RP, "')' to end the command");
+  return more;
+}
+
+Term SmtLibDirectParser::term()
+{
+  assert(frames_.empty());
+  while (true)
+  {
+    SmtLibToken tok = advance();
+    Term t = tok.kind == TOK_LP ? open_frame() : atom(tok);
+    // a completed term can complete its parents in turn
+    while (t)
+    {
+      if (frames_.empty())
+      {
+        return t;
+      }
+      t = add_child(t);
+    }
+  }
+}
+
+Term SmtLibDirectParser::open_frame()
+{
+  SmtLibToken tok = advance();
+  if (tok.kind == TOK_LP)
+  {
+    SmtLibToken head = advance();
+    if (is_symbol(head, "_"))
+    {
+      // ((_ op i) args) or ((_ op i j) args)
+      PrimOp po = reader_.lookup_primop(name(symbol("indexed operator")));
+      if (po == NUM_OPS_AND_NULL)
+      {
+        syntax_error("Unexpected symbol in indexed operator: " + name_);
+      }
+      uint64_t idx0 = numeral("index");
+      Op op(po, idx0);
+      if (peek().kind == TOK_NUMERAL)
+      {
+        op = Op(po, idx0, numeral("index"));
+      }
+      expect(TOK_RP, "')' to end the indexed operator");
+      push_frame(FRAME_INDEXED_OP);
+      frames_.back().op = op;
+      return close_if_done();
+    }
+    else if (is_symbol(head, "as") && is_symbol(peek(), "const"))
+    {
+      advance();
+      Sort array_sort = sort();
+      expect(TOK_RP, "')' to end as const");
+      push_frame(FRAME_AS_CONST);
+      frames_.back().sort = array_sort;
+      return Term();
+    }
+    syntax_error("Unexpected " + describe(head) + " after '(('");
+  }
+
+  if (tok.kind == TOK_SYMBOL)
+  {
+    if (tok.text == "_")
+    {
+      // (_ bvN width)
+      string_view bv = symbol("bit-vector constant");
+      if (bv.size() < 3 || bv.substr(0, 2) != "bv"
+          || bv.find_first_not_of("0123456789", 2) != string_view::npos)
+      {
+        syntax_error("Expected a bit-vector constant, got "
+                     + string(bv));
+      }
+      string val(bv.substr(2));
+      uint64_t width = numeral("width");
+      expect(TOK_RP, "')' to end the bit-vector constant");
+      return solver_->make_term(val, bv_sort(width), 10);
+    }
+    else if (tok.text == "!")
+    {
+      push_frame(FRAME_ANNOTATION);
+      return Term();
+    }
+    else if (tok.text == "let")
+    {
+      expect(TOK_LP, "'(' to start the let bindings");
+      reader_.push_scope();
+      if (peek().kind == TOK_RP)
+      {
+        advance();
+        push_frame(FRAME_LET_BODY);
+        return Term();
+      }
+      expect(TOK_LP, "'(' to start a let binding");
+      push_frame(FRAME_LET_BINDING);
+      frames_.back().name = symbol("let binding");
+      return Term();
+    }
+    else if (tok.text == "forall" || tok.text == "exists")
+    {
+      PrimOp po = reader_.lookup_primop(name(tok.text));
+      expect(TOK_LP, "'(' to start the bound variables");
+      reader_.push_scope();
+      // smt-switch takes all the parameters followed by the body
+      TermVec & params = push_frame(FRAME_QUANTIFIER);
+      frames_.back().op = Op(po);
+      sorted_vars(true, params);
+      return Term();
+    }
+  }
+
+  if (tok.kind == TOK_SYMBOL || tok.kind == TOK_QUOTED_SYMBOL)
+  {
+    // check if it's a known operator in the given logic, then a declared
+    // function, otherwise it must be a define-fun
+    const string & fun = name(tok.text);
+    PrimOp po = reader_.lookup_primop(fun);
+    if (po != NUM_OPS_AND_NULL)
+    {
+      push_frame(FRAME_PRIMOP);
+      frames_.back().op = Op(po);
+    }
+    else if (Term uf = reader_.lookup_symbol(fun))
+    {
+      push_frame(FRAME_APPLY).push_back(uf);
+    }
+    else
+    {
+      push_frame(FRAME_DEFINE_FUN);
+      frames_.back().name = fun;
+    }
+    return close_if_done();
+  }
+
+  syntax_error("Unexpected " + describe(tok) + " after '('");
+}
+
+Term SmtLibDirectParser::add_child(const Term & t)
+{
+  Frame & f = frames_.back();
+  TermVec & children = children_[frames_.size() - 1];
+  Term res;
+  switch (f.kind)
+  {
+    case FRAME_LET_BINDING:
+    {
+      reader_.let_binding(f.name, t);
+      expect(TOK_RP, "')' to end the let binding");
+      if (peek().kind == TOK_LP)
+      {
+        advance();
+        f.name = symbol("let binding");
+      }
+      else
+      {
+        expect(TOK_RP, "')' to end the let bindings");
+        f.kind = FRAME_LET_BODY;
+      }
+      return res;
+    }
+    case FRAME_LET_BODY:
+    {
+      expect(TOK_RP, "')' to end the let");
+      reader_.pop_scope();
+      res = t;
+      break;
+    }
+    case FRAME_QUANTIFIER:
+    {
+      expect(TOK_RP, "')' to end the quantifier");
+      children.push_back(t);
+      res = solver_->make_term(f.op, children);
+      reader_.pop_scope();
+      break;
+    }
+    case FRAME_ANNOTATION:
+    {
+      vector<pair<string, string>> attrs;
+      while (peek().kind != TOK_RP)
+      {
+        attrs.push_back(attribute());
+      }
+      advance();
+      // the default implementation only prints a warning, a derived
+      // reader can use the attributes
+      for (const auto & attr : attrs)
+      {
+        reader_.term_attribute(t, attr.first, attr.second);
+      }
+      res = t;
+      break;
+    }
+    case FRAME_AS_CONST:
+    {
+      expect(TOK_RP, "')' to end the constant array");
+      res = solver_->make_term(t, f.sort);
+      break;
+    }
+    default:
+    {
+      children.push_back(t);
+      return close_if_done();
+    }
+  }
+  pop_frame();
+  return res;
+}
+
+Term SmtLibDirectParser::close_if_done()
+{
+  if (peek().kind != TOK_RP)
+  {
+    return Term();
+  }
+  advance();
+
+  const Frame & f = frames_.back();
+  const TermVec & args = children_[frames_.size() - 1];
+  Term res;
+  switch (f.kind)
+  {
+    case FRAME_PRIMOP:
+    {
+      // Minus needs to be Negate if there is only one argument
+      if (f.op.prim_op == Minus && args.size() == 1)
+      {
+        res = solver_->make_term(Negate, args[0]);
+      }
+      else
+      {
+        res = solver_->make_term(f.op, args);
+      }
+      break;
+    }
+    case FRAME_INDEXED_OP: res = solver_->make_term(f.op, args); break;
+    case FRAME_APPLY: res = solver_->make_term(Apply, args); break;
+    case FRAME_DEFINE_FUN:
+    {
+      // throws if it is not a define-fun either
+      res = reader_.apply_define_fun(f.name, args);
+      break;
+    }
+    default: assert(false);
+  }
+  pop_frame();
+  return res;
+}
+
+Term SmtLibDirectParser::atom(const SmtLibToken & tok)
+{
+  switch (tok.kind)
+  {
+    case TOK_SYMBOL:
+    case TOK_QUOTED_SYMBOL:
+    {
+      Term sym = reader_.lookup_symbol(name(tok.text));
+      if (!sym)
+      {
+        syntax_error("Unrecognized symbol: " + name_);
+      }
+      return sym;
+    }
+    case TOK_NUMERAL:
+    {
+      return solver_->make_term(name(tok.text), int_sort());
+    }
+    case TOK_BINARY:
+    {
+      return solver_->make_term(
+          name(tok.text), bv_sort(tok.text.size()), 2);
+    }
+    case TOK_HEX:
+    {
+      return solver_->make_term(
+          name(tok.text), bv_sort(4 * tok.text.size()), 16);
+    }
+    default:
+    {
+      syntax_error("Expected a term, got " + describe(tok));
+    }
+  }
+}
+
+Sort SmtLibDirectParser::sort()
+{
+  SmtLibToken tok = advance();
+  if (tok.kind == TOK_SYMBOL || tok.kind == TOK_QUOTED_SYMBOL)
+  {
+    // check built-in sort kinds first, uninterpreted sorts are stored with
+    // the defined sorts
+    const string & sym = name(tok.text);
+    SortKind sk = reader_.lookup_sortkind(sym);
+    if (sk == NUM_SORT_KINDS || sk == UNINTERPRETED)
+    {
+      return reader_.lookup_sort(sym);
+    }
+    return solver_->make_sort(sk);
+  }
+  else if (tok.kind != TOK_LP)
+  {
+    syntax_error("Expected a sort, got " + describe(tok));
+  }
+
+  if (is_symbol(peek(), "_"))
+  {
+    // this one is intended for bit-vectors
+    advance();
+    SortKind sk = reader_.lookup_sortkind(name(symbol("sort")));
+    if (sk == NUM_SORT_KINDS)
+    {
+      syntax_error("Unrecognized sort: " + name_);
+    }
+    uint64_t width = numeral("sort index");
+    expect(TOK_RP, "')' to end the sort");
+    return sk == BV ? bv_sort(width) : solver_->make_sort(sk, width);
+  }
+
+  string con(symbol("sort"));
+  SortVec sorts;
+  while (peek().kind != TOK_RP)
+  {
+    sorts.push_back(sort());
+  }
+  advance();
+  if (reader_.lookup_sortkind(con) == ARRAY)
+  {
+    if (sorts.size() != 2)
+    {
+      syntax_error("Expected two sorts for Array");
+    }
+    return solver_->make_sort(ARRAY, sorts[0], sorts[1]);
+  }
+  // defined or declared sort
+  return solver_->make_sort(reader_.lookup_sort(con), sorts);
+}
+
+TermVec & SmtLibDirectParser::push_frame(FrameKind kind)
+{
+  size_t depth = frames_.size();
+  frames_.push_back({ kind, Op(), "", Sort() });
+  if (children_.size() == depth)
+  {
+    children_.emplace_back();
+  }
+  assert(children_[depth].empty());
+  return children_[depth];
+}
+
+void SmtLibDirectParser::pop_frame()
+{
+  // keep the capacity for the next term at this depth
+  children_[frames_.size() - 1].clear();
+  frames_.pop_back();
+}
+
+void SmtLibDirectParser::sorted_vars(bool params, TermVec & out)
+{
+  while (peek().kind == TOK_LP)
+  {
+    advance();
+    string var(symbol("variable name"));
+    Sort var_sort = sort();
+    expect(TOK_RP, "')' to end the sorted variable");
+    out.push_back(params ? reader_.create_param(var, var_sort)
+                         : reader_.register_arg(var, var_sort));
+  }
+  expect(TOK_RP, "')' to end the sorted variables");
+}
+
+pair<string, string> SmtLibDirectParser::attribute()
+{
+  SmtLibToken key = advance();
+  if (key.kind != TOK_KEYWORD)
+  {
+    syntax_error("Expected a keyword, got " + describe(key));
+  }
+  pair<string, string> res(key.text, "");
+  SmtLibTokenKind next = peek().kind;
+  if (next != TOK_KEYWORD && next != TOK_RP)
+  {
+    res.second = s_expr();
+  }
+  return res;
+}
+
+string SmtLibDirectParser::s_expr()
+{
+  // concatenated like the bison parser does, without separators
+  string res;
+  size_t depth = 0;
+  do
+  {
+    SmtLibToken tok = advance();
+    switch (tok.kind)
+    {
+      case TOK_LP:
+      {
+        res += '(';
+        ++depth;
+        break;
+      }
+      case TOK_RP:
+      {
+        if (!depth)
+        {
+          syntax_error("Expected an attribute value, got ')'");
+        }
+        res += ')';
+        --depth;
+        break;
+      }
+      case TOK_EOF:
+      case TOK_KEYWORD:
+      {
+        syntax_error("Unexpected " + describe(tok) + " in attribute value");
+      }
+      default: res.append(tok.text.data(), tok.text.size());
+    }
+  } while (depth);
+  return res;
+}
+
+void SmtLibDirectParser::refill()
+{
+  tok_end_ = lexer_->next(toks_, TOKEN_BUFFER);
+  tok_pos_ = 0;
+}
+
+void SmtLibDirectParser::expect(SmtLibTokenKind kind, const char * what)
+{
+  SmtLibToken tok = advance();
+  if (tok.kind != kind)
+  {
+    syntax_error(string("Expected ") + what + ", got " + describe(tok));
+  }
+}
+
+string_view SmtLibDirectParser::symbol(const char * what)
+{
+  SmtLibToken tok = advance();
+  if (tok.kind != TOK_SYMBOL && tok.kind != TOK_QUOTED_SYMBOL)
+  {
+    syntax_error(string("Expected a ") + what + ", got " + describe(tok));
+  }
+  return tok.text;
+}
+
+uint64_t SmtLibDirectParser::numeral(const char * what)
+{
+  SmtLibToken tok = advance();
+  if (tok.kind != TOK_NUMERAL)
+  {
+    syntax_error(string("Expected a numeral ") + what + ", got "
+                 + describe(tok));
+  }
+  uint64_t res = 0;
+  for (char c : tok.text)
+  {
+    if (res > (UINT64_MAX - 9) / 10)
+    {
+      syntax_error(string("Numeral ") + what + " is too large: "
+                   + string(tok.text));
+    }
+    res = res * 10 + (c - '0');
+  }
+  return res;
+}
+
+void SmtLibDirectParser::syntax_error(const string & msg)
+{
+  throw SyntaxError(msg);
+}
+
+Sort SmtLibDirectParser::bv_sort(uint64_t width)
+{
+  Sort & res = bv_sorts_[width];
+  if (!res)
+  {
+    res = solver_->make_sort(BV, width);
+  }
+  return res;
+}
+
+Sort SmtLibDirectParser::int_sort()
+{
+  if (!int_sort_)
+  {
+    int_sort_ = solver_->make_sort(INT);
+  }
+  return int_sort_;
+}
+
+}  // namespace smt
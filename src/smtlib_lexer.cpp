@@ -0,0 +1,629 @@
+/*********************                                                        */
+/*! \file smtlib_lexer.cpp
+** \verbatim
+** Top contributors (to current version):
+**   agent
+** This file is part of the smt-switch project.
+** Copyright (c) 2026 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved.  See the file LICENSE in the top-level source
+** directory for licensing information.\endverbatim
+**
+** \brief A hand-written SMT-LIB lexer over an in-memory buffer.
+**
+**        The tokens point into the buffer (no copies). The input is
+**        classified 64 bytes at a time with SSE4.2 or AVX2 when the CPU
+**        supports it, and the token boundaries are found with bit
+**        operations on the resulting masks.
+**
+**/
+
+#include "smtlib_lexer.h"
+
+#include <string>
+
+#include "exceptions.h"
+
+// the vector kernels are compiled with target attributes and selected at
+// runtime, so the library itself does not need to be built with -mavx2
+#if (defined(__x86_64__) || defined(__i386__)) \
+    && (defined(__GNUC__) || defined(__clang__))
+#define SMTLIB_LEXER_X86
+#include <immintrin.h>
+#endif
+
+using namespace std;
+
+namespace smt {
+
+namespace {
+
+enum CharClass : uint8_t
+{
+  CLASS_SPACE = 1,
+  CLASS_SYMBOL = 2  ///< may appear in a simple symbol, numeral, #b, :key...
+};
+
+constexpr bool in_symbol_class(unsigned char c)
+{
+  if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z')
+      || (c >= '0' && c <= '9'))
+  {
+    return true;
+  }
+  for (const char * s = "~!@$%^&*+=<>.?/_-#:"; *s; ++s)
+  {
+    if (c == (unsigned char)*s)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+constexpr bool in_space_class(unsigned char c)
+{
+  return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+/** The classes of all bytes, and the low nibble tables of the vector
+ *  kernels: bit h of lo[l] is set iff the byte h * 16 + l is in the
+ *  class. The high nibble table maps h to 1 << h (0 for non-ASCII), so
+ *  lo[c & 0xf] & hi[c >> 4] is non-zero iff c is in the class.
+ */
+struct Tables
+{
+  uint8_t cls[256];
+  uint8_t space_lo[16];
+  uint8_t symbol_lo[16];
+};
+
+constexpr Tables make_tables()
+{
+  Tables t{};
+  for (unsigned c = 0; c < 256; ++c)
+  {
+    t.cls[c] = (in_space_class(c) ? CLASS_SPACE : 0)
+               | (in_symbol_class(c) ? CLASS_SYMBOL : 0);
+    if (c < 128)
+    {
+      uint8_t bit = 1 << (c >> 4);
+      t.space_lo[c & 0xf] |= in_space_class(c) ? bit : 0;
+      t.symbol_lo[c & 0xf] |= in_symbol_class(c) ? bit : 0;
+    }
+  }
+  return t;
+}
+
+constexpr Tables tables = make_tables();
+
+inline bool is_delimiter(char c)
+{
+  return (tables.cls[(unsigned char)c] & CLASS_SPACE) || c == '('
+         || c == ')' || c == ';' || c == '"' || c == '|';
+}
+
+#if defined(__GNUC__) || defined(__clang__)
+#define LEXER_NOINLINE __attribute__((noinline))
+#else
+#define LEXER_NOINLINE
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+inline unsigned ctz64(uint64_t x) { return __builtin_ctzll(x); }
+inline unsigned popcount64(uint64_t x) { return __builtin_popcountll(x); }
+#else
+inline unsigned ctz64(uint64_t x)
+{
+  unsigned n = 0;
+  for (; !(x & 1); x >>= 1)
+  {
+    ++n;
+  }
+  return n;
+}
+inline unsigned popcount64(uint64_t x)
+{
+  unsigned n = 0;
+  for (; x; x &= x - 1)
+  {
+    ++n;
+  }
+  return n;
+}
+#endif
+
+[[noreturn]] LEXER_NOINLINE void lexer_error(const string & msg,
+                                             uint64_t line)
+{
+  throw SmtException("SMT-LIB lexer error on line " + std::to_string(line)
+                     + ": " + msg);
+}
+
+/** Every kernel set provides
+ *    skip_space(st, p): the first byte at or after p that is not
+ *      whitespace (or the end), counting the newlines skipped
+ *    skip_symbol(st, p): the first byte at or after p that is not a
+ *      symbol character (or the end)
+ *    find(p, end, c0, c1, lines): the first c0 or c1 at or after p (or
+ *      end), counting the newlines skipped -- used for the comments,
+ *      quoted symbols and strings, which are usually longer than a block
+ *  The vector kernels also provide classify(st), which fills the masks of
+ *  st for the 64 bytes from st.block (the bytes past the end are in no
+ *  class), and skip with the masks (see BlockSkips).
+ */
+struct ScalarKernels
+{
+  static inline const char * skip_space(SmtLibLexerState & st,
+                                        const char * p)
+  {
+    while (p < st.end && (tables.cls[(unsigned char)*p] & CLASS_SPACE))
+    {
+      st.line += *p == '\n';
+      ++p;
+    }
+    return p;
+  }
+
+  static inline const char * skip_symbol(SmtLibLexerState & st,
+                                         const char * p)
+  {
+    while (p < st.end && (tables.cls[(unsigned char)*p] & CLASS_SYMBOL))
+    {
+      ++p;
+    }
+    return p;
+  }
+
+  /** the tail of a block for the vector kernels */
+  static inline void classify(SmtLibLexerState & st)
+  {
+    uint64_t space = 0, symbol = 0, newline = 0;
+    size_t n = st.end - st.block < 64 ? st.end - st.block : 64;
+    for (size_t i = 0; i < n; ++i)
+    {
+      uint8_t c = tables.cls[(unsigned char)st.block[i]];
+      space |= uint64_t(c & CLASS_SPACE) << i;
+      symbol |= uint64_t((c & CLASS_SYMBOL) >> 1) << i;
+      newline |= uint64_t(st.block[i] == '\n') << i;
+    }
+    st.space = space;
+    st.symbol = symbol;
+    st.newline = newline;
+  }
+
+  static inline const char * find(
+      const char * p, const char * end, char c0, char c1, uint64_t & lines)
+  {
+    while (p < end && *p != c0 && *p != c1)
+    {
+      lines += *p == '\n';
+      ++p;
+    }
+    return p;
+  }
+};
+
+/** skip_space and skip_symbol of the vector kernels K, with the masks
+ *  of the current block
+ */
+template <class K>
+struct BlockSkips
+{
+  /** @return the offset of p in the block of st, classifying a new block
+   *  from p if p is not in the current one
+   */
+  static inline size_t block_offset(SmtLibLexerState & st, const char * p)
+  {
+    size_t off = p - st.block;
+    if (off >= 64)
+    {
+      st.block = p;
+      K::classify(st);
+      off = 0;
+    }
+    return off;
+  }
+
+  static inline const char * skip_space(SmtLibLexerState & st,
+                                        const char * p)
+  {
+    while (p < st.end)
+    {
+      size_t off = block_offset(st, p);
+      uint64_t stop = ~st.space >> off;
+      uint64_t nl = st.newline >> off;
+      if (stop)
+      {
+        unsigned k = ctz64(stop);
+        st.line += popcount64(nl & ((uint64_t(1) << k) - 1));
+        return p + k;
+      }
+      st.line += popcount64(nl);
+      p = st.block + 64;
+    }
+    return st.end;
+  }
+
+  static inline const char * skip_symbol(SmtLibLexerState & st,
+                                         const char * p)
+  {
+    while (p < st.end)
+    {
+      size_t off = block_offset(st, p);
+      uint64_t stop = ~st.symbol >> off;
+      if (stop)
+      {
+        return p + ctz64(stop);
+      }
+      p = st.block + 64;
+    }
+    return st.end;
+  }
+};
+
+#ifdef SMTLIB_LEXER_X86
+
+#define TARGET_SSE42 __attribute__((target("sse4.2,popcnt")))
+#define TARGET_AVX2 __attribute__((target("avx2,popcnt")))
+
+struct Sse42Kernels : public BlockSkips<Sse42Kernels>
+{
+  /** @return a bit per byte of v, set iff the byte is in the class */
+  TARGET_SSE42 static inline uint64_t in_class(__m128i v, __m128i lo_table)
+  {
+    const __m128i hi_table =
+        _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m128i nibble = _mm_set1_epi8(0x0f);
+    __m128i lo = _mm_shuffle_epi8(lo_table, _mm_and_si128(v, nibble));
+    __m128i hi = _mm_shuffle_epi8(
+        hi_table, _mm_and_si128(_mm_srli_epi16(v, 4), nibble));
+    __m128i out = _mm_cmpeq_epi8(_mm_and_si128(lo, hi), _mm_setzero_si128());
+    return ~_mm_movemask_epi8(out) & 0xffff;
+  }
+
+  TARGET_SSE42 static inline uint64_t equal(__m128i v, char c)
+  {
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8(c)));
+  }
+
+  TARGET_SSE42 static inline void classify(SmtLibLexerState & st)
+  {
+    if (st.end - st.block < 64)
+    {
+      ScalarKernels::classify(st);
+      return;
+    }
+    const __m128i space_table =
+        _mm_loadu_si128((const __m128i *)tables.space_lo);
+    const __m128i symbol_table =
+        _mm_loadu_si128((const __m128i *)tables.symbol_lo);
+    uint64_t space = 0, symbol = 0, newline = 0;
+    for (size_t i = 0; i < 64; i += 16)
+    {
+      __m128i v = _mm_loadu_si128((const __m128i *)(st.block + i));
+      space |= in_class(v, space_table) << i;
+      symbol |= in_class(v, symbol_table) << i;
+      newline |= equal(v, '\n') << i;
+    }
+    st.space = space;
+    st.symbol = symbol;
+    st.newline = newline;
+  }
+
+  TARGET_SSE42 static inline const char * find(
+      const char * p, const char * end, char c0, char c1, uint64_t & lines)
+  {
+    while (end - p >= 16)
+    {
+      __m128i v = _mm_loadu_si128((const __m128i *)p);
+      uint32_t stop = equal(v, c0) | equal(v, c1);
+      uint32_t nl = equal(v, '\n');
+      if (stop)
+      {
+        unsigned k = __builtin_ctz(stop);
+        lines += __builtin_popcount(nl & ((1u << k) - 1));
+        return p + k;
+      }
+      lines += __builtin_popcount(nl);
+      p += 16;
+    }
+    return ScalarKernels::find(p, end, c0, c1, lines);
+  }
+};
+
+struct Avx2Kernels : public BlockSkips<Avx2Kernels>
+{
+  /** @return a bit per byte of v, set iff the byte is in the class */
+  TARGET_AVX2 static inline uint64_t in_class(__m256i v, __m256i lo_table)
+  {
+    // vpshufb looks up each 128-bit lane separately, so the tables are
+    // repeated in both lanes
+    const __m256i hi_table = _mm256_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128,
+                                              0, 0, 0, 0, 0, 0, 0, 0,
+                                              1, 2, 4, 8, 16, 32, 64, -128,
+                                              0, 0, 0, 0, 0, 0, 0, 0);
+    const __m256i nibble = _mm256_set1_epi8(0x0f);
+    __m256i lo = _mm256_shuffle_epi8(lo_table, _mm256_and_si256(v, nibble));
+    __m256i hi = _mm256_shuffle_epi8(
+        hi_table, _mm256_and_si256(_mm256_srli_epi16(v, 4), nibble));
+    __m256i out =
+        _mm256_cmpeq_epi8(_mm256_and_si256(lo, hi), _mm256_setzero_si256());
+    return ~(uint32_t)_mm256_movemask_epi8(out);
+  }
+
+  TARGET_AVX2 static inline __m256i load_table(const uint8_t * lo)
+  {
+    return _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)lo));
+  }
+
+  TARGET_AVX2 static inline uint64_t equal(__m256i v, char c)
+  {
+    return (uint32_t)_mm256_movemask_epi8(
+        _mm256_cmpeq_epi8(v, _mm256_set1_epi8(c)));
+  }
+
+  TARGET_AVX2 static inline void classify(SmtLibLexerState & st)
+  {
+    if (st.end - st.block < 64)
+    {
+      ScalarKernels::classify(st);
+      return;
+    }
+    const __m256i space_table = load_table(tables.space_lo);
+    const __m256i symbol_table = load_table(tables.symbol_lo);
+    __m256i v0 = _mm256_loadu_si256((const __m256i *)st.block);
+    __m256i v1 = _mm256_loadu_si256((const __m256i *)(st.block + 32));
+    st.space = in_class(v0, space_table) | in_class(v1, space_table) << 32;
+    st.symbol = in_class(v0, symbol_table) | in_class(v1, symbol_table) << 32;
+    st.newline = equal(v0, '\n') | equal(v1, '\n') << 32;
+  }
+
+  TARGET_AVX2 static inline const char * find(
+      const char * p, const char * end, char c0, char c1, uint64_t & lines)
+  {
+    while (end - p >= 32)
+    {
+      __m256i v = _mm256_loadu_si256((const __m256i *)p);
+      uint32_t stop = equal(v, c0) | equal(v, c1);
+      uint32_t nl = equal(v, '\n');
+      if (stop)
+      {
+        unsigned k = __builtin_ctz(stop);
+        lines += __builtin_popcount(nl & ((1u << k) - 1));
+        return p + k;
+      }
+      lines += __builtin_popcount(nl);
+      p += 32;
+    }
+    return Sse42Kernels::find(p, end, c0, c1, lines);
+  }
+};
+
+#endif  // SMTLIB_LEXER_X86
+
+/** Classifies a run of symbol characters */
+inline SmtLibToken make_atom(const char * p, size_t n, uint64_t line)
+{
+  auto all_of = [](const char * s, const char * e, bool (*pred)(char)) {
+    for (; s < e; ++s)
+    {
+      if (!pred(*s))
+      {
+        return false;
+      }
+    }
+    return true;
+  };
+  auto digit = [](char c) { return c >= '0' && c <= '9'; };
+  auto bin = [](char c) { return c == '0' || c == '1'; };
+  auto hex = [](char c) {
+    return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f')
+           || (c >= 'A' && c <= 'F');
+  };
+
+  const char * e = p + n;
+  if (digit(*p))
+  {
+    const char * dot = p;
+    while (dot < e && *dot != '.')
+    {
+      ++dot;
+    }
+    if (all_of(p, dot, digit)
+        && (dot == e || (dot + 1 < e && all_of(dot + 1, e, digit))))
+    {
+      return { dot == e ? TOK_NUMERAL : TOK_DECIMAL, string_view(p, n), line };
+    }
+  }
+  else if (*p == '#')
+  {
+    if (n > 2 && p[1] == 'b' && all_of(p + 2, e, bin))
+    {
+      return { TOK_BINARY, string_view(p + 2, n - 2), line };
+    }
+    else if (n > 2 && p[1] == 'x' && all_of(p + 2, e, hex))
+    {
+      return { TOK_HEX, string_view(p + 2, n - 2), line };
+    }
+  }
+  else if (*p == ':')
+  {
+    if (n > 1)
+    {
+      return { TOK_KEYWORD, string_view(p + 1, n - 1), line };
+    }
+  }
+  else
+  {
+    return { TOK_SYMBOL, string_view(p, n), line };
+  }
+  lexer_error("invalid token " + string(p, n), line);
+}
+
+template <class K>
+inline SmtLibToken lex(SmtLibLexerState & st)
+{
+  const char * end = st.end;
+  const char * p = K::skip_space(st, st.pos);
+  while (p < end && *p == ';')
+  {
+    // comment until the end of the line
+    p = K::find(p, end, '\n', '\n', st.line);
+    p = K::skip_space(st, p);
+  }
+
+  if (p == end)
+  {
+    st.pos = p;
+    return { TOK_EOF, string_view(), st.line };
+  }
+
+  uint64_t start_line = st.line;
+  switch (*p)
+  {
+    case '(':
+    {
+      st.pos = p + 1;
+      return { TOK_LP, string_view(p, 1), start_line };
+    }
+    case ')':
+    {
+      st.pos = p + 1;
+      return { TOK_RP, string_view(p, 1), start_line };
+    }
+    case '|':
+    {
+      const char * q = K::find(p + 1, end, '|', '|', st.line);
+      if (q == end)
+      {
+        lexer_error("unterminated quoted symbol", start_line);
+      }
+      st.pos = q + 1;
+      return { TOK_QUOTED_SYMBOL, string_view(p + 1, q - p - 1), start_line };
+    }
+    case '"':
+    {
+      // both \" and the SMT-LIB 2.6 "" escape a quote
+      const char * q = p + 1;
+      while (true)
+      {
+        q = K::find(q, end, '"', '\\', st.line);
+        if (q == end || (*q == '\\' && q + 1 == end))
+        {
+          lexer_error("unterminated string literal", start_line);
+        }
+        else if (*q == '\\' || (q + 1 < end && q[1] == '"'))
+        {
+          st.line += q[1] == '\n';
+          q += 2;
+        }
+        else
+        {
+          break;
+        }
+      }
+      st.pos = q + 1;
+      return { TOK_STRING, string_view(p + 1, q - p - 1), start_line };
+    }
+    default:
+    {
+      const char * q = K::skip_symbol(st, p);
+      if (q == p || (q < end && !is_delimiter(*q)))
+      {
+        lexer_error(string("invalid character '") + *q + "'", start_line);
+      }
+      st.pos = q;
+      return make_atom(p, q - p, start_line);
+    }
+  }
+}
+
+template <class K>
+inline size_t lex_tokens(SmtLibLexerState & st, SmtLibToken * out, size_t n)
+{
+  size_t i = 0;
+  while (i < n)
+  {
+    out[i] = lex<K>(st);
+    if (out[i++].kind == TOK_EOF)
+    {
+      break;
+    }
+  }
+  return i;
+}
+
+size_t lex_scalar(SmtLibLexerState & st, SmtLibToken * out, size_t n)
+{
+  return lex_tokens<ScalarKernels>(st, out, n);
+}
+
+#ifdef SMTLIB_LEXER_X86
+
+// flatten inlines the kernels, which is only allowed in a caller compiled
+// for the same target
+__attribute__((target("sse4.2,popcnt"), flatten)) size_t lex_sse42(
+    SmtLibLexerState & st, SmtLibToken * out, size_t n)
+{
+  return lex_tokens<Sse42Kernels>(st, out, n);
+}
+
+__attribute__((target("avx2,popcnt"), flatten)) size_t lex_avx2(
+    SmtLibLexerState & st, SmtLibToken * out, size_t n)
+{
+  return lex_tokens<Avx2Kernels>(st, out, n);
+}
+
+#endif  // SMTLIB_LEXER_X86
+
+}  // namespace
+
+SmtLibLexer::SmtLibLexer(const char * data, size_t size, SmtLibLexerIsa isa)
+    : state_({ data, data + size, 1, data + size, 0, 0, 0 }),
+      isa_(isa < best_isa() ? isa : best_isa())
+{
+}
+
+SmtLibToken SmtLibLexer::next()
+{
+  SmtLibToken tok;
+  next(&tok, 1);
+  return tok;
+}
+
+size_t SmtLibLexer::next(SmtLibToken * out, size_t n)
+{
+  switch (isa_)
+  {
+#ifdef SMTLIB_LEXER_X86
+    case LEXER_AVX2: return lex_avx2(state_, out, n);
+    case LEXER_SSE42: return lex_sse42(state_, out, n);
+#endif
+    default: return lex_scalar(state_, out, n);
+  }
+}
+
+SmtLibLexerIsa SmtLibLexer::best_isa()
+{
+#ifdef SMTLIB_LEXER_X86
+  static const SmtLibLexerIsa best = []() {
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt"))
+    {
+      return LEXER_AVX2;
+    }
+    else if (__builtin_cpu_supports("sse4.2")
+             && __builtin_cpu_supports("popcnt"))
+    {
+      return LEXER_SSE42;
+    }
+    return LEXER_SCALAR;
+  }();
+  return best;
+#else
+  return LEXER_SCALAR;
+#endif
+}
+
+}  // namespace smt
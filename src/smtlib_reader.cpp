@@ -19,6 +19,7 @@
 #include "assert.h"
 #include "smtlibparser.h"
 #include "smtlibparser_maps.h"
+#include "trace.h"
 
 using namespace std;
 
@@ -59,6 +60,7 @@ SmtLibReader::SmtLibReader(smt::SmtSolver & solver, bool strict)
       strict_(strict),
       logic_("UNSET"),
       allow_ufs_(false),
+      memoize_define_funs_(true),
       def_arg_prefix_("__defvar_"),
       // logic always includes core theory
       primops_(strict_theory2opmap.at("Core")),
@@ -73,6 +75,7 @@ SmtLibReader::SmtLibReader(smt::SmtSolver & solver, bool strict)
 
 int SmtLibReader::parse(const std::string & f)
 {
+  SMT_TRACE_SPAN("SmtLibReader::parse", "parser");
   file = f;
   location_.initialize(&file);
   scan_begin();
@@ -398,6 +401,18 @@ void SmtLibReader::define_fun(const string & name,
     // this is a function
     defs_[name] = def;
     def_args_[name] = args;
+
+    // precompile the substitution map once per definition
+    // (replaces any plan and cached applications from a previous definition)
+    DefineFunPlan & plan = def_plans_[name];
+    plan.def = def;
+    plan.args = args;
+    plan.subs.clear();
+    plan.applications.clear();
+    for (const auto & a : args)
+    {
+      plan.subs[a] = a;
+    }
   }
   else
   {
@@ -409,31 +424,58 @@ void SmtLibReader::define_fun(const string & name,
 Term SmtLibReader::apply_define_fun(const string & defname,
                                     const TermVec & args)
 {
-  UnorderedTermMap subs_map;
   size_t num_args = args.size();
   assert(num_args); // apply_define_fun only for defines which take arguments
 
-  auto it = defs_.find(defname);
+  auto it = def_plans_.find(defname);
 
-  if (it == defs_.end())
+  if (it == def_plans_.end())
   {
     throw SmtException("Unknown function: " + defname);
   }
 
-  Term def = it->second;
+  DefineFunPlan & plan = it->second;
 
-  if (num_args != def_args_.at(defname).size())
+  if (num_args != plan.args.size())
   {
     throw SmtException(defname
                        + " not applied to correct number of arguments.");
   }
 
-  for (size_t i = 0; i < args.size(); ++i)
+  if (memoize_define_funs_)
+  {
+    auto app_it = plan.applications.find(args);
+    if (app_it != plan.applications.end())
+    {
+      return app_it->second;
+    }
+  }
+
+  // keys are fixed at definition time, so this only overwrites values
+  for (size_t i = 0; i < num_args; ++i)
   {
-    subs_map[def_args_.at(defname)[i]] = args[i];
+    plan.subs[plan.args[i]] = args[i];
   }
 
-  return solver_->substitute(def, subs_map);
+  Term res = solver_->substitute(plan.def, plan.subs);
+
+  if (memoize_define_funs_)
+  {
+    plan.applications[args] = res;
+  }
+  return res;
+}
+
+void SmtLibReader::set_memoize_define_funs(bool memoize)
+{
+  memoize_define_funs_ = memoize;
+  if (!memoize)
+  {
+    for (auto & elem : def_plans_)
+    {
+      elem.second.applications.clear();
+    }
+  }
 }
 
 Term SmtLibReader::register_arg(const string & name, const Sort & sort)
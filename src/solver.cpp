@@ -23,26 +23,38 @@ namespace smt {
 
 // TODO: Implement a generic visitor
 
+// backends override these to avoid the copy into a TermVec
+
 Result AbsSmtSolver::check_sat_assuming_list(const TermList & assumptions)
 {
-  throw NotImplementedException(
-      "check_sat_assuming_list not implemented by default");
+  return check_sat_assuming(TermVec(assumptions.begin(), assumptions.end()));
 }
 
 Result AbsSmtSolver::check_sat_assuming_set(
     const UnorderedTermSet & assumptions)
+{
+  return check_sat_assuming(TermVec(assumptions.begin(), assumptions.end()));
+}
+
+Sort AbsSmtSolver::make_unresolved_sort(const DatatypeDecl &) const
 {
   throw NotImplementedException(
-      "check_sat_assuming_set not implemented by default");
+      "make_unresolved_sort for mutually recursive datatypes not yet "
+      "implemented by "
+      + to_string(solver_enum));
 }
 
 SortVec AbsSmtSolver::make_datatype_sorts(
     const std::vector<DatatypeDecl> & decls) const
 {
-  throw NotImplementedException(
-      "make_datatype_sorts for mutually recursive datatypes not yet implementd "
-      "by "
-      + to_string(solver_enum));
+  // no mutual recursion: the datatypes can be created one at a time
+  SortVec dt_sorts;
+  dt_sorts.reserve(decls.size());
+  for (const auto & d : decls)
+  {
+    dt_sorts.push_back(make_sort(d));
+  }
+  return dt_sorts;
 }
 
 Sort AbsSmtSolver::make_datatype_sort(const DatatypeDecl & decl) const
@@ -55,57 +67,87 @@ Sort AbsSmtSolver::make_datatype_sort(const DatatypeDecl & decl) const
 Term AbsSmtSolver::substitute(const Term term,
                               const UnorderedTermMap & substitution_map) const
 {
-  // cache starts with the substitutions
-  UnorderedTermMap cache(substitution_map);
-  TermVec to_visit{ term };
+  return substitute_terms({ term }, substitution_map)[0];
+}
+
+TermVec AbsSmtSolver::substitute_terms(
+    const TermVec & terms, const UnorderedTermMap & substitution_map) const
+{
+  // one walk over the union of the DAGs, with one cache
+  // the substitution map is consulted first instead of being copied
+  // into the cache. A null cache entry marks a term as visited but not
+  // yet rebuilt.
+  UnorderedTermMap cache;
+  auto lookup = [&](const Term & t) -> const Term & {
+    auto it = substitution_map.find(t);
+    return it != substitution_map.end() ? it->second : cache.at(t);
+  };
+
+  TermVec to_visit(terms.rbegin(), terms.rend());
   TermVec cached_children;
   Term t;
   while (to_visit.size())
   {
     t = to_visit.back();
-    to_visit.pop_back();
-    if (cache.find(t) == cache.end())
+    if (substitution_map.find(t) != substitution_map.end())
     {
-      // doesn't get updated yet, just marking as visited
-      cache[t] = t;
-      to_visit.push_back(t);
-      for (auto c : t)
-      {
-        to_visit.push_back(c);
-      }
+      to_visit.pop_back();
+      continue;
     }
-    else
+
+    auto it = cache.find(t);
+    if (it == cache.end())
     {
-      cached_children.clear();
+      cache.emplace(t, Term());
       for (auto c : t)
       {
-        cached_children.push_back(cache.at(c));
+        if (substitution_map.find(c) == substitution_map.end()
+            && cache.find(c) == cache.end())
+        {
+          to_visit.push_back(c);
+        }
       }
+      continue;
+    }
 
-      // const arrays have children but don't need to be rebuilt
-      // (they're constructed in a particular way anyway)
-      if (cached_children.size() && !t->is_value())
-      {
-        cache[t] = make_term(t->get_op(), cached_children);
-      }
+    to_visit.pop_back();
+    if (it->second)
+    {
+      continue;
     }
-  }
 
-  return cache.at(term);
-}
+    bool changed = false;
+    cached_children.clear();
+    for (auto c : t)
+    {
+      const Term & sc = lookup(c);
+      changed |= sc != c;
+      cached_children.push_back(sc);
+    }
+
+    // const arrays have children but don't need to be rebuilt
+    // (they're constructed in a particular way anyway)
+    // unchanged subterms are shared with the input
+    it->second =
+        (changed && !t->is_value()) ? make_term(t->get_op(), cached_children)
+                                    : t;
+  }
 
-TermVec AbsSmtSolver::substitute_terms(
-    const TermVec & terms, const UnorderedTermMap & substitution_map) const
-{
   TermVec res;
   res.reserve(terms.size());
-  for (auto t : terms)
+  for (const auto & term : terms)
   {
-    res.push_back(substitute(t, substitution_map));
+    res.push_back(lookup(term));
   }
   return res;
 }
 
+void AbsSmtSolver::get_bv_value(const Term & t,
+                                std::vector<uint64_t> & out) const
+{
+  get_value(t)->to_bv_words(out);
+}
+
 Result AbsSmtSolver::get_sequence_interpolants(const TermVec & formulae,
                                                TermVec & out_I) const
 {
@@ -178,4 +220,11 @@ Result AbsSmtSolver::get_sequence_interpolants(const TermVec & formulae,
   }
 }
 
+MemoryStats AbsSmtSolver::get_memory_stats() const
+{
+  MemoryStats stats;
+  stats.rss_kb = current_rss_kb();
+  return stats;
+}
+
 }  // namespace smt
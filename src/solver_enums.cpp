@@ -34,7 +34,9 @@ const unordered_map<SolverEnum, unordered_set<SolverAttribute>>
             CONSTARR,
             UNSAT_CORE,
             QUANTIFIERS,
-            BOOL_BV1_ALIASING } },
+            BOOL_BV1_ALIASING,
+            CONCURRENT_INSTANCES,
+            INTERNED_TERMS } },
 
         { BZLA,
           { TERMITER,
@@ -47,7 +49,8 @@ const unordered_map<SolverEnum, unordered_set<SolverAttribute>>
             //      https://github.com/bitwuzla/bitwuzla/commit/605f31557ec6c635e3c617d2b0ab257309e994c4
             // QUANTIFIERS,
             BOOL_BV1_ALIASING,
-            TIMELIMIT } },
+            TIMELIMIT,
+            CONCURRENT_INSTANCES } },
 
         { CVC5,
           { TERMITER,
@@ -62,7 +65,8 @@ const unordered_map<SolverEnum, unordered_set<SolverAttribute>>
             THEORY_DATATYPE,
             QUANTIFIERS,
             UNINTERP_SORT,
-            PARAM_UNINTERP_SORT } },
+            PARAM_UNINTERP_SORT,
+            CONCURRENT_INSTANCES } },
 
         { GENERIC_SOLVER,
           { TERMITER,
@@ -72,7 +76,8 @@ const unordered_map<SolverEnum, unordered_set<SolverAttribute>>
             ARRAY_FUN_BOOLS,
             UNSAT_CORE,
             THEORY_DATATYPE,
-            QUANTIFIERS } },
+            QUANTIFIERS,
+            CONCURRENT_INSTANCES } },
 
         { MSAT,
           { TERMITER,
@@ -84,8 +89,12 @@ const unordered_map<SolverEnum, unordered_set<SolverAttribute>>
             FULL_TRANSFER,
             UNSAT_CORE,
             QUANTIFIERS,
-            UNINTERP_SORT } },
+            UNINTERP_SORT,
+            CONCURRENT_INSTANCES,
+            INTERNED_TERMS } },
 
+        // Yices2 keeps its terms in global tables, so instances
+        // can't be used concurrently
         // TODO: Yices2 should support UNSAT_CORE
         //       but something funky happens with testing
         //       has something to do with the context and yices_init
@@ -109,7 +118,10 @@ const unordered_map<SolverEnum, unordered_set<SolverAttribute>>
             UNSAT_CORE,
             QUANTIFIERS,
             UNINTERP_SORT,
-            TIMELIMIT } },
+            THEORY_DATATYPE,
+            TIMELIMIT,
+            CONCURRENT_INSTANCES,
+            INTERNED_TERMS } },
 
     });
 
@@ -181,6 +193,8 @@ std::ostream & operator<<(std::ostream & o, SolverAttribute a)
     case THEORY_DATATYPE: o << "THEORY_DATATYPE"; break;
     case QUANTIFIERS: o << "QUANTIFIERS"; break;
     case BOOL_BV1_ALIASING: o << "BOOL_BV1_ALIASING"; break;
+    case CONCURRENT_INSTANCES: o << "CONCURRENT_INSTANCES"; break;
+    case INTERNED_TERMS: o << "INTERNED_TERMS"; break;
     default:
       // should print the integer representation
       throw NotImplementedException("Unknown SolverAttribute: "
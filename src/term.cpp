@@ -16,6 +16,10 @@
 
 #include "term.h"
 
+#include "exceptions.h"
+#include "sort.h"
+#include "utils.h"
+
 namespace smt {
 
 std::ostream & operator<<(std::ostream & output, const Term t)
@@ -24,6 +28,17 @@ std::ostream & operator<<(std::ostream & output, const Term t)
   return output;
 }
 
+void AbsTerm::to_bv_words(std::vector<uint64_t> & out)
+{
+  Sort sort = get_sort();
+  if (!is_value() || sort->get_sort_kind() != BV)
+  {
+    throw IncorrectUsageException(
+        "Can only convert bit-vector values to words, got " + to_string());
+  }
+  bv_string_to_words(to_string(), sort->get_width(), out);
+}
+
 /* TermIterBase implementation */
 const Term TermIterBase::operator*()
 {
@@ -0,0 +1,172 @@
+/*********************                                                        */
+/*! \file term_dag_builder.cpp
+** \verbatim
+** Top contributors (to current version):
+**   agent
+** This file is part of the smt-switch project.
+** Copyright (c) 2026 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved.  See the file LICENSE in the top-level source
+** directory for licensing information.\endverbatim
+**
+** \brief Builds a whole serialized term DAG with one call, for frontends
+**        where every call into the library is expensive (e.g. Python).
+**
+**/
+
+#include "term_dag_builder.h"
+
+#include "exceptions.h"
+
+using namespace std;
+
+namespace smt {
+
+size_t TermDagBuilder::build(const TermDag & dag)
+{
+  const vector<int64_t> & code = dag.code;
+  size_t first = terms_.size();
+  size_t pos = 0;
+
+  auto next = [&code, &pos]() {
+    if (pos >= code.size())
+    {
+      throw IncorrectUsageException("Truncated node in TermDag");
+    }
+    return code[pos++];
+  };
+  auto index = [&next](size_t size, const char * what) {
+    int64_t i = next();
+    if (i < 0 || (size_t)i >= size)
+    {
+      throw IncorrectUsageException(string("Invalid ") + what
+                                    + " index in TermDag: "
+                                    + std::to_string(i));
+    }
+    return (size_t)i;
+  };
+
+  TermVec children;
+  try
+  {
+    while (pos < code.size())
+    {
+      int64_t kind = next();
+      switch (kind)
+      {
+        case DAG_OP:
+        {
+          int64_t po = next();
+          if (po < 0 || po >= NUM_OPS_AND_NULL)
+          {
+            throw IncorrectUsageException("Invalid PrimOp in TermDag: "
+                                          + std::to_string(po));
+          }
+          Op op((PrimOp)po);
+          int64_t num_idx = next();
+          if (num_idx == 1)
+          {
+            op = Op((PrimOp)po, next());
+          }
+          else if (num_idx == 2)
+          {
+            int64_t idx0 = next();
+            op = Op((PrimOp)po, idx0, next());
+          }
+          else if (num_idx)
+          {
+            throw IncorrectUsageException(
+                "Invalid number of indices in TermDag: "
+                + std::to_string(num_idx));
+          }
+
+          int64_t num_children = next();
+          children.clear();
+          for (int64_t i = 0; i < num_children; ++i)
+          {
+            children.push_back(terms_[index(terms_.size(), "child")]);
+          }
+          terms_.push_back(solver_->make_term(op, children));
+          break;
+        }
+        case DAG_SYMBOL:
+        {
+          size_t str = index(dag.strings.size(), "string");
+          const string & name = dag.strings[str];
+          const Sort & sort = dag.sorts[index(dag.sorts.size(), "sort")];
+          // the symbol may be left over from a DAG that was dropped
+          Term sym;
+          try
+          {
+            sym = solver_->get_symbol(name);
+          }
+          catch (IncorrectUsageException & e)
+          {
+            sym = solver_->make_symbol(name, sort);
+          }
+          if (sym->get_sort() != sort)
+          {
+            throw IncorrectUsageException("Symbol " + name
+                                          + " already declared with sort "
+                                          + sym->get_sort()->to_string());
+          }
+          terms_.push_back(sym);
+          break;
+        }
+        case DAG_VALUE:
+        {
+          size_t str = index(dag.strings.size(), "string");
+          const string & val = dag.strings[str];
+          const Sort & sort = dag.sorts[index(dag.sorts.size(), "sort")];
+          terms_.push_back(solver_->make_term(val, sort));
+          break;
+        }
+        case DAG_BOOL:
+        {
+          terms_.push_back(solver_->make_term((bool)next()));
+          break;
+        }
+        case DAG_CONST_ARRAY:
+        {
+          const Sort & sort = dag.sorts[index(dag.sorts.size(), "sort")];
+          const Term & val = terms_[index(terms_.size(), "child")];
+          terms_.push_back(solver_->make_term(val, sort));
+          break;
+        }
+        default:
+        {
+          throw IncorrectUsageException("Invalid node kind in TermDag: "
+                                        + std::to_string(kind));
+        }
+      }
+    }
+  }
+  catch (...)
+  {
+    terms_.resize(first);
+    throw;
+  }
+  return first;
+}
+
+const Term & TermDagBuilder::get_term(size_t id) const
+{
+  if (id >= terms_.size())
+  {
+    throw IncorrectUsageException("No TermDag node " + std::to_string(id));
+  }
+  return terms_[id];
+}
+
+vector<string> TermDagBuilder::get_values(const vector<size_t> & ids) const
+{
+  vector<string> res;
+  res.reserve(ids.size());
+  for (auto id : ids)
+  {
+    res.push_back(solver_->get_value(get_term(id))->to_string());
+  }
+  return res;
+}
+
+}  // namespace smt
@@ -17,6 +17,8 @@
 
 #include "term_hashtable.h"
 
+#include <algorithm>
+
 using namespace std;
 
 namespace smt {
@@ -61,4 +63,247 @@ void TermHashTable::erase(const Term & t)
 
 void TermHashTable::clear() { table.clear(); }
 
+size_t TermHashTable::size() const
+{
+  size_t res = 0;
+  for (const auto & elem : table)
+  {
+    res += elem.second.size();
+  }
+  return res;
+}
+
+/* WeakTermHashTable */
+
+WeakTermHashTable::WeakTermHashTable()
+    : size_(0), inserts_since_sweep_(0), live_after_sweep_(0)
+{
+}
+
+WeakTermHashTable::~WeakTermHashTable() {}
+
+void WeakTermHashTable::insert(const Term & t)
+{
+  vector<weak_ptr<AbsTerm>> & bucket = table[t->hash()];
+  size_t old_size = bucket.size();
+  bucket.erase(remove_if(bucket.begin(),
+                         bucket.end(),
+                         [](const weak_ptr<AbsTerm> & w) { return w.expired(); }),
+               bucket.end());
+  bucket.push_back(t);
+  size_ = size_ - old_size + bucket.size();
+
+  if (++inserts_since_sweep_ > std::max(MIN_SWEEP_INTERVAL, live_after_sweep_))
+  {
+    sweep();
+  }
+}
+
+bool WeakTermHashTable::contains(const Term & t) const
+{
+  auto it = table.find(t->hash());
+  if (it == table.end())
+  {
+    return false;
+  }
+  for (const auto & w : it->second)
+  {
+    Term e = w.lock();
+    if (e && e->compare(t))
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool WeakTermHashTable::lookup(Term & t)
+{
+  auto it = table.find(t->hash());
+  if (it == table.end())
+  {
+    return false;
+  }
+  for (const auto & w : it->second)
+  {
+    Term e = w.lock();
+    if (e && e->compare(t))
+    {
+      // reassign t
+      // should destroy the previous Term
+      // when reference counter goes to zero
+      t = e;
+      return true;
+    }
+  }
+  return false;
+}
+
+void WeakTermHashTable::clear()
+{
+  table.clear();
+  size_ = 0;
+  inserts_since_sweep_ = 0;
+  live_after_sweep_ = 0;
+}
+
+void WeakTermHashTable::sweep()
+{
+  size_ = 0;
+  for (auto it = table.begin(); it != table.end();)
+  {
+    vector<weak_ptr<AbsTerm>> & bucket = it->second;
+    bucket.erase(
+        remove_if(bucket.begin(),
+                  bucket.end(),
+                  [](const weak_ptr<AbsTerm> & w) { return w.expired(); }),
+        bucket.end());
+    if (bucket.empty())
+    {
+      it = table.erase(it);
+    }
+    else
+    {
+      size_ += bucket.size();
+      ++it;
+    }
+  }
+  inserts_since_sweep_ = 0;
+  live_after_sweep_ = size_;
+}
+
+size_t WeakTermHashTable::num_live() const
+{
+  size_t live = 0;
+  for (const auto & elem : table)
+  {
+    for (const auto & w : elem.second)
+    {
+      live += !w.expired();
+    }
+  }
+  return live;
+}
+
+/* TermInternTable */
+
+namespace {
+
+// the native handles are often consecutive ids or aligned pointers
+inline size_t slot_hash(uint64_t key)
+{
+  key ^= key >> 33;
+  key *= 0xff51afd7ed558ccdULL;
+  key ^= key >> 33;
+  return key;
+}
+
+}  // namespace
+
+TermInternTable::TermInternTable() : slots_(MIN_CAPACITY), used_(0) {}
+
+TermInternTable::~TermInternTable() {}
+
+Term TermInternTable::lookup(uint64_t key)
+{
+  Term res;
+  find(key, res);
+  return res;
+}
+
+size_t TermInternTable::num_live() const
+{
+  size_t live = 0;
+  for (const auto & s : slots_)
+  {
+    live += (s.key != EMPTY && !s.term.expired());
+  }
+  return live;
+}
+
+void TermInternTable::clear()
+{
+  slots_.assign(MIN_CAPACITY, Slot());
+  used_ = 0;
+}
+
+size_t TermInternTable::find(uint64_t key, Term & res)
+{
+  size_t mask = slots_.size() - 1;
+  size_t home = slot_hash(key) & mask;
+  // only compare the keys on the way, checking whether a wrapper
+  // expired touches its control block
+  size_t i = home;
+  for (; slots_[i].key != EMPTY; i = (i + 1) & mask)
+  {
+    if (slots_[i].key == key)
+    {
+      // a dead wrapper for the same key can be replaced in place
+      res = slots_[i].term.lock();
+      return i;
+    }
+  }
+
+  // not found, reuse the first dead slot before the empty one
+  for (size_t j = home; j != i; j = (j + 1) & mask)
+  {
+    if (slots_[j].term.expired())
+    {
+      return j;
+    }
+  }
+  return i;
+}
+
+void TermInternTable::insert_at(size_t idx, uint64_t key, const Term & t)
+{
+  Slot & s = slots_[idx];
+  if (s.key == EMPTY)
+  {
+    ++used_;
+  }
+  s.key = key;
+  s.term = t;
+  if (2 * used_ > slots_.size())
+  {
+    rehash();
+  }
+}
+
+void TermInternTable::rehash()
+{
+  vector<Slot> old;
+  old.swap(slots_);
+  size_t live = 0;
+  for (const auto & s : old)
+  {
+    live += (s.key != EMPTY && !s.term.expired());
+  }
+
+  size_t capacity = MIN_CAPACITY;
+  while (capacity < 4 * live)
+  {
+    capacity *= 2;
+  }
+  slots_.resize(capacity);
+  used_ = 0;
+
+  size_t mask = capacity - 1;
+  for (auto & s : old)
+  {
+    if (s.key == EMPTY || s.term.expired())
+    {
+      continue;
+    }
+    size_t i = slot_hash(s.key) & mask;
+    while (slots_[i].key != EMPTY)
+    {
+      i = (i + 1) & mask;
+    }
+    slots_[i].key = s.key;
+    slots_[i].term = std::move(s.term);
+    ++used_;
+  }
+}
+
 }  // namespace smt
@@ -0,0 +1,240 @@
+/*********************                                                        */
+/*! \file term_printer.cpp
+** \verbatim
+** Top contributors (to current version):
+**   agent
+** This file is part of the smt-switch project.
+** Copyright (c) 2026 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved.  See the file LICENSE in the top-level source
+** directory for licensing information.\endverbatim
+**
+** \brief SMT-LIB printing of terms that preserves the sharing of the DAG.
+**
+**        AbsTerm::to_string prints the fully expanded tree, which is
+**        exponential in the size of a DAG with a lot of sharing.
+**
+**/
+
+#include "term_printer.h"
+
+#include <unordered_map>
+#include <vector>
+
+#include "exceptions.h"
+
+using namespace std;
+
+namespace smt {
+
+namespace {
+
+/** Gets the children of t
+ *  @return false if the backend can't iterate over t (e.g. quantifiers in
+ *          z3), t is then printed with its own to_string
+ */
+bool get_children(const Term & t, TermVec & out)
+{
+  out.clear();
+  try
+  {
+    // begin first, it is the one that throws
+    TermIter it = t->begin();
+    out.assign(it, t->end());
+  }
+  catch (NotImplementedException & e)
+  {
+    return false;
+  }
+  return true;
+}
+
+/** Counts the parents of every non-leaf subterm of t
+ *  @param t the term to traverse
+ *  @param refs updated with the number of references to each subterm
+ *  @param order the non-leaf subterms that can be let-bound, in
+ *         post-order (children first). Subterms with a parameter are left
+ *         out, a let outside of the quantifier would not be in its scope.
+ */
+void count_refs(const Term & t,
+                unordered_map<Term, size_t> & refs,
+                TermVec & order)
+{
+  UnorderedTermSet visited;
+  UnorderedTermSet done;
+  UnorderedTermSet with_params;
+  TermVec to_visit({ t });
+  TermVec children;
+  while (!to_visit.empty())
+  {
+    Term cur = to_visit.back();
+    if (cur->get_op().is_null() || done.find(cur) != done.end())
+    {
+      to_visit.pop_back();
+    }
+    else if (visited.insert(cur).second)
+    {
+      if (!get_children(cur, children))
+      {
+        to_visit.pop_back();
+        done.insert(cur);
+        continue;
+      }
+      for (const Term & c : children)
+      {
+        ++refs[c];
+        to_visit.push_back(c);
+      }
+    }
+    else
+    {
+      to_visit.pop_back();
+      done.insert(cur);
+      bool has_param = false;
+      for (const Term & c : cur)
+      {
+        has_param |= c->is_param() || with_params.count(c);
+      }
+      if (has_param)
+      {
+        with_params.insert(cur);
+      }
+      else
+      {
+        order.push_back(cur);
+      }
+    }
+  }
+}
+
+/** Appends the SMT-LIB representation of t to out, using the names of
+ *  the let-bound subterms. Stops early once out is longer than
+ *  max_length (if non-zero).
+ */
+void print(const Term & t,
+           const unordered_map<Term, string> & names,
+           string & out,
+           size_t max_length)
+{
+  // a null term closes the application of the last open parenthesis
+  struct Item
+  {
+    Term term;
+    bool space;
+  };
+  vector<Item> to_print({ { t, false } });
+  TermVec children;
+  while (!to_print.empty())
+  {
+    if (max_length && out.size() > max_length)
+    {
+      return;
+    }
+
+    Item item = to_print.back();
+    to_print.pop_back();
+    if (!item.term)
+    {
+      out += ')';
+      continue;
+    }
+
+    if (item.space)
+    {
+      out += ' ';
+    }
+
+    auto it = names.find(item.term);
+    if (it != names.end())
+    {
+      out += it->second;
+      continue;
+    }
+
+    Op op = item.term->get_op();
+    if (op.is_null())
+    {
+      // symbols and values
+      out += item.term->to_string();
+      continue;
+    }
+
+    if (!get_children(item.term, children))
+    {
+      out += item.term->to_string();
+      continue;
+    }
+
+    out += '(';
+    if (op.prim_op == Forall || op.prim_op == Exists)
+    {
+      // (forall ((param sort)) body)
+      const Term & param = children[0];
+      out += op.to_string() + " ((" + param->to_string() + " "
+             + param->get_sort()->to_string() + "))";
+      to_print.push_back({ Term(), false });
+      to_print.push_back({ children[1], true });
+      continue;
+    }
+
+    // a function application is printed as (f args...)
+    bool apply = op.prim_op == Apply;
+    if (!apply)
+    {
+      out += op.to_string();
+    }
+    to_print.push_back({ Term(), false });
+    for (auto rit = children.rbegin(); rit != children.rend(); ++rit)
+    {
+      to_print.push_back({ *rit, true });
+    }
+    if (apply && !children.empty())
+    {
+      to_print.back().space = false;
+    }
+  }
+}
+
+}  // namespace
+
+string to_smtlib_string(const Term & t, bool use_lets, size_t max_length)
+{
+  string out;
+  unordered_map<Term, string> names;
+  size_t num_lets = 0;
+  if (use_lets)
+  {
+    unordered_map<Term, size_t> refs;
+    TermVec order;
+    count_refs(t, refs, order);
+    for (const Term & s : order)
+    {
+      if (s == t || refs[s] < 2)
+      {
+        continue;
+      }
+      if (max_length && out.size() > max_length)
+      {
+        break;
+      }
+
+      string name = "_let_" + std::to_string(num_lets++);
+      out += "(let ((" + name + " ";
+      print(s, names, out, max_length);
+      out += ")) ";
+      names[s] = name;
+    }
+  }
+
+  print(t, names, out, max_length);
+  out.append(num_lets, ')');
+
+  if (max_length && out.size() > max_length)
+  {
+    out.resize(max_length);
+    out += " ...";
+  }
+  return out;
+}
+
+}  // namespace smt
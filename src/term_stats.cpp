@@ -0,0 +1,232 @@
+/*********************                                                        */
+/*! \file term_stats.cpp
+** \verbatim
+** Top contributors (to current version):
+**   agent
+** This file is part of the smt-switch project.
+** Copyright (c) 2026 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved.  See the file LICENSE in the top-level source
+** directory for licensing information.\endverbatim
+**
+** \brief Single-pass statistics about term DAGs.
+**
+**/
+
+#include "term_stats.h"
+
+#include <algorithm>
+
+#include "term_printer.h"
+
+using namespace std;
+
+namespace smt {
+
+namespace {
+
+uint64_t saturating_add(uint64_t a, uint64_t b)
+{
+  return a > TermStats::saturated - b ? TermStats::saturated : a + b;
+}
+
+}  // namespace
+
+TermStats::TermStats() { clear(); }
+
+void TermStats::clear()
+{
+  info_.clear();
+  num_roots_ = 0;
+  tree_size_ = 0;
+  depth_ = 0;
+  op_counts_.fill(0);
+  sort_counts_.fill(0);
+  max_bv_width_ = 0;
+  num_symbols_ = 0;
+  num_values_ = 0;
+  nonlinear_ = false;
+}
+
+void TermStats::add(const Term & t)
+{
+  // iterative post-order, only new nodes are expanded
+  TermVec to_visit({ t });
+  while (to_visit.size())
+  {
+    Term x = to_visit.back();
+    auto it = info_.find(x);
+    if (it != info_.end() && it->second.tree_size)
+    {
+      to_visit.pop_back();
+      continue;
+    }
+
+    if (it == info_.end())
+    {
+      // first visit: mark as in progress and expand the children
+      info_.emplace(x, Info{ 0, 0 });
+      for (const auto & c : x)
+      {
+        auto cit = info_.find(c);
+        if (cit == info_.end())
+        {
+          to_visit.push_back(c);
+        }
+      }
+      continue;
+    }
+
+    // all children are done
+    to_visit.pop_back();
+    Info info{ 1, 0 };
+    for (const auto & c : x)
+    {
+      const Info & ci = info_.at(c);
+      info.tree_size = saturating_add(info.tree_size, ci.tree_size);
+      info.depth = std::max(info.depth, ci.depth + 1);
+    }
+    it->second = info;
+    count(x);
+  }
+
+  const Info & root = info_.at(t);
+  num_roots_++;
+  tree_size_ = saturating_add(tree_size_, root.tree_size);
+  depth_ = std::max(depth_, root.depth);
+}
+
+uint64_t TermStats::tree_size(const Term & t) const
+{
+  auto it = info_.find(t);
+  if (it == info_.end())
+  {
+    throw IncorrectUsageException("Term not in TermStats: "
+                                  + to_diagnostic_string(t));
+  }
+  return it->second.tree_size;
+}
+
+void TermStats::count(const Term & t)
+{
+  Op op = t->get_op();
+  op_counts_[op.prim_op]++;
+  if (op.is_null())
+  {
+    if (t->is_value())
+    {
+      num_values_++;
+    }
+    else if (t->is_symbol())
+    {
+      num_symbols_++;
+    }
+  }
+
+  Sort sort = t->get_sort();
+  SortKind sk = sort->get_sort_kind();
+  sort_counts_[sk]++;
+  if (sk == BV)
+  {
+    max_bv_width_ = std::max(max_bv_width_, sort->get_width());
+  }
+  else if (sk == ARRAY)
+  {
+    for (const Sort & s : { sort->get_indexsort(), sort->get_elemsort() })
+    {
+      if (s->get_sort_kind() == BV)
+      {
+        max_bv_width_ = std::max(max_bv_width_, s->get_width());
+      }
+    }
+  }
+
+  if ((sk == INT || sk == REAL)
+      && (op == Mult || op == Div || op == IntDiv || op == Mod))
+  {
+    size_t non_values = 0;
+    for (auto it = t->begin(); it != t->end(); ++it)
+    {
+      non_values += !(*it)->is_value();
+    }
+    nonlinear_ |= non_values > 1;
+  }
+}
+
+std::string TermStats::logic() const
+{
+  string logic = has_quantifiers() ? "" : "QF_";
+  if (has_arrays())
+  {
+    logic += "A";
+  }
+  if (has_uf() || has_sort_kind(UNINTERPRETED)
+      || has_sort_kind(UNINTERPRETED_CONS))
+  {
+    logic += "UF";
+  }
+  if (has_sort_kind(BV))
+  {
+    logic += "BV";
+  }
+  if (has_sort_kind(DATATYPE))
+  {
+    logic += "DT";
+  }
+  bool ints = has_sort_kind(INT);
+  bool reals = has_sort_kind(REAL);
+  if (ints || reals)
+  {
+    logic += nonlinear_ ? "N" : "L";
+    logic += ints ? "I" : "";
+    logic += reals ? "R" : "";
+    logic += "A";
+  }
+  if (logic.empty() || logic == "QF_")
+  {
+    logic += "UF";
+  }
+  return logic;
+}
+
+void TermStats::print(std::ostream & os) const
+{
+  os << "roots: " << num_roots_ << endl;
+  os << "dag size: " << dag_size() << endl;
+  os << "tree size: ";
+  if (tree_size_ == saturated)
+  {
+    os << ">= ";
+  }
+  os << tree_size_ << endl;
+  os << "depth: " << depth_ << endl;
+  os << "symbols: " << num_symbols_ << ", values: " << num_values_ << endl;
+  os << "max bit-vector width: " << max_bv_width_ << endl;
+  os << "logic: " << logic() << endl;
+  os << "sorts:";
+  for (size_t sk = 0; sk < NUM_SORT_KINDS; ++sk)
+  {
+    if (sort_counts_[sk])
+    {
+      os << " " << to_string(SortKind(sk)) << "=" << sort_counts_[sk];
+    }
+  }
+  os << endl;
+  os << "ops:";
+  for (size_t po = 0; po < NUM_OPS_AND_NULL; ++po)
+  {
+    if (op_counts_[po])
+    {
+      os << " " << to_string(PrimOp(po)) << "=" << op_counts_[po];
+    }
+  }
+  os << endl;
+}
+
+std::ostream & operator<<(std::ostream & output, const TermStats & stats)
+{
+  stats.print(output);
+  return output;
+}
+
+}  // namespace smt
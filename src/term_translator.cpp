@@ -21,6 +21,8 @@
 #include "assert.h"
 
 #include "sort_inference.h"
+#include "term_printer.h"
+#include "trace.h"
 #include "utils.h"
 #include "term_translator.h"
 
@@ -142,6 +144,8 @@ Term TermTranslator::transfer_term(const Term & term)
   {
     return cache.at(term);
   }
+  // only traced when there is work to do
+  SMT_TRACE_SPAN("TermTranslator::transfer_term", "translation");
 
   TermVec to_visit{ term };
   // better to keep a separate set for visited
@@ -186,7 +190,7 @@ Term TermTranslator::transfer_term(const Term & term)
       if (t->is_symbol())
       {
         s = transfer_sort(t->get_sort());
-        string name = t->to_string();
+        const string & name = symbol_name(t);
         try
         {
           Term sym = solver->get_symbol(name);
@@ -211,7 +215,7 @@ Term TermTranslator::transfer_term(const Term & term)
       else if (t->is_param())
       {
         s = transfer_sort(t->get_sort());
-        cache[t] = solver->make_param(t->to_string(), s);
+        cache[t] = solver->make_param(symbol_name(t), s);
       }
       else if (t->is_value())
       {
@@ -284,6 +288,11 @@ Term TermTranslator::transfer_term(const Term & term)
           cache[t] = solver->make_term(t->get_op(), cached_children);
         }
       }
+
+      if (cache_limit && !t->is_symbol() && !t->is_param())
+      {
+        trimmable.push_back(t);
+      }
     }
   }
 
@@ -291,7 +300,37 @@ Term TermTranslator::transfer_term(const Term & term)
   // make sure the sort is as-expected and cast if not
   // for dealing with solvers that alias sorts
 
-  return cache.at(term);
+  Term res = cache.at(term);
+  if (cache_limit && cache.size() > next_trim)
+  {
+    trim_cache();
+  }
+  return res;
+}
+
+void TermTranslator::trim_cache()
+{
+  for (const auto & t : trimmable)
+  {
+    cache.erase(t);
+  }
+  trimmable.clear();
+  // the names are only needed again for symbols that left the cache
+  if (symbol_names.size() > cache_limit)
+  {
+    symbol_names.clear();
+  }
+  next_trim = cache.size() + cache_limit;
+}
+
+const string & TermTranslator::symbol_name(const Term & t)
+{
+  auto it = symbol_names.find(t);
+  if (it == symbol_names.end())
+  {
+    it = symbol_names.emplace(t, t->to_string()).first;
+  }
+  return it->second;
 }
 
 Term TermTranslator::transfer_term(const Term & term, const SortKind sk)
@@ -331,7 +370,8 @@ Term TermTranslator::transfer_term(const Term & term, const SortKind sk)
   else
   {
     string msg("Cannot cast ");
-    msg += transferred_term->to_string() + " to " + smt::to_string(sk);
+    msg += to_diagnostic_string(transferred_term) + " to "
+           + smt::to_string(sk);
     throw IncorrectUsageException(msg);
   }
 }
@@ -574,7 +614,7 @@ Term TermTranslator::cast_op(Op op, const TermVec & terms) const
     msg += op.to_string();
     for (auto t : terms)
     {
-      msg += " " + t->to_string();
+      msg += " " + to_diagnostic_string(t);
     }
     msg += ")";
     throw NotImplementedException(msg);
@@ -616,8 +656,9 @@ Term TermTranslator::cast_term(const Term & term, const Sort & sort) const
   }
   else
   {
-    throw NotImplementedException("Cannot interpret " + term->to_string()
-                                  + " as " + sort->to_string());
+    throw NotImplementedException("Cannot interpret "
+                                  + to_diagnostic_string(term) + " as "
+                                  + sort->to_string());
   }
 }
 
@@ -0,0 +1,239 @@
+/*********************                                                        */
+/*! \file trace.cpp
+** \verbatim
+** Top contributors (to current version):
+**   agent
+** This file is part of the smt-switch project.
+** Copyright (c) 2026 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved.  See the file LICENSE in the top-level source
+** directory for licensing information.\endverbatim
+**
+** \brief Scoped tracing spans that can be exported as a Chrome trace.
+**
+**/
+
+#include "trace.h"
+
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "exceptions.h"
+
+using namespace std;
+
+namespace smt {
+
+namespace trace {
+
+std::atomic<bool> recording(false);
+
+namespace {
+
+struct Event
+{
+  const char * name;
+  const char * category;
+  uint64_t start;
+  uint64_t end;
+};
+
+// the spans of one thread
+// the lock is only contended while the trace is written or cleared
+struct Buffer
+{
+  mutex m;
+  vector<Event> events;
+  size_t tid;
+};
+
+struct Registry
+{
+  mutex m;
+  // kept after the threads exit, e.g. the detached portfolio threads
+  vector<shared_ptr<Buffer>> buffers;
+};
+
+Registry & registry()
+{
+  static Registry r;
+  return r;
+}
+
+Buffer & local_buffer()
+{
+  thread_local shared_ptr<Buffer> buffer;
+  if (!buffer)
+  {
+    buffer = make_shared<Buffer>();
+    Registry & r = registry();
+    lock_guard<mutex> lock(r.m);
+    buffer->tid = r.buffers.size() + 1;
+    r.buffers.push_back(buffer);
+  }
+  return *buffer;
+}
+
+void write_string(ostream & os, const char * s)
+{
+  os << '"';
+  for (; *s; ++s)
+  {
+    if (*s == '"' || *s == '\\')
+    {
+      os << '\\';
+    }
+    os << *s;
+  }
+  os << '"';
+}
+
+// enables recording if SMT_SWITCH_TRACE is set and writes the trace at exit
+struct EnvironmentTrace
+{
+  EnvironmentTrace()
+  {
+    // constructed first, so that it is destroyed after this object
+    registry();
+    const char * file = getenv("SMT_SWITCH_TRACE");
+    if (file && *file)
+    {
+      filename = file;
+      enable();
+    }
+  }
+
+  ~EnvironmentTrace()
+  {
+    if (!filename.empty())
+    {
+      try
+      {
+        write_chrome_trace(filename);
+      }
+      catch (SmtException & e)
+      {
+        cerr << e.what() << endl;
+      }
+    }
+  }
+
+  string filename;
+};
+
+EnvironmentTrace environment_trace;
+
+}  // namespace
+
+bool compiled_in()
+{
+#ifdef SMT_SWITCH_TRACING
+  return true;
+#else
+  return false;
+#endif
+}
+
+void enable(bool on) { recording.store(on, memory_order_relaxed); }
+
+void clear()
+{
+  Registry & r = registry();
+  lock_guard<mutex> lock(r.m);
+  for (auto & b : r.buffers)
+  {
+    lock_guard<mutex> buffer_lock(b->m);
+    b->events.clear();
+  }
+}
+
+size_t num_spans()
+{
+  Registry & r = registry();
+  lock_guard<mutex> lock(r.m);
+  size_t res = 0;
+  for (auto & b : r.buffers)
+  {
+    lock_guard<mutex> buffer_lock(b->m);
+    res += b->events.size();
+  }
+  return res;
+}
+
+void write_chrome_trace(std::ostream & os)
+{
+  Registry & r = registry();
+  lock_guard<mutex> lock(r.m);
+  pid_t pid = getpid();
+
+  os << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+  bool first = true;
+  char ts[64];
+  for (auto & b : r.buffers)
+  {
+    lock_guard<mutex> buffer_lock(b->m);
+    if (b->events.empty())
+    {
+      continue;
+    }
+
+    os << (first ? "\n" : ",\n") << "{\"ph\":\"M\",\"name\":\"thread_name\""
+       << ",\"pid\":" << pid << ",\"tid\":" << b->tid
+       << ",\"args\":{\"name\":\"thread " << b->tid << "\"}}";
+    first = false;
+    for (const auto & e : b->events)
+    {
+      // microseconds with nanosecond precision
+      snprintf(ts,
+               sizeof(ts),
+               "\"ts\":%.3f,\"dur\":%.3f",
+               e.start / 1000.0,
+               (e.end - e.start) / 1000.0);
+      os << ",\n{\"ph\":\"X\",\"name\":";
+      write_string(os, e.name);
+      os << ",\"cat\":";
+      write_string(os, e.category);
+      os << "," << ts << ",\"pid\":" << pid << ",\"tid\":" << b->tid << "}";
+    }
+  }
+  os << "\n]}" << endl;
+}
+
+void write_chrome_trace(const std::string & filename)
+{
+  ofstream out(filename);
+  if (!out)
+  {
+    throw IncorrectUsageException("Could not open trace file " + filename);
+  }
+  write_chrome_trace(out);
+}
+
+uint64_t Span::now()
+{
+  uint64_t ns = chrono::duration_cast<chrono::nanoseconds>(
+                    chrono::steady_clock::now().time_since_epoch())
+                    .count();
+  return ns ? ns : 1;
+}
+
+void Span::record(const char * name,
+                  const char * category,
+                  uint64_t start,
+                  uint64_t end)
+{
+  Buffer & b = local_buffer();
+  lock_guard<mutex> lock(b.m);
+  b.events.push_back({ name, category, start, end });
+}
+
+}  // namespace trace
+
+}  // namespace smt
@@ -3,6 +3,8 @@
 #include <iostream>
 #include <string>
 
+#include "trace.h"
+
 using namespace smt;
 using namespace std;
 
@@ -10,6 +12,7 @@ namespace smt {
 
 pair<Term, vector<int>> TreeWalker::visit(Term & node)
 {
+  SMT_TRACE_SPAN("TreeWalker::visit", "walker");
   // iterates over children, for tracking which child of it's parent node
   int child_no;
   // path for parts of the formula
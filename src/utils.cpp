@@ -962,6 +962,96 @@ Term to_cnf(Term formula, SmtSolver s)
   return ret;
 }
 
+void bits_to_words(const char * bits,
+                   size_t len,
+                   uint64_t width,
+                   std::vector<uint64_t> & out)
+{
+  out.assign((width + 63) / 64, 0);
+  size_t n = len < width ? len : width;
+  // bits[len - 1] is bit 0
+  const char * lsb = bits + len - 1;
+  for (size_t i = 0; i < n; i += 64)
+  {
+    size_t chunk = n - i < 64 ? n - i : 64;
+    uint64_t w = 0;
+    for (size_t b = 0; b < chunk; ++b)
+    {
+      w |= uint64_t(lsb[-(ptrdiff_t)(i + b)] == '1') << b;
+    }
+    out[i / 64] = w;
+  }
+}
+
+void decimal_to_words(const char * digits,
+                      size_t len,
+                      uint64_t width,
+                      std::vector<uint64_t> & out)
+{
+  out.assign((width + 63) / 64, 0);
+  // words = words * 10^k + chunk, for chunks of up to 19 digits
+  size_t i = 0;
+  while (i < len && isdigit(digits[i]))
+  {
+    uint64_t chunk = 0;
+    uint64_t scale = 1;
+    for (size_t k = 0; k < 19 && i < len && isdigit(digits[i]); ++k, ++i)
+    {
+      chunk = chunk * 10 + (digits[i] - '0');
+      scale *= 10;
+    }
+    unsigned __int128 carry = chunk;
+    for (auto & w : out)
+    {
+      unsigned __int128 v = (unsigned __int128)w * scale + carry;
+      w = (uint64_t)v;
+      carry = v >> 64;
+    }
+  }
+  if (width % 64 && !out.empty())
+  {
+    out.back() &= (1ULL << (width % 64)) - 1;
+  }
+}
+
+void bv_string_to_words(const std::string & s,
+                        uint64_t width,
+                        std::vector<uint64_t> & out)
+{
+  if (s.compare(0, 2, "#b") == 0)
+  {
+    bits_to_words(s.data() + 2, s.size() - 2, width, out);
+    return;
+  }
+
+  out.assign((width + 63) / 64, 0);
+  if (s.compare(0, 2, "#x") == 0)
+  {
+    size_t n = s.size() - 2;
+    for (size_t i = 0; i < n && 4 * i < width; ++i)
+    {
+      char c = s[s.size() - 1 - i];
+      uint64_t nibble = (c >= '0' && c <= '9') ? c - '0' : (tolower(c) - 'a' + 10);
+      out[(4 * i) / 64] |= nibble << ((4 * i) % 64);
+    }
+  }
+  else if (s.compare(0, 5, "(_ bv") == 0)
+  {
+    decimal_to_words(s.data() + 5, s.size() - 5, width, out);
+    return;
+  }
+  else
+  {
+    throw IncorrectUsageException("Expecting a bit-vector value but got: "
+                                  + s);
+  }
+
+  if (width % 64 && !out.empty())
+  {
+    out.back() &= (1ULL << (width % 64)) - 1;
+  }
+}
+
 // ----------------------------------------------------------------------------
 
 UnsatCoreReducer::UnsatCoreReducer(SmtSolver reducer_solver)
@@ -38,3 +38,79 @@ def test_basic(solver_str, T, logic, implicit):
             else:
                 x_val = solver.get_value(problem)
         assert x_val is not None
+
+
+@pytest.mark.parametrize('solver_str', fe.SWITCH_SOLVERS.keys())
+def test_large_model(solver_str):
+    if sl.QF_BV not in fe.SWITCH_SOLVERS[solver_str].LOGICS:
+        pytest.skip()
+
+    n = 200
+    xs = [sc.Symbol(f'x{i}', st.BV8) for i in range(n)]
+    b = sc.Symbol('b')
+    # x_i = x_0 + ... + x_{i-1}, every sum shares the previous one
+    acc = xs[0]
+    constraints = [sc.Equals(xs[0], sc.BV(1, 8))]
+    for x in xs[1:]:
+        constraints.append(sc.Equals(x, acc))
+        acc = sc.BVAdd(acc, x)
+    constraints.append(sc.Iff(b, sc.BVULT(xs[-1], xs[1])))
+    problem = sc.And(constraints)
+
+    with fe.Solver(solver_str, sl.QF_BV) as solver:
+        solver.add_assertion(problem)
+        assert solver.solve()
+        model = solver.get_model()
+        for i in range(1, 9):
+            assert model.get_py_value(xs[i]) == 2**(i - 1)
+        assert model.get_py_value(xs[-1]) == 0
+        assert model.get_py_value(b)
+        assert solver.get_py_value(xs[3]) == 4
+
+
+class _CountingBuilder:
+    def __init__(self, builder):
+        self.builder = builder
+        self.builds = 0
+        self.value_calls = 0
+
+    def build(self, *args):
+        self.builds += 1
+        return self.builder.build(*args)
+
+    def get_values(self, *args):
+        self.value_calls += 1
+        return self.builder.get_values(*args)
+
+    def __getattr__(self, name):
+        return getattr(self.builder, name)
+
+    def __len__(self):
+        return len(self.builder)
+
+
+@pytest.mark.parametrize('solver_str', fe.SWITCH_SOLVERS.keys())
+def test_batched_calls(solver_str):
+    if sl.QF_BV not in fe.SWITCH_SOLVERS[solver_str].LOGICS:
+        pytest.skip()
+
+    xs = [sc.Symbol(f'y{i}', st.BV8) for i in range(50)]
+    acc = xs[0]
+    for x in xs[1:]:
+        acc = sc.BVAdd(acc, x)
+    problem = sc.And(sc.Equals(acc, sc.BV(7, 8)),
+                     *(sc.BVULT(x, sc.BV(2, 8)) for x in xs))
+
+    with fe.Solver(solver_str, sl.QF_BV) as solver:
+        builder = _CountingBuilder(solver.converter.builder)
+        solver.converter.builder = builder
+        solver.add_assertion(problem)
+        assert builder.builds == 1
+        # nothing new to build
+        solver.add_assertion(problem)
+        assert builder.builds == 1
+
+        assert solver.solve()
+        model = solver.get_model()
+        assert builder.value_calls == 1
+        assert sum(model.get_py_value(x) for x in xs) == 7
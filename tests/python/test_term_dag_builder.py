@@ -0,0 +1,57 @@
+###############################################################
+# \file test_term_dag_builder.py
+# \verbatim
+# Top contributors (to current version):
+#   agent
+# This file is part of the smt-switch project.
+# Copyright (c) 2026 by the authors listed in the file AUTHORS
+# in the top-level source directory) and their institutional affiliations.
+# All rights reserved.  See the file LICENSE in the top-level source
+# directory for licensing information.\endverbatim
+#
+# \brief Test TermDagBuilder through Python bindings
+#        see include/term_dag_builder.h for the layout of the code
+#
+
+import pytest
+
+import smt_switch as ss
+from smt_switch.primops import And, BVAdd, Equal, Extract
+
+
+@pytest.mark.parametrize("create_solver", ss.solvers.values())
+def test_term_dag_builder(create_solver):
+    solver = create_solver(False)
+    solver.set_opt('produce-models', 'true')
+    bvsort = solver.make_sort(ss.sortkinds.BV, 8)
+
+    builder = ss.TermDagBuilder(solver)
+    code = [ss.DAG_SYMBOL, 0, 0,                       # 0: x
+            ss.DAG_VALUE, 1, 0,                        # 1: 3
+            ss.DAG_OP, BVAdd.as_int(), 0, 2, 0, 1,     # 2: x + 3
+            ss.DAG_OP, Extract.as_int(), 2, 3, 0, 1, 2,  # 3: (x + 3)[3:0]
+            ss.DAG_OP, Equal.as_int(), 0, 2, 2, 1,     # 4: x + 3 = 3
+            ss.DAG_BOOL, 1,                            # 5: true
+            ss.DAG_OP, And.as_int(), 0, 2, 4, 5]       # 6
+    assert builder.build(code, ['x', '3'], [bvsort]) == 0
+    assert len(builder) == 7
+
+    x = builder.get_term(0)
+    three = solver.make_term(3, bvsort)
+    assert x.is_symbolic_const()
+    assert builder.get_term(1) == three
+    assert builder.get_term(2) == solver.make_term(BVAdd, x, three)
+    assert builder.get_term(3).get_sort() == solver.make_sort(ss.sortkinds.BV, 4)
+
+    # a malformed DAG is dropped, its symbols are reused by the next one
+    with pytest.raises(RuntimeError):
+        builder.build([ss.DAG_SYMBOL, 0, 0, ss.DAG_OP, BVAdd.as_int(), 0, 2, 0, 8],
+                      ['y'], [bvsort])
+    assert len(builder) == 7
+    assert builder.build([ss.DAG_SYMBOL, 0, 0], ['y'], [bvsort]) == 7
+    assert str(builder.get_term(7)) == 'y'
+
+    solver.assert_formula(builder.get_term(6))
+    assert solver.check_sat().is_sat()
+    values = builder.get_values([0, 4])
+    assert values == [str(solver.get_value(x)), 'true']
@@ -0,0 +1,22 @@
+(set-logic QF_UFBV)
+(set-option :incremental true)
+(declare-const x (_ BitVec 8))
+(declare-const y (_ BitVec 8))
+(define-fun inc ((a (_ BitVec 8))) (_ BitVec 8) (bvadd a #x01))
+(define-fun inc2 ((a (_ BitVec 8))) (_ BitVec 8) (inc (inc a)))
+(define-fun sum ((a (_ BitVec 8)) (b (_ BitVec 8))) (_ BitVec 8) (bvadd (inc a) (inc b)))
+(push 1)
+(assert (= (inc x) (inc y)))
+(check-sat)
+(assert (distinct x y))
+(check-sat)
+(pop 1)
+(push 1)
+(assert (= (inc2 x) (inc (inc x))))
+(assert (= (sum x y) (sum y x)))
+(assert (distinct (sum x y) (bvadd (inc2 x) y)))
+(check-sat)
+(pop 1)
+(assert (= (inc2 x) (inc y)))
+(assert (= (inc (inc x)) (sum y #xff)))
+(check-sat)
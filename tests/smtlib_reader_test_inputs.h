@@ -36,6 +36,11 @@ const std::unordered_map<std::string, std::vector<smt::Result>> qf_uflia_tests({
 const std::unordered_map<std::string, std::vector<smt::Result>> qf_ufbv_tests(
     { { "test-attr.smt2",
         { smt::Result(smt::SAT), smt::Result(smt::UNSAT) } },
+      { "test-define-fun.smt2",
+        { smt::Result(smt::SAT),
+          smt::Result(smt::UNSAT),
+          smt::Result(smt::UNSAT),
+          smt::Result(smt::SAT) } },
       { "test-define-sort.smt2", { smt::Result(smt::UNSAT) } },
       { "test-define-sort-edge-case.smt2", { smt::Result(smt::UNSAT) } } });
 
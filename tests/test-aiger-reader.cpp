@@ -0,0 +1,125 @@
+/*********************                                                        */
+/*! \file test-aiger-reader.cpp
+** \verbatim
+** Top contributors (to current version):
+**   agent
+** This file is part of the smt-switch project.
+** Copyright (c) 2026 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved.  See the file LICENSE in the top-level source
+** directory for licensing information.\endverbatim
+**
+** \brief Tests for AigerReader.
+**
+**
+**/
+
+#include <utility>
+#include <vector>
+
+#include "aiger_reader.h"
+#include "available_solvers.h"
+#include "gtest/gtest.h"
+#include "smt.h"
+
+using namespace smt;
+using namespace std;
+
+namespace smt_tests {
+
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(AigerReaderTests);
+class AigerReaderTests
+    : public ::testing::Test,
+      public ::testing::WithParamInterface<SolverConfiguration>
+{
+ protected:
+  void SetUp() override { s = create_solver(GetParam()); }
+
+  bool valid(const Term & t)
+  {
+    s->push();
+    s->assert_formula(s->make_term(Not, t));
+    bool res = s->check_sat().is_unsat();
+    s->pop();
+    return res;
+  }
+
+  SmtSolver s;
+};
+
+TEST_P(AigerReaderTests, Toggle)
+{
+  // toggle flip-flop from the AIGER documentation
+  AigerReader r(s);
+  r.parse_string("aag 1 0 1 2 0\n2 3\n2\n3\n");
+  ASSERT_EQ(r.states().size(), 1);
+  ASSERT_EQ(r.outputs().size(), 2);
+  Term l = r.states()[0];
+  EXPECT_EQ(r.init().at(l), s->make_term(false));
+  EXPECT_TRUE(valid(s->make_term(Equal, r.next().at(l), s->make_term(Not, l))));
+  EXPECT_TRUE(valid(s->make_term(Xor, r.outputs()[0], r.outputs()[1])));
+}
+
+TEST_P(AigerReaderTests, UnorderedAscii)
+{
+  AigerReader r(s);
+  r.parse_string(
+      "aag 5 2 1 1 2 1\n"
+      "2\n"
+      "4\n"
+      "10 8 10\n"
+      "9\n"
+      "6\n"
+      "8 6 3\n"
+      "6 2 4\n"
+      "i0 x\n"
+      "i1 y\n"
+      "l0 latch\n"
+      "o0 out\n"
+      "c\n"
+      "a comment\n");
+  Term x = r.get_symbol("x");
+  Term y = r.get_symbol("y");
+  ASSERT_TRUE(x);
+  ASSERT_TRUE(y);
+  ASSERT_TRUE(r.get_symbol("latch"));
+  // out = !(x & y & !x)
+  EXPECT_TRUE(valid(r.outputs()[0]));
+  ASSERT_EQ(r.bad().size(), 1);
+  EXPECT_TRUE(valid(s->make_term(Equal, r.bad()[0], s->make_term(And, x, y))));
+  // latch reset to itself is uninitialized
+  EXPECT_TRUE(r.init().empty());
+}
+
+TEST_P(AigerReaderTests, Binary)
+{
+  // the and gate 6 = 4 & 2 is delta encoded as 2, 2
+  string aig = "aig 3 2 0 1 1\n6\n";
+  aig += '\x02';
+  aig += '\x02';
+  aig += "i0 x\ni1 y\n";
+  AigerReader r(s);
+  r.parse_string(aig);
+  Term x = r.get_symbol("x");
+  Term y = r.get_symbol("y");
+  ASSERT_TRUE(x);
+  ASSERT_TRUE(y);
+  EXPECT_TRUE(
+      valid(s->make_term(Equal, r.outputs()[0], s->make_term(And, x, y))));
+}
+
+TEST_P(AigerReaderTests, Errors)
+{
+  AigerReader r(s);
+  EXPECT_THROW(r.parse_string("p cnf 1 1\n"), SmtException);
+  // cyclic and gates
+  EXPECT_THROW(r.parse_string("aag 2 0 0 1 2\n2\n2 4 1\n4 2 1\n"),
+               SmtException);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    ParameterizedSolverAigerReaderTests,
+    AigerReaderTests,
+    testing::ValuesIn(filter_non_generic_solver_configurations({})));
+
+}  // namespace smt_tests
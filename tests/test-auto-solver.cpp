@@ -0,0 +1,233 @@
+/*********************                                                        */
+/*! \file test-auto-solver.cpp
+** \verbatim
+** Top contributors (to current version):
+**   agent
+** This file is part of the smt-switch project.
+** Copyright (c) 2026 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved.  See the file LICENSE in the top-level source
+** directory for licensing information.\endverbatim
+**
+** \brief Tests for BackendSelector and AutoSolver
+**
+**
+**/
+
+#include <algorithm>
+#include <sstream>
+#include <vector>
+
+#include "auto_solver.h"
+#include "available_solvers.h"
+#include "gtest/gtest.h"
+#include "smt.h"
+
+using namespace smt;
+using namespace std;
+
+namespace smt_tests {
+
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(AutoSolverTests);
+class AutoSolverTests
+    : public ::testing::Test,
+      public ::testing::WithParamInterface<SolverConfiguration>
+{
+ protected:
+  void SetUp() override
+  {
+    // the front solver needs term iteration for the features
+    front = create_solver(SolverConfiguration(GetParam().solver_enum, true));
+    candidates = available_non_generic_solver_enums();
+    make_backend = [](SolverEnum se) {
+      SmtSolver backend = create_solver(SolverConfiguration(se, false));
+      return backend;
+    };
+    bvsort = front->make_sort(BV, 8);
+    intsort = front->make_sort(INT);
+  }
+
+  // stats of a formula over bit-vectors
+  TermStats bv_stats()
+  {
+    Term x = front->make_symbol("x", bvsort);
+    TermStats stats;
+    stats.add(front->make_term(BVUlt, x, front->make_term(3, bvsort)));
+    return stats;
+  }
+
+  SmtSolver front;
+  vector<SolverEnum> candidates;
+  BackendFactory make_backend;
+  Sort bvsort, intsort;
+};
+
+TEST_P(AutoSolverTests, DefaultRules)
+{
+  BackendSelector selector;
+  TermStats stats = bv_stats();
+  ASSERT_EQ(stats.logic(), "QF_BV");
+  EXPECT_EQ(selector.select(stats, { Z3, BTOR }), BTOR);
+  EXPECT_EQ(selector.select(stats, { Z3, CVC5 }), Z3);
+
+  // boolector has no integers
+  Term i = front->make_symbol("i", intsort);
+  stats.add(front->make_term(Lt, i, front->make_term(0, intsort)));
+  EXPECT_EQ(selector.select(stats, { BTOR, Z3 }), Z3);
+  // and no candidate to fall back on
+  try
+  {
+    selector.select(stats, { BTOR });
+    FAIL() << "expected IncorrectUsageException";
+  }
+  catch (IncorrectUsageException & e)
+  {
+    EXPECT_NE(string(e.what()).find("THEORY_INT"), string::npos);
+  }
+}
+
+TEST_P(AutoSolverTests, FitSaveLoad)
+{
+  TermStats stats = bv_stats();
+  vector<TimingRecord> records = {
+    { "a.smt2", "QF_BV", 5, 8, Z3, 0.5, true },
+    { "a.smt2", "QF_BV", 5, 8, BTOR, 2.0, true },
+    { "b.smt2", "QF_BV", 5000, 8, Z3, 10.0, false },
+    { "b.smt2", "QF_BV", 5000, 8, BTOR, 3.0, true },
+    // skipped b.smt2, so it is only compared on small instances
+    { "a.smt2", "QF_BV", 5, 8, CVC5, 0.1, true },
+  };
+
+  BackendSelector selector;
+  selector.fit(records, 10);
+  EXPECT_EQ(selector.select(stats, { BTOR, Z3, CVC5 }), CVC5);
+  EXPECT_EQ(selector.select(stats, { BTOR, Z3 }), BTOR);
+  // the learned rule for larger instances
+  ASSERT_GE(selector.get_rules().size(), 3);
+  EXPECT_EQ(selector.get_rules()[1].min_dag_size, 1000);
+  EXPECT_EQ(selector.get_rules()[1].backend, BTOR);
+  // the learned fallback for QF_BV: PAR-2 of z3 is 0.5 + 20, btor 5
+  EXPECT_EQ(selector.get_rules()[2].max_dag_size, 0);
+  EXPECT_EQ(selector.get_rules()[2].backend, BTOR);
+
+  stringstream ss;
+  selector.save(ss);
+  BackendSelector loaded;
+  loaded.load(ss);
+  ASSERT_EQ(loaded.get_rules().size(), selector.get_rules().size());
+  for (size_t i = 0; i < loaded.get_rules().size(); ++i)
+  {
+    EXPECT_EQ(loaded.get_rules()[i].logic, selector.get_rules()[i].logic);
+    EXPECT_EQ(loaded.get_rules()[i].min_dag_size,
+              selector.get_rules()[i].min_dag_size);
+    EXPECT_EQ(loaded.get_rules()[i].backend, selector.get_rules()[i].backend);
+  }
+
+  stringstream missing("QF_BV 0 0 Z3\n");
+  EXPECT_THROW(loaded.load(missing), IncorrectUsageException);
+  stringstream unknown("QF_BV 0 0 0 NO_SOLVER\n");
+  EXPECT_THROW(loaded.load(unknown), IncorrectUsageException);
+}
+
+TEST_P(AutoSolverTests, PicksAtCheckSat)
+{
+  AutoSolver as(front, candidates, make_backend);
+  as.set_opt("produce-models", "true");
+  as.set_opt("incremental", "true");
+  Term x = as.make_symbol("x", bvsort);
+  Term y = as.make_symbol("y", bvsort);
+  as.assert_formula(as.make_term(BVUlt, x, y));
+  as.push();
+  as.assert_formula(as.make_term(BVUlt, y, x));
+  EXPECT_FALSE(as.has_backend());
+  EXPECT_EQ(as.get_context_level(), 1);
+  TermStats stats = as.get_stats();
+  EXPECT_EQ(stats.num_roots(), 2);
+
+  EXPECT_TRUE(as.check_sat().is_unsat());
+  ASSERT_TRUE(as.has_backend());
+  EXPECT_EQ(as.get_backend_enum(),
+            BackendSelector().select(stats, candidates));
+  // the statistics are dropped after the selection
+  EXPECT_EQ(as.get_stats().num_roots(), 0);
+  as.assert_formula(as.make_term(BVUle, x, y));
+  EXPECT_EQ(as.get_stats().num_roots(), 0);
+  EXPECT_EQ(as.get_context_level(), 1);
+
+  as.pop();
+  ASSERT_TRUE(as.check_sat().is_sat());
+  Term xv = as.get_value(x);
+  Term yv = as.get_value(y);
+  EXPECT_LT(xv->to_int(), yv->to_int());
+  // values are terms of the front solver
+  Term eq = as.make_term(Equal, x, xv);
+  EXPECT_EQ(eq->get_sort(), front->make_sort(BOOL));
+}
+
+TEST_P(AutoSolverTests, PopDropsStats)
+{
+  AutoSolver as(front, candidates, make_backend);
+  as.set_opt("incremental", "true");
+  Term x = as.make_symbol("x", bvsort);
+  as.assert_formula(as.make_term(BVUlt, x, as.make_term(3, bvsort)));
+  TermStats bv_only = as.get_stats();
+
+  as.push();
+  Term i = as.make_symbol("i", intsort);
+  as.assert_formula(as.make_term(Lt, i, as.make_term(0, intsort)));
+  EXPECT_EQ(as.get_stats().num_roots(), 2);
+  EXPECT_TRUE(as.get_stats().has_sort_kind(INT));
+
+  // the popped assertion no longer counts for the selection
+  as.pop();
+  EXPECT_FALSE(as.has_backend());
+  EXPECT_EQ(as.get_stats().num_roots(), 1);
+  EXPECT_FALSE(as.get_stats().has_sort_kind(INT));
+  EXPECT_EQ(as.get_stats().logic(), "QF_BV");
+  EXPECT_EQ(as.get_stats().dag_size(), bv_only.dag_size());
+
+  EXPECT_TRUE(as.check_sat().is_sat());
+  EXPECT_EQ(as.get_backend_enum(),
+            BackendSelector().select(bv_only, candidates));
+}
+
+TEST_P(AutoSolverTests, TranslatedBackend)
+{
+  vector<SolverEnum> others;
+  for (auto se : candidates)
+  {
+    if (se != GetParam().solver_enum
+        && solver_has_attribute(se, UNSAT_CORE)
+        && solver_has_attribute(se, FULL_TRANSFER))
+    {
+      others.push_back(se);
+    }
+  }
+  if (others.empty())
+  {
+    // needs a second backend
+    return;
+  }
+
+  AutoSolver as(front, others, make_backend);
+  as.set_opt("produce-unsat-assumptions", "true");
+  as.set_opt("incremental", "true");
+  Sort boolsort = as.make_sort(BOOL);
+  Term a = as.make_symbol("a", boolsort);
+  Term b = as.make_symbol("b", boolsort);
+  as.assert_formula(as.make_term(Not, as.make_term(And, a, b)));
+  ASSERT_TRUE(as.check_sat_assuming({ a, b }).is_unsat());
+  EXPECT_NE(as.get_backend(), front);
+
+  UnorderedTermSet core;
+  as.get_unsat_assumptions(core);
+  EXPECT_EQ(core, UnorderedTermSet({ a, b }));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    ParameterizedAutoSolverTests,
+    AutoSolverTests,
+    testing::ValuesIn(filter_non_generic_solver_configurations(
+        { THEORY_BV, THEORY_INT })));
+
+}  // namespace smt_tests
@@ -0,0 +1,189 @@
+/*********************                                                        */
+/*! \file test-btor2-reader.cpp
+** \verbatim
+** Top contributors (to current version):
+**   agent
+** This file is part of the smt-switch project.
+** Copyright (c) 2026 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved.  See the file LICENSE in the top-level source
+** directory for licensing information.\endverbatim
+**
+** \brief Tests for Btor2Reader.
+**
+**
+**/
+
+#include <cstdio>
+#include <fstream>
+#include <utility>
+#include <vector>
+
+#include "available_solvers.h"
+#include "btor2_reader.h"
+#include "gtest/gtest.h"
+#include "smt.h"
+
+using namespace smt;
+using namespace std;
+
+namespace smt_tests {
+
+// a 4-bit counter that must not reach 15
+const string counter = R"(; counter
+1 sort bitvec 1
+2 sort bitvec 4
+3 zero 2
+4 state 2 cnt
+5 init 2 4 3
+6 one 2
+7 add 2 4 6
+8 next 2 4 7
+9 ones 2
+10 eq 1 4 9
+11 bad 10
+12 input 1 en
+13 constd 2 -1
+14 eq 1 13 9
+15 constraint 14 ; always true
+16 sort array 2 2
+17 state 16 mem
+18 init 16 17 3
+19 read 2 17 4
+20 write 16 17 4 19
+21 next 16 17 20
+)";
+
+// each bad property is a valid encoding check, so all are unsat
+const string encodings = R"(
+1 sort bitvec 1
+2 sort bitvec 4
+3 input 2 a
+4 input 2 b
+5 uaddo 1 3 4
+6 add 2 3 4
+7 ult 1 6 3
+8 xor 1 5 7
+9 bad 8
+10 sort bitvec 5
+11 sext 10 3 1
+12 sext 10 4 1
+13 add 10 11 12
+14 slice 2 13 3 0
+15 sext 10 14 1
+16 neq 1 13 15
+17 saddo 1 3 4
+18 xor 1 16 17
+19 bad 18
+20 one 2
+21 rol 2 3 20
+22 sort bitvec 3
+23 slice 22 3 2 0
+24 slice 1 3 3 3
+25 concat 2 23 24
+26 neq 1 21 25
+27 bad 26
+28 sort bitvec 8
+29 uext 28 3 4
+30 uext 28 4 4
+31 mul 28 29 30
+32 slice 2 31 7 4
+33 redor 1 32
+34 umulo 1 3 4
+35 xor 1 33 34
+36 bad 35
+37 implies 1 -33 -34
+38 bad -37
+)";
+
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(Btor2ReaderTests);
+class Btor2ReaderTests
+    : public ::testing::Test,
+      public ::testing::WithParamInterface<SolverConfiguration>
+{
+ protected:
+  void SetUp() override { s = create_solver(GetParam()); }
+  SmtSolver s;
+};
+
+TEST_P(Btor2ReaderTests, Counter)
+{
+  Btor2Reader r(s);
+  r.parse_string(counter);
+
+  ASSERT_EQ(r.states().size(), 2);
+  ASSERT_EQ(r.inputs().size(), 1);
+  ASSERT_EQ(r.bad().size(), 1);
+  ASSERT_EQ(r.constraints().size(), 1);
+  Term cnt = r.get_symbol("cnt");
+  Term mem = r.get_symbol("mem");
+  ASSERT_TRUE(cnt);
+  ASSERT_TRUE(mem);
+  EXPECT_EQ(r.lookup(4), cnt);
+  EXPECT_EQ(r.init().at(cnt), s->make_term(0, cnt->get_sort()));
+  EXPECT_EQ(r.init().at(mem)->get_sort(), mem->get_sort());
+  EXPECT_EQ(r.bad()[0]->get_sort()->get_sort_kind(), BOOL);
+
+  Sort bvsort = cnt->get_sort();
+  s->push();
+  s->assert_formula(s->make_term(
+      Distinct,
+      r.next().at(cnt),
+      s->make_term(BVAdd, cnt, s->make_term(1, bvsort))));
+  EXPECT_TRUE(s->check_sat().is_unsat());
+  s->pop();
+
+  s->push();
+  s->assert_formula(s->make_term(Not, r.constraints()[0]));
+  EXPECT_TRUE(s->check_sat().is_unsat());
+  s->pop();
+
+  s->assert_formula(r.bad()[0]);
+  s->assert_formula(
+      s->make_term(Equal, cnt, s->make_term("1111", bvsort, 2)));
+  EXPECT_TRUE(s->check_sat().is_sat());
+}
+
+TEST_P(Btor2ReaderTests, Encodings)
+{
+  Btor2Reader r(s);
+  r.parse_string(encodings);
+  ASSERT_EQ(r.bad().size(), 5);
+  for (const auto & b : r.bad())
+  {
+    s->push();
+    s->assert_formula(b);
+    EXPECT_TRUE(s->check_sat().is_unsat()) << b;
+    s->pop();
+  }
+}
+
+TEST_P(Btor2ReaderTests, File)
+{
+  string filename = "btor2-reader-test.btor2";
+  {
+    ofstream out(filename);
+    out << counter;
+  }
+  Btor2Reader r(s);
+  r.parse(filename);
+  std::remove(filename.c_str());
+  EXPECT_EQ(r.states().size(), 2);
+  EXPECT_EQ(r.bad().size(), 1);
+}
+
+TEST_P(Btor2ReaderTests, Errors)
+{
+  Btor2Reader r(s);
+  EXPECT_THROW(r.parse_string("1 sort bitvec 4\n2 input 3\n"), SmtException);
+  EXPECT_THROW(r.parse_string("1 frobnicate 4\n"), SmtException);
+  EXPECT_THROW(r.parse("does-not-exist.btor2"), IncorrectUsageException);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    ParameterizedSolverBtor2ReaderTests,
+    Btor2ReaderTests,
+    testing::ValuesIn(filter_non_generic_solver_configurations(
+        { THEORY_BV, CONSTARR })));
+
+}  // namespace smt_tests
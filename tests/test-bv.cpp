@@ -14,12 +14,14 @@
 **
 **/
 
+#include <bitset>
 #include <utility>
 #include <vector>
 
 #include "available_solvers.h"
 #include "gtest/gtest.h"
 #include "smt.h"
+#include "utils.h"
 
 using namespace smt;
 using namespace std;
@@ -55,6 +57,49 @@ TEST_P(BVTests, to_int)
 
 }
 
+TEST_P(BVTests, to_bv_words)
+{
+  // 512 bits: word k holds k + 1 in its low bits and a 1 in bit 63
+  Sort sort = s->make_sort(BV, 512);
+  string bits;
+  for (int k = 7; k >= 0; --k)
+  {
+    bitset<64> word((uint64_t(1) << 63) | (k + 1));
+    bits += word.to_string();
+  }
+  Term val = s->make_term(bits, sort, 2);
+
+  vector<uint64_t> words;
+  val->to_bv_words(words);
+  ASSERT_EQ(words.size(), 8);
+  for (uint64_t k = 0; k < 8; ++k)
+  {
+    EXPECT_EQ(words[k], (uint64_t(1) << 63) | (k + 1));
+  }
+
+  Term x = s->make_symbol("x", sort);
+  s->assert_formula(s->make_term(Equal, x, val));
+  ASSERT_TRUE(s->check_sat().is_sat());
+  vector<uint64_t> xwords;
+  s->get_bv_value(x, xwords);
+  EXPECT_EQ(xwords, words);
+  s->get_value(x)->to_bv_words(xwords);
+  EXPECT_EQ(xwords, words);
+
+  // odd width, and a value that doesn't fill the last word
+  Sort sort70 = s->make_sort(BV, 70);
+  s->make_term(5, sort70)->to_bv_words(words);
+  EXPECT_EQ(words, vector<uint64_t>({ 5, 0 }));
+
+  EXPECT_THROW(x->to_bv_words(words), IncorrectUsageException);
+
+  // printed forms parsed by the default implementation
+  bv_string_to_words("#x1f", 70, words);
+  EXPECT_EQ(words, vector<uint64_t>({ 0x1f, 0 }));
+  bv_string_to_words("(_ bv18446744073709551617 70)", 70, words);
+  EXPECT_EQ(words, vector<uint64_t>({ 1, 1 }));
+}
+
 INSTANTIATE_TEST_SUITE_P(
     ParameterizedSolverBVTests,
     BVTests,
@@ -0,0 +1,320 @@
+/*********************                                                        */
+/*! \file test-caching-solver.cpp
+** \verbatim
+** Top contributors (to current version):
+**   agent
+** This file is part of the smt-switch project.
+** Copyright (c) 2026 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved.  See the file LICENSE in the top-level source
+** directory for licensing information.\endverbatim
+**
+** \brief Tests for CachingSolver.
+**
+**
+**/
+
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "available_solvers.h"
+#include "caching_solver.h"
+#include "gtest/gtest.h"
+#include "smt.h"
+
+using namespace smt;
+using namespace std;
+
+namespace smt_tests {
+
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(CachingTests);
+class CachingTests : public ::testing::Test,
+                     public ::testing::WithParamInterface<SolverConfiguration>
+{
+ protected:
+  void SetUp() override
+  {
+    cs = make_shared<CachingSolver>(create_solver(GetParam()));
+    s = cs;
+    s->set_opt("produce-models", "true");
+    s->set_opt("incremental", "true");
+    boolsort = s->make_sort(BOOL);
+    bvsort = s->make_sort(BV, 8);
+    x = s->make_symbol("x", bvsort);
+    y = s->make_symbol("y", bvsort);
+  }
+  shared_ptr<CachingSolver> cs;
+  SmtSolver s;
+  Sort boolsort, bvsort;
+  Term x, y;
+};
+
+TEST_P(CachingTests, RepeatedQuery)
+{
+  Term x_lt_y = s->make_term(BVUlt, x, y);
+  s->assert_formula(x_lt_y);
+  Result r = s->check_sat();
+  ASSERT_TRUE(r.is_sat());
+  Term xv = s->get_value(x);
+  EXPECT_EQ(cs->num_misses(), 1);
+  EXPECT_EQ(cs->num_hits(), 0);
+
+  r = s->check_sat();
+  ASSERT_TRUE(r.is_sat());
+  EXPECT_EQ(cs->num_hits(), 1);
+  // answered from the cache
+  EXPECT_EQ(s->get_value(x), xv);
+  // y was recorded with x, the term is evaluated over the cached values
+  Term yv = s->get_value(y);
+  Term x_lt_y_v = s->get_value(x_lt_y);
+  EXPECT_EQ(x_lt_y_v, s->make_term(true));
+  EXPECT_EQ(s->get_value(y), yv);
+}
+
+TEST_P(CachingTests, ValuesFromOneModel)
+{
+  s->assert_formula(s->make_term(BVUlt, x, y));
+  ASSERT_TRUE(s->check_sat().is_sat());
+  s->get_value(x);
+
+  // the whole model was recorded, both come from the cache
+  ASSERT_TRUE(s->check_sat().is_sat());
+  Term xv = s->get_value(x);
+  Term yv = s->get_value(y);
+  EXPECT_LT(xv->to_int(), yv->to_int());
+
+  ASSERT_TRUE(s->check_sat().is_sat());
+  EXPECT_EQ(cs->num_hits(), 2);
+  EXPECT_EQ(s->get_value(x), xv);
+  EXPECT_EQ(s->get_value(y), yv);
+}
+
+TEST_P(CachingTests, HashCapacity)
+{
+  shared_ptr<CachingSolver> small =
+      make_shared<CachingSolver>(create_solver(GetParam()), 16, "", 4);
+  Sort bvsort1 = small->make_sort(BV, 8);
+  Term a = small->make_symbol("a", bvsort1);
+  Term b = small->make_symbol("b", bvsort1);
+  Term sum = a;
+  for (size_t i = 0; i < 8; ++i)
+  {
+    sum = small->make_term(BVAdd, sum, b);
+    small->assert_formula(small->make_term(BVUle, a, sum));
+    ASSERT_TRUE(small->check_sat().is_sat());
+    // the memo is cleared once it is full, so it holds at most the
+    // capacity plus the i + 4 terms of one assertion
+    EXPECT_LE(small->get_memory_stats().cache_entries["caching_hashes"],
+              4 + i + 4);
+  }
+  // the same query is still recognized
+  EXPECT_EQ(small->num_hits(), 0);
+  ASSERT_TRUE(small->check_sat().is_sat());
+  EXPECT_EQ(small->num_hits(), 1);
+}
+
+// gives access to the cache entries to simulate a key collision
+class CollidingCachingSolver : public CachingSolver
+{
+ public:
+  CollidingCachingSolver(SmtSolver s) : CachingSolver(s) {}
+
+  void corrupt_entries()
+  {
+    for (auto & elem : entries_)
+    {
+      // another query with the same key
+      elem.second.first->assertions.push_back(0);
+      elem.second.first->result = Result(UNSAT);
+    }
+  }
+};
+
+TEST_P(CachingTests, KeyCollision)
+{
+  shared_ptr<CollidingCachingSolver> ccs =
+      make_shared<CollidingCachingSolver>(create_solver(GetParam()));
+  Sort bvsort1 = ccs->make_sort(BV, 8);
+  Term a = ccs->make_symbol("a", bvsort1);
+  Term b = ccs->make_symbol("b", bvsort1);
+  ccs->assert_formula(ccs->make_term(BVUlt, a, b));
+  ASSERT_TRUE(ccs->check_sat().is_sat());
+
+  ccs->corrupt_entries();
+  ASSERT_TRUE(ccs->check_sat().is_sat());
+  EXPECT_EQ(ccs->num_hits(), 0);
+  EXPECT_EQ(ccs->num_misses(), 2);
+}
+
+// gives access to the cache entries to change the cached models
+class ModelEditingCachingSolver : public CachingSolver
+{
+ public:
+  ModelEditingCachingSolver(SmtSolver s) : CachingSolver(s) {}
+
+  void set_value(const Term & sym, const Term & val)
+  {
+    for (auto & elem : entries_)
+    {
+      elem.second.first->values[sym] = val;
+      elem.second.first->value_strs[sym->to_string()] = val->to_string();
+    }
+  }
+
+  void forget_value(const Term & sym)
+  {
+    for (auto & elem : entries_)
+    {
+      elem.second.first->values.erase(sym);
+      elem.second.first->value_strs.erase(sym->to_string());
+    }
+  }
+};
+
+TEST_P(CachingTests, PartialCachedModel)
+{
+  shared_ptr<ModelEditingCachingSolver> mcs =
+      make_shared<ModelEditingCachingSolver>(create_solver(GetParam()));
+  mcs->set_opt("produce-models", "true");
+  Sort bvsort1 = mcs->make_sort(BV, 8);
+  Term a = mcs->make_symbol("a", bvsort1);
+  Term b = mcs->make_symbol("b", bvsort1);
+  Term a_plus_1 = mcs->make_term(BVAdd, a, mcs->make_term(1, bvsort1));
+  mcs->assert_formula(mcs->make_term(Equal, b, a_plus_1));
+  ASSERT_TRUE(mcs->check_sat().is_sat());
+  int64_t av = mcs->get_value(a)->to_int();
+
+  // another model of the query, of which only a is cached
+  mcs->set_value(a, mcs->make_term((av + 10) % 256, bvsort1));
+  mcs->forget_value(b);
+
+  ASSERT_TRUE(mcs->check_sat().is_sat());
+  EXPECT_EQ(mcs->num_hits(), 1);
+  Term a_val = mcs->get_value(a);
+  Term b_val = mcs->get_value(b);
+  EXPECT_EQ((a_val->to_int() + 1) % 256, b_val->to_int());
+  EXPECT_EQ(mcs->get_value(a_plus_1), b_val);
+}
+
+TEST_P(CachingTests, TermsOverCachedModel)
+{
+  shared_ptr<ModelEditingCachingSolver> mcs =
+      make_shared<ModelEditingCachingSolver>(create_solver(GetParam()));
+  mcs->set_opt("produce-models", "true");
+  Sort bvsort1 = mcs->make_sort(BV, 8);
+  Term a = mcs->make_symbol("a", bvsort1);
+  Term b = mcs->make_symbol("b", bvsort1);
+  Term a_plus_1 = mcs->make_term(BVAdd, a, mcs->make_term(1, bvsort1));
+  mcs->assert_formula(mcs->make_term(Equal, b, a_plus_1));
+  ASSERT_TRUE(mcs->check_sat().is_sat());
+  int64_t av = mcs->get_value(a)->to_int();
+
+  // another whole model of the query
+  int64_t new_av = (av + 10) % 256;
+  mcs->set_value(a, mcs->make_term(new_av, bvsort1));
+  mcs->set_value(b, mcs->make_term((new_av + 1) % 256, bvsort1));
+
+  ASSERT_TRUE(mcs->check_sat().is_sat());
+  EXPECT_EQ(mcs->num_hits(), 1);
+  EXPECT_EQ(mcs->get_value(a)->to_int(), new_av);
+  // evaluated over the cached model, not the one of the wrapped solver
+  EXPECT_EQ(mcs->get_value(a_plus_1)->to_int(), (new_av + 1) % 256);
+  EXPECT_EQ(mcs->get_value(b)->to_int(), (new_av + 1) % 256);
+}
+
+TEST_P(CachingTests, Scopes)
+{
+  s->push();
+  s->assert_formula(s->make_term(Equal, x, y));
+  ASSERT_TRUE(s->check_sat().is_sat());
+  s->assert_formula(s->make_term(Distinct, x, y));
+  ASSERT_TRUE(s->check_sat().is_unsat());
+  s->pop();
+
+  ASSERT_TRUE(s->check_sat().is_sat());
+  EXPECT_EQ(cs->num_hits(), 0);
+
+  // the same assertions again, in a different order
+  s->push();
+  s->assert_formula(s->make_term(Distinct, x, y));
+  s->assert_formula(s->make_term(Equal, x, y));
+  ASSERT_TRUE(s->check_sat().is_unsat());
+  s->pop();
+  EXPECT_EQ(cs->num_hits(), 1);
+}
+
+TEST_P(CachingTests, UnsatCore)
+{
+  Term a = s->make_symbol("a", boolsort);
+  Term b = s->make_symbol("b", boolsort);
+  Term c = s->make_symbol("c", boolsort);
+  Term nb = s->make_term(Not, b);
+
+  Result r = s->check_sat_assuming({ a, b, c, nb });
+  ASSERT_TRUE(r.is_unsat());
+  UnorderedTermSet core;
+  s->get_unsat_assumptions(core);
+  ASSERT_TRUE(core.find(b) != core.end());
+  ASSERT_TRUE(core.find(nb) != core.end());
+
+  // same assumptions in a different order
+  r = s->check_sat_assuming({ nb, c, b, a });
+  ASSERT_TRUE(r.is_unsat());
+  EXPECT_EQ(cs->num_hits(), 1);
+  UnorderedTermSet cached_core;
+  s->get_unsat_assumptions(cached_core);
+  EXPECT_EQ(core, cached_core);
+}
+
+TEST_P(CachingTests, CacheFile)
+{
+  // a unique file, so that parallel runs don't share it
+  string filename = ::testing::TempDir() + "caching-solver-XXXXXX";
+  int fd = mkstemp(&filename[0]);
+  ASSERT_NE(fd, -1);
+  close(fd);
+
+  // keep the value as a string -- terms can't outlive their solver
+  string xv;
+  {
+    SmtSolver s1 =
+        create_caching_solver(create_solver(GetParam()), 16, filename);
+    s1->set_opt("produce-models", "true");
+    Sort bvsort1 = s1->make_sort(BV, 8);
+    Term x1 = s1->make_symbol("x", bvsort1);
+    Term y1 = s1->make_symbol("y", bvsort1);
+    s1->assert_formula(s1->make_term(BVUlt, x1, y1));
+    ASSERT_TRUE(s1->check_sat().is_sat());
+    xv = s1->get_value(x1)->to_string();
+  }
+
+  {
+    // a fresh solver with the same query
+    shared_ptr<CachingSolver> cs2 =
+        make_shared<CachingSolver>(create_solver(GetParam()), 16, filename);
+    cs2->set_opt("produce-models", "true");
+    Sort bvsort2 = cs2->make_sort(BV, 8);
+    Term x2 = cs2->make_symbol("x", bvsort2);
+    Term y2 = cs2->make_symbol("y", bvsort2);
+    cs2->assert_formula(cs2->make_term(BVUlt, x2, y2));
+    ASSERT_TRUE(cs2->check_sat().is_sat());
+    EXPECT_EQ(cs2->num_hits(), 1);
+    EXPECT_EQ(cs2->get_value(x2)->to_string(), xv);
+  }
+
+  // the destructor of cs2 wrote the file again
+  std::remove(filename.c_str());
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    ParameterizedSolverCachingTests,
+    CachingTests,
+    testing::ValuesIn(filter_non_generic_solver_configurations(
+        { THEORY_BV, UNSAT_CORE })));
+
+}  // namespace smt_tests
@@ -0,0 +1,186 @@
+/*********************                                                        */
+/*! \file test-concurrent-solver.cpp
+** \verbatim
+** Top contributors (to current version):
+**   agent
+** This file is part of the smt-switch project.
+** Copyright (c) 2026 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved.  See the file LICENSE in the top-level source
+** directory for licensing information.\endverbatim
+**
+** \brief Tests for sharing a solver between threads with ConcurrentSolver
+**
+**
+**/
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "available_solvers.h"
+#include "concurrent_solver.h"
+#include "gtest/gtest.h"
+#include "smt.h"
+
+using namespace smt;
+using namespace std;
+
+namespace smt_tests {
+
+const size_t NUM_THREADS = 8;
+
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(ConcurrentTests);
+class ConcurrentTests
+    : public ::testing::Test,
+      public ::testing::WithParamInterface<SolverConfiguration>
+{
+ protected:
+  void SetUp() override
+  {
+    cs = make_shared<ConcurrentSolver>(create_solver(GetParam()));
+    s = cs;
+    s->set_opt("produce-models", "true");
+    s->set_opt("incremental", "true");
+    bvsort = s->make_sort(BV, 8);
+    x = s->make_symbol("x", bvsort);
+    y = s->make_symbol("y", bvsort);
+  }
+  shared_ptr<ConcurrentSolver> cs;
+  SmtSolver s;
+  Sort bvsort;
+  Term x, y;
+};
+
+TEST_P(ConcurrentTests, BuildFromThreads)
+{
+  vector<thread> threads;
+  for (size_t i = 0; i < NUM_THREADS; ++i)
+  {
+    threads.emplace_back([this, i]() {
+      Term z = s->make_symbol("z" + std::to_string(i), bvsort);
+      Term sum = z;
+      for (size_t j = 0; j < 100; ++j)
+      {
+        sum = s->make_term(BVAdd, sum, j % 2 ? x : y);
+      }
+      s->assert_formula(s->make_term(Equal, sum, s->make_term(i, bvsort)));
+    });
+  }
+  for (auto & t : threads)
+  {
+    t.join();
+  }
+
+  ASSERT_TRUE(s->check_sat().is_sat());
+  for (size_t i = 0; i < NUM_THREADS; ++i)
+  {
+    Term z = s->get_symbol("z" + std::to_string(i));
+    EXPECT_TRUE(s->get_value(z)->is_value());
+  }
+}
+
+TEST_P(ConcurrentTests, SameTermFromThreads)
+{
+  vector<Term> results(NUM_THREADS);
+  vector<thread> threads;
+  for (size_t i = 0; i < NUM_THREADS; ++i)
+  {
+    threads.emplace_back([this, i, &results]() {
+      Term t = x;
+      for (size_t j = 0; j < 100; ++j)
+      {
+        t = s->make_term(BVMul, t, s->make_term(BVAdd, x, y));
+      }
+      results[i] = t;
+    });
+  }
+  for (auto & t : threads)
+  {
+    t.join();
+  }
+
+  for (size_t i = 1; i < NUM_THREADS; ++i)
+  {
+    EXPECT_EQ(results[0], results[i]);
+    if (GetParam().is_logging_solver)
+    {
+      // hash-consed to the same LoggingTerm
+      EXPECT_EQ(results[0].get(), results[i].get());
+    }
+  }
+}
+
+TEST_P(ConcurrentTests, Batch)
+{
+  Term x_lt_y = s->make_term(BVUlt, x, y);
+  vector<thread> threads;
+  vector<Result> results(NUM_THREADS);
+  for (size_t i = 0; i < NUM_THREADS; ++i)
+  {
+    threads.emplace_back([this, i, &x_lt_y, &results]() {
+      results[i] = cs->batch([&]() {
+        s->push();
+        s->assert_formula(x_lt_y);
+        if (i % 2)
+        {
+          s->assert_formula(s->make_term(BVUlt, y, x));
+        }
+        Result r = s->check_sat();
+        s->pop();
+        return r;
+      });
+    });
+  }
+  for (auto & t : threads)
+  {
+    t.join();
+  }
+
+  for (size_t i = 0; i < NUM_THREADS; ++i)
+  {
+    EXPECT_EQ(results[i].is_sat(), i % 2 == 0);
+  }
+  EXPECT_EQ(s->get_context_level(), 0);
+}
+
+TEST_P(ConcurrentTests, SeparateInstances)
+{
+  SolverConfiguration sc = GetParam();
+  if (!solver_has_attribute(sc.solver_enum, CONCURRENT_INSTANCES))
+  {
+    return;
+  }
+
+  vector<Result> results(NUM_THREADS);
+  vector<thread> threads;
+  for (size_t i = 0; i < NUM_THREADS; ++i)
+  {
+    threads.emplace_back([&sc, i, &results]() {
+      SmtSolver solver = create_solver(sc);
+      Sort bvs = solver->make_sort(BV, 8);
+      Term a = solver->make_symbol("a", bvs);
+      solver->assert_formula(solver->make_term(
+          Equal,
+          solver->make_term(BVMul, a, solver->make_term(3, bvs)),
+          solver->make_term(i, bvs)));
+      results[i] = solver->check_sat();
+    });
+  }
+  for (auto & t : threads)
+  {
+    t.join();
+  }
+
+  for (const auto & r : results)
+  {
+    EXPECT_TRUE(r.is_sat());
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    ParameterizedConcurrentTests,
+    ConcurrentTests,
+    testing::ValuesIn(filter_solver_configurations({ THEORY_BV })));
+
+}  // namespace smt_tests
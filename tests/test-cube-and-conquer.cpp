@@ -0,0 +1,190 @@
+/*********************                                                        */
+/*! \file test-cube-and-conquer.cpp
+** \verbatim
+** Top contributors (to current version):
+**   agent
+** This file is part of the smt-switch project.
+** Copyright (c) 2026 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved.  See the file LICENSE in the top-level source
+** directory for licensing information.\endverbatim
+**
+** \brief Tests for CubeAndConquer.
+**
+**
+**/
+
+#include <utility>
+#include <vector>
+
+#include "available_solvers.h"
+#include "cube_and_conquer.h"
+#include "gtest/gtest.h"
+#include "profiling_solver.h"
+#include "smt.h"
+
+using namespace smt;
+using namespace std;
+
+namespace smt_tests {
+
+/** reports a core made of a term the caller never used as an assumption */
+class ForeignCoreSolver : public ProfilingSolver
+{
+ public:
+  ForeignCoreSolver(SmtSolver s) : ProfilingSolver(s) {}
+
+  void get_unsat_assumptions(UnorderedTermSet & out) override
+  {
+    if (!foreign)
+    {
+      foreign = make_symbol("foreign_core_term", make_sort(BOOL));
+    }
+    out.clear();
+    out.insert(foreign);
+  }
+
+  Term foreign;
+};
+
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(CubeAndConquerTests);
+class CubeAndConquerTests
+    : public ::testing::Test,
+      public ::testing::WithParamInterface<SolverConfiguration>
+{
+ protected:
+  void SetUp() override
+  {
+    s = create_solver(GetParam());
+    boolsort = s->make_sort(BOOL);
+    for (size_t i = 0; i < 2; ++i)
+    {
+      SmtSolver w = create_solver(GetParam());
+      w->set_opt("produce-models", "true");
+      workers.push_back(w);
+    }
+  }
+
+  /** pigeons in holes, each pigeon in some hole and no two in the same */
+  Term pigeonhole(size_t pigeons, size_t holes)
+  {
+    vector<vector<Term>> p(pigeons);
+    Term res = s->make_term(true);
+    for (size_t i = 0; i < pigeons; ++i)
+    {
+      Term some_hole = s->make_term(false);
+      for (size_t j = 0; j < holes; ++j)
+      {
+        p[i].push_back(s->make_symbol(
+            "p_" + std::to_string(i) + "_" + std::to_string(j), boolsort));
+        some_hole = s->make_term(Or, some_hole, p[i][j]);
+      }
+      res = s->make_term(And, res, some_hole);
+    }
+    for (size_t j = 0; j < holes; ++j)
+    {
+      for (size_t i = 0; i < pigeons; ++i)
+      {
+        for (size_t k = i + 1; k < pigeons; ++k)
+        {
+          res = s->make_term(
+              And,
+              res,
+              s->make_term(Not, s->make_term(And, p[i][j], p[k][j])));
+        }
+      }
+    }
+    return res;
+  }
+
+  SmtSolver s;
+  Sort boolsort;
+  vector<SmtSolver> workers;
+};
+
+TEST_P(CubeAndConquerTests, PigeonholeUnsat)
+{
+  CubeAndConquer cc(workers, pigeonhole(5, 4));
+  cc.set_max_depth(4);
+  ASSERT_TRUE(cc.solve().is_unsat());
+
+  const CubeStats & stats = cc.get_stats();
+  EXPECT_GT(stats.cubes_solved, 0);
+  EXPECT_EQ(stats.solved_per_worker.size(), 2);
+  // every generated cube is split, solved or pruned
+  EXPECT_EQ(stats.cubes_generated,
+            (stats.cubes_generated - 1) / 2 + stats.cubes_solved
+                + stats.cubes_pruned);
+}
+
+TEST_P(CubeAndConquerTests, PigeonholeSat)
+{
+  CubeAndConquer cc(workers, pigeonhole(4, 4));
+  cc.set_heuristic(CUBE_OCCURRENCE);
+  ASSERT_TRUE(cc.solve().is_sat());
+
+  SmtSolver w = workers[cc.get_sat_worker()];
+  for (const auto & l : cc.get_sat_cube())
+  {
+    EXPECT_EQ(w->get_value(l), w->make_term(true));
+  }
+}
+
+TEST_P(CubeAndConquerTests, BVSplit)
+{
+  Sort bvsort = s->make_sort(BV, 8);
+  Term x = s->make_symbol("x", bvsort);
+  Term y = s->make_symbol("y", bvsort);
+  Term one = s->make_term(1, bvsort);
+  Term f = s->make_term(
+      And,
+      s->make_term(Equal, s->make_term(BVMul, x, y), s->make_term(35, bvsort)),
+      s->make_term(And,
+                   s->make_term(BVUgt, x, one),
+                   s->make_term(BVUlt, x, y)));
+  f = s->make_term(
+      And, f, s->make_term(BVUlt, y, s->make_term(16, bvsort)));
+
+  CubeAndConquer cc(workers, f, { x });
+  cc.set_heuristic(CUBE_STATIC);
+  ASSERT_TRUE(cc.solve().is_sat());
+  // one split literal per bit, so at most a full tree of depth 8
+  EXPECT_LE(cc.get_stats().cubes_generated, (1 << 9) - 1);
+
+  // x = 5, y = 7 is the only solution
+  SmtSolver w = workers[cc.get_sat_worker()];
+  Term wx = w->get_symbol("x");
+  EXPECT_EQ(w->get_value(wx), w->make_term(5, w->make_sort(BV, 8)));
+}
+
+TEST_P(CubeAndConquerTests, UnknownCoreTerms)
+{
+  Term a = s->make_symbol("a", boolsort);
+  Term b = s->make_symbol("b", boolsort);
+  Term f = s->make_term(And, s->make_term(Not, a), b);
+
+  // with one worker, the cube {a} is solved first and is unsat
+  // its core cannot be mapped, so it must neither prove the formula
+  // unsat nor prune the cube {not a}
+  SmtSolver w = std::make_shared<ForeignCoreSolver>(create_solver(GetParam()));
+  w->set_opt("produce-models", "true");
+  CubeAndConquer cc({ w }, f, { a, b });
+  cc.set_heuristic(CUBE_STATIC);
+  ASSERT_TRUE(cc.solve().is_sat());
+  EXPECT_GE(cc.get_stats().cubes_solved, 2);
+
+  TermVec cube = cc.get_sat_cube();
+  ASSERT_EQ(cube.size(), 2);
+  for (const auto & l : cube)
+  {
+    EXPECT_EQ(w->get_value(l), w->make_term(true));
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    ParameterizedSolverCubeAndConquerTests,
+    CubeAndConquerTests,
+    testing::ValuesIn(filter_non_generic_solver_configurations(
+        { THEORY_BV, UNSAT_CORE })));
+
+}  // namespace smt_tests
@@ -101,6 +101,16 @@ TEST_P(DTTests, DatatypeDecl)
     assert(gdt->get_num_constructors() == 1);
     assert(gdt->get_num_selectors("constest") == 0);
     assert(gdt->get_name() == "secondtestdt");
+    EXPECT_EQ(gdt->get_constructor_index("constest"), 0);
+    EXPECT_EQ(gdt->get_constructor_index("missing"), -1);
+    EXPECT_EQ(gdt->get_cons_decl(0), cons2test);
+    SelectorComponents sel{ "sel", s->make_sort(INT), true };
+    gdt->add_selector(cons2test, sel);
+    EXPECT_EQ(cons2test->get_selector_index("sel"), 0);
+    EXPECT_EQ(cons2test->get_selector_index("missing"), -1);
+    // constructor names must be unique within a datatype
+    EXPECT_ANY_THROW(gdt->add_constructor(
+        make_shared<GenericDatatypeConstructorDecl>("constest")));
 
     DatatypeConstructorDecl nildecl = s->make_datatype_constructor_decl("nil");
     DatatypeConstructorDecl consdecl = s->make_datatype_constructor_decl("cons");
@@ -182,6 +192,100 @@ TEST_P(DTTests, DatatypeDecl)
     EXPECT_THROW(listdt->get_num_selectors("kons"), InternalSolverException);
 }
 
+TEST_P(DTTests, MutuallyRecursive)
+{
+  // tree = leaf(val Int) | node(children forest)
+  // forest = empty | add(first tree, rest forest)
+  DatatypeDecl treeSpec = s->make_datatype_decl("tree");
+  DatatypeDecl forestSpec = s->make_datatype_decl("forest");
+  Sort unres_forest;
+  try
+  {
+    unres_forest = s->make_unresolved_sort(forestSpec);
+  }
+  catch (NotImplementedException & e)
+  {
+    return;
+  }
+
+  DatatypeConstructorDecl leaf = s->make_datatype_constructor_decl("leaf");
+  s->add_selector(leaf, "val", intsort);
+  DatatypeConstructorDecl node = s->make_datatype_constructor_decl("node");
+  s->add_selector(node, "children", unres_forest);
+  s->add_constructor(treeSpec, leaf);
+  s->add_constructor(treeSpec, node);
+
+  Sort unres_tree = s->make_unresolved_sort(treeSpec);
+  DatatypeConstructorDecl empty = s->make_datatype_constructor_decl("empty");
+  DatatypeConstructorDecl add = s->make_datatype_constructor_decl("add");
+  s->add_selector(add, "first", unres_tree);
+  s->add_selector_self(add, "rest");
+  s->add_constructor(forestSpec, empty);
+  s->add_constructor(forestSpec, add);
+
+  SortVec sorts = s->make_datatype_sorts({ treeSpec, forestSpec });
+  ASSERT_EQ(sorts.size(), 2);
+  Sort treesort = sorts[0];
+  Sort forestsort = sorts[1];
+  EXPECT_EQ(treesort->get_sort_kind(), DATATYPE);
+  EXPECT_EQ(forestsort->get_sort_kind(), DATATYPE);
+  EXPECT_NE(treesort, forestsort);
+  EXPECT_EQ(treesort->get_datatype()->get_name(), "tree");
+  EXPECT_EQ(forestsort->get_datatype()->get_num_constructors(), 2);
+  EXPECT_EQ(forestsort->get_datatype()->get_num_selectors("add"), 2);
+
+  Term children = s->get_selector(treesort, "node", "children");
+  Term first = s->get_selector(forestsort, "add", "first");
+  EXPECT_EQ(children->get_sort()->get_codomain_sort(), forestsort);
+  EXPECT_EQ(first->get_sort()->get_codomain_sort(), treesort);
+
+  Term five = s->make_term(5, intsort);
+  Term leaf5 = s->make_term(
+      Apply_Constructor, s->get_constructor(treesort, "leaf"), five);
+  Term f = s->make_term(Apply_Constructor,
+                        s->get_constructor(forestsort, "add"),
+                        leaf5,
+                        s->make_term(Apply_Constructor,
+                                     s->get_constructor(forestsort, "empty")));
+  Term t = s->make_symbol("t", treesort);
+  EXPECT_EQ(f->get_sort(), forestsort);
+  s->assert_formula(s->make_term(
+      Equal,
+      t,
+      s->make_term(
+          Apply_Constructor, s->get_constructor(treesort, "node"), f)));
+  s->assert_formula(s->make_term(
+      Apply_Tester,
+      s->get_tester(treesort, "leaf"),
+      s->make_term(Apply_Selector, first, s->make_term(Apply_Selector, children, t))));
+  ASSERT_TRUE(s->check_sat().is_sat());
+}
+
+TEST_P(DTTests, UninterpretedSortNamedLikeDatatype)
+{
+  // only placeholders from make_unresolved_sort refer to the datatype,
+  // not other sorts with its name
+  Sort boxsort;
+  try
+  {
+    boxsort = s->make_sort("box", 0);
+  }
+  catch (SmtException & e)
+  {
+    return;
+  }
+  DatatypeDecl boxSpec = s->make_datatype_decl("box");
+  DatatypeConstructorDecl wrap = s->make_datatype_constructor_decl("wrap");
+  s->add_selector(wrap, "contents", boxsort);
+  s->add_constructor(boxSpec, wrap);
+  Sort dtsort = s->make_sort(boxSpec);
+
+  Term contents = s->get_selector(dtsort, "wrap", "contents");
+  EXPECT_EQ(contents->get_sort()->get_codomain_sort()->get_sort_kind(),
+            UNINTERPRETED);
+  EXPECT_NE(contents->get_sort()->get_codomain_sort(), dtsort);
+}
+
 INSTANTIATE_TEST_SUITE_P(ParameterizedSolverDTTests,
                          DTTests,
                          testing::ValuesIn(filter_solver_configurations({ THEORY_DATATYPE })));
@@ -81,6 +81,30 @@ TEST_P(LoggingTests, HashConsing)
   EXPECT_EQ(xp1.get(), xp1_2.get());
 }
 
+TEST_P(LoggingTests, DeadTermsAreFreed)
+{
+  weak_ptr<AbsTerm> w;
+  {
+    Term xp2 = s->make_term(BVAdd, x, s->make_term(2, bvsort4));
+    w = xp2;
+    ASSERT_FALSE(w.expired());
+  }
+  // the hash-consing table does not keep the term alive
+  EXPECT_TRUE(w.expired());
+
+  // rebuilding it hash-conses to a new term
+  Term xp2 = s->make_term(BVAdd, x, s->make_term(2, bvsort4));
+  EXPECT_EQ(xp2, s->make_term(BVAdd, x, s->make_term(2, bvsort4)));
+
+  // long churn keeps the table small
+  for (size_t i = 0; i < 20000; ++i)
+  {
+    s->make_term(BVMul, x, s->make_term(i % 16, bvsort4));
+  }
+  EXPECT_LT(s->get_memory_stats().cache_entries.at("logging_hashtable"),
+            5000);
+}
+
 TEST_P(LoggingTests, Sorts)
 {
   Term cond = s->make_term(BVUge, x, zero);
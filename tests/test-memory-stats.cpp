@@ -0,0 +1,221 @@
+/*********************                                                        */
+/*! \file test-memory-stats.cpp
+** \verbatim
+** Top contributors (to current version):
+**   agent
+** This file is part of the smt-switch project.
+** Copyright (c) 2026 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved.  See the file LICENSE in the top-level source
+** directory for licensing information.\endverbatim
+**
+** \brief Tests for memory accounting and bounded caches
+**
+**
+**/
+
+#include <sstream>
+#include <vector>
+
+#include "available_solvers.h"
+#include "gtest/gtest.h"
+#include "identity_walker.h"
+#include "smt.h"
+#include "substitution_walker.h"
+#include "term_translator.h"
+#include "utils.h"
+
+using namespace smt;
+using namespace std;
+
+namespace smt_tests {
+
+class NamesTranslator : public TermTranslator
+{
+ public:
+  NamesTranslator(const SmtSolver & s) : TermTranslator(s) {}
+  size_t num_names() const { return symbol_names.size(); }
+};
+
+// visits another term from the post-order step of every term
+class NestedVisitWalker : public SubstitutionWalker
+{
+ public:
+  NestedVisitWalker(const SmtSolver & solver,
+                    const UnorderedTermMap & smap,
+                    const Term & other)
+      : SubstitutionWalker(solver, smap), other_(other)
+  {
+  }
+
+ protected:
+  WalkerStepResult visit_term(Term & term) override
+  {
+    if (!preorder_ && !nested_)
+    {
+      nested_ = true;
+      visit(other_);
+      nested_ = false;
+      preorder_ = false;
+    }
+    return IdentityWalker::visit_term(term);
+  }
+
+  Term other_;
+  bool nested_ = false;
+};
+
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(MemoryStatsTests);
+class MemoryStatsTests
+    : public ::testing::Test,
+      public ::testing::WithParamInterface<SolverConfiguration>
+{
+ protected:
+  void SetUp() override
+  {
+    s = create_solver(GetParam());
+    bvsort = s->make_sort(BV, 8);
+    x = s->make_symbol("x", bvsort);
+    y = s->make_symbol("y", bvsort);
+  }
+
+  // a chain of n distinct terms over x
+  Term make_chain(size_t n)
+  {
+    Term t = x;
+    for (size_t i = 0; i < n; ++i)
+    {
+      t = s->make_term(BVAdd, t, s->make_term(i, bvsort));
+    }
+    return t;
+  }
+
+  SmtSolver s;
+  Sort bvsort;
+  Term x, y;
+};
+
+TEST_P(MemoryStatsTests, LiveObjects)
+{
+  SolverConfiguration sc = GetParam();
+  MemoryStats before = s->get_memory_stats();
+  EXPECT_GT(before.rss_kb, 0);
+
+  TermVec terms;
+  for (size_t i = 0; i < 100; ++i)
+  {
+    terms.push_back(s->make_term(BVAdd, x, s->make_term(i, bvsort)));
+  }
+
+  // the terms of another solver are not counted
+  SmtSolver s2 = create_solver(sc);
+  Sort bvsort2 = s2->make_sort(BV, 8);
+  uint64_t before2 = s2->get_memory_stats().live_terms;
+  TermVec terms2;
+  for (size_t i = 0; i < 50; ++i)
+  {
+    terms2.push_back(s2->make_symbol("z" + std::to_string(i), bvsort2));
+  }
+
+  if (sc.is_logging_solver || solver_has_attribute(sc.solver_enum, INTERNED_TERMS))
+  {
+    // the solver keeps its symbols alive
+    EXPECT_GE(before.live_terms, 2);
+    EXPECT_GE(s->get_memory_stats().live_terms, before.live_terms + 100);
+    EXPECT_EQ(s2->get_memory_stats().live_terms, before2 + 50);
+    terms.clear();
+    EXPECT_EQ(s->get_memory_stats().live_terms, before.live_terms);
+  }
+
+  if (sc.is_logging_solver)
+  {
+    EXPECT_GE(s->get_memory_stats().cache_entries.at("logging_hashtable"),
+              2);
+  }
+
+  ostringstream ss;
+  ss << s->get_memory_stats();
+  EXPECT_NE(ss.str().find("live terms"), string::npos);
+}
+
+TEST_P(MemoryStatsTests, BoundedWalkerCache)
+{
+  Term z = s->make_symbol("z", bvsort);
+  UnorderedTermMap subst{ { x, z } };
+  SubstitutionWalker sw(s, subst);
+  sw.set_cache_limit(50);
+
+  for (size_t n = 10; n < 200; n += 10)
+  {
+    Term chain = make_chain(n);
+    Term res = sw.visit(chain);
+    // the substitution survives trimming the cache
+    UnorderedTermSet free_symbols;
+    get_free_symbols(res, free_symbols);
+    EXPECT_EQ(free_symbols.count(x), 0);
+    EXPECT_EQ(free_symbols.count(z), 1);
+    // trimmed at the start of each visit
+    EXPECT_LE(sw.cache_size(), 2 * n + 2 + 50);
+  }
+}
+
+TEST_P(MemoryStatsTests, BoundedWalkerCacheNestedVisit)
+{
+  Term z = s->make_symbol("z", bvsort);
+  UnorderedTermMap subst{ { x, z } };
+  NestedVisitWalker nw(s, subst, y);
+  nw.set_cache_limit(5);
+
+  for (size_t n = 10; n < 50; n += 10)
+  {
+    // a nested visit must not trim the children of the outer traversal
+    Term chain = make_chain(n);
+    Term res = nw.visit(chain);
+    UnorderedTermSet free_symbols;
+    get_free_symbols(res, free_symbols);
+    EXPECT_EQ(free_symbols.count(x), 0);
+    EXPECT_EQ(free_symbols.count(z), 1);
+  }
+}
+
+TEST_P(MemoryStatsTests, BoundedTranslatorCache)
+{
+  SmtSolver s2 = create_solver(GetParam());
+  TermTranslator tt(s2);
+  tt.set_cache_limit(20);
+
+  // entries added by the user are never dropped
+  Term xy = s->make_term(BVAdd, x, y);
+  Term user_xy = s2->make_term(7, s2->make_sort(BV, 8));
+  tt.get_cache()[xy] = user_xy;
+
+  for (size_t n = 10; n < 100; n += 10)
+  {
+    Term t = tt.transfer_term(make_chain(n));
+    EXPECT_EQ(t->get_sort()->get_width(), 8);
+    // the symbols are never dropped, so they are not declared again
+    EXPECT_LE(tt.get_cache().size(), 3 + 20 + 2 * n + 1);
+  }
+  EXPECT_EQ(tt.transfer_term(x), s2->get_symbol("x"));
+  EXPECT_EQ(tt.transfer_term(xy), user_xy);
+}
+
+TEST_P(MemoryStatsTests, BoundedTranslatorNames)
+{
+  SmtSolver s2 = create_solver(GetParam());
+  NamesTranslator tt(s2);
+  tt.set_cache_limit(20);
+  for (size_t i = 0; i < 200; ++i)
+  {
+    Term z = s->make_symbol("z" + std::to_string(i), bvsort);
+    tt.transfer_term(s->make_term(BVAdd, x, z));
+    EXPECT_LE(tt.num_names(), 2 * 20 + 2);
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    ParameterizedMemoryStatsTests,
+    MemoryStatsTests,
+    testing::ValuesIn(filter_non_generic_solver_configurations({ THEORY_BV })));
+
+}  // namespace smt_tests
@@ -0,0 +1,165 @@
+/*********************                                                        */
+/*! \file test-model.cpp
+** \verbatim
+** Top contributors (to current version):
+**   agent
+** This file is part of the smt-switch project.
+** Copyright (c) 2026 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved.  See the file LICENSE in the top-level source
+** directory for licensing information.\endverbatim
+**
+** \brief Tests for Model snapshots.
+**
+**
+**/
+
+#include <sstream>
+#include <utility>
+#include <vector>
+
+#include "available_solvers.h"
+#include "gtest/gtest.h"
+#include "model.h"
+#include "smt.h"
+
+using namespace smt;
+using namespace std;
+
+namespace smt_tests {
+
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(ModelTests);
+class ModelTests : public ::testing::Test,
+                   public ::testing::WithParamInterface<SolverConfiguration>
+{
+ protected:
+  void SetUp() override
+  {
+    s = create_solver(GetParam());
+    s->set_opt("produce-models", "true");
+    boolsort = s->make_sort(BOOL);
+    bvsort = s->make_sort(BV, 8);
+    widesort = s->make_sort(BV, 100);
+    x = s->make_symbol("x", bvsort);
+    y = s->make_symbol("y", bvsort);
+    w = s->make_symbol("w", widesort);
+    b = s->make_symbol("b", boolsort);
+  }
+  SmtSolver s;
+  Sort boolsort, bvsort, widesort;
+  Term x, y, w, b;
+};
+
+TEST_P(ModelTests, BitVectors)
+{
+  s->assert_formula(s->make_term(Equal, x, s->make_term(200, bvsort)));
+  s->assert_formula(s->make_term(BVUlt, y, x));
+  s->assert_formula(s->make_term(BVUgt, y, s->make_term(198, bvsort)));
+  s->assert_formula(s->make_term(
+      Equal, w, s->make_term("1" + string(99, '0'), widesort, 2)));
+  s->assert_formula(b);
+  ASSERT_TRUE(s->check_sat().is_sat());
+
+  Model m(s, { x, y, w, b });
+  ASSERT_EQ(m.size(), 4);
+  EXPECT_EQ(m.get_id("y"), 1);
+  EXPECT_EQ(m.get_id(x), 0);
+  EXPECT_EQ(m.get_id("z"), Model::npos);
+  EXPECT_EQ(m.get_kind(m.get_id("x")), MV_BV);
+  EXPECT_EQ(m.get_bv_word(m.get_id("x")), 200);
+  EXPECT_EQ(m.get_bv_word(m.get_id("y")), 199);
+  EXPECT_EQ(m.get_bv_width(m.get_id("w")), 100);
+  EXPECT_EQ(m.get_bv_string(m.get_id("w")), "1" + string(99, '0'));
+  EXPECT_TRUE(m.get_bool(m.get_id("b")));
+
+  // values can be rebuilt in the solver
+  EXPECT_EQ(m.get_value(s, x), s->get_value(x));
+  EXPECT_EQ(m.get_value(s, w), s->get_value(w));
+}
+
+TEST_P(ModelTests, Evaluate)
+{
+  s->assert_formula(s->make_term(Equal, x, s->make_term(13, bvsort)));
+  s->assert_formula(s->make_term(Equal, y, s->make_term(250, bvsort)));
+  s->assert_formula(s->make_term(Not, b));
+  ASSERT_TRUE(s->check_sat().is_sat());
+  Model m(s, { x, y, b });
+
+  Term sum = s->make_term(BVAdd, x, y);
+  Term prod = s->make_term(BVMul, x, y);
+  Term ext = s->make_term(Op(Zero_Extend, 8), s->make_term(BVNeg, x));
+  Term cmp = s->make_term(
+      Or, b, s->make_term(BVSlt, y, x));  // y is negative as signed
+  Term cat = s->make_term(Concat, x, s->make_term(Op(Extract, 3, 0), y));
+  for (const auto & t : { sum, prod, ext, cat })
+  {
+    EXPECT_EQ(m.evaluate_bv(t), s->get_value(t)->to_int()) << t;
+  }
+  EXPECT_TRUE(m.evaluate_bool(cmp));
+  EXPECT_THROW(m.evaluate_bv(cmp), IncorrectUsageException);
+}
+
+TEST_P(ModelTests, OutlivesSolverAndSerializes)
+{
+  stringstream ss;
+  {
+    SmtSolver s2 = create_solver(GetParam());
+    s2->set_opt("produce-models", "true");
+    Term x2 = s2->make_symbol("x", s2->make_sort(BV, 8));
+    s2->assert_formula(
+        s2->make_term(Equal, x2, s2->make_term(42, x2->get_sort())));
+    ASSERT_TRUE(s2->check_sat().is_sat());
+    Model m(s2, { x2 });
+    s2 = nullptr;
+    m.serialize(ss);
+  }
+
+  Model m = Model::deserialize(ss);
+  ASSERT_EQ(m.size(), 1);
+  EXPECT_EQ(m.get_bv_word(m.get_id("x")), 42);
+  EXPECT_EQ(m.get_value(s, x), s->make_term(42, bvsort));
+
+  stringstream bad("smt-switch-model 3 1\n1 8 1 1:x\n");
+  EXPECT_THROW(Model::deserialize(bad), SmtException);
+}
+
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(ModelArrayTests);
+class ModelArrayTests : public ModelTests
+{
+};
+
+TEST_P(ModelArrayTests, Arrays)
+{
+  Sort arrsort = s->make_sort(ARRAY, bvsort, bvsort);
+  Term a = s->make_symbol("a", arrsort);
+  s->assert_formula(s->make_term(
+      Equal, s->make_term(Select, a, x), s->make_term(7, bvsort)));
+  s->assert_formula(s->make_term(Equal, x, s->make_term(3, bvsort)));
+  ASSERT_TRUE(s->check_sat().is_sat());
+
+  Model m(s, { a, x });
+  size_t id = m.get_id("a");
+  ASSERT_EQ(m.get_kind(id), MV_ARRAY);
+  EXPECT_EQ(m.evaluate_bv(s->make_term(Select, a, x)), 7);
+
+  stringstream ss;
+  m.serialize(ss);
+  Model m2 = Model::deserialize(ss);
+  EXPECT_EQ(m2.get_kind(m2.get_id("a")), MV_ARRAY);
+  EXPECT_EQ(m2.get_array_exceptions(m2.get_id("a")).size(),
+            m.get_array_exceptions(id).size());
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    ParameterizedSolverModelTests,
+    ModelTests,
+    testing::ValuesIn(filter_non_generic_solver_configurations({ THEORY_BV,
+                                                                 TERMITER })));
+
+INSTANTIATE_TEST_SUITE_P(
+    ParameterizedSolverModelArrayTests,
+    ModelArrayTests,
+    testing::ValuesIn(filter_non_generic_solver_configurations(
+        { THEORY_BV, TERMITER, ARRAY_MODELS })));
+
+}  // namespace smt_tests
@@ -0,0 +1,307 @@
+/*********************                                                        */
+/*! \file test-parallel-interpolator.cpp
+** \verbatim
+** Top contributors (to current version):
+**   agent
+** This file is part of the smt-switch project.
+** Copyright (c) 2026 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved.  See the file LICENSE in the top-level source
+** directory for licensing information.\endverbatim
+**
+** \brief Tests for ParallelInterpolator.
+**
+**
+**/
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "available_solvers.h"
+#include "gtest/gtest.h"
+#include "parallel_interpolator.h"
+#include "profiling_solver.h"
+#include "smt.h"
+
+using namespace smt;
+using namespace std;
+
+namespace smt_tests {
+
+/** An interpolator that returns A itself (a valid, if useless, interpolant)
+ *  so that the scheduling can be tested with any solver
+ */
+class TrivialInterpolator : public ProfilingSolver
+{
+ public:
+  TrivialInterpolator(SmtSolver s) : ProfilingSolver(s)
+  {
+    s->set_opt("incremental", "true");
+  }
+
+  Result get_interpolant(const Term & A,
+                         const Term & B,
+                         Term & out_I) const override
+  {
+    wrapped_solver->push();
+    wrapped_solver->assert_formula(A);
+    wrapped_solver->assert_formula(B);
+    Result r = wrapped_solver->check_sat();
+    wrapped_solver->pop();
+    if (r.is_unsat())
+    {
+      out_I = A;
+    }
+    return r;
+  }
+
+  Result get_sequence_interpolants(const TermVec & formulae,
+                                   TermVec & out_I) const override
+  {
+    wrapped_solver->push();
+    for (const auto & f : formulae)
+    {
+      wrapped_solver->assert_formula(f);
+    }
+    Result r = wrapped_solver->check_sat();
+    wrapped_solver->pop();
+    if (r.is_unsat())
+    {
+      Term prefix = formulae[0];
+      for (size_t i = 1; i < formulae.size(); ++i)
+      {
+        out_I.push_back(prefix);
+        prefix = wrapped_solver->make_term(And, prefix, formulae[i]);
+      }
+    }
+    return r;
+  }
+};
+
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(ParallelInterpolatorTests);
+class ParallelInterpolatorTests
+    : public ::testing::Test,
+      public ::testing::WithParamInterface<SolverConfiguration>
+{
+ protected:
+  void SetUp() override
+  {
+    // interpolating solvers can't check the interpolants, use another
+    // solver for the formulae then
+    SolverConfiguration sc = GetParam();
+    if (interpolating())
+    {
+      vector<SolverConfiguration> configs =
+          filter_non_generic_solver_configurations({ THEORY_INT });
+      if (configs.empty())
+      {
+        GTEST_SKIP() << "no solver to check the interpolants";
+      }
+      sc = configs[0];
+    }
+    s = create_solver(sc);
+    s->set_opt("incremental", "true");
+    intsort = s->make_sort(INT);
+
+    // an unrolling of a counter: x_0 = 0, x_i+1 = x_i + 1, x_n < 0
+    size_t n = 6;
+    TermVec x;
+    for (size_t i = 0; i < n; ++i)
+    {
+      x.push_back(s->make_symbol("x" + std::to_string(i), intsort));
+    }
+    formulae.push_back(s->make_term(Equal, x[0], s->make_term(0, intsort)));
+    for (size_t i = 1; i < n; ++i)
+    {
+      formulae.push_back(s->make_term(
+          Equal, x[i], s->make_term(Plus, x[i - 1], s->make_term(1, intsort))));
+    }
+    bad = s->make_term(Lt, x[n - 1], s->make_term(0, intsort));
+    formulae.back() = s->make_term(And, formulae.back(), bad);
+  }
+
+  bool interpolating() const
+  {
+    vector<SolverEnum> itp = available_interpolator_enums();
+    return std::find(itp.begin(), itp.end(), GetParam().solver_enum)
+           != itp.end();
+  }
+
+  vector<SmtSolver> make_workers(size_t num)
+  {
+    vector<SmtSolver> workers;
+    for (size_t i = 0; i < num; ++i)
+    {
+      workers.push_back(interpolating()
+                            ? create_interpolating_solver(GetParam())
+                            : std::make_shared<TrivialInterpolator>(
+                                create_solver(GetParam())));
+    }
+    return workers;
+  }
+
+  /** checks A -> I and I /\ B is unsat for cut point c */
+  void check_interpolant(const Term & I, size_t c)
+  {
+    ASSERT_TRUE(I);
+    Term A = formulae[0];
+    for (size_t i = 1; i < c; ++i)
+    {
+      A = s->make_term(And, A, formulae[i]);
+    }
+    Term B = formulae[c];
+    for (size_t i = c + 1; i < formulae.size(); ++i)
+    {
+      B = s->make_term(And, B, formulae[i]);
+    }
+    s->push();
+    s->assert_formula(s->make_term(And, A, s->make_term(Not, I)));
+    EXPECT_TRUE(s->check_sat().is_unsat());
+    s->pop();
+    s->push();
+    s->assert_formula(s->make_term(And, I, B));
+    EXPECT_TRUE(s->check_sat().is_unsat());
+    s->pop();
+  }
+
+  /** checks I_c-1 /\ F_c -> I_c at every inner cut point */
+  void check_sequence(const TermVec & I)
+  {
+    for (size_t c = 1; c < I.size(); ++c)
+    {
+      s->push();
+      s->assert_formula(s->make_term(And, I[c - 1], formulae[c]));
+      s->assert_formula(s->make_term(Not, I[c]));
+      EXPECT_TRUE(s->check_sat().is_unsat());
+      s->pop();
+    }
+  }
+
+  SmtSolver s;
+  Sort intsort;
+  TermVec formulae;
+  Term bad;
+};
+
+TEST_P(ParallelInterpolatorTests, Partitions)
+{
+  ParallelInterpolator pi(s, make_workers(3));
+  vector<size_t> cuts;
+  for (size_t c = 1; c < formulae.size(); ++c)
+  {
+    cuts.push_back(c);
+  }
+  for (size_t partition_size : { 0, 1, 2, 5 })
+  {
+    pi.set_partition_size(partition_size);
+    TermVec out;
+    Result r = pi.get_interpolants(formulae, cuts, out);
+    ASSERT_TRUE(r.is_unsat());
+    ASSERT_EQ(out.size(), formulae.size() - 1);
+    for (size_t c = 1; c < formulae.size(); ++c)
+    {
+      check_interpolant(out[c - 1], c);
+    }
+  }
+}
+
+TEST_P(ParallelInterpolatorTests, SequenceIgnoresPartitions)
+{
+  ParallelInterpolator pi(s, make_workers(3));
+  for (size_t partition_size : { 0, 1, 2 })
+  {
+    pi.set_partition_size(partition_size);
+    TermVec out;
+    ASSERT_TRUE(pi.get_sequence_interpolants(formulae, out).is_unsat());
+    ASSERT_EQ(out.size(), formulae.size() - 1);
+    for (size_t c = 1; c < formulae.size(); ++c)
+    {
+      check_interpolant(out[c - 1], c);
+    }
+    check_sequence(out);
+  }
+}
+
+TEST_P(ParallelInterpolatorTests, CutPointsAndSat)
+{
+  ParallelInterpolator pi(s, make_workers(2));
+  pi.set_partition_size(1);
+  TermVec out;
+  ASSERT_TRUE(pi.get_interpolants(formulae, { 2, 4 }, out).is_unsat());
+  ASSERT_EQ(out.size(), 2);
+  check_interpolant(out[0], 2);
+  check_interpolant(out[1], 4);
+
+  // reuses the translations of the previous call
+  TermVec sat_formulae(formulae.begin(), formulae.end() - 1);
+  out.clear();
+  EXPECT_TRUE(pi.get_sequence_interpolants(sat_formulae, out).is_sat());
+
+  // and the conjunctions of the common prefix
+  out.clear();
+  ASSERT_TRUE(pi.get_sequence_interpolants(formulae, out).is_unsat());
+  ASSERT_EQ(out.size(), formulae.size() - 1);
+  for (size_t c = 1; c < formulae.size(); ++c)
+  {
+    check_interpolant(out[c - 1], c);
+  }
+
+  EXPECT_THROW(pi.get_interpolants(formulae, { 3, 2 }, out),
+               IncorrectUsageException);
+  EXPECT_THROW(pi.get_interpolants(formulae, { 0 }, out),
+               IncorrectUsageException);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    ParameterizedParallelInterpolatorTests,
+    ParallelInterpolatorTests,
+    testing::ValuesIn(filter_non_generic_solver_configurations({ THEORY_INT })));
+
+INSTANTIATE_TEST_SUITE_P(
+    ParameterizedItpParallelInterpolatorTests,
+    ParallelInterpolatorTests,
+    testing::ValuesIn(available_interpolator_configurations()));
+
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(ParallelItpSolverTests);
+class ParallelItpSolverTests
+    : public ::testing::Test,
+      public ::testing::WithParamInterface<SolverConfiguration>
+{
+};
+
+TEST_P(ParallelItpSolverTests, SequenceInterpolants)
+{
+  SmtSolver s = create_interpolating_solver(GetParam());
+  vector<SmtSolver> workers = { create_interpolating_solver(GetParam()),
+                                create_interpolating_solver(GetParam()) };
+  Sort intsort = s->make_sort(INT);
+  Term x = s->make_symbol("x", intsort);
+  Term y = s->make_symbol("y", intsort);
+  Term z = s->make_symbol("z", intsort);
+  Term w = s->make_symbol("w", intsort);
+
+  // same formulae as TEST_SEQITP in test-itp.cpp
+  TermVec formulae(
+      { s->make_term(And, s->make_term(Lt, x, y), s->make_term(Lt, y, w)),
+        s->make_term(And, s->make_term(Gt, z, w), s->make_term(Lt, z, x)),
+        s->make_term(And, s->make_term(Gt, y, z), s->make_term(Lt, y, w)) });
+
+  ParallelInterpolator pi(s, workers);
+  for (size_t partition_size : { 0, 1 })
+  {
+    pi.set_partition_size(partition_size);
+    TermVec out;
+    ASSERT_TRUE(pi.get_sequence_interpolants(formulae, out).is_unsat());
+    ASSERT_EQ(out.size(), 2);
+    EXPECT_TRUE(out[0]);
+    EXPECT_TRUE(out[1]);
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    ParameterizedParallelItpSolverTests,
+    ParallelItpSolverTests,
+    testing::ValuesIn(available_interpolator_configurations()));
+
+}  // namespace smt_tests
@@ -0,0 +1,142 @@
+/*********************                                                        */
+/*! \file test-profiling-solver.cpp
+** \verbatim
+** Top contributors (to current version):
+**   agent
+** This file is part of the smt-switch project.
+** Copyright (c) 2026 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved.  See the file LICENSE in the top-level source
+** directory for licensing information.\endverbatim
+**
+** \brief Tests for ProfilingSolver.
+**
+**
+**/
+
+#include <memory>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+#include "available_solvers.h"
+#include "gtest/gtest.h"
+#include "profiling_solver.h"
+#include "smt.h"
+
+using namespace smt;
+using namespace std;
+
+namespace smt_tests {
+
+TEST(LatencyHistogramTests, Quantiles)
+{
+  LatencyHistogram h;
+  EXPECT_EQ(h.quantile(0.5), 0);
+  for (uint64_t v = 1; v <= 1000; ++v)
+  {
+    h.record(v);
+  }
+  EXPECT_EQ(h.count(), 1000);
+  EXPECT_EQ(h.min(), 1);
+  EXPECT_EQ(h.max(), 1000);
+  EXPECT_EQ(h.total(), 500500);
+
+  // relative error bounded by the sub-bucket resolution
+  for (double q : { 0.1, 0.5, 0.9, 0.99 })
+  {
+    double exact = q * 1000;
+    double approx = h.quantile(q);
+    EXPECT_GE(approx, exact);
+    EXPECT_LE(approx, exact * (1 + 1.0 / LatencyHistogram::SUB_BUCKETS) + 1);
+  }
+  EXPECT_EQ(h.quantile(1), 1000);
+
+  // bucket indices are monotonic and upper bounds are consistent
+  size_t prev = 0;
+  for (uint64_t v : vector<uint64_t>{ 0, 7, 8, 100, 1ULL << 40, UINT64_MAX })
+  {
+    size_t idx = LatencyHistogram::bucket_index(v);
+    EXPECT_GE(idx, prev);
+    EXPECT_LT(idx, LatencyHistogram::NUM_BUCKETS);
+    EXPECT_GE(LatencyHistogram::bucket_upper_bound(idx), v);
+    prev = idx;
+  }
+}
+
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(ProfilingTests);
+class ProfilingTests : public ::testing::Test,
+                       public ::testing::WithParamInterface<SolverConfiguration>
+{
+ protected:
+  void SetUp() override
+  {
+    ps = make_shared<ProfilingSolver>(create_solver(GetParam()));
+    s = ps;
+    s->set_opt("produce-models", "true");
+    bvsort = s->make_sort(BV, 8);
+    x = s->make_symbol("x", bvsort);
+    y = s->make_symbol("y", bvsort);
+  }
+  shared_ptr<ProfilingSolver> ps;
+  SmtSolver s;
+  Sort bvsort;
+  Term x, y;
+};
+
+TEST_P(ProfilingTests, Counts)
+{
+  Term sum = s->make_term(BVAdd, x, y);
+  Term prod = s->make_term(BVMul, x, y);
+  Term sum2 = s->make_term(BVAdd, sum, prod);
+  s->assert_formula(s->make_term(Equal, sum2, s->make_term(3, bvsort)));
+  ASSERT_TRUE(s->check_sat().is_sat());
+  s->get_value(x);
+  s->get_value(y);
+
+  EXPECT_EQ(ps->get_histogram(PROF_MAKE_SYMBOL).count(), 2);
+  EXPECT_EQ(ps->get_histogram(PROF_MAKE_TERM).count(), 4);
+  EXPECT_EQ(ps->get_histogram(PROF_MAKE_VALUE).count(), 1);
+  EXPECT_EQ(ps->get_histogram(PROF_CHECK_SAT).count(), 1);
+  EXPECT_EQ(ps->get_histogram(PROF_GET_VALUE).count(), 2);
+  EXPECT_EQ(ps->get_op_count(BVAdd), 2);
+  EXPECT_EQ(ps->get_op_count(BVMul), 1);
+  EXPECT_EQ(ps->get_op_count(Equal), 1);
+
+  // disabled profiling records nothing
+  ps->set_enabled(false);
+  s->make_term(BVSub, x, y);
+  ASSERT_TRUE(s->check_sat().is_sat());
+  EXPECT_EQ(ps->get_op_count(BVSub), 0);
+  EXPECT_EQ(ps->get_histogram(PROF_CHECK_SAT).count(), 1);
+
+  ps->clear_stats();
+  EXPECT_EQ(ps->get_histogram(PROF_MAKE_TERM).count(), 0);
+  EXPECT_EQ(ps->get_op_count(BVAdd), 0);
+}
+
+TEST_P(ProfilingTests, Export)
+{
+  s->assert_formula(s->make_term(BVUlt, x, y));
+  ASSERT_TRUE(s->check_sat().is_sat());
+
+  ostringstream json;
+  ps->dump_json(json);
+  EXPECT_NE(json.str().find("\"check_sat\": { \"calls\": 1"),
+            string::npos);
+  EXPECT_NE(json.str().find("\"bvult\": 1"), string::npos);
+
+  ostringstream prom;
+  ps->dump_prometheus(prom);
+  EXPECT_NE(prom.str().find("# TYPE smt_switch_calls_total counter"),
+            string::npos);
+  EXPECT_NE(prom.str().find("method=\"check_sat\"} 1"), string::npos);
+  EXPECT_NE(prom.str().find("op=\"bvult\"} 1"), string::npos);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    ParameterizedSolverProfilingTests,
+    ProfilingTests,
+    testing::ValuesIn(filter_solver_configurations({ THEORY_BV })));
+
+}  // namespace smt_tests
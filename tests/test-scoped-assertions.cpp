@@ -0,0 +1,127 @@
+/*********************                                                        */
+/*! \file test-scoped-assertions.cpp
+** \verbatim
+** Top contributors (to current version):
+**   agent
+** This file is part of the smt-switch project.
+** Copyright (c) 2026 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved.  See the file LICENSE in the top-level source
+** directory for licensing information.\endverbatim
+**
+** \brief Tests for ScopedAssertions.
+**
+**
+**/
+
+#include <utility>
+#include <vector>
+
+#include "available_solvers.h"
+#include "gtest/gtest.h"
+#include "scoped_assertions.h"
+#include "smt.h"
+
+using namespace smt;
+using namespace std;
+
+namespace smt_tests {
+
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(ScopedAssertionsTests);
+class ScopedAssertionsTests
+    : public ::testing::Test,
+      public ::testing::WithParamInterface<SolverConfiguration>
+{
+ protected:
+  void SetUp() override
+  {
+    s = create_solver(GetParam());
+    s->set_opt("incremental", "true");
+    s->set_opt("produce-unsat-assumptions", "true");
+    boolsort = s->make_sort(BOOL);
+    bvsort = s->make_sort(BV, 8);
+    x = s->make_symbol("x", bvsort);
+    y = s->make_symbol("y", bvsort);
+  }
+  SmtSolver s;
+  Sort boolsort, bvsort;
+  Term x, y;
+};
+
+TEST_P(ScopedAssertionsTests, PushPop)
+{
+  ScopedAssertions sa(s);
+  sa.assert_formula(s->make_term(BVUlt, x, y));
+  ASSERT_TRUE(sa.check_sat().is_sat());
+
+  sa.push();
+  EXPECT_EQ(sa.get_context_level(), 1);
+  sa.assert_formula(s->make_term(Equal, x, y));
+  ASSERT_TRUE(sa.check_sat().is_unsat());
+
+  sa.push();
+  sa.assert_formula(s->make_term(Equal, x, s->make_term(0, bvsort)));
+  ASSERT_TRUE(sa.check_sat().is_unsat());
+  sa.pop(2);
+  EXPECT_EQ(sa.get_context_level(), 0);
+  EXPECT_EQ(sa.num_retired(), 2);
+
+  ASSERT_TRUE(sa.check_sat().is_sat());
+  ASSERT_THROW(sa.pop(), IncorrectUsageException);
+}
+
+TEST_P(ScopedAssertionsTests, UnsatAssumptions)
+{
+  ScopedAssertions sa(s);
+  Term a = s->make_symbol("a", boolsort);
+  Term b = s->make_symbol("b", boolsort);
+  sa.push();
+  sa.assert_formula(s->make_term(Implies, a, s->make_term(BVUlt, x, y)));
+  sa.assert_formula(s->make_term(Implies, b, s->make_term(BVUlt, y, x)));
+  ASSERT_TRUE(sa.check_sat_assuming({ a, b }).is_unsat());
+
+  UnorderedTermSet core;
+  sa.get_unsat_assumptions(core);
+  EXPECT_EQ(core, UnorderedTermSet({ a, b }));
+  sa.pop();
+
+  ASSERT_TRUE(sa.check_sat_assuming({ a, b }).is_sat());
+}
+
+TEST_P(ScopedAssertionsTests, Compaction)
+{
+  ScopedAssertions sa(s, 4);
+  sa.assert_formula(s->make_term(BVUle, x, s->make_term(10, bvsort)));
+  sa.push();
+  sa.assert_formula(s->make_term(BVUge, x, s->make_term(5, bvsort)));
+
+  for (int64_t i = 0; i < 20; ++i)
+  {
+    sa.push();
+    sa.assert_formula(s->make_term(Equal, x, s->make_term(i, bvsort)));
+    Result r = sa.check_sat();
+    ASSERT_EQ(r.is_sat(), 5 <= i && i <= 10);
+    sa.pop();
+  }
+
+  EXPECT_EQ(sa.get_context_level(), 1);
+  // one for the outer scope and at most threshold for the inner scopes
+  EXPECT_LE(sa.num_activation_literals(), 5);
+  EXPECT_LT(sa.num_retired(), 4);
+
+  // the outer scope is still active after compaction
+  sa.push();
+  sa.assert_formula(s->make_term(Equal, x, s->make_term(4, bvsort)));
+  ASSERT_TRUE(sa.check_sat().is_unsat());
+  sa.pop(2);
+  sa.assert_formula(s->make_term(Equal, x, s->make_term(4, bvsort)));
+  ASSERT_TRUE(sa.check_sat().is_sat());
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    ParameterizedSolverScopedAssertionsTests,
+    ScopedAssertionsTests,
+    testing::ValuesIn(filter_non_generic_solver_configurations(
+        { THEORY_BV, UNSAT_CORE })));
+
+}  // namespace smt_tests
@@ -0,0 +1,158 @@
+/*********************                                                        */
+/*! \file test-smtlib-lexer.cpp
+** \verbatim
+** Top contributors (to current version):
+**   agent
+** This file is part of the smt-switch project.
+** Copyright (c) 2026 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved.  See the file LICENSE in the top-level source
+** directory for licensing information.\endverbatim
+**
+** \brief Tests for the SMT-LIB lexer with every instruction set
+**
+**
+**/
+
+#include <string>
+#include <vector>
+
+#include "exceptions.h"
+#include "gtest/gtest.h"
+#include "smtlib_lexer.h"
+
+using namespace smt;
+using namespace std;
+
+namespace smt_tests {
+
+vector<SmtLibToken> lex_all(const string & text, SmtLibLexerIsa isa)
+{
+  SmtLibLexer lexer(text.data(), text.size(), isa);
+  vector<SmtLibToken> res;
+  do
+  {
+    res.push_back(lexer.next());
+  } while (res.back().kind != TOK_EOF);
+  return res;
+}
+
+vector<SmtLibLexerIsa> available_isas()
+{
+  vector<SmtLibLexerIsa> res;
+  for (int i = LEXER_SCALAR; i <= SmtLibLexer::best_isa(); ++i)
+  {
+    res.push_back((SmtLibLexerIsa)i);
+  }
+  return res;
+}
+
+class SmtLibLexerTests : public ::testing::Test,
+                         public ::testing::WithParamInterface<SmtLibLexerIsa>
+{
+};
+
+TEST_P(SmtLibLexerTests, Tokens)
+{
+  string text =
+      "; a comment (with parens)\n"
+      "(set-logic QF_BV)\n"
+      "(declare-fun |x y\nz| () (_ BitVec 8))\n"
+      "(assert (! (= #b0101 #xaF (_ bv5 8)) :named a1))  ; trailing\n"
+      "(set-info :source \"say \"\"hi\"\" \\\" \n\")\n"
+      "(check-sat 12 3.25)";
+  vector<SmtLibToken> toks = lex_all(text, GetParam());
+
+  vector<pair<SmtLibTokenKind, string>> expected = {
+    { TOK_LP, "(" },          { TOK_SYMBOL, "set-logic" },
+    { TOK_SYMBOL, "QF_BV" },  { TOK_RP, ")" },
+    { TOK_LP, "(" },          { TOK_SYMBOL, "declare-fun" },
+    { TOK_QUOTED_SYMBOL, "x y\nz" },
+    { TOK_LP, "(" },          { TOK_RP, ")" },
+    { TOK_LP, "(" },          { TOK_SYMBOL, "_" },
+    { TOK_SYMBOL, "BitVec" }, { TOK_NUMERAL, "8" },
+    { TOK_RP, ")" },          { TOK_RP, ")" },
+    { TOK_LP, "(" },          { TOK_SYMBOL, "assert" },
+    { TOK_LP, "(" },          { TOK_SYMBOL, "!" },
+    { TOK_LP, "(" },          { TOK_SYMBOL, "=" },
+    { TOK_BINARY, "0101" },   { TOK_HEX, "aF" },
+    { TOK_LP, "(" },          { TOK_SYMBOL, "_" },
+    { TOK_SYMBOL, "bv5" },    { TOK_NUMERAL, "8" },
+    { TOK_RP, ")" },          { TOK_RP, ")" },
+    { TOK_KEYWORD, "named" }, { TOK_SYMBOL, "a1" },
+    { TOK_RP, ")" },          { TOK_RP, ")" },
+    { TOK_LP, "(" },          { TOK_SYMBOL, "set-info" },
+    { TOK_KEYWORD, "source" },
+    { TOK_STRING, "say \"\"hi\"\" \\\" \n" },
+    { TOK_RP, ")" },
+    { TOK_LP, "(" },          { TOK_SYMBOL, "check-sat" },
+    { TOK_NUMERAL, "12" },    { TOK_DECIMAL, "3.25" },
+    { TOK_RP, ")" },          { TOK_EOF, "" }
+  };
+  ASSERT_EQ(toks.size(), expected.size());
+  for (size_t i = 0; i < toks.size(); ++i)
+  {
+    EXPECT_EQ(toks[i].kind, expected[i].first) << i;
+    EXPECT_EQ(toks[i].text, expected[i].second) << i;
+  }
+
+  EXPECT_EQ(toks[0].line, 2);
+  EXPECT_EQ(toks[6].line, 3);   // |x y z| starts on line 3
+  EXPECT_EQ(toks[7].line, 4);
+  EXPECT_EQ(toks[15].line, 5);  // (assert
+  EXPECT_EQ(toks.back().line, 8);
+}
+
+TEST_P(SmtLibLexerTests, SameAsScalar)
+{
+  // long runs cross the vector block boundaries at every offset
+  string text;
+  for (size_t i = 0; i < 200; ++i)
+  {
+    text += string(i % 37, ' ') + "(assert (bvadd x_" + to_string(i)
+            + string(i % 41, 'a') + " #b" + string(i % 70 + 1, '1') + "))"
+            + string(i % 5, '\n') + ";" + string(i % 45, 'c') + "\n|"
+            + string(i % 50, 'q') + "\n|\"" + string(i % 33, 's') + "\"";
+  }
+  vector<SmtLibToken> expected = lex_all(text, LEXER_SCALAR);
+  vector<SmtLibToken> toks = lex_all(text, GetParam());
+
+  // and in batches
+  SmtLibLexer lexer(text.data(), text.size(), GetParam());
+  vector<SmtLibToken> batched;
+  SmtLibToken buf[7];
+  size_t n;
+  do
+  {
+    n = lexer.next(buf, 7);
+    batched.insert(batched.end(), buf, buf + n);
+  } while (buf[n - 1].kind != TOK_EOF);
+
+  ASSERT_EQ(toks.size(), expected.size());
+  ASSERT_EQ(batched.size(), expected.size());
+  for (size_t i = 0; i < toks.size(); ++i)
+  {
+    EXPECT_EQ(toks[i].kind, expected[i].kind);
+    EXPECT_EQ(toks[i].text, expected[i].text);
+    EXPECT_EQ(toks[i].line, expected[i].line);
+    EXPECT_EQ(batched[i].kind, expected[i].kind);
+    EXPECT_EQ(batched[i].text, expected[i].text);
+  }
+}
+
+TEST_P(SmtLibLexerTests, Errors)
+{
+  for (string text : { "(assert |x", "\"abc", "\"abc\\", "(a{b)", "#b012",
+                       "#q1", "1.", "12ab", ":", "x\x80" })
+  {
+    EXPECT_THROW(lex_all(text, GetParam()), SmtException) << text;
+  }
+  EXPECT_EQ(lex_all("", GetParam()).size(), 1);
+  EXPECT_EQ(lex_all(" \n; only a comment", GetParam()).size(), 1);
+}
+
+INSTANTIATE_TEST_SUITE_P(ParameterizedSmtLibLexerTests,
+                         SmtLibLexerTests,
+                         testing::ValuesIn(available_isas()));
+
+}  // namespace smt_tests
@@ -23,6 +23,7 @@
 
 #include "available_solvers.h"
 #include "smt.h"
+#include "smtlib_direct_parser.h"
 #include "smtlib_reader.h"
 #include "smtlib_reader_test_inputs.h"
 
@@ -174,6 +175,169 @@ TEST_P(UninterpReaderTests, QF_UF_Smt2Files)
   }
 }
 
+TEST_P(IntReaderTests, QF_UFLIA_Smt2Files_DirectParser)
+{
+  // SMT_SWITCH_DIR is a macro defined at build time
+  // and should point to the top-level Smt-Switch directory
+  string test = STRFY(SMT_SWITCH_DIR);
+  auto testpair = get<1>(GetParam());
+  test += "/tests/smt2/qf_uflia/" + testpair.first;
+  SmtLibDirectParser parser(*reader);
+  ASSERT_EQ(parser.parse(test), 0);
+  auto results = reader->get_results();
+  auto expected_results = testpair.second;
+  ASSERT_EQ(results.size(), expected_results.size());
+
+  size_t size = results.size();
+  for (size_t i = 0; i < size; i++)
+  {
+    EXPECT_EQ(results[i], expected_results[i]);
+  }
+}
+
+TEST_P(BitVecReaderTests, QF_UFBV_Smt2Files_DirectParser)
+{
+  // SMT_SWITCH_DIR is a macro defined at build time
+  // and should point to the top-level Smt-Switch directory
+  string test = STRFY(SMT_SWITCH_DIR);
+  auto testpair = get<1>(GetParam());
+  test += "/tests/smt2/qf_ufbv/" + testpair.first;
+  SmtLibDirectParser parser(*reader);
+  ASSERT_EQ(parser.parse(test), 0);
+  auto results = reader->get_results();
+  auto expected_results = testpair.second;
+  ASSERT_EQ(results.size(), expected_results.size());
+
+  size_t size = results.size();
+  for (size_t i = 0; i < size; i++)
+  {
+    EXPECT_EQ(results[i], expected_results[i]);
+  }
+}
+
+TEST_P(ArrayIntReaderTests, QF_ALIA_Smt2Files_DirectParser)
+{
+  // SMT_SWITCH_DIR is a macro defined at build time
+  // and should point to the top-level Smt-Switch directory
+  string test = STRFY(SMT_SWITCH_DIR);
+  auto testpair = get<1>(GetParam());
+  test += "/tests/smt2/qf_alia/" + testpair.first;
+  SmtLibDirectParser parser(*reader);
+  ASSERT_EQ(parser.parse(test), 0);
+  auto results = reader->get_results();
+  auto expected_results = testpair.second;
+  ASSERT_EQ(results.size(), expected_results.size());
+
+  size_t size = results.size();
+  for (size_t i = 0; i < size; i++)
+  {
+    EXPECT_EQ(results[i], expected_results[i]);
+  }
+}
+
+TEST_P(UninterpReaderTests, QF_UF_Smt2Files_DirectParser)
+{
+  // SMT_SWITCH_DIR is a macro defined at build time
+  // and should point to the top-level Smt-Switch directory
+  string test = STRFY(SMT_SWITCH_DIR);
+  auto testpair = get<1>(GetParam());
+  test += "/tests/smt2/qf_uf/" + testpair.first;
+  SmtLibDirectParser parser(*reader);
+  ASSERT_EQ(parser.parse(test), 0);
+  auto results = reader->get_results();
+  auto expected_results = testpair.second;
+  ASSERT_EQ(results.size(), expected_results.size());
+
+  size_t size = results.size();
+  for (size_t i = 0; i < size; i++)
+  {
+    EXPECT_EQ(results[i], expected_results[i]);
+  }
+}
+
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(DirectParserTests);
+class DirectParserTests
+    : public ::testing::Test,
+      public ::testing::WithParamInterface<SolverConfiguration>
+{
+ protected:
+  void SetUp() override
+  {
+    s = create_solver(GetParam());
+    reader = new SmtLibReaderTester(s);
+  }
+
+  void TearDown() override { delete reader; }
+
+  SmtSolver s;
+  SmtLibReaderTester * reader;
+};
+
+TEST_P(DirectParserTests, DeepTerm)
+{
+  // deeper than the default stack of the bison parser (10000)
+  size_t depth = 100000;
+  string text = "(set-logic QF_BV)\n(declare-const x (_ BitVec 8))\n";
+  text += "(assert (= x ";
+  for (size_t i = 0; i < depth; ++i)
+  {
+    text += "(bvnot ";
+  }
+  text += "x" + string(depth, ')') + "))\n(check-sat)\n";
+
+  SmtLibDirectParser parser(*reader);
+  ASSERT_EQ(parser.parse_string(text), 0);
+  ASSERT_EQ(reader->get_results().size(), 1);
+  EXPECT_EQ(reader->get_results()[0], Result(SAT));
+}
+
+TEST_P(DirectParserTests, LetAndAttributes)
+{
+  string text =
+      "(set-logic QF_BV)\n"
+      "(declare-fun f ((_ BitVec 4)) (_ BitVec 4))\n"
+      "(declare-const |x y| (_ BitVec 4))\n"
+      "(define-fun g ((a (_ BitVec 4)) (b (_ BitVec 4))) (_ BitVec 4)\n"
+      "  (let ((c (bvadd a b)) (d #b0001)) (bvsub c d)))\n"
+      "(assert (! (let () (= (g |x y| (_ bv1 4)) ((_ extract 3 0) |x y|)))\n"
+      "           :named a1 :pattern ((f |x y|))))\n"
+      "(check-sat)\n"
+      "(check-sat-assuming ((distinct (f |x y|) (f (g |x y| #x1)))))\n"
+      "(exit)\n"
+      "(assert false)\n";
+
+  SmtLibDirectParser parser(*reader);
+  ASSERT_EQ(parser.parse_string(text), 0);
+  ASSERT_EQ(reader->get_results().size(), 2);
+  EXPECT_EQ(reader->get_results()[0], Result(SAT));
+  EXPECT_EQ(reader->get_results()[1], Result(UNSAT));
+}
+
+TEST_P(DirectParserTests, SyntaxErrors)
+{
+  SmtLibDirectParser parser(*reader);
+  ASSERT_EQ(parser.parse_string("(set-logic QF_BV)"
+                                "(declare-const x (_ BitVec 8))"),
+            0);
+  for (string text :
+       { "(assert (bvadd x",
+         "(assert (= x y))",
+         "(assert (let ((a x)) (= a :k)))",
+         "(define-fun f ((a (_ BitVec 8))) (_ BitVec 8) (bvadd a z))",
+         "(get-model)",
+         "(push x)" })
+  {
+    EXPECT_EQ(parser.parse_string(text), 1) << text;
+    // scopes opened by the failed command are closed
+    EXPECT_EQ(reader->current_scope(), 0) << text;
+  }
+  // errors from the lexer and the solver are propagated
+  EXPECT_THROW(parser.parse_string("(assert (= x #b012))"), SmtException);
+  EXPECT_ANY_THROW(parser.parse_string(
+      "(define-fun f ((a (_ BitVec 8))) (_ BitVec 8) (a))"));
+  EXPECT_EQ(reader->current_scope(), 0);
+}
+
 INSTANTIATE_TEST_SUITE_P(
     ParameterizedSolverIntReaderTests,
     IntReaderTests,
@@ -213,4 +377,11 @@ INSTANTIATE_TEST_SUITE_P(
                      testing::ValuesIn(qf_uf_param_sorts_tests.begin(),
                                        qf_uf_param_sorts_tests.end())));
 
+
+INSTANTIATE_TEST_SUITE_P(
+    ParameterizedSolverDirectParserTests,
+    DirectParserTests,
+    testing::ValuesIn(filter_non_generic_solver_configurations(
+        { THEORY_BV })));
+
 }  // namespace smt_tests
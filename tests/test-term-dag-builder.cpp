@@ -0,0 +1,134 @@
+/*********************                                                        */
+/*! \file test-term-dag-builder.cpp
+** \verbatim
+** Top contributors (to current version):
+**   agent
+** This file is part of the smt-switch project.
+** Copyright (c) 2026 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved.  See the file LICENSE in the top-level source
+** directory for licensing information.\endverbatim
+**
+** \brief Tests for building serialized term DAGs
+**
+**
+**/
+
+#include <string>
+#include <vector>
+
+#include "available_solvers.h"
+#include "gtest/gtest.h"
+#include "smt.h"
+#include "term_dag_builder.h"
+
+using namespace smt;
+using namespace std;
+
+namespace smt_tests {
+
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(TermDagBuilderTests);
+class TermDagBuilderTests
+    : public ::testing::Test,
+      public ::testing::WithParamInterface<SolverConfiguration>
+{
+ protected:
+  void SetUp() override
+  {
+    s = create_solver(GetParam());
+    s->set_opt("produce-models", "true");
+    s->set_opt("incremental", "true");
+    bvsort = s->make_sort(BV, 8);
+  }
+  SmtSolver s;
+  Sort bvsort;
+};
+
+TEST_P(TermDagBuilderTests, Build)
+{
+  TermDagBuilder builder(s);
+  TermDag dag;
+  dag.sorts = { bvsort };
+  dag.strings = { "x", "3" };
+  dag.code = {
+    DAG_SYMBOL, 0, 0,                     // 0: x
+    DAG_VALUE,  1, 0,                     // 1: 3
+    DAG_OP,     BVAdd, 0, 2, 0, 1,        // 2: x + 3
+    DAG_OP,     Extract, 2, 3, 0, 1, 2,   // 3: x + 3 [3:0]
+    DAG_OP,     Equal, 0, 2, 2, 1,        // 4: x + 3 = 3
+    DAG_BOOL,   1,                        // 5: true
+    DAG_OP,     And, 0, 2, 4, 5           // 6
+  };
+  ASSERT_EQ(builder.build(dag), 0);
+  ASSERT_EQ(builder.size(), 7);
+
+  Term x = s->get_symbol("x");
+  Term three = s->make_term(3, bvsort);
+  Term sum = s->make_term(BVAdd, x, three);
+  EXPECT_EQ(builder.get_term(0), x);
+  EXPECT_EQ(builder.get_term(2), sum);
+  EXPECT_EQ(builder.get_term(3), s->make_term(Op(Extract, 3, 0), sum));
+  EXPECT_EQ(builder.get_term(3)->get_sort(), s->make_sort(BV, 4));
+
+  // later DAGs refer to the earlier nodes
+  dag.strings = { "y" };
+  dag.code = {
+    DAG_SYMBOL, 0, 0,                     // 7: y
+    DAG_OP,     Distinct, 0, 2, 0, 7      // 8: x != y
+  };
+  ASSERT_EQ(builder.build(dag), 7);
+
+  s->assert_formula(builder.get_term(6));
+  s->assert_formula(builder.get_term(8));
+  ASSERT_TRUE(s->check_sat().is_sat());
+  vector<string> values = builder.get_values({ 0, 4 });
+  ASSERT_EQ(values.size(), 2);
+  EXPECT_EQ(values[0], s->get_value(x)->to_string());
+  EXPECT_EQ(values[1], "true");
+}
+
+TEST_P(TermDagBuilderTests, Malformed)
+{
+  TermDagBuilder builder(s);
+  TermDag dag;
+  dag.sorts = { bvsort };
+  dag.strings = { "x" };
+  dag.code = { DAG_SYMBOL, 0, 0 };
+  builder.build(dag);
+
+  // unknown child, the whole DAG is dropped
+  dag.strings = { "1" };
+  dag.code = { DAG_VALUE, 0, 0, DAG_OP, BVAdd, 0, 2, 0, 2 };
+  EXPECT_THROW(builder.build(dag), IncorrectUsageException);
+  EXPECT_EQ(builder.size(), 1);
+
+  dag.code = { DAG_OP, BVAdd, 0, 2, 0 };
+  EXPECT_THROW(builder.build(dag), IncorrectUsageException);
+  dag.code = { DAG_VALUE, 1, 0 };
+  EXPECT_THROW(builder.build(dag), IncorrectUsageException);
+  dag.code = { 42 };
+  EXPECT_THROW(builder.build(dag), IncorrectUsageException);
+  EXPECT_THROW(builder.get_term(1), IncorrectUsageException);
+  EXPECT_EQ(builder.size(), 1);
+
+  // the symbols of a dropped DAG can be built again
+  dag.strings = { "y" };
+  dag.code = { DAG_SYMBOL, 0, 0, DAG_OP, BVAdd, 0, 2, 0, 3 };
+  EXPECT_THROW(builder.build(dag), IncorrectUsageException);
+  dag.code = { DAG_SYMBOL, 0, 0, DAG_OP, BVAdd, 0, 2, 0, 1 };
+  ASSERT_EQ(builder.build(dag), 1);
+  EXPECT_EQ(builder.get_term(1), s->get_symbol("y"));
+
+  // but not with another sort
+  dag.sorts = { s->make_sort(BOOL) };
+  dag.code = { DAG_SYMBOL, 0, 0 };
+  EXPECT_THROW(builder.build(dag), IncorrectUsageException);
+  EXPECT_EQ(builder.size(), 3);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    ParameterizedTermDagBuilderTests,
+    TermDagBuilderTests,
+    testing::ValuesIn(filter_solver_configurations({ THEORY_BV })));
+
+}  // namespace smt_tests
@@ -0,0 +1,127 @@
+/*********************                                                        */
+/*! \file test-term-printer.cpp
+** \verbatim
+** Top contributors (to current version):
+**   agent
+** This file is part of the smt-switch project.
+** Copyright (c) 2026 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved.  See the file LICENSE in the top-level source
+** directory for licensing information.\endverbatim
+**
+** \brief Tests for printing terms with lets
+**
+**
+**/
+
+#include <sstream>
+#include <string>
+
+#include "available_solvers.h"
+#include "gtest/gtest.h"
+#include "printing_solver.h"
+#include "smt.h"
+#include "term_printer.h"
+
+using namespace smt;
+using namespace std;
+
+namespace smt_tests {
+
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(TermPrinterTests);
+class TermPrinterTests
+    : public ::testing::Test,
+      public ::testing::WithParamInterface<SolverConfiguration>
+{
+ protected:
+  void SetUp() override
+  {
+    s = create_solver(GetParam());
+    bvsort = s->make_sort(BV, 8);
+    x = s->make_symbol("x", bvsort);
+    y = s->make_symbol("y", bvsort);
+  }
+  SmtSolver s;
+  Sort bvsort;
+  Term x, y;
+};
+
+TEST_P(TermPrinterTests, NoSharing)
+{
+  Term t = s->make_term(BVMul, s->make_term(BVAdd, x, y), y);
+  string str = to_smtlib_string(t);
+  EXPECT_EQ(str.find("let"), string::npos);
+  EXPECT_EQ(str, to_smtlib_string(t, false));
+  EXPECT_EQ(str.front(), '(');
+  EXPECT_EQ(str.back(), ')');
+  EXPECT_EQ(to_smtlib_string(x), x->to_string());
+}
+
+TEST_P(TermPrinterTests, SharedDag)
+{
+  // 2^50 leaves as a tree, 50 nodes as a DAG
+  Term t = s->make_term(BVAdd, x, y);
+  for (size_t i = 0; i < 50; ++i)
+  {
+    t = s->make_term(BVMul, t, s->make_term(BVNot, t));
+  }
+  string str = to_smtlib_string(t);
+  EXPECT_EQ(str.find("(let ((_let_0 "), 0);
+  EXPECT_NE(str.find("_let_49"), string::npos);
+  EXPECT_LT(str.size(), 50 * 100);
+
+  string diag = to_diagnostic_string(t);
+  EXPECT_LE(diag.size(), DIAGNOSTIC_STRING_LENGTH + 4);
+  EXPECT_EQ(diag.substr(diag.size() - 4), " ...");
+
+  // the cap elides unshared output too
+  string capped = to_smtlib_string(t, false, 100);
+  EXPECT_EQ(capped.size(), 104);
+  EXPECT_EQ(capped.substr(100), " ...");
+}
+
+TEST_P(TermPrinterTests, Quantifiers)
+{
+  if (!solver_has_attribute(GetParam().solver_enum, QUANTIFIERS))
+  {
+    GTEST_SKIP();
+  }
+  Term p = s->make_param("p", bvsort);
+  Term sum = s->make_term(BVAdd, x, y);
+  Term bound = s->make_term(BVMul, p, sum);
+  Term body = s->make_term(
+      Equal, s->make_term(BVAdd, bound, bound), s->make_term(BVAdd, sum, x));
+  Term t = s->make_term(And, s->make_term(Forall, p, body), s->make_term(BVUlt, sum, x));
+  string str = to_smtlib_string(t);
+
+  // the subterms with p are not let-bound, only x + y is
+  size_t forall = str.find("(forall ((p (_ BitVec 8))) ");
+  if (forall == string::npos)
+  {
+    // printed by the backend, which can't iterate over quantifiers
+    EXPECT_NE(str.find("forall"), string::npos);
+    return;
+  }
+  EXPECT_EQ(str.find("(let ((_let_0 "), 0);
+  EXPECT_EQ(str.find("_let_1"), string::npos);
+  EXPECT_LT(str.find("_let_0", forall), string::npos);
+  EXPECT_GT(str.find("p"), forall);
+}
+
+TEST_P(TermPrinterTests, PrintingSolver)
+{
+  ostringstream out;
+  SmtSolver ps = create_printing_solver(s, &out, DEFAULT_STYLE, true);
+  Term sum = ps->make_term(BVAdd, x, y);
+  Term t = ps->make_term(Equal, ps->make_term(BVMul, sum, sum), x);
+  ps->assert_formula(t);
+  EXPECT_EQ(out.str(), "(assert " + to_smtlib_string(t) + ")\n");
+  EXPECT_EQ(out.str().find("(assert (let ((_let_0 "), 0);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    ParameterizedTermPrinterTests,
+    TermPrinterTests,
+    testing::ValuesIn(filter_solver_configurations({ THEORY_BV })));
+
+}  // namespace smt_tests
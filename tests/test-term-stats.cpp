@@ -0,0 +1,136 @@
+/*********************                                                        */
+/*! \file test-term-stats.cpp
+** \verbatim
+** Top contributors (to current version):
+**   agent
+** This file is part of the smt-switch project.
+** Copyright (c) 2026 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved.  See the file LICENSE in the top-level source
+** directory for licensing information.\endverbatim
+**
+** \brief Tests for TermStats.
+**
+**
+**/
+
+#include <sstream>
+#include <utility>
+#include <vector>
+
+#include "available_solvers.h"
+#include "gtest/gtest.h"
+#include "smt.h"
+#include "term_stats.h"
+
+using namespace smt;
+using namespace std;
+
+namespace smt_tests {
+
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(TermStatsTests);
+class TermStatsTests
+    : public ::testing::Test,
+      public ::testing::WithParamInterface<SolverConfiguration>
+{
+ protected:
+  void SetUp() override
+  {
+    s = create_solver(GetParam());
+    boolsort = s->make_sort(BOOL);
+    bvsort = s->make_sort(BV, 8);
+    intsort = s->make_sort(INT);
+    a = s->make_symbol("a", boolsort);
+    x = s->make_symbol("x", bvsort);
+  }
+  SmtSolver s;
+  Sort boolsort, bvsort, intsort;
+  Term a, x;
+};
+
+TEST_P(TermStatsTests, Sizes)
+{
+  TermStats stats;
+  stats.add(s->make_term(And, a, s->make_term(Not, a)));
+  EXPECT_EQ(stats.num_roots(), 1);
+  EXPECT_EQ(stats.dag_size(), 3);
+  EXPECT_EQ(stats.tree_size(), 4);
+  EXPECT_EQ(stats.depth(), 2);
+  EXPECT_EQ(stats.op_count(And), 1);
+  EXPECT_EQ(stats.op_count(Not), 1);
+  EXPECT_EQ(stats.num_symbols(), 1);
+  EXPECT_EQ(stats.logic(), "QF_UF");
+
+  // t_i+1 = t_i + t_i: linear DAG, exponential tree
+  Term t = x;
+  for (size_t i = 0; i < 100; ++i)
+  {
+    t = s->make_term(BVAdd, t, t);
+  }
+  Term root = s->make_term(Equal, t, s->make_term(0, bvsort));
+  stats.add(root);
+  EXPECT_EQ(stats.num_roots(), 2);
+  EXPECT_EQ(stats.dag_size(), 3 + 103);
+  EXPECT_EQ(stats.depth(), 101);
+  EXPECT_EQ(stats.tree_size(), TermStats::saturated);
+  EXPECT_EQ(stats.tree_size(s->make_term(BVAdd, x, x)), 3);
+  EXPECT_EQ(stats.op_count(BVAdd), 100);
+  EXPECT_EQ(stats.max_bv_width(), 8);
+  EXPECT_EQ(stats.num_values(), 1);
+  EXPECT_EQ(stats.logic(), "QF_BV");
+
+  // incremental: only the new nodes are counted
+  stats.add(s->make_term(Or, a, root));
+  EXPECT_EQ(stats.dag_size(), 3 + 103 + 1);
+  EXPECT_EQ(stats.op_count(Equal), 1);
+
+  stringstream ss;
+  ss << stats;
+  EXPECT_NE(ss.str().find("logic: QF_BV"), string::npos);
+
+  stats.clear();
+  EXPECT_EQ(stats.dag_size(), 0);
+  EXPECT_THROW(stats.tree_size(x), IncorrectUsageException);
+}
+
+TEST_P(TermStatsTests, Logic)
+{
+  Term i = s->make_symbol("i", intsort);
+  Term j = s->make_symbol("j", intsort);
+
+  TermStats linear;
+  linear.add(s->make_term(
+      Lt, s->make_term(Mult, s->make_term(2, intsort), i), j));
+  EXPECT_FALSE(linear.has_nonlinear_arithmetic());
+  EXPECT_EQ(linear.logic(), "QF_LIA");
+
+  TermStats nonlinear;
+  nonlinear.add(s->make_term(Lt, s->make_term(Mult, i, j), j));
+  EXPECT_TRUE(nonlinear.has_nonlinear_arithmetic());
+  EXPECT_EQ(nonlinear.logic(), "QF_NIA");
+
+  Sort arrsort = s->make_sort(ARRAY, s->make_sort(BV, 32), bvsort);
+  Term arr = s->make_symbol("arr", arrsort);
+  TermStats arrays;
+  arrays.add(s->make_term(
+      Equal, s->make_term(Select, arr, s->make_term(0, s->make_sort(BV, 32))),
+      x));
+  EXPECT_TRUE(arrays.has_arrays());
+  EXPECT_FALSE(arrays.has_uf());
+  EXPECT_EQ(arrays.max_bv_width(), 32);
+  EXPECT_EQ(arrays.logic(), "QF_ABV");
+
+  Sort funsort = s->make_sort(FUNCTION, { bvsort, boolsort });
+  Term f = s->make_symbol("f", funsort);
+  arrays.add(s->make_term(Apply, f, x));
+  EXPECT_TRUE(arrays.has_uf());
+  EXPECT_EQ(arrays.logic(), "QF_AUFBV");
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    ParameterizedTermStatsTests,
+    TermStatsTests,
+    testing::ValuesIn(filter_non_generic_solver_configurations(
+        { TERMITER, THEORY_BV, THEORY_INT })));
+
+}  // namespace smt_tests
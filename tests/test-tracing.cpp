@@ -0,0 +1,143 @@
+/*********************                                                        */
+/*! \file test-tracing.cpp
+** \verbatim
+** Top contributors (to current version):
+**   agent
+** This file is part of the smt-switch project.
+** Copyright (c) 2026 by the authors listed in the file AUTHORS
+** in the top-level source directory) and their institutional affiliations.
+** All rights reserved.  See the file LICENSE in the top-level source
+** directory for licensing information.\endverbatim
+**
+** \brief Tests for the tracing spans
+**
+**
+**/
+
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include "available_solvers.h"
+#include "gtest/gtest.h"
+#include "smt.h"
+#include "trace.h"
+
+using namespace smt;
+using namespace std;
+
+namespace smt_tests {
+
+size_t count(const string & s, const string & sub)
+{
+  size_t res = 0;
+  for (size_t pos = s.find(sub); pos != string::npos;
+       pos = s.find(sub, pos + 1))
+  {
+    ++res;
+  }
+  return res;
+}
+
+class TracingTests : public ::testing::Test
+{
+ protected:
+  void SetUp() override { trace::clear(); }
+  void TearDown() override
+  {
+    trace::enable(false);
+    trace::clear();
+  }
+};
+
+TEST_F(TracingTests, Spans)
+{
+  {
+    // not recording yet
+    trace::Span s("ignored", "test");
+  }
+  EXPECT_EQ(trace::num_spans(), 0);
+
+  trace::enable();
+  {
+    trace::Span outer("outer", "test");
+    trace::Span inner("inner \"quoted\"", "test");
+  }
+  EXPECT_EQ(trace::num_spans(), 2);
+
+  ostringstream ss;
+  trace::write_chrome_trace(ss);
+  string json = ss.str();
+  EXPECT_EQ(json.find("{\"displayTimeUnit\":\"ms\",\"traceEvents\":["), 0);
+  EXPECT_EQ(count(json, "\"ph\":\"X\""), 2);
+  EXPECT_NE(json.find("\"name\":\"outer\""), string::npos);
+  EXPECT_NE(json.find("\"name\":\"inner \\\"quoted\\\"\""), string::npos);
+  EXPECT_EQ(json.find("ignored"), string::npos);
+
+  trace::clear();
+  EXPECT_EQ(trace::num_spans(), 0);
+}
+
+TEST_F(TracingTests, Threads)
+{
+  trace::enable();
+  vector<thread> threads;
+  for (size_t i = 0; i < 4; ++i)
+  {
+    threads.emplace_back([]() {
+      for (size_t j = 0; j < 10; ++j)
+      {
+        trace::Span s("work", "test");
+      }
+    });
+  }
+  for (auto & t : threads)
+  {
+    t.join();
+  }
+  EXPECT_EQ(trace::num_spans(), 40);
+
+  // the buffers outlive the threads, one row per thread
+  ostringstream ss;
+  trace::write_chrome_trace(ss);
+  EXPECT_EQ(count(ss.str(), "\"thread_name\""), 4);
+}
+
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(BackendTracingTests);
+class BackendTracingTests
+    : public TracingTests,
+      public ::testing::WithParamInterface<SolverConfiguration>
+{
+};
+
+TEST_P(BackendTracingTests, CheckSat)
+{
+  SmtSolver s = create_solver(GetParam());
+  s->set_opt("incremental", "true");
+  Term b = s->make_symbol("b", s->make_sort(BOOL));
+  trace::enable();
+  s->push();
+  s->assert_formula(b);
+  ASSERT_TRUE(s->check_sat().is_sat());
+  s->pop();
+
+  ostringstream ss;
+  trace::write_chrome_trace(ss);
+  if (trace::compiled_in())
+  {
+    EXPECT_NE(ss.str().find("::check_sat\""), string::npos);
+    EXPECT_NE(ss.str().find("::push\""), string::npos);
+    EXPECT_NE(ss.str().find("\"cat\":\"backend\""), string::npos);
+  }
+  else
+  {
+    EXPECT_EQ(trace::num_spans(), 0);
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    ParameterizedBackendTracingTests,
+    BackendTracingTests,
+    testing::ValuesIn(available_non_generic_solver_configurations()));
+
+}  // namespace smt_tests
@@ -71,14 +71,11 @@ TEST_P(UnitSolveTests, CheckSatAssuming)
     EXPECT_TRUE(r.is_unsat());
   }
 
-  if (s->get_solver_enum() != GENERIC_SOLVER)
-  {
-    r = s->check_sat_assuming_list(TermList{ b1, nb2 });
-    EXPECT_TRUE(r.is_unsat());
+  r = s->check_sat_assuming_list(TermList{ b1, nb2 });
+  EXPECT_TRUE(r.is_unsat());
 
-    r = s->check_sat_assuming_set(UnorderedTermSet{ b1, nb2 });
-    EXPECT_TRUE(r.is_unsat());
-  }
+  r = s->check_sat_assuming_set(UnorderedTermSet{ b1, nb2 });
+  EXPECT_TRUE(r.is_unsat());
 }
 
 INSTANTIATE_TEST_SUITE_P(ParameterizedUnitSolveTests,
@@ -106,6 +106,26 @@ TEST_P(UnitSubstituteTests, SubstituteTerms)
   EXPECT_EQ(subs[2], apb);
 }
 
+TEST_P(UnitSubstituteTests, SubstituteTermsShared)
+{
+  // roots sharing a subterm, plus a root without substituted symbols
+  Term shared = s->make_term(BVMul, xpy, xpy);
+  Term r0 = s->make_term(BVAdd, shared, x);
+  Term r1 = s->make_term(BVSub, shared, y);
+  Term r2 = s->make_term(BVAnd, a, b);
+  UnorderedTermMap subs_map({ { x, a }, { y, b } });
+  TermVec roots({ r0, r1, r2, shared });
+  TermVec subs = s->substitute_terms(roots, subs_map);
+
+  ASSERT_EQ(subs.size(), roots.size());
+  for (size_t i = 0; i < roots.size(); ++i)
+  {
+    EXPECT_EQ(subs[i], s->substitute(roots[i], subs_map));
+  }
+  EXPECT_EQ(subs[2], r2);
+  EXPECT_TRUE(s->substitute_terms({}, subs_map).empty());
+}
+
 TEST_P(UnitSubstituteTests, SimpleSubstitutionWalker)
 {
   // substitution walker can substitute arbitrary terms
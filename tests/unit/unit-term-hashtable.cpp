@@ -16,6 +16,7 @@
 
 #include "available_solvers.h"
 #include "gtest/gtest.h"
+#include "logging_term.h"
 #include "smt.h"
 #include "term_hashtable.h"
 
@@ -42,6 +43,25 @@ class UnitTestsHashTable : public testing::Test,
     funsort = s->make_sort(FUNCTION, SortVec{ bvsort, bvsort });
     arrsort = s->make_sort(ARRAY, bvsort, bvsort);
   }
+  /** @return a logging solver and x + 1 over it */
+  Term make_logging_xp1(SmtSolver & ls)
+  {
+    ls = create_solver(SolverConfiguration(GetParam(), true));
+    Sort lbvsort = ls->make_sort(BV, 4);
+    Term x = ls->make_symbol("x", lbvsort);
+    return ls->make_term(BVAdd, x, ls->make_term(1, lbvsort));
+  }
+
+  /** @return a distinct object equal to t, which must be a logging term
+   *  logging terms are hash-consed by the solver, so this is the way
+   *  to get equal terms that are not interned with any backend
+   */
+  Term copy_logging_term(const Term & t)
+  {
+    return std::make_shared<LoggingTerm>(
+        *std::static_pointer_cast<LoggingTerm>(t));
+  }
+
   SmtSolver s;
   Sort bvsort, funsort, arrsort;
   TermHashTable table;
@@ -49,6 +69,11 @@ class UnitTestsHashTable : public testing::Test,
 
 TEST_P(UnitTestsHashTable, HashTable)
 {
+  if (solver_has_attribute(GetParam(), INTERNED_TERMS))
+  {
+    GTEST_SKIP() << "equal terms are already the same object";
+  }
+
   Term x = s->make_symbol("x", bvsort);
   Term one = s->make_term(1, bvsort);
   Term xp1 = s->make_term(BVAdd, x, one);
@@ -71,6 +96,140 @@ TEST_P(UnitTestsHashTable, HashTable)
   ASSERT_EQ(cp_xp1_2.use_count(), 1);
 }
 
+TEST_P(UnitTestsHashTable, WeakHashTable)
+{
+  if (solver_has_attribute(GetParam(), INTERNED_TERMS))
+  {
+    GTEST_SKIP() << "equal terms are already the same object";
+  }
+
+  WeakTermHashTable weak_table;
+  Term x = s->make_symbol("x", bvsort);
+  Term one = s->make_term(1, bvsort);
+  Term xp1 = s->make_term(BVAdd, x, one);
+  Term xp1_2 = s->make_term(BVAdd, x, one);
+
+  ASSERT_FALSE(weak_table.lookup(xp1));
+  weak_table.insert(xp1);
+  // the table does not hold a reference
+  ASSERT_EQ(xp1.use_count(), 1);
+  ASSERT_TRUE(weak_table.lookup(xp1_2));
+  ASSERT_EQ(xp1.get(), xp1_2.get());
+  ASSERT_EQ(weak_table.size(), 1);
+
+  xp1 = nullptr;
+  xp1_2 = nullptr;
+  Term xp1_3 = s->make_term(BVAdd, x, one);
+  ASSERT_FALSE(weak_table.contains(xp1_3));
+  ASSERT_FALSE(weak_table.lookup(xp1_3));
+  weak_table.sweep();
+  ASSERT_EQ(weak_table.size(), 0);
+}
+
+TEST_P(UnitTestsHashTable, HashTableUninterned)
+{
+  SmtSolver ls;
+  Term xp1 = make_logging_xp1(ls);
+  Term xp1_2 = copy_logging_term(xp1);
+  Term cp_xp1_2 = xp1_2;
+  ASSERT_NE(xp1.get(), xp1_2.get());
+  ASSERT_EQ(xp1, xp1_2);
+  ASSERT_FALSE(table.lookup(xp1));
+
+  table.insert(xp1);
+  ASSERT_TRUE(table.contains(xp1_2));
+  ASSERT_TRUE(table.lookup(xp1_2));
+  ASSERT_EQ(xp1.get(), xp1_2.get());
+  // two references here and one in the hash table
+  ASSERT_EQ(xp1_2.use_count(), 3);
+  ASSERT_EQ(cp_xp1_2.use_count(), 1);
+
+  table.erase(xp1);
+  ASSERT_FALSE(table.contains(cp_xp1_2));
+  ASSERT_EQ(table.size(), 0);
+}
+
+TEST_P(UnitTestsHashTable, WeakHashTableUninterned)
+{
+  SmtSolver ls;
+  WeakTermHashTable weak_table;
+  Term xp1 = make_logging_xp1(ls);
+  Term xp1_2 = copy_logging_term(xp1);
+  Term xp1_3 = copy_logging_term(xp1);
+  ASSERT_NE(xp1.get(), xp1_2.get());
+
+  ASSERT_FALSE(weak_table.lookup(xp1));
+  weak_table.insert(xp1);
+  // the table does not hold a reference
+  ASSERT_EQ(xp1.use_count(), 1);
+  ASSERT_TRUE(weak_table.lookup(xp1_2));
+  ASSERT_EQ(xp1.get(), xp1_2.get());
+  ASSERT_EQ(weak_table.size(), 1);
+  ASSERT_EQ(weak_table.num_live(), 1);
+
+  // the entry expires with the last reference
+  xp1 = nullptr;
+  xp1_2 = nullptr;
+  ASSERT_EQ(weak_table.num_live(), 0);
+  ASSERT_FALSE(weak_table.contains(xp1_3));
+  ASSERT_FALSE(weak_table.lookup(xp1_3));
+  weak_table.sweep();
+  ASSERT_EQ(weak_table.size(), 0);
+
+  // and a new equal term can take its place
+  weak_table.insert(xp1_3);
+  ASSERT_TRUE(weak_table.contains(copy_logging_term(xp1_3)));
+  ASSERT_EQ(weak_table.size(), 1);
+}
+
+TEST_P(UnitTestsHashTable, InternTable)
+{
+  TermInternTable intern_table;
+  Sort bv32sort = s->make_sort(BV, 32);
+  size_t made = 0;
+  auto make = [this, &made]() {
+    ++made;
+    return s->make_term(made, bvsort);
+  };
+
+  Term t1 = intern_table.intern(1, make);
+  ASSERT_EQ(intern_table.intern(1, make), t1);
+  ASSERT_EQ(made, 1);
+  // the table does not hold a reference
+  ASSERT_EQ(t1.use_count(), 1);
+  ASSERT_EQ(intern_table.lookup(1), t1);
+  ASSERT_FALSE(intern_table.lookup(2));
+
+  // a dead entry is replaced
+  t1 = nullptr;
+  ASSERT_FALSE(intern_table.lookup(1));
+  Term t2 = intern_table.intern(1, make);
+  ASSERT_EQ(made, 2);
+  ASSERT_EQ(intern_table.size(), 1);
+
+  // the table only grows with the live entries
+  TermVec live;
+  for (uint64_t key = 100; key < 10100; ++key)
+  {
+    Term t = intern_table.intern(
+        key, [this, key, bv32sort]() { return s->make_term(key, bv32sort); });
+    if (key % 10 == 0)
+    {
+      live.push_back(t);
+    }
+  }
+  ASSERT_LE(intern_table.capacity(), 16 * live.size());
+  for (uint64_t key = 100; key < 10100; key += 10)
+  {
+    ASSERT_TRUE(intern_table.lookup(key));
+  }
+  ASSERT_EQ(intern_table.lookup(1), t2);
+
+  intern_table.clear();
+  ASSERT_EQ(intern_table.size(), 0);
+  ASSERT_FALSE(intern_table.lookup(1));
+}
+
 // similarly to logging solvers, generic solvers
 // increase the usage count and so we ignore
 // them in this test
@@ -14,6 +14,7 @@
 **
 **/
 
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -49,6 +50,11 @@ class ConstArrUnitTests : public UnitTests
 {
 };
 
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(InternedTermsUnitTests);
+class InternedTermsUnitTests : public UnitTests
+{
+};
+
 TEST_P(UnitTests, TermIter)
 {
   Term x = s->make_symbol("x", bvsort);
@@ -125,6 +131,35 @@ TEST_P(UnitTests, CopyIter)
   EXPECT_NE(it1, it2);
 }
 
+TEST_P(InternedTermsUnitTests, SameWrappers)
+{
+  Term x = s->make_symbol("x", bvsort);
+  Term f = s->make_symbol("f", funsort);
+  Term fx = s->make_term(Apply, f, x);
+  Term sum = s->make_term(BVAdd, fx, x);
+  ASSERT_EQ(s->make_term(BVAdd, fx, x).get(), sum.get());
+
+  // the children are the terms that were built, in any order
+  unordered_set<AbsTerm *> built({ fx.get(), x.get() });
+  TermVec children(sum->begin(), sum->end());
+  ASSERT_EQ(children.size(), 2);
+  for (const auto & c : children)
+  {
+    EXPECT_TRUE(built.find(c.get()) != built.end());
+  }
+
+  // visiting again does not create new wrappers
+  TermVec children2(sum->begin(), sum->end());
+  for (size_t i = 0; i < children.size(); ++i)
+  {
+    EXPECT_EQ(children[i].get(), children2[i].get());
+  }
+  TermVec fx_children(fx->begin(), fx->end());
+  ASSERT_EQ(fx_children.size(), 2);
+  EXPECT_EQ(fx_children[0].get(), f.get());
+  EXPECT_EQ(fx_children[1].get(), x.get());
+}
+
 INSTANTIATE_TEST_SUITE_P(ParametrizedUnit,
                          UnitTests,
                          testing::ValuesIn(filter_solver_configurations({ TERMITER })));
@@ -134,4 +169,9 @@ INSTANTIATE_TEST_SUITE_P(
     ConstArrUnitTests,
     testing::ValuesIn(filter_solver_configurations({ CONSTARR, TERMITER })));
 
+INSTANTIATE_TEST_SUITE_P(ParametrizedInternedTermsUnit,
+                         InternedTermsUnitTests,
+                         testing::ValuesIn(filter_solver_configurations(
+                             { TERMITER, INTERNED_TERMS })));
+
 }  // namespace smt_tests
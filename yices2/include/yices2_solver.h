@@ -126,6 +126,9 @@ class Yices2Solver : public AbsSmtSolver
   void reset_assertions() override;
   Term substitute(const Term term,
                   const UnorderedTermMap & substitution_map) const override;
+  TermVec substitute_terms(
+      const TermVec & terms,
+      const UnorderedTermMap & substitution_map) const override;
   void dump_smt2(std::string filename) const override;
 
  protected:
@@ -147,12 +150,26 @@ class Yices2Solver : public AbsSmtSolver
   ///< can't rely on yices_get_term_by_name to see if name
   ///< has already been used.
 
-  // helper function
+  std::vector<term_t> assumption_buffer_;
+  ///< reused by check_sat_assuming* to avoid an allocation per query
+
+  // helper functions
+  template <class I>
+  inline void fill_assumption_buffer(I it, const I & end)
+  {
+    assumption_buffer_.clear();
+    for (; it != end; ++it)
+    {
+      assumption_buffer_.push_back(
+          std::static_pointer_cast<Yices2Term>(*it)->term);
+    }
+  }
+
   inline Result check_sat_assuming(const std::vector<term_t> & y_assumps)
   {
     timelimit_start();
     smt_status_t res = yices_check_context_with_assumptions(
-        ctx, NULL, y_assumps.size(), &y_assumps[0]);
+        ctx, NULL, y_assumps.size(), y_assumps.data());
     bool tl_triggered = timelimit_end();
 
     if (yices_error_code() != 0)
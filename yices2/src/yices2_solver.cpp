@@ -21,6 +21,7 @@
 #include <unistd.h>
 
 #include "solver_utils.h"
+#include "trace.h"
 #include "yices.h"
 #include "yices2_extensions.h"
 
@@ -316,6 +317,7 @@ void Yices2Solver::assert_formula(const Term & t)
 
 Result Yices2Solver::check_sat()
 {
+  SMT_TRACE_SPAN("Yices2Solver::check_sat", "backend");
   timelimit_start();
   smt_status_t res = yices_check_context(ctx, NULL);
   bool tl_triggered = timelimit_end();
@@ -346,52 +348,29 @@ Result Yices2Solver::check_sat()
 
 Result Yices2Solver::check_sat_assuming(const TermVec & assumptions)
 {
-  vector<term_t> y_assumps;
-  y_assumps.reserve(assumptions.size());
-
-  shared_ptr<Yices2Term> ya;
-  for (auto a : assumptions)
-  {
-    ya = static_pointer_cast<Yices2Term>(a);
-    y_assumps.push_back(ya->term);
-  }
-
-  return check_sat_assuming(y_assumps);
+  SMT_TRACE_SPAN("Yices2Solver::check_sat_assuming", "backend");
+  fill_assumption_buffer(assumptions.begin(), assumptions.end());
+  return check_sat_assuming(assumption_buffer_);
 }
 
 Result Yices2Solver::check_sat_assuming_list(const TermList & assumptions)
 {
-  vector<term_t> y_assumps;
-  y_assumps.reserve(assumptions.size());
-
-  shared_ptr<Yices2Term> ya;
-  for (auto a : assumptions)
-  {
-    ya = static_pointer_cast<Yices2Term>(a);
-    y_assumps.push_back(ya->term);
-  }
-
-  return check_sat_assuming(y_assumps);
+  SMT_TRACE_SPAN("Yices2Solver::check_sat_assuming_list", "backend");
+  fill_assumption_buffer(assumptions.begin(), assumptions.end());
+  return check_sat_assuming(assumption_buffer_);
 }
 
 Result Yices2Solver::check_sat_assuming_set(
     const UnorderedTermSet & assumptions)
 {
-  vector<term_t> y_assumps;
-  y_assumps.reserve(assumptions.size());
-
-  shared_ptr<Yices2Term> ya;
-  for (auto a : assumptions)
-  {
-    ya = static_pointer_cast<Yices2Term>(a);
-    y_assumps.push_back(ya->term);
-  }
-
-  return check_sat_assuming(y_assumps);
+  SMT_TRACE_SPAN("Yices2Solver::check_sat_assuming_set", "backend");
+  fill_assumption_buffer(assumptions.begin(), assumptions.end());
+  return check_sat_assuming(assumption_buffer_);
 }
 
 void Yices2Solver::push(uint64_t num)
 {
+  SMT_TRACE_SPAN("Yices2Solver::push", "backend");
   if (yices_context_status(ctx) == STATUS_UNSAT)
   {
     pushes_after_unsat += num;
@@ -408,6 +387,7 @@ void Yices2Solver::push(uint64_t num)
 
 void Yices2Solver::pop(uint64_t num)
 {
+  SMT_TRACE_SPAN("Yices2Solver::pop", "backend");
   for (size_t i = 0; i < num; ++i)
   {
     if (pushes_after_unsat)
@@ -425,6 +405,7 @@ uint64_t Yices2Solver::get_context_level() const { return context_level; }
 
 Term Yices2Solver::get_value(const Term & t) const
 {
+  SMT_TRACE_SPAN("Yices2Solver::get_value", "backend");
   shared_ptr<Yices2Term> yterm = static_pointer_cast<Yices2Term>(t);
   model_t * model = yices_get_model(ctx, true);
 
@@ -1051,6 +1032,46 @@ Term Yices2Solver::substitute(const Term term,
   return std::make_shared<Yices2Term> (res);
 }
 
+TermVec Yices2Solver::substitute_terms(
+    const TermVec & terms, const UnorderedTermMap & substitution_map) const
+{
+  vector<term_t> to_subst;
+  vector<term_t> values;
+  for (auto elem : substitution_map)
+  {
+    to_subst.push_back(static_pointer_cast<Yices2Term>(elem.first)->term);
+    values.push_back(static_pointer_cast<Yices2Term>(elem.second)->term);
+  }
+
+  vector<term_t> yterms;
+  yterms.reserve(terms.size());
+  for (const auto & t : terms)
+  {
+    yterms.push_back(static_pointer_cast<Yices2Term>(t)->term);
+  }
+
+  // substitutes in place, sharing one cache across all terms
+  yices_subst_term_array(to_subst.size(),
+                         to_subst.data(),
+                         values.data(),
+                         yterms.size(),
+                         yterms.data());
+
+  if (yices_error_code() != 0)
+  {
+    std::string msg(yices_error_string());
+    throw InternalSolverException(msg.c_str());
+  }
+
+  TermVec res;
+  res.reserve(yterms.size());
+  for (auto yt : yterms)
+  {
+    res.push_back(std::make_shared<Yices2Term>(yt));
+  }
+  return res;
+}
+
 void Yices2Solver::dump_smt2(std::string filename) const
 {
   throw NotImplementedException(
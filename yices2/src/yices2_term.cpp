@@ -446,6 +446,24 @@ uint64_t Yices2Term::to_int() const
   }
 }
 
+void Yices2Term::to_bv_words(std::vector<uint64_t> & out)
+{
+  if (is_function || yices_term_constructor(term) != YICES_BV_CONSTANT)
+  {
+    throw IncorrectUsageException(
+        "Can only convert bit-vector values to words, got " + to_string());
+  }
+  uint32_t width = yices_term_bitsize(term);
+  // one int32_t per bit, least significant bit first
+  std::vector<int32_t> bits(width);
+  yices_bv_const_value(term, bits.data());
+  out.assign((width + 63) / 64, 0);
+  for (uint32_t i = 0; i < width; ++i)
+  {
+    out[i / 64] |= uint64_t(bits[i] & 1) << (i % 64);
+  }
+}
+
 TermIter Yices2Term::begin()
 {
   throw NotImplementedException(
@@ -0,0 +1,75 @@
+/*********************                                                        */
+/*! \file z3_datatype.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   agent
+ ** This file is part of the smt-switch project.
+ ** Copyright (c) 2026 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file LICENSE in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Z3 implementation of the datatype declaration classes
+ **
+ **
+ **/
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "datatype.h"
+#include "exceptions.h"
+#include "smt_defs.h"
+#include "sort.h"
+#include "z3++.h"
+
+namespace smt {
+
+// Z3 creates a whole family of datatypes at once (Z3_mk_datatypes),
+// so the declarations only record the constructors and selectors
+// until make_datatype_sorts is called.
+
+class Z3DatatypeDecl : public AbsDatatypeDecl
+{
+ public:
+  Z3DatatypeDecl(const std::string & name) : name(name){};
+
+ protected:
+  std::string name;
+  std::vector<DatatypeConstructorDecl> constructors;
+
+  friend class Z3Solver;
+};
+
+class Z3DatatypeConstructorDecl : public AbsDatatypeConstructorDecl
+{
+ public:
+  Z3DatatypeConstructorDecl(const std::string & name) : name(name){};
+  bool compare(const DatatypeConstructorDecl & d) const override;
+
+ protected:
+  std::string name;
+  std::vector<std::string> selector_names;
+  // a null sort stands for the datatype being declared (add_selector_self)
+  SortVec selector_sorts;
+
+  friend class Z3Solver;
+};
+
+class Z3Datatype : public AbsDatatype
+{
+ public:
+  Z3Datatype(z3::sort s) : type(s){};
+  std::string get_name() const override;
+  int get_num_constructors() const override;
+  int get_num_selectors(std::string cons) const override;
+
+ protected:
+  z3::sort type;
+
+  friend class Z3Solver;
+};
+
+}  // namespace smt
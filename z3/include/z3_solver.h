@@ -26,6 +26,7 @@
 #include "result.h"
 #include "smt.h"
 #include "sort.h"
+#include "z3_datatype.h"
 #include "z3_sort.h"
 #include "z3_term.h"
 
@@ -75,6 +76,9 @@ class Z3Solver : public AbsSmtSolver
   Sort make_sort(SortKind sk, const SortVec & sorts) const override;
   Sort make_sort(const Sort & sort_con, const SortVec & sorts) const override;
   Sort make_sort(const DatatypeDecl & d) const override;
+  Sort make_unresolved_sort(const DatatypeDecl & decl) const override;
+  SortVec make_datatype_sorts(
+      const std::vector<DatatypeDecl> & decls) const override;
 
   DatatypeDecl make_datatype_decl(const std::string & s) override;
   DatatypeConstructorDecl make_datatype_constructor_decl(
@@ -111,8 +115,12 @@ class Z3Solver : public AbsSmtSolver
   Term make_term(Op op, const TermVec & terms) const override;
   void reset() override;
   void reset_assertions() override;
+  MemoryStats get_memory_stats() const override;
   Term substitute(const Term term,
                   const UnorderedTermMap & substitution_map) const override;
+  TermVec substitute_terms(
+      const TermVec & terms,
+      const UnorderedTermMap & substitution_map) const override;
   void dump_smt2(std::string filename) const override;
 
   // getters for solver-specific objects (EXPERTS ONLY)
@@ -131,26 +139,55 @@ class Z3Solver : public AbsSmtSolver
   bool last_query_assuming;  ///< used to determine if last query was
                              ///< check_sat_assuming (vs just check_sat)
 
+  std::vector<Z3_ast> assumption_buffer_;  ///< reused by check_sat_assuming
+
+  mutable TermInternTable term_table_;  ///< one wrapper per live Z3 AST
+
+  /** placeholders from make_unresolved_sort, by the identity of the wrapper
+   *  (Z3 uninterpreted sorts with the same name are the same sort)
+   */
+  mutable std::unordered_map<const AbsSort *, Sort> unresolved_sorts_;
+
+  // helpers for creating the term wrappers
+  Term wrap(const expr & e) const { return Z3Term::wrap(&term_table_, e); }
+  Term wrap(const func_decl & f) const
+  {
+    return Z3Term::wrap(&term_table_, f);
+  }
+
   // helper function
-  inline Result check_sat_assuming(expr_vector & z3assumps)
+  // passes the assumptions to z3 directly, without an expr_vector
+  template <class I>
+  inline Result check_sat_assuming_internal(I it, const I & end)
   {
+    assumption_buffer_.clear();
+    std::shared_ptr<Z3Term> za;
+    for (; it != end; ++it)
+    {
+      za = std::static_pointer_cast<Z3Term>(*it);
+      if (za->is_function)
+      {
+        throw IncorrectUsageException(
+            "Functions cannot be used directly as assumptions.");
+      }
+      assumption_buffer_.push_back(za->term);
+    }
+
     last_query_assuming = true;
-    check_result r = slv.check(z3assumps);
-    if (r == unsat)
+    Z3_lbool r = Z3_solver_check_assumptions(
+        ctx, slv, assumption_buffer_.size(), assumption_buffer_.data());
+    ctx.check_error();
+    if (r == Z3_L_FALSE)
     {
       return Result(UNSAT);
     }
-    else if (r == sat)
+    else if (r == Z3_L_TRUE)
     {
       return Result(SAT);
     }
-    else if (r == unknown)
-    {
-      return Result(UNKNOWN, slv.reason_unknown());
-    }
     else
     {
-      throw NotImplementedException("Unimplemented result type from Z3");
+      return Result(UNKNOWN, slv.reason_unknown());
     }
   }
 };
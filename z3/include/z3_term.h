@@ -19,6 +19,7 @@
 #include <vector>
 
 #include "term.h"
+#include "term_hashtable.h"
 #include "utils.h"
 #include "z3++.h"
 #include "z3_sort.h"
@@ -31,10 +32,13 @@ class Z3Solver;
 class Z3TermIter : public TermIterBase
 {
  public:
-  Z3TermIter(expr t, uint32_t p, bool nt = false)
-      : term(t), pos(p), null_term(nt){};
+  Z3TermIter(expr t,
+             uint32_t p,
+             bool nt = false,
+             TermInternTable * table = nullptr)
+      : term(t), pos(p), null_term(nt), table(table){};
   Z3TermIter(const Z3TermIter & it)
-      : term(it.term), pos(it.pos), null_term(it.null_term)
+      : term(it.term), pos(it.pos), null_term(it.null_term), table(it.table)
   {
   }
   ~Z3TermIter(){};
@@ -52,6 +56,7 @@ class Z3TermIter : public TermIterBase
   expr term;
   uint32_t pos;
   bool null_term;  ///< set to true if the term is null (no iteration)
+  TermInternTable * table;  ///< interns the children, may be null
 };
 
 class Z3Term : public AbsTerm
@@ -89,6 +94,7 @@ class Z3Term : public AbsTerm
   bool is_value() const override;
   virtual std::string to_string() override;
   uint64_t to_int() const override;
+  void to_bv_words(std::vector<uint64_t> & out) override;
   /* Iterators for traversing the children */
   TermIter begin() override;
   TermIter end() override;
@@ -121,6 +127,14 @@ class Z3Term : public AbsTerm
   bool is_function;
   bool is_parameter;
   context * ctx;
+  /** the table of the solver that created this term, if any
+   *  the children are interned in the same table
+   */
+  TermInternTable * intern_table = nullptr;
+
+  /** wrap a Z3 object, interned by its AST id if table is not null */
+  static Term wrap(TermInternTable * table, const expr & e);
+  static Term wrap(TermInternTable * table, const func_decl & f);
 
   // a const version of to_string
   // the main to_string can't be const so that LoggingSolver
@@ -0,0 +1,50 @@
+/*********************                                                        */
+/*! \file z3_datatype.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   agent
+ ** This file is part of the smt-switch project.
+ ** Copyright (c) 2026 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved.  See the file LICENSE in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief Z3 implementation of the datatype declaration classes
+ **
+ **
+ **/
+
+#include "z3_datatype.h"
+
+using namespace std;
+
+namespace smt {
+
+bool Z3DatatypeConstructorDecl::compare(const DatatypeConstructorDecl & d) const
+{
+  return name == static_pointer_cast<Z3DatatypeConstructorDecl>(d)->name;
+}
+
+string Z3Datatype::get_name() const { return type.name().str(); }
+
+int Z3Datatype::get_num_constructors() const
+{
+  return Z3_get_datatype_sort_num_constructors(type.ctx(), type);
+}
+
+int Z3Datatype::get_num_selectors(string cons) const
+{
+  int num_cons = get_num_constructors();
+  for (int i = 0; i < num_cons; ++i)
+  {
+    z3::func_decl c(type.ctx(),
+                    Z3_get_datatype_sort_constructor(type.ctx(), type, i));
+    if (c.name().str() == cons)
+    {
+      return c.arity();
+    }
+  }
+  throw InternalSolverException(get_name() + "." + cons + " not found");
+}
+
+}  // namespace smt
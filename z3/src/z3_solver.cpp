@@ -4,6 +4,7 @@
 #include <z3++.h>
 
 #include "solver_utils.h"
+#include "trace.h"
 
 #include <iostream>
 
@@ -22,6 +23,13 @@ typedef Z3_ast (*bin_fun)(Z3_context c, Z3_ast t1, Z3_ast t2);
 typedef Z3_ast (*tern_fun)(Z3_context c, Z3_ast t1, Z3_ast t2, Z3_ast t3);
 typedef Z3_ast (*variadic_fun)(Z3_context c, unsigned num, Z3_ast const args[]);
 
+// true for the operators that apply a function symbol (the first child)
+bool is_apply_op(PrimOp po)
+{
+  return po == Apply || po == Apply_Constructor || po == Apply_Selector
+         || po == Apply_Tester;
+}
+
 // extension function
 Z3_ast ext_Z3_mk_bvcomp(Z3_context c, Z3_ast t1, Z3_ast t2)
 {
@@ -216,53 +224,255 @@ Term Z3Solver::make_term(bool b) const
     z_term = ctx.bool_val(true);
   }
 
-  return std::make_shared<Z3Term>(z_term, ctx);
+  return wrap(z_term);
 }
 
 Sort Z3Solver::make_sort(const DatatypeDecl & d) const
 {
-  throw NotImplementedException("Z3Solver::make_sort");
+  return make_datatype_sorts({ d })[0];
 };
+
+Sort Z3Solver::make_unresolved_sort(const DatatypeDecl & decl) const
+{
+  // an uninterpreted sort with the same name, resolved in
+  // make_datatype_sorts
+  Sort placeholder =
+      make_sort(static_pointer_cast<Z3DatatypeDecl>(decl)->name, 0);
+  unresolved_sorts_[placeholder.get()] = placeholder;
+  return placeholder;
+}
+
+SortVec Z3Solver::make_datatype_sorts(
+    const std::vector<DatatypeDecl> & decls) const
+{
+  size_t num_sorts = decls.size();
+  unordered_map<string, unsigned> dt_index;
+  vector<Z3_symbol> names;
+  names.reserve(num_sorts);
+  for (size_t i = 0; i < num_sorts; ++i)
+  {
+    const string & name = static_pointer_cast<Z3DatatypeDecl>(decls[i])->name;
+    if (!dt_index.emplace(name, i).second)
+    {
+      throw IncorrectUsageException("Datatype " + name + " declared twice");
+    }
+    names.push_back(Z3_mk_string_symbol(ctx, name.c_str()));
+  }
+
+  vector<Z3_constructor> constructors;
+  vector<Z3_constructor_list> constructor_lists;
+  constructor_lists.reserve(num_sorts);
+  vector<Z3_symbol> field_names;
+  vector<Z3_sort> field_sorts;
+  vector<unsigned> field_refs;
+  vector<const AbsSort *> resolved;
+  for (size_t i = 0; i < num_sorts; ++i)
+  {
+    size_t first = constructors.size();
+    for (const auto & c :
+         static_pointer_cast<Z3DatatypeDecl>(decls[i])->constructors)
+    {
+      shared_ptr<Z3DatatypeConstructorDecl> zc =
+          static_pointer_cast<Z3DatatypeConstructorDecl>(c);
+      size_t num_fields = zc->selector_names.size();
+      field_names.clear();
+      field_sorts.clear();
+      field_refs.clear();
+      for (size_t f = 0; f < num_fields; ++f)
+      {
+        field_names.push_back(
+            Z3_mk_string_symbol(ctx, zc->selector_names[f].c_str()));
+        const Sort & fs = zc->selector_sorts[f];
+        if (!fs)
+        {
+          // self selector
+          field_sorts.push_back(nullptr);
+          field_refs.push_back(i);
+          continue;
+        }
+        z3::sort zs = static_pointer_cast<Z3Sort>(fs)->type;
+        if (unresolved_sorts_.find(fs.get()) != unresolved_sorts_.end())
+        {
+          // placeholder from make_unresolved_sort
+          string dt_name = zs.name().str();
+          auto it = dt_index.find(dt_name);
+          if (it == dt_index.end())
+          {
+            for (auto cl : constructor_lists)
+            {
+              Z3_del_constructor_list(ctx, cl);
+            }
+            for (auto c : constructors)
+            {
+              Z3_del_constructor(ctx, c);
+            }
+            throw IncorrectUsageException("Unresolved sort " + dt_name
+                                          + " has no datatype in this batch");
+          }
+          field_sorts.push_back(nullptr);
+          field_refs.push_back(it->second);
+          resolved.push_back(fs.get());
+        }
+        else
+        {
+          field_sorts.push_back(zs);
+          field_refs.push_back(0);
+        }
+      }
+      string recognizer = "is-" + zc->name;
+      constructors.push_back(
+          Z3_mk_constructor(ctx,
+                            Z3_mk_string_symbol(ctx, zc->name.c_str()),
+                            Z3_mk_string_symbol(ctx, recognizer.c_str()),
+                            num_fields,
+                            field_names.data(),
+                            field_sorts.data(),
+                            field_refs.data()));
+    }
+    constructor_lists.push_back(Z3_mk_constructor_list(
+        ctx, constructors.size() - first, constructors.data() + first));
+  }
+
+  vector<Z3_sort> z3_sorts(num_sorts);
+  Z3_mk_datatypes(ctx,
+                  num_sorts,
+                  names.data(),
+                  z3_sorts.data(),
+                  constructor_lists.data());
+  for (auto cl : constructor_lists)
+  {
+    Z3_del_constructor_list(ctx, cl);
+  }
+  for (auto c : constructors)
+  {
+    Z3_del_constructor(ctx, c);
+  }
+  ctx.check_error();
+  for (auto p : resolved)
+  {
+    unresolved_sorts_.erase(p);
+  }
+
+  SortVec dt_sorts;
+  dt_sorts.reserve(num_sorts);
+  for (auto zs : z3_sorts)
+  {
+    dt_sorts.push_back(std::make_shared<Z3Sort>(z3::sort(ctx, zs), ctx));
+  }
+  return dt_sorts;
+}
+
 DatatypeDecl Z3Solver::make_datatype_decl(const std::string & s)
 {
-  throw NotImplementedException("Z3Solver::make_datatype_decl");
+  return std::make_shared<Z3DatatypeDecl>(s);
 }
+
 DatatypeConstructorDecl Z3Solver::make_datatype_constructor_decl(
     const std::string s)
 {
-  throw NotImplementedException("Z3Solver::make_datatype_constructor_decl");
+  return std::make_shared<Z3DatatypeConstructorDecl>(s);
 };
+
 void Z3Solver::add_constructor(DatatypeDecl & dt,
                                const DatatypeConstructorDecl & con) const
 {
-  throw NotImplementedException("Z3Solver::add_constructor");
+  static_pointer_cast<Z3DatatypeDecl>(dt)->constructors.push_back(con);
 };
+
 void Z3Solver::add_selector(DatatypeConstructorDecl & dt,
                             const std::string & name,
                             const Sort & s) const
 {
-  throw NotImplementedException("Z3Solver::add_selector");
+  shared_ptr<Z3DatatypeConstructorDecl> zc =
+      static_pointer_cast<Z3DatatypeConstructorDecl>(dt);
+  if (static_pointer_cast<Z3Sort>(s)->is_function)
+  {
+    throw IncorrectUsageException("Can't use a function sort for selector "
+                                  + name);
+  }
+  zc->selector_names.push_back(name);
+  zc->selector_sorts.push_back(s);
 };
+
 void Z3Solver::add_selector_self(DatatypeConstructorDecl & dt,
                                  const std::string & name) const
 {
-  throw NotImplementedException("Z3Solver::add_selector_self");
+  shared_ptr<Z3DatatypeConstructorDecl> zc =
+      static_pointer_cast<Z3DatatypeConstructorDecl>(dt);
+  zc->selector_names.push_back(name);
+  zc->selector_sorts.push_back(nullptr);
 };
 
 Term Z3Solver::get_constructor(const Sort & s, std::string name) const
 {
-  throw NotImplementedException("Z3Solver::get_constructor");
+  z3::sort zs = static_pointer_cast<Z3Sort>(s)->type;
+  if (s->get_sort_kind() != DATATYPE)
+  {
+    throw IncorrectUsageException("Expecting a datatype sort but got "
+                                  + s->to_string());
+  }
+  unsigned num_cons = Z3_get_datatype_sort_num_constructors(ctx, zs);
+  for (unsigned i = 0; i < num_cons; ++i)
+  {
+    func_decl c(ctx, Z3_get_datatype_sort_constructor(ctx, zs, i));
+    if (c.name().str() == name)
+    {
+      return wrap(c);
+    }
+  }
+  throw InternalSolverException(name + " not found in " + s->to_string());
 };
+
 Term Z3Solver::get_tester(const Sort & s, std::string name) const
 {
-  throw NotImplementedException("Z3Solver::get_testeer");
+  z3::sort zs = static_pointer_cast<Z3Sort>(s)->type;
+  if (s->get_sort_kind() != DATATYPE)
+  {
+    throw IncorrectUsageException("Expecting a datatype sort but got "
+                                  + s->to_string());
+  }
+  unsigned num_cons = Z3_get_datatype_sort_num_constructors(ctx, zs);
+  for (unsigned i = 0; i < num_cons; ++i)
+  {
+    func_decl c(ctx, Z3_get_datatype_sort_constructor(ctx, zs, i));
+    if (c.name().str() == name)
+    {
+      return wrap(func_decl(ctx, Z3_get_datatype_sort_recognizer(ctx, zs, i)));
+    }
+  }
+  throw InternalSolverException(name + " not found in " + s->to_string());
 };
 
 Term Z3Solver::get_selector(const Sort & s,
                             std::string con,
                             std::string name) const
 {
-  throw NotImplementedException("Z3Solver::get_selector");
+  z3::sort zs = static_pointer_cast<Z3Sort>(s)->type;
+  if (s->get_sort_kind() != DATATYPE)
+  {
+    throw IncorrectUsageException("Expecting a datatype sort but got "
+                                  + s->to_string());
+  }
+  unsigned num_cons = Z3_get_datatype_sort_num_constructors(ctx, zs);
+  for (unsigned i = 0; i < num_cons; ++i)
+  {
+    func_decl c(ctx, Z3_get_datatype_sort_constructor(ctx, zs, i));
+    if (c.name().str() != con)
+    {
+      continue;
+    }
+    for (unsigned j = 0; j < c.arity(); ++j)
+    {
+      func_decl sel(
+          ctx, Z3_get_datatype_sort_constructor_accessor(ctx, zs, i, j));
+      if (sel.name().str() == name)
+      {
+        return wrap(sel);
+      }
+    }
+  }
+  throw InternalSolverException(con + "." + name + " not found in "
+                                + s->to_string());
 };
 
 Term Z3Solver::make_term(int64_t i, const Sort & sort) const
@@ -290,7 +500,7 @@ Term Z3Solver::make_term(int64_t i, const Sort & sort) const
     throw IncorrectUsageException(msg);
   }
 
-  return std::make_shared<Z3Term>(z_term, ctx);
+  return wrap(z_term);
 }
 
 Term Z3Solver::make_term(const std::string val,
@@ -345,7 +555,7 @@ Term Z3Solver::make_term(const std::string val,
     throw IncorrectUsageException(msg);
   }
 
-  return std::make_shared<Z3Term>(z_term, ctx);
+  return wrap(z_term);
 }
 
 Term Z3Solver::make_term(const Term & val, const Sort & sort) const
@@ -363,7 +573,7 @@ Term Z3Solver::make_term(const Term & val, const Sort & sort) const
 
   Z3_ast c_array = Z3_mk_const_array(ctx, arrtype.array_domain(), zterm->term);
   expr final = to_expr(ctx, c_array);
-  return std::make_shared<Z3Term>(final, ctx);
+  return wrap(final);
 }
 
 void Z3Solver::assert_formula(const Term & t)
@@ -379,6 +589,7 @@ void Z3Solver::assert_formula(const Term & t)
 
 Result Z3Solver::check_sat()
 {
+  SMT_TRACE_SPAN("Z3Solver::check_sat", "backend");
   last_query_assuming = false;
   check_result r = slv.check();
   if (r == unsat)
@@ -401,63 +612,25 @@ Result Z3Solver::check_sat()
 
 Result Z3Solver::check_sat_assuming(const TermVec & assumptions)
 {
-  z3::expr_vector z3assumps(ctx);
-
-  shared_ptr<Z3Term> za;
-  for (auto a : assumptions)
-  {
-    za = static_pointer_cast<Z3Term>(a);
-    if (za->is_function)
-    {
-      throw IncorrectUsageException(
-          "Functions cannot be used directly as assumptions.");
-    }
-    z3assumps.push_back(za->term);
-  }
-
-  return check_sat_assuming(z3assumps);
+  SMT_TRACE_SPAN("Z3Solver::check_sat_assuming", "backend");
+  return check_sat_assuming_internal(assumptions.begin(), assumptions.end());
 }
 
 Result Z3Solver::check_sat_assuming_list(const TermList & assumptions)
 {
-  z3::expr_vector z3assumps(ctx);
-
-  shared_ptr<Z3Term> za;
-  for (auto a : assumptions)
-  {
-    za = static_pointer_cast<Z3Term>(a);
-    if (za->is_function)
-    {
-      throw IncorrectUsageException(
-          "Functions cannot be used directly as assumptions.");
-    }
-    z3assumps.push_back(za->term);
-  }
-
-  return check_sat_assuming(z3assumps);
+  SMT_TRACE_SPAN("Z3Solver::check_sat_assuming_list", "backend");
+  return check_sat_assuming_internal(assumptions.begin(), assumptions.end());
 }
 
 Result Z3Solver::check_sat_assuming_set(const UnorderedTermSet & assumptions)
 {
-  z3::expr_vector z3assumps(ctx);
-
-  shared_ptr<Z3Term> za;
-  for (auto a : assumptions)
-  {
-    za = static_pointer_cast<Z3Term>(a);
-    if (za->is_function)
-    {
-      throw IncorrectUsageException(
-          "Functions cannot be used directly as assumptions.");
-    }
-    z3assumps.push_back(za->term);
-  }
-
-  return check_sat_assuming(z3assumps);
+  SMT_TRACE_SPAN("Z3Solver::check_sat_assuming_set", "backend");
+  return check_sat_assuming_internal(assumptions.begin(), assumptions.end());
 }
 
 void Z3Solver::push(uint64_t num)
 {
+  SMT_TRACE_SPAN("Z3Solver::push", "backend");
   for (int i = 0; i < num; i++)
   {
     slv.push();
@@ -467,6 +640,7 @@ void Z3Solver::push(uint64_t num)
 
 void Z3Solver::pop(uint64_t num)
 {
+  SMT_TRACE_SPAN("Z3Solver::pop", "backend");
   slv.pop(num);
   context_level -= num;
 }
@@ -475,6 +649,7 @@ uint64_t Z3Solver::get_context_level() const { return context_level; }
 
 Term Z3Solver::get_value(const Term & t) const
 {
+  SMT_TRACE_SPAN("Z3Solver::get_value", "backend");
   shared_ptr<Z3Term> zterm = static_pointer_cast<Z3Term>(t);
   if (zterm->is_function)
   {
@@ -482,7 +657,7 @@ Term Z3Solver::get_value(const Term & t) const
   }
   z3::model model = slv.get_model();
   expr eval = model.eval(zterm->term, true);
-  return std::make_shared<Z3Term>(eval, ctx);
+  return wrap(eval);
 }
 
 UnorderedTermMap Z3Solver::get_array_values(const Term & arr,
@@ -504,7 +679,7 @@ void Z3Solver::get_unsat_assumptions(UnorderedTermSet & out)
   expr_vector core = slv.unsat_core();
   for (const auto & c : core)
   {
-    out.insert(std::make_shared<Z3Term>(c, ctx));
+    out.insert(wrap(c));
   }
 }
 
@@ -686,14 +861,14 @@ Term Z3Solver::make_symbol(const std::string name, const Sort & sort)
     }
 
     func_decl z_func = ctx.function(c, domain, sort_func.range());
-    sym = std::make_shared<Z3Term>(z_func, ctx);
+    sym = wrap(z_func);
   }
   else
   {
     // nb this is creating an expr
     expr z_term = ctx.constant(z_name, zsort->type);
 
-    sym = std::make_shared<Z3Term>(z_term, ctx);
+    sym = wrap(z_term);
   }
   assert(sym);
   symbol_table[name] = sym;
@@ -733,6 +908,11 @@ Term Z3Solver::make_term(Op op, const Term & t) const
 
   if (zterm->is_function)
   {
+    if (op.prim_op == Apply_Constructor && !zterm->z_func.arity())
+    {
+      // nullary constructor
+      return wrap(zterm->z_func());
+    }
     throw IncorrectUsageException(
         "Cannot make a unary operator term with a function.");
   }
@@ -822,7 +1002,7 @@ Term Z3Solver::make_term(Op op, const Term & t) const
     throw IncorrectUsageException(msg);
   }
 
-  return std::make_shared<Z3Term>(to_expr(ctx, res), ctx);
+  return wrap(to_expr(ctx, res));
 }
 
 Term Z3Solver::make_term(Op op, const Term & t0, const Term & t1) const
@@ -833,7 +1013,7 @@ Term Z3Solver::make_term(Op op, const Term & t0, const Term & t1) const
 
   if (zterm0->is_function || zterm1->is_function)
   {
-    if (op.prim_op == Apply)
+    if (is_apply_op(op.prim_op))
     {
       return make_term(op, TermVec{ t0, t1 });
     }
@@ -861,12 +1041,12 @@ Term Z3Solver::make_term(Op op, const Term & t0, const Term & t1) const
       z3::expr zbody = static_pointer_cast<Z3Term>(t1)->term;
       if (op == Forall)
       {
-        return make_shared<Z3Term>(forall(zparams, zbody), ctx);
+        return wrap(forall(zparams, zbody));
       }
       else
       {
         assert(op == Exists);
-        return make_shared<Z3Term>(exists(zparams, zbody), ctx);
+        return wrap(exists(zparams, zbody));
       }
     }
     else
@@ -884,7 +1064,7 @@ Term Z3Solver::make_term(Op op, const Term & t0, const Term & t1) const
     throw IncorrectUsageException(msg);
   }
 
-  return std::make_shared<Z3Term>(to_expr(ctx, res), ctx);
+  return wrap(to_expr(ctx, res));
 }
 
 Term Z3Solver::make_term(Op op,
@@ -899,7 +1079,7 @@ Term Z3Solver::make_term(Op op,
 
   if (zterm0->is_function || zterm1->is_function || zterm2->is_function)
   {
-    if (op.prim_op == Apply)
+    if (is_apply_op(op.prim_op))
     {
       return make_term(op, TermVec{ t0, t1, t2 });
     }
@@ -930,12 +1110,12 @@ Term Z3Solver::make_term(Op op,
       z3::expr zbody = static_pointer_cast<Z3Term>(t2)->term;
       if (op == Forall)
       {
-        return make_shared<Z3Term>(forall(zparams, zbody), ctx);
+        return wrap(forall(zparams, zbody));
       }
       else
       {
         assert(op == Exists);
-        return make_shared<Z3Term>(exists(zparams, zbody), ctx);
+        return wrap(exists(zparams, zbody));
       }
     }
     else
@@ -953,7 +1133,7 @@ Term Z3Solver::make_term(Op op,
     throw IncorrectUsageException(msg);
   }
 
-  return std::make_shared<Z3Term>(to_expr(ctx, res), ctx);
+  return wrap(to_expr(ctx, res));
 }
 
 Term Z3Solver::make_term(Op op, const TermVec & terms) const
@@ -973,7 +1153,7 @@ Term Z3Solver::make_term(Op op, const TermVec & terms) const
     return make_term(op, terms[0]);
   }
 
-  if (op.prim_op == Apply)
+  if (is_apply_op(op.prim_op))
   {
     vector<Z3_ast> zargs;
     zargs.reserve(size - 1);
@@ -1000,7 +1180,7 @@ Term Z3Solver::make_term(Op op, const TermVec & terms) const
     }
 
     res = Z3_mk_app(ctx, zterm->z_func, size - 1, &zargs[0]);
-    return std::make_shared<Z3Term>(to_expr(ctx, res), ctx);
+    return wrap(to_expr(ctx, res));
   }
 
   if (op.prim_op == Forall || op.prim_op == Exists)
@@ -1031,7 +1211,7 @@ Term Z3Solver::make_term(Op op, const TermVec & terms) const
     {
       quant_res = exists(zterms, quantified_body);
     }
-    return std::make_shared<Z3Term>(quant_res, ctx);
+    return wrap(quant_res);
   }
 
   if (size == 2)
@@ -1066,7 +1246,7 @@ Term Z3Solver::make_term(Op op, const TermVec & terms) const
         res = z3_fun(ctx, res, z3args[i]);
       }
     }
-    return std::make_shared<Z3Term>(to_expr(ctx, res), ctx);
+    return wrap(to_expr(ctx, res));
   }
   else if (op == Distinct)
   {
@@ -1089,6 +1269,16 @@ void Z3Solver::reset() { slv.reset(); }
 
 void Z3Solver::reset_assertions() { slv.reset(); }
 
+MemoryStats Z3Solver::get_memory_stats() const
+{
+  MemoryStats stats = AbsSmtSolver::get_memory_stats();
+  // z3's allocator is shared by all contexts in the process
+  stats.backend_bytes = Z3_get_estimated_alloc_size();
+  stats.live_terms = term_table_.num_live();
+  stats.cache_entries["term_intern_table"] = term_table_.size();
+  return stats;
+}
+
 Term Z3Solver::substitute(const Term term,
                           const UnorderedTermMap & substitution_map) const
 {
@@ -1114,7 +1304,52 @@ Term Z3Solver::substitute(const Term term,
 
   // perform the substitution and return the result
   expr result = z3expr.substitute(z3sources, z3destinations);
-  return std::make_shared<Z3Term>(result, ctx);
+  return wrap(result);
+}
+
+TermVec Z3Solver::substitute_terms(
+    const TermVec & terms, const UnorderedTermMap & substitution_map) const
+{
+  z3::expr_vector z3sources(ctx);
+  z3::expr_vector z3destinations(ctx);
+  for (const auto & p : substitution_map)
+  {
+    z3sources.push_back(static_pointer_cast<Z3Term>(p.first)->term);
+    z3destinations.push_back(static_pointer_cast<Z3Term>(p.second)->term);
+  }
+
+  // z3 substitutes in a single expression with its own cache, so bundle
+  // all the terms as arguments of an uninterpreted function (which z3
+  // doesn't rewrite) and substitute once
+  z3::sort_vector domain(ctx);
+  z3::expr_vector args(ctx);
+  for (const auto & t : terms)
+  {
+    shared_ptr<Z3Term> zt = static_pointer_cast<Z3Term>(t);
+    if (zt->is_function)
+    {
+      // function symbols can't be arguments
+      return AbsSmtSolver::substitute_terms(terms, substitution_map);
+    }
+    args.push_back(zt->term);
+    domain.push_back(zt->term.get_sort());
+  }
+  if (terms.empty())
+  {
+    return {};
+  }
+
+  z3::func_decl bundle =
+      ctx.function("__smt_switch_substitute", domain, ctx.bool_sort());
+  expr result = bundle(args).substitute(z3sources, z3destinations);
+
+  TermVec res;
+  res.reserve(terms.size());
+  for (unsigned i = 0; i < result.num_args(); ++i)
+  {
+    res.push_back(wrap(result.arg(i)));
+  }
+  return res;
 }
 
 void Z3Solver::dump_smt2(std::string filename) const
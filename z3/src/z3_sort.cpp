@@ -3,6 +3,7 @@
 #include <sstream>
 
 #include "exceptions.h"
+#include "z3_datatype.h"
 
 using namespace std;
 
@@ -126,7 +127,11 @@ SortVec Z3Sort::get_uninterpreted_param_sorts() const
 
 Datatype Z3Sort::get_datatype() const
 {
-  throw NotImplementedException("get_datatype");
+  if (is_function || !type.is_datatype())
+  {
+    throw IncorrectUsageException("Can only get datatype from datatype sort");
+  }
+  return std::make_shared<Z3Datatype>(type);
 };
 
 bool Z3Sort::compare(const Sort & s) const
@@ -142,6 +147,17 @@ bool Z3Sort::compare(const Sort & s) const
 
 SortKind Z3Sort::get_sort_kind() const
 {
+  if (is_function)
+  {
+    switch (z_func.decl_kind())
+    {
+      case Z3_OP_DT_CONSTRUCTOR: return CONSTRUCTOR;
+      case Z3_OP_DT_ACCESSOR: return SELECTOR;
+      case Z3_OP_DT_IS: return TESTER;
+      default: break;
+    }
+  }
+
   if (type.is_int())
   {
     return INT;
@@ -1,15 +1,40 @@
 #include "z3_term.h"
 
+#include <cstring>
 #include <unordered_map>
 
 #include "exceptions.h"
 #include "ops.h"
+#include "utils.h"
 #include "z3_sort.h"
 
 using namespace std;
 
 namespace smt {
 
+namespace {
+
+// true for applications of uninterpreted functions and datatype
+// constructors, selectors and testers -- smt-switch treats the function
+// symbol as the first child of these terms
+bool is_function_app(const expr & t)
+{
+  if (!t.is_app())
+  {
+    return false;
+  }
+  switch (t.decl().decl_kind())
+  {
+    case Z3_OP_UNINTERPRETED: return !t.is_const();
+    case Z3_OP_DT_CONSTRUCTOR:
+    case Z3_OP_DT_ACCESSOR:
+    case Z3_OP_DT_IS: return true;
+    default: return false;
+  }
+}
+
+}  // namespace
+
 // Z3TermIter implementation
 
 Z3TermIter & Z3TermIter::operator=(const Z3TermIter & it)
@@ -17,6 +42,7 @@ Z3TermIter & Z3TermIter::operator=(const Z3TermIter & it)
   term = it.term;
   pos = it.pos;
   null_term = it.null_term;
+  table = it.table;
   return *this;
 }
 
@@ -25,24 +51,21 @@ void Z3TermIter::operator++() { pos++; }
 const Term Z3TermIter::operator*()
 {
   assert(!null_term);
-  bool is_function_app = term.is_app()
-                         && (term.decl().decl_kind() == Z3_OP_UNINTERPRETED)
-                         && !term.is_const();
-  if (!pos && is_function_app)
+  bool function_app = is_function_app(term);
+  if (!pos && function_app)
   {
-    return std::make_shared<Z3Term>(term.decl(), term.ctx());
+    return Z3Term::wrap(table, term.decl());
   }
   else
   {
-    uint32_t actual_idx = is_function_app ? pos - 1 : pos;
-    expr z_child = term.arg(actual_idx);
-    return std::make_shared<Z3Term>(z_child, z_child.ctx());
+    uint32_t actual_idx = function_app ? pos - 1 : pos;
+    return Z3Term::wrap(table, term.arg(actual_idx));
   }
 }
 
 TermIterBase * Z3TermIter::clone() const
 {
-  return new Z3TermIter(term, pos, null_term);
+  return new Z3TermIter(term, pos, null_term, table);
 }
 
 bool Z3TermIter::operator==(const Z3TermIter & it)
@@ -76,6 +99,33 @@ bool Z3TermIter::equal(const TermIterBase & other) const
 
 // Z3Term implementation
 
+Term Z3Term::wrap(TermInternTable * table, const expr & e)
+{
+  if (!table)
+  {
+    return std::make_shared<Z3Term>(e, e.ctx());
+  }
+  // AST ids are unique among the live ASTs of a context
+  return table->intern(e.id(), [table, &e]() {
+    shared_ptr<Z3Term> res = std::make_shared<Z3Term>(e, e.ctx());
+    res->intern_table = table;
+    return res;
+  });
+}
+
+Term Z3Term::wrap(TermInternTable * table, const func_decl & f)
+{
+  if (!table)
+  {
+    return std::make_shared<Z3Term>(f, f.ctx());
+  }
+  return table->intern(f.id(), [table, &f]() {
+    shared_ptr<Z3Term> res = std::make_shared<Z3Term>(f, f.ctx());
+    res->intern_table = table;
+    return res;
+  });
+}
+
 size_t Z3Term::hash() const
 {
   if (!is_function)
@@ -116,7 +166,23 @@ bool Z3Term::compare(const Term & absterm) const
 
 Op Z3Term::get_op() const
 {
-  if (is_function || term.is_const())
+  if (is_function)
+  {
+    return Op();
+  }
+  else if (term.is_app())
+  {
+    // checked before is_const for nullary constructors
+    switch (term.decl().decl_kind())
+    {
+      case Z3_OP_DT_CONSTRUCTOR: return Op(Apply_Constructor);
+      case Z3_OP_DT_ACCESSOR: return Op(Apply_Selector);
+      case Z3_OP_DT_IS: return Op(Apply_Tester);
+      default: break;
+    }
+  }
+
+  if (term.is_const())
   {
     return Op();
   }
@@ -249,6 +315,14 @@ Sort Z3Term::get_sort() const
     return std::make_shared<Z3Sort>(term.get_sort(), *ctx);
   }
 
+  Z3_decl_kind kind = z_func.decl_kind();
+  if (kind == Z3_OP_DT_CONSTRUCTOR || kind == Z3_OP_DT_ACCESSOR
+      || kind == Z3_OP_DT_IS)
+  {
+    // can't be rebuilt with ctx->function
+    return std::make_shared<Z3Sort>(z_func, *ctx);
+  }
+
   z3::sort_vector domain(*ctx);
   for (int i = 0; i < z_func.arity(); i++)
   {
@@ -292,7 +366,22 @@ bool Z3Term::is_value() const
     func_decl decl = term.decl();
     Z3_decl_kind kind = decl.decl_kind();
     // constant arrays are considered values
-    return (kind == Z3_OP_CONST_ARRAY);
+    if (kind == Z3_OP_CONST_ARRAY)
+    {
+      return true;
+    }
+    // and so are constructors applied to values
+    if (kind == Z3_OP_DT_CONSTRUCTOR)
+    {
+      for (unsigned i = 0; i < term.num_args(); ++i)
+      {
+        if (!Z3Term(term.arg(i), *ctx).is_value())
+        {
+          return false;
+        }
+      }
+      return true;
+    }
   }
   return false;
 }
@@ -349,6 +438,28 @@ uint64_t Z3Term::to_int() const
   }
 }
 
+void Z3Term::to_bv_words(std::vector<uint64_t> & out)
+{
+  if (is_function || !term.is_bv() || !term.is_numeral())
+  {
+    throw IncorrectUsageException(
+        "Can only convert bit-vector values to words, got "
+        + term.to_string());
+  }
+  uint64_t width = term.get_sort().bv_size();
+  if (width <= 64)
+  {
+    uint64_t w;
+    Z3_get_numeral_uint64(*ctx, term, &w);
+    out.assign(1, w);
+    return;
+  }
+  // the decimal string is much cheaper for z3 to produce than the
+  // binary one, which is built bit by bit
+  Z3_string digits = Z3_get_numeral_string(*ctx, term);
+  decimal_to_words(digits, strlen(digits), width, out);
+}
+
 TermIter Z3Term::begin()
 {
   if (is_function)
@@ -367,7 +478,7 @@ TermIter Z3Term::begin()
         + "support getting parameters from quantified "
         + "expression. Use logging if required.");
   }
-  return TermIter(new Z3TermIter(term, 0));
+  return TermIter(new Z3TermIter(term, 0, false, intern_table));
 }
 
 TermIter Z3Term::end()
@@ -379,11 +490,8 @@ TermIter Z3Term::end()
     return TermIter(new Z3TermIter(term, 0, true));
   }
 
-  bool is_function_app = term.is_app()
-                         && (term.decl().decl_kind() == Z3_OP_UNINTERPRETED)
-                         && !term.is_const();
   uint32_t num_args = term.num_args();
-  if (is_function_app)
+  if (is_function_app(term))
   {
     // smt-switch treats the function as an argument
     num_args++;